@@ -1,7 +1,9 @@
 /*------------------------------STANDARD LIBRARIES------------------------------*/
 
 #include <math.h>
+#include <stddef.h>
 #include <stdint.h>
+#include <stdio.h>
 
 /*------------------------------DRIVERLIB------------------------------*/
 
@@ -9,6 +11,7 @@
 #include "gpio.h"
 #include "dac.h"
 #include "adc.h"
+#include "dma.h"
 #include "epwm.h"
 #include "device.h"
 #include "inc/hw_types.h"
@@ -19,122 +22,537 @@
 #include "inc/hw_ints.h" // Interrupt registers
 #include "machine/_types.h"
 #include "pin_map.h"
+#include "sci.h"
 #include "sysctl.h"
 
-/*------------------------------GLOBAL VARIABLES AND MACROS------------------------------*/
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "adcDMA.h"
+#include "control.h"
+#include "dds.h"
+#include "isrProfiler.h"
+#include "parameters.h"
+#include "powerQuality.h"
+#include "pwmUpdate.h"
+#include "report.h"
+#include "ringBuffer.h"
+#include "scheduler.h"
+#include "scope.h"
+#include "spectrum.h"
+#include "telemetry.h"
 
-#define TWO_PI (2.0 * M_PI)
+/*------------------------------GLOBAL VARIABLES AND MACROS------------------------------*/
 
-#define TIMER0_FREQ 10000.0 // 10 kHz, period 100 us
-#define TIMER0_PRD 0.000100
+#define TIMER0_FREQ 10000.0f // 10 kHz, period 100 us
 
 #define HALF_DEVICE_SYSCLK_FREQ (DEVICE_SYSCLK_FREQ / 2)
 
+#define TIMER0_PERIOD ((uint32_t)DEVICE_SYSCLK_FREQ / (uint32_t)TIMER0_FREQ - 1UL) // Interrupts every PRD + 1 SYSCLK ticks
+
+// ADCA acquisition: 1 moves samples with the DMA in blocks, 0 takes one ADCA1 interrupt per sample
+#ifndef ADCA_DMA_MODE
+#define ADCA_DMA_MODE 1
+#endif
+
+// EPWM1 duty cycle: 0 open loop (dutyCyclePWM1 from the host), 1 PI on referenceADCA, 2 PR tracking the DACA sine
+#ifndef CONTROL_MODE
+#define CONTROL_MODE 1
+#endif
+
+// ISR profiling on the free-running CPU timer 1, expected periods in SYSCLK ticks
+PROF_Profile profileTimer0;
+#if ADCA_DMA_MODE
+PROF_Profile profileDMACH1;
+#else
+PROF_Profile profileADCA1;
+#endif
+PROF_Profile profileDMACH2;
+volatile uint16_t dumpProfiles; // Set from the debugger to print the report on the CCS console
+
+// Timer 0 tick: per-sample path in the ISR, slower work released to the main loop
+#define ACQUISITION_TASK_FREQ 1000.0f
+#define CONTROL_TASK_FREQ 100.0f
+#define MONITOR_TASK_FREQ 10.0f
+#define COMMAND_TASK_FREQ 100.0f
+#define SPECTRUM_TASK_FREQ 1000.0f // One transform step per run, lowest priority
+#define UTILISATION_WINDOW 10000U // Ticks, 1 s
+
+SCHED_Scheduler scheduler;
+
 // ADCA buffer
 #define BUFFER_LENGTH 167 // From the formula: (TIMER0 frequency / DACA frequency)
 
-uint16_t bufferADCA_SOC0[BUFFER_LENGTH];
+// ADCA power-quality analytics over one 60 Hz period, snapshot refreshed by the background loop
+#define NOMINAL_FREQUENCY 60.0f
+#define CROSSING_HYSTERESIS 20U // Digital levels
 
-// DACA parameters
-double amplitudeDACA = 4095.0; // Digital level
-double offsetDACA = 2048.0; // Shift wave X levels upward
-double frequencyDACA = 60.0; // Sine wave frequency in Hz
+PQ_Analyzer analyzerADCA;
+PQ_Snapshot powerQualityADCA;
 
-// PWM1 parameters
-// Parameter history
-EPWM_TimeBaseCountMode lastCountModePWM1;
-uint16_t lastFrequencyPWM1;
-float lastDutyCyclePWM1;
+// ADCA spectrum: Hann-windowed 1024-point transforms (9.77 Hz bins) overlapping by half, 8 per average (0.46 s)
+#define SPECTRUM_POINTS 1024U
+#define SPECTRUM_AVERAGES 8U
 
-// Current parameters
-EPWM_TimeBaseCountMode countModePWM1 = EPWM_COUNTER_MODE_UP_DOWN;
-uint16_t frequencyPWM1 = 1000U;
-float dutyCyclePWM1 = 0.80; // Ranges from 0 to 1
+float storageSpectrumADCA[SPEC_STORAGE(SPECTRUM_POINTS)];
+uint16_t historySpectrumADCA[SPEC_HISTORY(SPECTRUM_POINTS)];
+SPEC_Analyzer spectrumADCA;
 
-/*------------------------------EPWM FUNCTIONS------------------------------*/
+// EPWM1 switching spectrum: ADCINB3 (jumpered to the EPWM1A pin) converted at every EPWM2 SOCA, ten samples per
+// period of the default 20 kHz carrier, so the carrier and its harmonics up to the fourth sit below Nyquist
+#define SWITCHING_FREQ 200000.0f // 195 Hz bins with SPECTRUM_POINTS
+#define SWITCHING_PERIOD ((uint32_t)HALF_DEVICE_SYSCLK_FREQ / (uint32_t)SWITCHING_FREQ - 1UL) // EPWM2 TBPRD, up count
+#define SWITCHING_BLOCK_LENGTH 256U // Samples per DMA block, 1.28 ms
+#define CARRIER_CHECK_SPECTRA 4U // Switching spectra published before the carrier is looked for
 
-void setPWMFrequency(uint32_t base, EPWM_TimeBaseCountMode counterMode, uint16_t frequency) {
-    // Frequency MUST BE positive
-    if (frequency <= 0) {
-        frequency = 1U;
-    }
-    uint16_t timeBasePeriod;
-    // Symmetric PWM waveform
-    if (counterMode == EPWM_COUNTER_MODE_UP_DOWN) {
-        timeBasePeriod = HALF_DEVICE_SYSCLK_FREQ / (2 * frequency);
-    // Asymmetric PWM waveform
-    } else {
-        timeBasePeriod = HALF_DEVICE_SYSCLK_FREQ / frequency - 1;
-    }
-    EPWM_setTimeBaseCounterMode(base, counterMode);
-    EPWM_setTimeBasePeriod(base, timeBasePeriod);
-    EPWM_setTimeBaseCounter(base, 0U);
+float storageSpectrumPWM1[SPEC_STORAGE(SPECTRUM_POINTS)];
+uint16_t historySpectrumPWM1[SPEC_HISTORY(SPECTRUM_POINTS)];
+SPEC_Analyzer spectrumPWM1;
+#pragma DATA_SECTION(blocksADCB_SOC0, "ramgs0")
+uint16_t blocksADCB_SOC0[2 * SWITCHING_BLOCK_LENGTH];
+ADCDMA_PingPong acquisitionADCB;
+
+// SCIA telemetry (GPIO 42 and 43, the LaunchPad's USB virtual COM port)
+#define TELEMETRY_BAUD 230400UL
+#define TELEMETRY_TX_LEVEL SCI_FIFO_TX4
+#define TELEMETRY_QUEUE_LENGTH 2048U // Power of two, several capture frames
+// Refill interval while streaming: FIFO drained from 16 to the level, 10 bits per character
+#define TELEMETRY_TX_PERIOD ((uint32_t)(DEVICE_SYSCLK_FREQ / TELEMETRY_BAUD) * 10UL * (16UL - TELEMETRY_TX_LEVEL))
+#define TELEMETRY_CHANNEL_ADCA 0U
+#define TELEMETRY_CHANNEL_SCOPE 1U
+
+uint16_t queueTelemetry[TELEMETRY_QUEUE_LENGTH];
+TLM_Streamer telemetry;
+// Host commands on the same port, one reply frame each
+#define COMMAND_QUEUE_LENGTH 256U // Power of two, several command frames
+uint16_t queueCommands[COMMAND_QUEUE_LENGTH];
+TLM_Receiver commands;
+uint16_t replyCommand[PARAM_MAX_REPLY];
+PROF_Profile profileSCIATX;
+uint32_t lastWindowTelemetry; // Last analytics window sent
+
+#if ADCA_DMA_MODE
+// Ping-pong blocks of BUFFER_LENGTH samples, the DMA only reaches global shared RAM
+#pragma DATA_SECTION(blocksADCA_SOC0, "ramgs0")
+uint16_t blocksADCA_SOC0[2 * BUFFER_LENGTH];
+ADCDMA_PingPong acquisitionADCA;
+const uint16_t *volatile latestBlockADCA; // Last full block, stable for one block time
+#else
+// ADCA1_ISR to background handoff, about three blocks deep
+#define RING_LENGTH 512U // Power of two
+uint16_t storageADCA_SOC0[RING_LENGTH];
+RING_Buffer ringADCA_SOC0;
+uint16_t captureADCA[BUFFER_LENGTH]; // Ring spans gathered into whole telemetry captures
+uint16_t captureLengthADCA;
+#endif
+
+// ADCA scope: every sample through the trigger, frozen frames sent to the host from the background
+#define SCOPE_LENGTH 128U // Points, min/max pairs fill a whole telemetry capture
+
+uint16_t storageScopeADCA[SCOPE_STORAGE(SCOPE_LENGTH)];
+SCOPE_Scope scopeADCA;
+
+// Current settings (may be changed from the debugger), applied when armScopeADCA is set:
+// rising edge through mid-scale, a quarter of the frame before it, 8 samples per point (102 ms per frame)
+SCOPE_Settings settingsScopeADCA = {SCOPE_NORMAL, SCOPE_RISING, 2048U, 20U, 1024U, 3072U, 32U, 8U, true, 256U};
+volatile uint16_t armScopeADCA = 1U;
+
+// DACA and PWM1 parameters, set and committed by the host over SCIA (tools/parameterClient.py)
+typedef struct {
+    float frequencyDACA; // Sine wave frequency in Hz
+    uint16_t amplitudeDACA; // Digital level
+    uint16_t offsetDACA; // Shift wave X levels upward
+    uint16_t frequencyPWM1; // Carrier; up-down at 20 kHz loads the compares at the control rate
+    float dutyCyclePWM1; // Ranges from 0 to 1, open loop and before the first control step
+    uint16_t countModePWM1; // EPWM_TimeBaseCountMode: 0 up, 1 down, 2 up-down
+    // Prepared in the background before each commit, all the ISR uses
+    uint32_t phaseIncrementDACA;
+    PWMUPDATE_Registers registersPWM1;
+} Settings;
+
+const PARAM_Descriptor descriptorsSettings[] = {
+    {"frequencyDACA", "Hz", PARAM_TYPE_FLOAT, offsetof(Settings, frequencyDACA), 0.0f, 0.5f * TIMER0_FREQ},
+    {"amplitudeDACA", "codes", PARAM_TYPE_UINT16, offsetof(Settings, amplitudeDACA), 0.0f, 4095.0f},
+    {"offsetDACA", "codes", PARAM_TYPE_UINT16, offsetof(Settings, offsetDACA), 0.0f, 4095.0f},
+    {"frequencyPWM1", "Hz", PARAM_TYPE_UINT16, offsetof(Settings, frequencyPWM1), 1000.0f, 50000.0f},
+#if !CONTROL_MODE
+    // Closed loop, controlStep owns the compares: a committed duty would never take effect, so it is not offered
+    {"dutyCyclePWM1", "p.u.", PARAM_TYPE_FLOAT, offsetof(Settings, dutyCyclePWM1), 0.0f, 1.0f},
+#endif
+    {"countModePWM1", "mode", PARAM_TYPE_UINT16, offsetof(Settings, countModePWM1),
+     (float)EPWM_COUNTER_MODE_UP, (float)EPWM_COUNTER_MODE_UP_DOWN}
+};
+
+// Staging copy (the defaults until the first command) and the two committed images
+Settings copiesSettings[PARAM_COPIES] = {
+    {60.0f, 4095U, 2048U, 20000U, 0.80f, EPWM_COUNTER_MODE_UP_DOWN}
+};
+PARAM_Registry registrySettings;
+
+// DACA sine generator, stepped at TIMER0_FREQ
+DDS_Generator generatorDACA;
+
+// Register images computed in the background, written by timer0_ISR
+PWMUPDATE_Channel updatePWM1;
+
+// Closed loop from ADCIN14 to the EPWM1 duty cycle: timer 2 starts ADCA SOC1 and its end of conversion
+// (ADCA interrupt 2) runs the controller on the sample just converted. CONTROL_MODE is set at the top.
+// Step test of the PI at start-up, otherwise set from the debugger
+#ifndef STEP_TEST_ADCA
+#define STEP_TEST_ADCA 0
+#endif
+
+#define CONTROL_FREQ 40000.0f // 40 kHz, twice per period of the 20 kHz up-down carrier
+#define CONTROL_PERIOD ((uint32_t)DEVICE_SYSCLK_FREQ / (uint32_t)CONTROL_FREQ - 1UL) // Timer 2 PRD
+
+#define DUTY_MINIMUM 0 // Controller output limits, Q15 duty
+#define DUTY_MAXIMUM 32767
+// PI zero on the 1 ms RC pole, crossover about 300 Hz
+#define PI_KP 2.0f
+#define PI_KI 2000.0f // 1/s
+// PR on the DACA frequency, reference fed forward
+#define PR_KP 1.0f
+#define PR_KR 20.0f
+#define PR_CUTOFF 5.0f // Hz
+#define PR_LIMIT 16384 // Resonant output clamp, Q15
+#define STEP_TEST_RUNS 50U // Control task runs per half period of the step test, 0.5 s
+// Step test limits, met against the RC (tau 1 ms) and LC (1 kHz, zeta 0.6) plants of the host simulation.
+// The start-up step is skipped, the next STEP_TEST_CHECKS give one verdict
+#define STEP_TEST_CHECKS 4U
+#define STEP_MAX_RISE 2e-3f // s, 10-90 %
+#define STEP_MAX_OVERSHOOT 10.0f // %
+#define STEP_MAX_SETTLING 10e-3f // s, 2 %
+
+#if CONTROL_MODE
+PROF_Profile profileControl; // Cycles per control iteration
+#endif
+#if CONTROL_MODE == 1
+CTRL_PI loopPI;
+CTRL_StepMonitor stepADCA;
+volatile uint16_t referenceADCA = 2048U; // Set-point in ADC codes
+volatile uint16_t stepTestADCA = STEP_TEST_ADCA; // Reference square wave between referenceADCA and half of it, 0 holds referenceADCA
+volatile uint16_t activeReferenceADCA; // Set-point used by the ISR
+#if STEP_TEST_ADCA
+uint16_t stepChecksADCA; // Steps held to the limits so far
+uint16_t stepFailuresADCA;
+#endif
+#elif CONTROL_MODE == 2
+CTRL_PR loopPR;
+volatile uint16_t referenceDACA; // Latest DACA sample, held between timer 0 ticks
+#endif
+
+/*------------------------------SETTINGS FUNCTIONS------------------------------*/
+
+// Background, before each commit: DDS tuning word and PWM1 register image of the new values
+void prepareSettings(void *image, void *context) {
+    Settings *settings = (Settings *)image;
+    settings->phaseIncrementDACA = DDS_computePhaseIncrement((float)TIMER0_FREQ, settings->frequencyDACA);
+    const uint16_t duty = PWMUPDATE_dutyToQ15(settings->dutyCyclePWM1);
+    PWMUPDATE_compute(&settings->registersPWM1, (EPWM_TimeBaseCountMode)settings->countModePWM1,
+                      HALF_DEVICE_SYSCLK_FREQ, settings->frequencyPWM1, duty, duty);
+}
+
+// ISR, at the sample a commit is taken: plain copies, every value already checked and prepared
+void applySettings(const Settings *settings) {
+    DDS_setPhaseIncrement(&generatorDACA, settings->phaseIncrementDACA);
+    DDS_setAmplitude(&generatorDACA, settings->amplitudeDACA);
+    DDS_setOffset(&generatorDACA, settings->offsetDACA);
+    // The ISR is the only publisher, PWMUPDATE_apply loads the image right after
+    PWMUPDATE_publish(&updatePWM1, &settings->registersPWM1);
 }
 
-void setPWMDutyCycle(uint32_t base, EPWM_TimeBaseCountMode counterMode, EPWM_CounterCompareModule module, float dutyCycle) {
-    // Duty cycle MUST BE between 0 and 1
-    if (dutyCycle < 0.0) {
-        dutyCycle = 0.0;
-    } else if (dutyCycle > 1.0) {
-        dutyCycle = 1.0;
+/*------------------------------ISR------------------------------*/
+
+#if CONTROL_MODE
+// ADCIN14 result just converted by SOC1 to the EPWM1 compares, no float on the way
+void controlStep(void) {
+    const int16_t feedback = CTRL_adcToQ15(ADC_readResult(ADCARESULT_BASE, ADC_SOC_NUMBER1));
+#if CONTROL_MODE == 1
+    const int16_t reference = CTRL_adcToQ15(activeReferenceADCA);
+    const int16_t duty = CTRL_stepPI(&loopPI, reference - feedback);
+    CTRL_updateStep(&stepADCA, reference, feedback);
+#else
+    // Feed-forward of the reference, the resonant term removes the remaining error at its frequency
+    const int16_t reference = CTRL_adcToQ15(referenceDACA);
+    int32_t duty = (int32_t)reference + CTRL_stepPR(&loopPR, reference - feedback);
+    if (duty > DUTY_MAXIMUM) {
+        duty = DUTY_MAXIMUM;
+    } else if (duty < DUTY_MINIMUM) {
+        duty = DUTY_MINIMUM;
     }
-    uint16_t counterCompareValue;
-    float timeBasePeriod = (float)(EPWM_getTimeBasePeriod(base));
-    // Symmetric PWM waveform
-    if (counterMode == EPWM_COUNTER_MODE_UP_DOWN) {
-        counterCompareValue = (uint16_t)(timeBasePeriod * (1.0 - dutyCycle));
-    // Asymmetric PWM waveform
-    } else {
-        counterCompareValue = (uint16_t)((timeBasePeriod + 1.0) * (1.0 - dutyCycle) - 1.0);
+#endif
+    PWMUPDATE_setDuty(&updatePWM1, (uint16_t)duty);
+}
+#endif
+
+// Hard real-time slot of the scheduler, every timer 0 tick
+void samplePath(void *context) {
+    // A commit takes effect as a whole at a sample boundary, never half of it
+    if (PARAM_acquire(&registrySettings)) {
+        applySettings((const Settings *)PARAM_image(&registrySettings));
     }
-    EPWM_setCounterCompareValue(base, module, counterCompareValue);
+    // Write to DACA, phase accumulator advanced by the generator
+    const uint16_t sampleDACA = DDS_step(&generatorDACA);
+    DAC_setShadowValue(DACA_BASE, sampleDACA);
+    // Load PWM1 registers when the background has published new ones
+    PWMUPDATE_apply(&updatePWM1);
+#if CONTROL_MODE == 2
+    referenceDACA = sampleDACA;
+#endif
 }
 
-/*------------------------------ISR------------------------------*/
+#if CONTROL_MODE
+// ADCA SOC1 converted, CONTROL_FREQ: no older than the conversion time when the duty is written
+interrupt void ADCA2_ISR() {
+    PROF_enter(&profileControl);
+    controlStep();
+    PROF_exit(&profileControl);
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP10);
+    ADC_clearInterruptStatus(ADCA_BASE, ADC_INT_NUMBER2);
+}
+#endif
 
 interrupt void timer0_ISR() {
-    // Timer 0 frequency check
-    GPIO_togglePin(122U);
-    // Time elapsed since sine wave began
-    static double timeElapsed;
-    timeElapsed += TIMER0_PRD;
-    // Write to DACA
-    uint16_t outputDACA = (uint16_t)(sin(TWO_PI * frequencyDACA * timeElapsed) * amplitudeDACA * 0.5 + offsetDACA);
-    DAC_setShadowValue(DACA_BASE, outputDACA);
-    // Update PWM1 when a parameter has changed
-    if (countModePWM1 != lastCountModePWM1 || frequencyPWM1 != lastFrequencyPWM1 || dutyCyclePWM1 != lastDutyCyclePWM1) {
-        setPWMFrequency(EPWM1_BASE, EPWM_COUNTER_MODE_UP_DOWN, frequencyPWM1);
-        setPWMDutyCycle(EPWM1_BASE, EPWM_COUNTER_MODE_UP_DOWN, EPWM_COUNTER_COMPARE_A, dutyCyclePWM1);
-        setPWMDutyCycle(EPWM1_BASE, EPWM_COUNTER_MODE_UP_DOWN, EPWM_COUNTER_COMPARE_B, dutyCyclePWM1);
-        // Update parameter history
-        lastCountModePWM1 = countModePWM1;
-        lastFrequencyPWM1 = frequencyPWM1;
-        lastDutyCyclePWM1 = dutyCyclePWM1;
-    }
+    PROF_enter(&profileTimer0);
+    SCHED_tick(&scheduler);
+    PROF_exit(&profileTimer0);
     Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP1);
 }
 
+// SCIA TX FIFO at or below TELEMETRY_TX_LEVEL: next bytes of the queued frames
+interrupt void SCIA_TX_ISR() {
+    PROF_enter(&profileSCIATX);
+    TLM_handleTxInterrupt(&telemetry);
+    PROF_exit(&profileSCIATX);
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP9);
+}
+
+// SCIA RX FIFO holds a byte: host commands to the background
+interrupt void SCIA_RX_ISR() {
+    TLM_handleRxInterrupt(&commands);
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP9);
+}
+
+#if ADCA_DMA_MODE
+// Block-ready callback, runs inside DMACH1_ISR
+void onBlockADCA(const uint16_t *block, uint16_t length, void *context) {
+    latestBlockADCA = block;
+    uint16_t sample;
+    for (sample = 0; sample < length; sample ++) {
+        SCOPE_update(&scopeADCA, block[sample]);
+    }
+}
+
+// One interrupt per BUFFER_LENGTH samples, at the start of each DMA transfer
+interrupt void DMACH1_ISR() {
+    PROF_enter(&profileDMACH1);
+    ADCDMA_handleInterrupt(&acquisitionADCA);
+    PROF_exit(&profileDMACH1);
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP7);
+}
+#else
 interrupt void ADCA1_ISR() {
-    // Buffer to store SOC0 read result history
-    static uint16_t bufferIndex_SOC0;
-    bufferIndex_SOC0 ++;
-    if (bufferIndex_SOC0 >= BUFFER_LENGTH) {
-        bufferIndex_SOC0 = 0;
-    }
-    // Read result saved in the buffer
-    const uint16_t resultADCA_SOC0 = ADC_readResult(ADCARESULT_BASE, ADC_SOC_NUMBER0);
-    bufferADCA_SOC0[bufferIndex_SOC0] = resultADCA_SOC0;
+    PROF_enter(&profileADCA1);
+    // Read result handed to the background, counted as an overrun if the ring is full
+    const uint16_t sample = ADC_readResult(ADCARESULT_BASE, ADC_SOC_NUMBER0);
+    RING_push(&ringADCA_SOC0, sample);
+    SCOPE_update(&scopeADCA, sample);
+    PROF_exit(&profileADCA1);
     Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP1);
     ADC_clearInterruptStatus(ADCA_BASE, ADC_INT_NUMBER1);
 }
+#endif
+
+// Block-ready callback, runs inside DMACH2_ISR: the producer side of the switching spectrum
+void onBlockADCB(const uint16_t *block, uint16_t length, void *context) {
+    SPEC_push(&spectrumPWM1, block, length);
+}
+
+// One interrupt per SWITCHING_BLOCK_LENGTH samples of ADCINB3
+interrupt void DMACH2_ISR() {
+    PROF_enter(&profileDMACH2);
+    ADCDMA_handleInterrupt(&acquisitionADCB);
+    PROF_exit(&profileDMACH2);
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP7);
+}
+
+/*------------------------------BACKGROUND------------------------------*/
+
+// Scheduler clock, the profiler time base
+uint32_t readTimebase(void) {
+    return PROF_now();
+}
+
+// Profiler report line, CIO console of the debugger
+void printProfileLine(const char *line, void *context) {
+    printf("%s\n", line);
+}
+
+// Runs in the main loop on up to BUFFER_LENGTH samples, must keep up with the acquisition
+void processBlockADCA(const uint16_t *block, uint16_t length) {
+    uint16_t sample;
+    for (sample = 0; sample < length; sample ++) {
+        PQ_update(&analyzerADCA, block[sample]);
+    }
+    SPEC_push(&spectrumADCA, block, length);
+    // Raw samples to the host, dropped whole when the line cannot keep up
+#if ADCA_DMA_MODE
+    TLM_sendCapture(&telemetry, TELEMETRY_CHANNEL_ADCA, block, length);
+#else
+    // Ring spans are short, a frame per span would be mostly header
+    for (sample = 0; sample < length; sample ++) {
+        captureADCA[captureLengthADCA ++] = block[sample];
+        if (captureLengthADCA == BUFFER_LENGTH) {
+            TLM_sendCapture(&telemetry, TELEMETRY_CHANNEL_ADCA, captureADCA, BUFFER_LENGTH);
+            captureLengthADCA = 0U;
+        }
+    }
+#endif
+}
+
+// 1 kHz: analyse the new ADCA samples
+void acquisitionTask(void *context) {
+#if ADCA_DMA_MODE
+    static uint32_t processedBlocks;
+    if (acquisitionADCA.blockCount != processedBlocks) {
+        processedBlocks = acquisitionADCA.blockCount;
+        processBlockADCA(latestBlockADCA, BUFFER_LENGTH);
+    }
+#else
+    // Analysed in place in the ring, then handed back to ADCA1_ISR
+    const uint16_t *spanADCA;
+    uint16_t lengthADCA = RING_peek(&ringADCA_SOC0, &spanADCA);
+    while (lengthADCA > 0U) {
+        if (lengthADCA > BUFFER_LENGTH) {
+            lengthADCA = BUFFER_LENGTH;
+        }
+        processBlockADCA(spanADCA, lengthADCA);
+        RING_release(&ringADCA_SOC0, lengthADCA);
+        lengthADCA = RING_peek(&ringADCA_SOC0, &spanADCA);
+    }
+#endif
+}
+
+#if CONTROL_MODE == 1 && STEP_TEST_ADCA
+// Background, as the step test moves the reference: the step that ends is held to the limits
+void checkStepADCA(void) {
+    CTRL_StepResult result;
+    if (stepChecksADCA >= STEP_TEST_CHECKS || !CTRL_readStep(&stepADCA, &result) || result.steps < 2U) {
+        return;
+    }
+    const bool within = result.risen && result.settled && result.riseTime <= STEP_MAX_RISE
+                        && result.overshoot <= STEP_MAX_OVERSHOOT && result.settlingTime <= STEP_MAX_SETTLING;
+    stepChecksADCA ++;
+    stepFailuresADCA += within ? 0U : 1U;
+    printf("PI ADCA step %u: overshoot %.1f%% rise %.0f us settling %.0f us%s %s\n", result.steps, result.overshoot,
+           1e6f * result.riseTime, 1e6f * result.settlingTime,
+           !result.risen ? ", 90% not reached" : (!result.settled ? ", not settled" : ""), within ? "ok" : "FAIL");
+    if (stepChecksADCA == STEP_TEST_CHECKS) {
+        const bool passed = REPORT_check(stepFailuresADCA == 0U);
+        printf("PI ADCA step test: %u of %u steps within %.0f%% overshoot, %.0f us rise and %.0f us settling %s\n",
+               STEP_TEST_CHECKS - stepFailuresADCA, STEP_TEST_CHECKS, STEP_MAX_OVERSHOOT, 1e6f * STEP_MAX_RISE,
+               1e6f * STEP_MAX_SETTLING, passed ? "ok" : "FAIL");
+    }
+}
+#endif
+
+// 100 Hz: PWM1 reconfiguration and analytics snapshot
+void controlTask(void *context) {
+#if CONTROL_MODE == 1
+    // Step test: the monitor measures the response to every reference change
+    static uint16_t stepRuns;
+    static uint16_t stepLow;
+    if (stepTestADCA && ++ stepRuns >= STEP_TEST_RUNS) {
+#if STEP_TEST_ADCA
+        checkStepADCA();
+#endif
+        stepRuns = 0U;
+        stepLow ^= 1U;
+    }
+    activeReferenceADCA = (stepTestADCA && stepLow) ? referenceADCA / 2U : referenceADCA;
+#endif
+    // Latest analytics, never torn by a window ending meanwhile
+    PQ_read(&analyzerADCA, &powerQualityADCA);
+    if (powerQualityADCA.window != lastWindowTelemetry) {
+        lastWindowTelemetry = powerQualityADCA.window;
+        TLM_sendSnapshot(&telemetry, &powerQualityADCA);
+    }
+    // Scope: new settings restart the capture; a frozen frame goes out in place, then back to the ISR
+    if (armScopeADCA) {
+        armScopeADCA = 0U;
+        SCOPE_arm(&scopeADCA, &settingsScopeADCA);
+    }
+    const SCOPE_Frame *frameScopeADCA = SCOPE_takeFrame(&scopeADCA);
+    if (frameScopeADCA != 0) {
+        TLM_sendScope(&telemetry, TELEMETRY_CHANNEL_SCOPE, frameScopeADCA);
+        SCOPE_releaseFrame(&scopeADCA);
+    }
+}
+
+// 10 Hz: ISR execution time, jitter, overruns and task deadlines on request
+void monitorTask(void *context) {
+    if (dumpProfiles) {
+        dumpProfiles = 0U;
+        PROF_dump(&printProfileLine, 0);
+        SCHED_dump(&scheduler, &printProfileLine, 0);
+#if CONTROL_MODE == 1
+        CTRL_dumpStep(&stepADCA, &printProfileLine, 0);
+#endif
+        SPEC_dump(&spectrumADCA, &printProfileLine, 0);
+        SPEC_dump(&spectrumPWM1, &printProfileLine, 0);
+    }
+}
+
+// 100 Hz: host commands on the settings, answered in the telemetry stream
+void commandTask(void *context) {
+    TLM_Command command;
+    while (TLM_receive(&commands, &command)) {
+        const uint16_t length = PARAM_handleCommand(&registrySettings, command.type, command.sequence, command.payload,
+                                                    command.length, replyCommand);
+        // Dropped with a full queue: the host asks again when the reply does not come
+        TLM_sendReply(&telemetry, replyCommand, length);
+    }
+}
+
+// EPWM1 carrier of the register image in use, Hz
+float carrierPWM1(void) {
+    const float clock = (float)HALF_DEVICE_SYSCLK_FREQ / (float)(1U << updatePWM1.appliedDivider);
+    const float counts = updatePWM1.appliedMode == EPWM_COUNTER_MODE_UP_DOWN ? 2.0f * updatePWM1.appliedPeriod
+                                                                              : updatePWM1.appliedPeriod + 1.0f;
+    return clock / counts;
+}
+
+// Background, once: the strongest tone of the switching spectrum must be the EPWM1 carrier, within a bin
+void checkCarrierPWM1(void) {
+    SPEC_Peak peaks[SPEC_MAX_PEAKS];
+    const float carrier = carrierPWM1();
+    const uint16_t count = SPEC_findPeaks(&spectrumPWM1, peaks, SPEC_MAX_PEAKS);
+    const bool passed = REPORT_check(count > 0U && fabsf(peaks[0].frequency - carrier) <= SPEC_binFrequency(&spectrumPWM1, 1U));
+    if (count == 0U) {
+        printf("EPWM1 carrier %.0f Hz: no tone in the switching spectrum FAIL\n", carrier);
+        return;
+    }
+    printf("EPWM1 carrier %.0f Hz: strongest switching tone %.0f Hz at %.1f dBFS %s\n", carrier, peaks[0].frequency,
+           peaks[0].level, passed ? "ok" : "FAIL");
+}
+
+// 1 kHz, last: one step of each spectrum, segments are dropped rather than delaying the other tasks
+void spectrumTask(void *context) {
+    SPEC_process(&spectrumADCA);
+    if (SPEC_process(&spectrumPWM1) && spectrumPWM1.spectra == CARRIER_CHECK_SPECTRA) {
+        checkCarrierPWM1();
+    }
+}
 
 /*------------------------------SETUP------------------------------*/
 
+// Settings registry, first: the other modules start from its default image
+void configureSettings() {
+    PARAM_init(&registrySettings, descriptorsSettings, sizeof(descriptorsSettings) / sizeof(descriptorsSettings[0]),
+               copiesSettings, sizeof(Settings), &prepareSettings, 0);
+}
+
 // GPIO and peripherals configuration
 void configureGPIO() {
-    // GPIO 122 (pin 17) as output
-    GPIO_setPadConfig(122U, GPIO_PIN_TYPE_STD);
-    GPIO_setDirectionMode(122U, GPIO_DIR_MODE_OUT);
     // GPIO 0 (pin 40) as EPWM1A output
     GPIO_setPinConfig(GPIO_0_EPWM1A);
     GPIO_setPadConfig(0U, GPIO_PIN_TYPE_STD);
@@ -143,6 +561,13 @@ void configureGPIO() {
     GPIO_setPinConfig(GPIO_1_EPWM1B);
     GPIO_setPadConfig(1U, GPIO_PIN_TYPE_STD);
     GPIO_setDirectionMode(1U, GPIO_DIR_MODE_OUT);
+    // GPIO 42 and 43 as SCIA TX and RX (USB virtual COM port)
+    GPIO_setPinConfig(GPIO_42_SCITXDA);
+    GPIO_setPadConfig(42U, GPIO_PIN_TYPE_STD);
+    GPIO_setDirectionMode(42U, GPIO_DIR_MODE_OUT);
+    GPIO_setPinConfig(GPIO_43_SCIRXDA);
+    GPIO_setPadConfig(43U, GPIO_PIN_TYPE_PULLUP);
+    GPIO_setDirectionMode(43U, GPIO_DIR_MODE_IN);
 }
 
 // DACA (pin AA0) configuration
@@ -154,6 +579,12 @@ void configureDACA() {
     DAC_setShadowValue(DACA_BASE, 800U);
     // Initialisation delay
     DEVICE_DELAY_US(300);
+    // Sine generator parameters from the default settings (changed later by applySettings)
+    const Settings *settings = (const Settings *)PARAM_image(&registrySettings);
+    DDS_init(&generatorDACA, (float)TIMER0_FREQ);
+    DDS_setPhaseIncrement(&generatorDACA, settings->phaseIncrementDACA);
+    DDS_setAmplitude(&generatorDACA, settings->amplitudeDACA);
+    DDS_setOffset(&generatorDACA, settings->offsetDACA);
 }
 
 // EPWM configuration on GPIO 0 and 1 (pins 40 and 39)
@@ -162,10 +593,9 @@ void configureEPWM1() {
     // EPWM clock frequency is HALF_DEVICE_SYSCLK_FREQ by default (100 MHz)
     EPWM_setClockPrescaler(EPWM1_BASE, EPWM_CLOCK_DIVIDER_1, EPWM_HSCLOCK_DIVIDER_1);
     EPWM_setPeriodLoadMode(EPWM1_BASE, EPWM_PERIOD_SHADOW_LOAD);
-    // Frequency and duty cycle first loaded
-    setPWMFrequency(EPWM1_BASE, EPWM_COUNTER_MODE_UP_DOWN, frequencyPWM1);
-    setPWMDutyCycle(EPWM1_BASE, EPWM_COUNTER_MODE_UP_DOWN, EPWM_COUNTER_COMPARE_A, dutyCyclePWM1);
-    setPWMDutyCycle(EPWM1_BASE, EPWM_COUNTER_MODE_UP_DOWN, EPWM_COUNTER_COMPARE_B, dutyCyclePWM1);
+    // Frequency and duty cycle first loaded, from the default settings
+    const Settings *settings = (const Settings *)PARAM_image(&registrySettings);
+    PWMUPDATE_init(&updatePWM1, EPWM1_BASE, &settings->registersPWM1);
     EPWM_setPhaseShift(EPWM1_BASE, 0U);
     // Counter-compare submodule
     // New counter-compare value loaded at every zero and TBPRD
@@ -174,11 +604,9 @@ void configureEPWM1() {
     // Action-qualifier submodule
     EPWM_setActionQualifierShadowLoadMode(EPWM1_BASE, EPWM_ACTION_QUALIFIER_A, EPWM_AQ_LOAD_ON_CNTR_ZERO_PERIOD);
     EPWM_setActionQualifierShadowLoadMode(EPWM1_BASE, EPWM_ACTION_QUALIFIER_B, EPWM_AQ_LOAD_ON_CNTR_ZERO_PERIOD);
-    EPWM_setActionQualifierAction(EPWM1_BASE, EPWM_AQ_OUTPUT_A, EPWM_AQ_OUTPUT_HIGH, EPWM_AQ_OUTPUT_ON_TIMEBASE_UP_CMPA);
-    EPWM_setActionQualifierAction(EPWM1_BASE, EPWM_AQ_OUTPUT_A, EPWM_AQ_OUTPUT_LOW, EPWM_AQ_OUTPUT_ON_TIMEBASE_DOWN_CMPA);
-    // EPWM1-B as a complement to A (inverse actions)
-    EPWM_setActionQualifierAction(EPWM1_BASE, EPWM_AQ_OUTPUT_B, EPWM_AQ_OUTPUT_HIGH, EPWM_AQ_OUTPUT_ON_TIMEBASE_DOWN_CMPA);
-    EPWM_setActionQualifierAction(EPWM1_BASE, EPWM_AQ_OUTPUT_B, EPWM_AQ_OUTPUT_LOW, EPWM_AQ_OUTPUT_ON_TIMEBASE_UP_CMPA);
+    // Mode, prescaler, period, compares and actions (EPWM1-B as a complement to A) from the first image
+    PWMUPDATE_apply(&updatePWM1);
+    EPWM_setTimeBaseCounter(EPWM1_BASE, 0U);
     // Configuration done, EPWM1 clock enabled
     SysCtl_enablePeripheral(SYSCTL_PERIPH_CLK_EPWM1);
 }
@@ -201,20 +629,126 @@ void configureADCA() {
     // ADCA interrupt 1 enabled and linked to SOC0
     ADC_setInterruptSource(ADCA_BASE, ADC_INT_NUMBER1, ADC_SOC_NUMBER0);
     ADC_enableInterrupt(ADCA_BASE, ADC_INT_NUMBER1);
+#if !ADCA_DMA_MODE
+    RING_init(&ringADCA_SOC0, storageADCA_SOC0, RING_LENGTH);
     Interrupt_register(INT_ADCA1, &ADCA1_ISR);
     Interrupt_enable(INT_ADCA1);
+#endif
+#if CONTROL_MODE
+    // SOC1 on the same channel, started by timer 2; its end of conversion runs the controller
+    ADC_setupSOC(ADCA_BASE, ADC_SOC_NUMBER1, ADC_TRIGGER_CPU1_TINT2, ADC_CH_ADCIN14, 20U);
+    ADC_setInterruptSOCTrigger(ADCA_BASE, ADC_SOC_NUMBER1, ADC_INT_SOC_TRIGGER_NONE);
+    ADC_setInterruptSource(ADCA_BASE, ADC_INT_NUMBER2, ADC_SOC_NUMBER1);
+    ADC_enableInterrupt(ADCA_BASE, ADC_INT_NUMBER2);
+    Interrupt_register(INT_ADCA2, &ADCA2_ISR);
+    Interrupt_enable(INT_ADCA2);
+#endif
+    PQ_init(&analyzerADCA, (float)TIMER0_FREQ, NOMINAL_FREQUENCY, BUFFER_LENGTH, CROSSING_HYSTERESIS);
+    SPEC_init(&spectrumADCA, "spectrumADCA", (float)TIMER0_FREQ, SPECTRUM_POINTS, SPEC_WINDOW_HANN, SPECTRUM_AVERAGES,
+              storageSpectrumADCA, historySpectrumADCA);
+    SCOPE_init(&scopeADCA, storageScopeADCA, SCOPE_LENGTH);
     ADC_enableConverter(ADCA_BASE);
     // Initialisation delay
     DEVICE_DELAY_US(1000);
 }
 
+// EPWM2 only paces the switching spectrum: SOCA at every counter zero, no outputs
+void configureEPWM2() {
+    EPWM_setClockPrescaler(EPWM2_BASE, EPWM_CLOCK_DIVIDER_1, EPWM_HSCLOCK_DIVIDER_1);
+    EPWM_setTimeBasePeriod(EPWM2_BASE, SWITCHING_PERIOD);
+    EPWM_setTimeBaseCounter(EPWM2_BASE, 0U);
+    EPWM_setTimeBaseCounterMode(EPWM2_BASE, EPWM_COUNTER_MODE_UP);
+    EPWM_setADCTriggerSource(EPWM2_BASE, EPWM_SOC_A, EPWM_SOC_TBCTR_ZERO);
+    EPWM_setADCTriggerEventPrescale(EPWM2_BASE, EPWM_SOC_A, 1U);
+    EPWM_enableADCTrigger(EPWM2_BASE, EPWM_SOC_A);
+    SysCtl_enablePeripheral(SYSCTL_PERIPH_CLK_EPWM2);
+}
+
+// ADCB configuration on input channel ADCIN3 (pin B3, jumpered to the EPWM1A pin)
+void configureADCB() {
+    SysCtl_resetPeripheral(SYSCTL_PERIPH_RES_ADCB);
+    ADC_disableConverter(ADCB_BASE);
+    ADC_setMode(ADCB_BASE, ADC_RESOLUTION_12BIT, ADC_MODE_SINGLE_ENDED);
+    ADC_setPrescaler(ADCB_BASE, ADC_CLK_DIV_4_0);
+    // SOC0 on ADCIN3, started by EPWM2 SOCA
+    ADC_setSOCPriority(ADCB_BASE, ADC_PRI_ALL_ROUND_ROBIN);
+    ADC_setupSOC(ADCB_BASE, ADC_SOC_NUMBER0, ADC_TRIGGER_EPWM2_SOCA, ADC_CH_ADCIN3, 20U);
+    ADC_setInterruptSOCTrigger(ADCB_BASE, ADC_SOC_NUMBER0, ADC_INT_SOC_TRIGGER_NONE);
+    // ADCB interrupt 1 at the end of SOC0, continuous: it only triggers the DMA
+    ADC_setInterruptPulseMode(ADCB_BASE, ADC_PULSE_END_OF_CONV);
+    ADC_enableContinuousMode(ADCB_BASE, ADC_INT_NUMBER1);
+    ADC_setInterruptSource(ADCB_BASE, ADC_INT_NUMBER1, ADC_SOC_NUMBER0);
+    ADC_enableInterrupt(ADCB_BASE, ADC_INT_NUMBER1);
+    SPEC_init(&spectrumPWM1, "spectrumPWM1", SWITCHING_FREQ, SPECTRUM_POINTS, SPEC_WINDOW_HANN, SPECTRUM_AVERAGES,
+              storageSpectrumPWM1, historySpectrumPWM1);
+    ADC_enableConverter(ADCB_BASE);
+    // Initialisation delay
+    DEVICE_DELAY_US(1000);
+}
+
+// DMA channel 1 moves ADCA SOC0 results and channel 2 ADCB SOC0 results, each triggered by interrupt 1 of its ADC
+// (continuous mode, no flag clearing)
+void configureDMA() {
+    DMA_initController();
+    DMA_setEmulationMode(DMA_EMULATION_FREE_RUN);
+#if ADCA_DMA_MODE
+    ADCDMA_init(&acquisitionADCA, DMA_CH1_BASE, DMA_TRIGGER_ADCA1, (const void *)(uintptr_t)(ADCARESULT_BASE + ADC_O_RESULT0),
+                blocksADCA_SOC0, BUFFER_LENGTH, &onBlockADCA, 0);
+    Interrupt_register(INT_DMA_CH1, &DMACH1_ISR);
+    Interrupt_enable(INT_DMA_CH1);
+    ADCDMA_start(&acquisitionADCA);
+#endif
+    ADCDMA_init(&acquisitionADCB, DMA_CH2_BASE, DMA_TRIGGER_ADCB1, (const void *)(uintptr_t)(ADCBRESULT_BASE + ADC_O_RESULT0),
+                blocksADCB_SOC0, SWITCHING_BLOCK_LENGTH, &onBlockADCB, 0);
+    Interrupt_register(INT_DMA_CH2, &DMACH2_ISR);
+    Interrupt_enable(INT_DMA_CH2);
+    ADCDMA_start(&acquisitionADCB);
+}
+
+// SCIA configuration: 8N1 at TELEMETRY_BAUD, transmit FIFO refilled by SCIA_TX_ISR
+void configureSCIA() {
+    SCI_performSoftwareReset(SCIA_BASE);
+    SCI_setConfig(SCIA_BASE, DEVICE_LSPCLK_FREQ, TELEMETRY_BAUD,
+                  SCI_CONFIG_WLEN_8 | SCI_CONFIG_STOP_ONE | SCI_CONFIG_PAR_NONE);
+    SCI_resetChannels(SCIA_BASE);
+    SCI_enableFIFO(SCIA_BASE);
+    // Every received byte interrupts: commands are short and rare, no byte waits for the FIFO to fill
+    SCI_setFIFOInterruptLevel(SCIA_BASE, TELEMETRY_TX_LEVEL, SCI_FIFO_RX1);
+    SCI_enableModule(SCIA_BASE);
+    SCI_performSoftwareReset(SCIA_BASE);
+    TLM_init(&telemetry, SCIA_BASE, queueTelemetry, TELEMETRY_QUEUE_LENGTH);
+    TLM_initReceiver(&commands, SCIA_BASE, queueCommands, COMMAND_QUEUE_LENGTH);
+    Interrupt_register(INT_SCIA_TX, &SCIA_TX_ISR);
+    Interrupt_enable(INT_SCIA_TX);
+    Interrupt_register(INT_SCIA_RX, &SCIA_RX_ISR);
+    Interrupt_enable(INT_SCIA_RX);
+}
+
+// Controller of the EPWM1 duty cycle, sampled at CONTROL_FREQ
+void configureControl() {
+#if CONTROL_MODE == 1
+    activeReferenceADCA = referenceADCA;
+    CTRL_initPI(&loopPI, PI_KP, PI_KI, (float)CONTROL_FREQ, DUTY_MINIMUM, DUTY_MAXIMUM);
+    CTRL_initStepMonitor(&stepADCA, "PI ADCA", (float)CONTROL_FREQ);
+#elif CONTROL_MODE == 2
+    // Tuned to the default DACA frequency, a new one from the host is not tracked
+    CTRL_initPR(&loopPR, PR_KP, PR_KR, copiesSettings[0].frequencyDACA, PR_CUTOFF, (float)CONTROL_FREQ, -PR_LIMIT, PR_LIMIT, PR_LIMIT);
+#endif
+#if CONTROL_MODE
+    // Timer 2 only starts the control conversions, its CPU interrupt (INT14) stays disabled
+    CPUTimer_stopTimer(CPUTIMER2_BASE);
+    CPUTimer_setPreScaler(CPUTIMER2_BASE, CPUTIMER_CLOCK_PRESCALER_1);
+    CPUTimer_setPeriod(CPUTIMER2_BASE, CONTROL_PERIOD);
+    CPUTimer_reloadTimerCounter(CPUTIMER2_BASE);
+#endif
+}
+
 // CPU timer 0 configuration
 void configureTimer0() {
-    // Timer 0 uses half system clock frequency (100 MHz)
-    const uint32_t timerPeriod = HALF_DEVICE_SYSCLK_FREQ / (uint32_t)TIMER0_FREQ;
+    // Timer 0 counts SYSCLK (200 MHz)
     CPUTimer_stopTimer(CPUTIMER0_BASE);
     CPUTimer_setPreScaler(CPUTIMER0_BASE, CPUTIMER_CLOCK_PRESCALER_1);
-    CPUTimer_setPeriod(CPUTIMER0_BASE, timerPeriod);
+    CPUTimer_setPeriod(CPUTIMER0_BASE, TIMER0_PERIOD);
     CPUTimer_reloadTimerCounter(CPUTIMER0_BASE);
     // Timer 0 end-of-cycle interrupt
     CPUTimer_enableInterrupt(CPUTIMER0_BASE);
@@ -222,6 +756,34 @@ void configureTimer0() {
     Interrupt_enable(INT_TIMER0);
 }
 
+// ISR profiler, replaces the GPIO 122 toggle on the scope
+void configureProfiler() {
+    PROF_initTimebase(CPUTIMER1_BASE);
+    PROF_init(&profileTimer0, "timer0_ISR", TIMER0_PERIOD + 1UL);
+    PROF_setTriggerTimer(&profileTimer0, CPUTIMER0_BASE, TIMER0_PERIOD);
+#if ADCA_DMA_MODE
+    PROF_init(&profileDMACH1, "DMACH1_ISR", (TIMER0_PERIOD + 1UL) * BUFFER_LENGTH);
+#else
+    PROF_init(&profileADCA1, "ADCA1_ISR", TIMER0_PERIOD + 1UL);
+#endif
+    PROF_init(&profileDMACH2, "DMACH2_ISR", 2UL * (SWITCHING_PERIOD + 1UL) * SWITCHING_BLOCK_LENGTH);
+    PROF_init(&profileSCIATX, "SCIA_TX_ISR", TELEMETRY_TX_PERIOD);
+#if CONTROL_MODE
+    PROF_init(&profileControl, "controlStep", CONTROL_PERIOD + 1UL);
+#endif
+}
+
+// Task rates as divisions of the timer 0 tick, fastest first (highest priority)
+void configureScheduler() {
+    SCHED_init(&scheduler, (float)TIMER0_FREQ, &readTimebase, UTILISATION_WINDOW);
+    SCHED_setRealTime(&scheduler, &samplePath, 0);
+    SCHED_addTask(&scheduler, "acquisition", ACQUISITION_TASK_FREQ, &acquisitionTask, 0);
+    SCHED_addTask(&scheduler, "control", CONTROL_TASK_FREQ, &controlTask, 0);
+    SCHED_addTask(&scheduler, "monitor", MONITOR_TASK_FREQ, &monitorTask, 0);
+    SCHED_addTask(&scheduler, "commands", COMMAND_TASK_FREQ, &commandTask, 0);
+    SCHED_addTask(&scheduler, "spectrum", SPECTRUM_TASK_FREQ, &spectrumTask, 0);
+}
+
 /*------------------------------MAIN------------------------------*/
 
 void main(void) {
@@ -234,17 +796,28 @@ void main(void) {
     Interrupt_initModule();
     Interrupt_initVectorTable();
     /*------------------------------MODULES------------------------------*/
+    configureSettings();
     configureGPIO();
     configureDACA();
     configureEPWM1();
     configureADCA();
+    configureADCB();
+    configureDMA();
+    configureEPWM2();
+    configureSCIA();
+    configureControl();
     configureTimer0();
+    configureProfiler();
+    configureScheduler();
     // Global interrupts and real-time debugging initialisation
     EINT;
     ERTM;
     // Main loop
     CPUTimer_startTimer(CPUTIMER0_BASE);
+#if CONTROL_MODE
+    CPUTimer_startTimer(CPUTIMER2_BASE);
+#endif
     while (1) {
-        // No operation
+        SCHED_runPending(&scheduler);
     }
 }
@@ -0,0 +1,34 @@
+#ifndef DUALCORE_H
+#define DUALCORE_H
+
+// Shared by dualCoreCPU1_main.c and dualCoreCPU2_main.c: what goes through the IPC queue between them
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "ipc.h"
+
+/*------------------------------MACROS------------------------------*/
+
+// IPC flags: doorbell of the queue, the same number each way (interrupt IPC_INT1 on both cores), start-up meetings
+#define DUAL_FLAG_DOORBELL IPC_FLAG1
+#define DUAL_INT_DOORBELL IPC_INT1
+#define DUAL_FLAG_SYNC IPC_FLAG31
+
+// Blocks of the acquisition on CPU2, one IPC block each
+#define DUAL_BLOCK_LENGTH 64U
+#define DUAL_DECIMATION 4U
+
+// Block types, CPU2 to CPU1
+#define DUAL_MESSAGE_SAMPLES 1U // DUAL_BLOCK_LENGTH ADCIN14 codes
+#define DUAL_MESSAGE_FILTERED 2U // DUAL_BLOCK_LENGTH / DUAL_DECIMATION low-pass samples, Q15
+#define DUAL_MESSAGE_SNAPSHOT 3U // PQ_Snapshot of the last window
+#define DUAL_MESSAGE_PATTERN 4U // Benchmark: payload word i is sequence + i
+// Block types, CPU1 to CPU2
+#define DUAL_MESSAGE_STREAM 16U // payload[0]: raw samples sent (1) or not (0)
+
+// 1 replaces the acquisition blocks by back-to-back pattern blocks: queue throughput, latency and integrity
+#ifndef IPC_BENCHMARK
+#define IPC_BENCHMARK 0
+#endif
+
+#endif
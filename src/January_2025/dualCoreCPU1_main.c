@@ -0,0 +1,392 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "debug.h"
+#include "gpio.h"
+#include "dac.h"
+#include "epwm.h"
+#include "device.h"
+#include "inc/hw_types.h"
+#include "interrupt.h"
+#include "ipc.h"
+#include "cpu.h"
+#include "cputimer.h"
+#include "inc/hw_memmap.h" // Bases
+#include "inc/hw_ints.h" // Interrupt registers
+#include "machine/_types.h"
+#include "pin_map.h"
+#include "sci.h"
+#include "sysctl.h"
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "dds.h"
+#include "dualCore.h"
+#include "ipcQueue.h"
+#include "isrProfiler.h"
+#include "powerQuality.h"
+#include "pwmUpdate.h"
+#include "report.h"
+#include "telemetry.h"
+
+/*------------------------------GLOBAL VARIABLES AND MACROS------------------------------*/
+
+// CPU1 of the dual-core split: DACA generation, EPWM1 and the SCIA telemetry; ADCA and its processing run on
+// CPU2 (dualCoreCPU2_main.c), which sends blocks and analytics back through the IPC queue
+#define TIMER0_FREQ 10000.0f // 10 kHz, period 100 us, also starts the ADCA conversions of CPU2
+
+#define HALF_DEVICE_SYSCLK_FREQ (DEVICE_SYSCLK_FREQ / 2)
+
+#define TIMER0_PERIOD (DEVICE_SYSCLK_FREQ / (uint32_t)TIMER0_FREQ - 1UL) // PRD register value, the CPU timers count SYSCLK
+
+// ISR profiling on the free-running CPU timer 1, expected periods in SYSCLK ticks
+PROF_Profile profileTimer0;
+PROF_Profile profileSCIATX;
+PROF_Profile profileIPC1;
+volatile uint16_t dumpProfiles; // Set from the debugger to print the report on the CCS console
+
+// SCIA telemetry (GPIO 42 and 43, the LaunchPad's USB virtual COM port)
+#define TELEMETRY_BAUD 230400UL
+#define TELEMETRY_TX_LEVEL SCI_FIFO_TX4
+#define TELEMETRY_QUEUE_LENGTH 2048U // Power of two, several capture frames
+// Refill interval while streaming: FIFO drained from 16 to the level, 10 bits per character
+#define TELEMETRY_TX_PERIOD ((uint32_t)(DEVICE_SYSCLK_FREQ / TELEMETRY_BAUD) * 10UL * (16UL - TELEMETRY_TX_LEVEL))
+#define TELEMETRY_CHANNEL_ADCA 0U
+#define TELEMETRY_CHANNEL_FILTERED 2U
+
+uint16_t queueTelemetry[TELEMETRY_QUEUE_LENGTH];
+TLM_Streamer telemetry;
+
+// Queue to and from CPU2
+IPCQ_Link linkCPU2;
+PQ_Snapshot powerQualityADCA; // Latest analytics of CPU2
+uint16_t filteredADCA[DUAL_BLOCK_LENGTH]; // Filtered block back in ADC codes for the telemetry
+volatile uint16_t requestSamplesADCA = 1U; // Set from the debugger: raw samples from CPU2 (1) or only the filtered ones (0)
+uint16_t lastRequestSamplesADCA = 1U;
+#if IPC_BENCHMARK
+#define BENCHMARK_REPORT_BLOCKS 32768UL // Report printed every so many pattern blocks
+// The queue must carry ten times the words of the acquisition: raw and filtered samples
+#define BENCHMARK_MIN_RATE (10.0f * TIMER0_FREQ * (1.0f + 1.0f / (float)DUAL_DECIMATION)) // Words/s
+uint32_t patternErrorsIPC; // Benchmark blocks with a wrong word
+#endif
+
+// Link check, once after CHECK_TICKS timer 0 ticks
+#define CHECK_TICKS 20000UL // 2 s
+// Every block read before the acquisition could fill the ring behind it, two blocks per DUAL_BLOCK_LENGTH ticks
+#define LATENCY_LIMIT ((uint32_t)IPCQ_SLOTS / 2UL * DUAL_BLOCK_LENGTH * (TIMER0_PERIOD + 1UL)) // SYSCLK ticks
+volatile uint32_t ticksTimer0;
+uint32_t filteredBlocksADCA; // Each one covers DUAL_BLOCK_LENGTH conversions of CPU2
+uint16_t linkChecked;
+
+// DACA parameters
+uint16_t amplitudeDACA = 4095U; // Digital level
+uint16_t offsetDACA = 2048U; // Shift wave X levels upward
+float frequencyDACA = 60.0f; // Sine wave frequency in Hz
+
+// DACA sine generator, stepped at TIMER0_FREQ
+DDS_Generator generatorDACA;
+
+// PWM1 parameters
+// Parameter history
+EPWM_TimeBaseCountMode lastCountModePWM1;
+uint16_t lastFrequencyPWM1;
+float lastDutyCyclePWM1;
+
+// Current parameters
+EPWM_TimeBaseCountMode countModePWM1 = EPWM_COUNTER_MODE_UP_DOWN;
+uint16_t frequencyPWM1 = 20000U;
+float dutyCyclePWM1 = 0.80f; // Ranges from 0 to 1
+
+// Register images computed in the background, written by timer0_ISR
+PWMUPDATE_Channel updatePWM1;
+
+/*------------------------------EPWM FUNCTIONS------------------------------*/
+
+// Register image for the current PWM1 parameters
+void computePWM1(PWMUPDATE_Registers *registers) {
+    const uint16_t duty = PWMUPDATE_dutyToQ15(dutyCyclePWM1);
+    PWMUPDATE_compute(registers, countModePWM1, HALF_DEVICE_SYSCLK_FREQ, frequencyPWM1, duty, duty);
+    // Update parameter history
+    lastCountModePWM1 = countModePWM1;
+    lastFrequencyPWM1 = frequencyPWM1;
+    lastDutyCyclePWM1 = dutyCyclePWM1;
+}
+
+/*------------------------------ISR------------------------------*/
+
+// DACA sample and PWM1 registers; the same tick starts the ADCA conversion on CPU2
+interrupt void timer0_ISR() {
+    PROF_enter(&profileTimer0);
+    ticksTimer0 ++;
+    DAC_setShadowValue(DACA_BASE, DDS_step(&generatorDACA));
+    PWMUPDATE_apply(&updatePWM1);
+    PROF_exit(&profileTimer0);
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP1);
+}
+
+// SCIA TX FIFO at or below TELEMETRY_TX_LEVEL: next bytes of the queued frames
+interrupt void SCIA_TX_ISR() {
+    PROF_enter(&profileSCIATX);
+    TLM_handleTxInterrupt(&telemetry);
+    PROF_exit(&profileSCIATX);
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP9);
+}
+
+// Doorbell of CPU2: blocks waiting in the queue, read by the background
+interrupt void IPC1_ISR() {
+    PROF_enter(&profileIPC1);
+    IPCQ_handleInterrupt(&linkCPU2);
+    PROF_exit(&profileIPC1);
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP1);
+}
+
+/*------------------------------BACKGROUND------------------------------*/
+
+// Report line, CIO console of the debugger
+void printLine(const char *line, void *context) {
+    printf("%s\n", line);
+}
+
+// One block from CPU2 on its way to the host, read in place in the message RAM
+void forwardBlock(const IPCQ_Block *block) {
+    uint16_t sample;
+    switch (block->type) {
+        case DUAL_MESSAGE_SAMPLES:
+            TLM_sendCapture(&telemetry, TELEMETRY_CHANNEL_ADCA, block->payload, block->length);
+            break;
+        case DUAL_MESSAGE_FILTERED:
+            // Q15 back to 12-bit codes around mid-scale, the capture frames carry codes
+            for (sample = 0; sample < block->length; sample ++) {
+                filteredADCA[sample] = (uint16_t)(((int16_t)block->payload[sample] >> 4) + 2048);
+            }
+            TLM_sendCapture(&telemetry, TELEMETRY_CHANNEL_FILTERED, filteredADCA, block->length);
+            filteredBlocksADCA ++;
+            break;
+        case DUAL_MESSAGE_SNAPSHOT:
+            memcpy(&powerQualityADCA, block->payload, sizeof(powerQualityADCA));
+            TLM_sendSnapshot(&telemetry, &powerQualityADCA);
+            break;
+#if IPC_BENCHMARK
+        case DUAL_MESSAGE_PATTERN:
+            for (sample = 0; sample < block->length; sample ++) {
+                if (block->payload[sample] != (uint16_t)(block->sequence + sample)) {
+                    patternErrorsIPC ++;
+                    break;
+                }
+            }
+            if (linkCPU2.statistics.received % BENCHMARK_REPORT_BLOCKS == 0UL) {
+                dumpProfiles = 1U;
+            }
+            break;
+#endif
+        default:
+            break;
+    }
+}
+
+// Everything CPU2 has sent, the slots go back as soon as each block is forwarded
+void receiveStep(void) {
+    const IPCQ_Block *block = IPCQ_peek(&linkCPU2);
+    while (block != 0) {
+        forwardBlock(block);
+        IPCQ_release(&linkCPU2);
+        block = IPCQ_peek(&linkCPU2);
+    }
+}
+
+// PWM1 reconfiguration and commands to CPU2, on parameter changes
+void parameterStep(void) {
+    // PWM1 parameters changed: compute off the ISR, timer0_ISR only writes the registers
+    if (countModePWM1 != lastCountModePWM1 || frequencyPWM1 != lastFrequencyPWM1 || dutyCyclePWM1 != lastDutyCyclePWM1) {
+        PWMUPDATE_Registers registersPWM1;
+        computePWM1(&registersPWM1);
+        PWMUPDATE_publish(&updatePWM1, &registersPWM1);
+    }
+    // Retried on the next pass when the queue is full
+    if (requestSamplesADCA != lastRequestSamplesADCA) {
+        const uint16_t stream = requestSamplesADCA;
+        if (IPCQ_send(&linkCPU2, DUAL_MESSAGE_STREAM, &stream, 1U)) {
+            lastRequestSamplesADCA = stream;
+        }
+    }
+    if (dumpProfiles) {
+        dumpProfiles = 0U;
+        PROF_dump(&printLine, 0);
+        IPCQ_dump(&linkCPU2, &printLine, 0);
+#if IPC_BENCHMARK
+        printf("IPC benchmark pattern errors %lu\n", (unsigned long)patternErrorsIPC);
+#endif
+    }
+}
+
+// Verdict on the link after CHECK_TICKS: nothing lost or out of sequence, throughput and latency within limits
+void checkStep(void) {
+    if (linkChecked || ticksTimer0 < CHECK_TICKS) {
+        return;
+    }
+    linkChecked = 1U;
+    const IPCQ_Statistics *statistics = &linkCPU2.statistics;
+#if IPC_BENCHMARK
+    const float span = (float)(statistics->lastArrival - statistics->firstArrival) / (float)DEVICE_SYSCLK_FREQ;
+    const float rate = span > 0.0f ? (float)statistics->receivedWords / span : 0.0f;
+    const bool passed = REPORT_check(patternErrorsIPC == 0UL && statistics->sequenceErrors == 0UL
+                                     && rate >= BENCHMARK_MIN_RATE && statistics->maximumLatency <= LATENCY_LIMIT);
+    printf("IPC benchmark check: pattern errors %lu, sequence errors %lu, %.0f words/s (minimum %.0f), latency max %lu ticks (limit %lu) %s\n",
+           (unsigned long)patternErrorsIPC, (unsigned long)statistics->sequenceErrors, rate, BENCHMARK_MIN_RATE,
+           (unsigned long)statistics->maximumLatency, (unsigned long)LATENCY_LIMIT, passed ? "ok" : "FAIL");
+#else
+    // Conversions started by timer 0 that came back filtered. Behind them only the blocks waiting in the ring, the
+    // block CPU2 is filling and a block of conversions it has not gathered yet; a refused block is lost for good
+    const uint32_t ticks = ticksTimer0;
+    const uint32_t samples = filteredBlocksADCA * DUAL_BLOCK_LENGTH;
+    const uint32_t behind = ((uint32_t)IPCQ_pending(&linkCPU2) + 2UL) * DUAL_BLOCK_LENGTH;
+    const bool passed = REPORT_check(statistics->sequenceErrors == 0UL && samples + behind >= ticks
+                                     && statistics->maximumLatency <= LATENCY_LIMIT);
+    printf("IPC check: sequence errors %lu, %lu of %lu samples filtered, latency max %lu ticks (limit %lu) %s\n",
+           (unsigned long)statistics->sequenceErrors, (unsigned long)samples, (unsigned long)ticks,
+           (unsigned long)statistics->maximumLatency, (unsigned long)LATENCY_LIMIT, passed ? "ok" : "FAIL");
+#endif
+}
+
+/*------------------------------SETUP------------------------------*/
+
+// GPIO and peripherals configuration
+void configureGPIO() {
+    // GPIO 0 (pin 40) as EPWM1A output
+    GPIO_setPinConfig(GPIO_0_EPWM1A);
+    GPIO_setPadConfig(0U, GPIO_PIN_TYPE_STD);
+    GPIO_setDirectionMode(0U, GPIO_DIR_MODE_OUT);
+    // GPIO 1 (pin 39) as EPWM1B output
+    GPIO_setPinConfig(GPIO_1_EPWM1B);
+    GPIO_setPadConfig(1U, GPIO_PIN_TYPE_STD);
+    GPIO_setDirectionMode(1U, GPIO_DIR_MODE_OUT);
+    // GPIO 42 and 43 as SCIA TX and RX (USB virtual COM port)
+    GPIO_setPinConfig(GPIO_42_SCITXDA);
+    GPIO_setPadConfig(42U, GPIO_PIN_TYPE_STD);
+    GPIO_setDirectionMode(42U, GPIO_DIR_MODE_OUT);
+    GPIO_setPinConfig(GPIO_43_SCIRXDA);
+    GPIO_setPadConfig(43U, GPIO_PIN_TYPE_PULLUP);
+    GPIO_setDirectionMode(43U, GPIO_DIR_MODE_IN);
+}
+
+// DACA (pin AA0) configuration
+void configureDACA() {
+    DAC_disableOutput(DACA_BASE);
+    DAC_setLoadMode(DACA_BASE, DAC_LOAD_SYSCLK);
+    DAC_setReferenceVoltage(DACA_BASE, DAC_REF_ADC_VREFHI);
+    DAC_enableOutput(DACA_BASE);
+    DAC_setShadowValue(DACA_BASE, 800U);
+    // Initialisation delay
+    DEVICE_DELAY_US(300);
+    // Sine generator parameters (may be changed later with DDS_set*)
+    DDS_init(&generatorDACA, (float)TIMER0_FREQ);
+    DDS_setFrequency(&generatorDACA, frequencyDACA);
+    DDS_setAmplitude(&generatorDACA, amplitudeDACA);
+    DDS_setOffset(&generatorDACA, offsetDACA);
+}
+
+// EPWM configuration on GPIO 0 and 1 (pins 40 and 39)
+void configureEPWM1() {
+    // EPWM clock frequency is HALF_DEVICE_SYSCLK_FREQ by default (100 MHz)
+    EPWM_setClockPrescaler(EPWM1_BASE, EPWM_CLOCK_DIVIDER_1, EPWM_HSCLOCK_DIVIDER_1);
+    EPWM_setPeriodLoadMode(EPWM1_BASE, EPWM_PERIOD_SHADOW_LOAD);
+    // Frequency and duty cycle first loaded
+    PWMUPDATE_Registers registersPWM1;
+    computePWM1(&registersPWM1);
+    PWMUPDATE_init(&updatePWM1, EPWM1_BASE, &registersPWM1);
+    EPWM_setPhaseShift(EPWM1_BASE, 0U);
+    // New counter-compare value loaded at every zero and TBPRD
+    EPWM_setCounterCompareShadowLoadMode(EPWM1_BASE, EPWM_COUNTER_COMPARE_A, EPWM_COMP_LOAD_ON_CNTR_ZERO_PERIOD);
+    EPWM_setCounterCompareShadowLoadMode(EPWM1_BASE, EPWM_COUNTER_COMPARE_B, EPWM_COMP_LOAD_ON_CNTR_ZERO_PERIOD);
+    EPWM_setActionQualifierShadowLoadMode(EPWM1_BASE, EPWM_ACTION_QUALIFIER_A, EPWM_AQ_LOAD_ON_CNTR_ZERO_PERIOD);
+    EPWM_setActionQualifierShadowLoadMode(EPWM1_BASE, EPWM_ACTION_QUALIFIER_B, EPWM_AQ_LOAD_ON_CNTR_ZERO_PERIOD);
+    // Mode, prescaler, period, compares and actions (EPWM1-B as a complement to A) from the first image
+    PWMUPDATE_apply(&updatePWM1);
+    EPWM_setTimeBaseCounter(EPWM1_BASE, 0U);
+    // Configuration done, EPWM1 clock enabled
+    SysCtl_enablePeripheral(SYSCTL_PERIPH_CLK_EPWM1);
+}
+
+// SCIA configuration: 8N1 at TELEMETRY_BAUD, transmit FIFO refilled by SCIA_TX_ISR
+void configureSCIA() {
+    SCI_performSoftwareReset(SCIA_BASE);
+    SCI_setConfig(SCIA_BASE, DEVICE_LSPCLK_FREQ, TELEMETRY_BAUD,
+                  SCI_CONFIG_WLEN_8 | SCI_CONFIG_STOP_ONE | SCI_CONFIG_PAR_NONE);
+    SCI_resetChannels(SCIA_BASE);
+    SCI_enableFIFO(SCIA_BASE);
+    SCI_setFIFOInterruptLevel(SCIA_BASE, TELEMETRY_TX_LEVEL, SCI_FIFO_RX16);
+    SCI_enableModule(SCIA_BASE);
+    SCI_performSoftwareReset(SCIA_BASE);
+    TLM_init(&telemetry, SCIA_BASE, queueTelemetry, TELEMETRY_QUEUE_LENGTH);
+    Interrupt_register(INT_SCIA_TX, &SCIA_TX_ISR);
+    Interrupt_enable(INT_SCIA_TX);
+}
+
+// CPU2 owns ADCA: handed over and CPU2 started, the queue's CPU1 side cleared before the first meeting
+void configureLinkCPU2() {
+    SysCtl_selectCPUForPeripheral(SYSCTL_CPUSEL11_ADC, 1U, SYSCTL_CPUSEL_CPU2);
+    IPCQ_init(&linkCPU2, IPC_CPU1_L_CPU2_R, DUAL_FLAG_DOORBELL);
+    IPC_registerInterrupt(IPC_CPU1_L_CPU2_R, DUAL_INT_DOORBELL, &IPC1_ISR);
+    Device_bootCPU2(C1C2_BROM_BOOTMODE_BOOT_FROM_FLASH);
+}
+
+// CPU timer 0 configuration
+void configureTimer0() {
+    CPUTimer_stopTimer(CPUTIMER0_BASE);
+    CPUTimer_setPreScaler(CPUTIMER0_BASE, CPUTIMER_CLOCK_PRESCALER_1);
+    CPUTimer_setPeriod(CPUTIMER0_BASE, TIMER0_PERIOD);
+    CPUTimer_reloadTimerCounter(CPUTIMER0_BASE);
+    // Timer 0 end-of-cycle interrupt
+    CPUTimer_enableInterrupt(CPUTIMER0_BASE);
+    Interrupt_register(INT_TIMER0, &timer0_ISR);
+    Interrupt_enable(INT_TIMER0);
+}
+
+// ISR profiler on CPU1's CPU timer 1
+void configureProfiler() {
+    PROF_initTimebase(CPUTIMER1_BASE);
+    PROF_init(&profileTimer0, "timer0_ISR", TIMER0_PERIOD + 1UL);
+    PROF_setTriggerTimer(&profileTimer0, CPUTIMER0_BASE, TIMER0_PERIOD);
+    PROF_init(&profileSCIATX, "SCIA_TX_ISR", TELEMETRY_TX_PERIOD);
+    PROF_init(&profileIPC1, "IPC1_ISR", (TIMER0_PERIOD + 1UL) * DUAL_BLOCK_LENGTH);
+}
+
+/*------------------------------MAIN------------------------------*/
+
+void main(void) {
+    /*------------------------------DEVICE------------------------------*/
+    // Device initialisation
+    Device_init();
+    Device_initGPIO();
+    /*------------------------------INTERRUPT------------------------------*/
+    // PIE module initialisation
+    Interrupt_initModule();
+    Interrupt_initVectorTable();
+    /*------------------------------MODULES------------------------------*/
+    configureLinkCPU2();
+    configureGPIO();
+    configureDACA();
+    configureEPWM1();
+    configureSCIA();
+    configureTimer0();
+    configureProfiler();
+    // CPU2 may configure ADCA, then waits until it is ready to take conversions
+    IPC_sync(IPC_CPU1_L_CPU2_R, DUAL_FLAG_SYNC);
+    IPC_sync(IPC_CPU1_L_CPU2_R, DUAL_FLAG_SYNC);
+    // Global interrupts and real-time debugging initialisation
+    EINT;
+    ERTM;
+    // Main loop
+    CPUTimer_startTimer(CPUTIMER0_BASE);
+    while (1) {
+        receiveStep();
+        parameterStep();
+        checkStep();
+    }
+}
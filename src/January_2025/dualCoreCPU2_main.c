@@ -0,0 +1,241 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdint.h>
+#include <string.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "adc.h"
+#include "debug.h"
+#include "device.h"
+#include "inc/hw_types.h"
+#include "interrupt.h"
+#include "ipc.h"
+#include "cpu.h"
+#include "cputimer.h"
+#include "inc/hw_memmap.h" // Bases
+#include "inc/hw_ints.h" // Interrupt registers
+#include "machine/_types.h"
+#include "sysctl.h"
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "dualCore.h"
+#include "filter.h"
+#include "ipcQueue.h"
+#include "isrProfiler.h"
+#include "powerQuality.h"
+#include "ringBuffer.h"
+
+/*------------------------------GLOBAL VARIABLES AND MACROS------------------------------*/
+
+// CPU2 of the dual-core split: ADCA acquisition, filtering and analytics; results to CPU1 through the IPC queue.
+// Names differ from the CPU1 program, so the host simulation links both into one binary
+#define SAMPLE_FREQ 10000.0f // CPU1 timer 0 starts every conversion
+#define SAMPLE_PERIOD (DEVICE_SYSCLK_FREQ / 10000UL) // SYSCLK ticks
+
+// ADCA1_ISR to background handoff, about eight blocks deep
+#define RING_LENGTH 512U // Power of two
+uint16_t storageADCA_SOC0[RING_LENGTH];
+RING_Buffer ringADCA_SOC0;
+uint16_t blockADCA[DUAL_BLOCK_LENGTH]; // Ring spans gathered into whole blocks
+uint16_t blockLengthADCA;
+
+// ADCA filter stage: 32-tap Hamming low-pass (1 kHz cut-off at 10 kHz) followed by decimation
+#define FILTER_TAPS 32
+
+const int16_t lowPassADCA[FILTER_TAPS] = {
+    -17, 20, 73, 135, 163, 91, -129, -466, -782, -850, -435, 588, 2141, 3926, 5501, 6424,
+    6424, 5501, 3926, 2141, 588, -435, -850, -782, -466, -129, 91, 163, 135, 73, 20, -17
+};
+int16_t decimatorStateADCA[2 * FILTER_TAPS];
+FILTER_DecimatorQ15 decimatorADCA;
+int16_t samplesADCA[DUAL_BLOCK_LENGTH]; // Q15 copy of the block being filtered
+
+// ADCA power-quality analytics over one 60 Hz period
+#define NOMINAL_FREQUENCY 60.0f
+#define CROSSING_HYSTERESIS 20U // Digital levels
+#define ANALYSIS_WINDOW 167U // Samples, SAMPLE_FREQ / NOMINAL_FREQUENCY
+
+PQ_Analyzer analyzerADCA;
+uint32_t lastWindowADCA; // Last analytics window sent
+
+// Queue to and from CPU1, raw samples sent until CPU1 asks otherwise
+IPCQ_Link linkCPU1;
+uint16_t streamSamplesADCA = 1U;
+uint32_t blocksDroppedADCA; // Blocks not sent, queue full
+
+// Per-sample and per-doorbell cost on CPU2's own CPU timer 1
+PROF_Profile profileCPU2ADCA1;
+PROF_Profile profileCPU2IPC1;
+
+/*------------------------------ISR------------------------------*/
+
+interrupt void ADCA1_ISR() {
+    PROF_enter(&profileCPU2ADCA1);
+    // Read result handed to the background, counted as an overrun if the ring is full
+    RING_push(&ringADCA_SOC0, ADC_readResult(ADCARESULT_BASE, ADC_SOC_NUMBER0));
+    PROF_exit(&profileCPU2ADCA1);
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP1);
+    ADC_clearInterruptStatus(ADCA_BASE, ADC_INT_NUMBER1);
+}
+
+// Doorbell of CPU1: commands waiting in the queue, read by the background
+interrupt void CPU2_IPC1_ISR() {
+    PROF_enter(&profileCPU2IPC1);
+    IPCQ_handleInterrupt(&linkCPU1);
+    PROF_exit(&profileCPU2IPC1);
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP1);
+}
+
+/*------------------------------BACKGROUND------------------------------*/
+
+// One whole block: filtered and analysed here, raw and filtered samples to CPU1
+void processBlockADCA(const uint16_t *block) {
+    FILTER_adcToQ15(block, samplesADCA, DUAL_BLOCK_LENGTH, 2048U);
+    uint16_t sample;
+    for (sample = 0; sample < DUAL_BLOCK_LENGTH; sample ++) {
+        PQ_update(&analyzerADCA, block[sample]);
+    }
+#if !IPC_BENCHMARK
+    // Filtered straight into the outgoing block, no copy
+    IPCQ_Block *filtered = IPCQ_reserve(&linkCPU1);
+    if (filtered != 0) {
+        const uint16_t length = FILTER_runDecimatorQ15(&decimatorADCA, samplesADCA, (int16_t *)filtered->payload, DUAL_BLOCK_LENGTH);
+        IPCQ_commit(&linkCPU1, DUAL_MESSAGE_FILTERED, length);
+    } else {
+        // The filter state must still follow the signal
+        int16_t discarded[DUAL_BLOCK_LENGTH / DUAL_DECIMATION + 1U];
+        FILTER_runDecimatorQ15(&decimatorADCA, samplesADCA, discarded, DUAL_BLOCK_LENGTH);
+        blocksDroppedADCA ++;
+    }
+    if (streamSamplesADCA && !IPCQ_send(&linkCPU1, DUAL_MESSAGE_SAMPLES, block, DUAL_BLOCK_LENGTH)) {
+        blocksDroppedADCA ++;
+    }
+#endif
+}
+
+// New ADCA samples gathered into blocks, analytics snapshot on every new window
+void acquisitionStep(void) {
+    const uint16_t *spanADCA;
+    uint16_t lengthADCA = RING_peek(&ringADCA_SOC0, &spanADCA);
+    while (lengthADCA > 0U) {
+        if (lengthADCA > DUAL_BLOCK_LENGTH - blockLengthADCA) {
+            lengthADCA = DUAL_BLOCK_LENGTH - blockLengthADCA;
+        }
+        memcpy(&blockADCA[blockLengthADCA], spanADCA, lengthADCA * sizeof(uint16_t));
+        blockLengthADCA += lengthADCA;
+        RING_release(&ringADCA_SOC0, lengthADCA);
+        if (blockLengthADCA == DUAL_BLOCK_LENGTH) {
+            processBlockADCA(blockADCA);
+            blockLengthADCA = 0U;
+        }
+        lengthADCA = RING_peek(&ringADCA_SOC0, &spanADCA);
+    }
+#if !IPC_BENCHMARK
+    PQ_Snapshot snapshot;
+    PQ_read(&analyzerADCA, &snapshot);
+    if (snapshot.window != lastWindowADCA) {
+        lastWindowADCA = snapshot.window;
+        // Floats as raw words, same layout on both cores
+        IPCQ_send(&linkCPU1, DUAL_MESSAGE_SNAPSHOT, (const uint16_t *)&snapshot,
+                  (uint16_t)((sizeof(snapshot) + sizeof(uint16_t) - 1U) / sizeof(uint16_t)));
+    }
+#endif
+}
+
+#if IPC_BENCHMARK
+// Queue kept full of pattern blocks, CPU1 checks every word
+void benchmarkStep(void) {
+    while (IPCQ_free(&linkCPU1) > 0U) {
+        IPCQ_Block *block = IPCQ_reserve(&linkCPU1);
+        const uint16_t sequence = linkCPU1.sequence;
+        uint16_t word;
+        for (word = 0; word < IPCQ_PAYLOAD; word ++) {
+            block->payload[word] = sequence + word;
+        }
+        IPCQ_commit(&linkCPU1, DUAL_MESSAGE_PATTERN, IPCQ_PAYLOAD);
+    }
+}
+#endif
+
+// Commands from CPU1
+void commandStep(void) {
+    const IPCQ_Block *block = IPCQ_peek(&linkCPU1);
+    while (block != 0) {
+        if (block->type == DUAL_MESSAGE_STREAM && block->length >= 1U) {
+            streamSamplesADCA = block->payload[0];
+        }
+        IPCQ_release(&linkCPU1);
+        block = IPCQ_peek(&linkCPU1);
+    }
+}
+
+/*------------------------------SETUP------------------------------*/
+
+// ADCA configuration on input channel ADCIN14 (pin A14), handed over by CPU1, conversions started by CPU1's timer 0
+void configureADCA() {
+    SysCtl_resetPeripheral(SYSCTL_PERIPH_RES_ADCA);
+    ADC_disableConverter(ADCA_BASE);
+    ADC_setMode(ADCA_BASE, ADC_RESOLUTION_12BIT, ADC_MODE_SINGLE_ENDED);
+    ADC_setPrescaler(ADCA_BASE, ADC_CLK_DIV_4_0);
+    ADC_setSOCPriority(ADCA_BASE, ADC_PRI_ALL_ROUND_ROBIN);
+    ADC_setupSOC(ADCA_BASE, ADC_SOC_NUMBER0, ADC_TRIGGER_CPU1_TINT0, ADC_CH_ADCIN14, 20U);
+    ADC_setInterruptSOCTrigger(ADCA_BASE, ADC_SOC_NUMBER0, ADC_INT_SOC_TRIGGER_NONE);
+    ADC_setInterruptPulseMode(ADCA_BASE, ADC_PULSE_END_OF_CONV);
+    ADC_enableContinuousMode(ADCA_BASE, ADC_INT_NUMBER1);
+    ADC_setInterruptSource(ADCA_BASE, ADC_INT_NUMBER1, ADC_SOC_NUMBER0);
+    ADC_enableInterrupt(ADCA_BASE, ADC_INT_NUMBER1);
+    RING_init(&ringADCA_SOC0, storageADCA_SOC0, RING_LENGTH);
+    FILTER_initDecimatorQ15(&decimatorADCA, lowPassADCA, decimatorStateADCA, FILTER_TAPS, DUAL_DECIMATION);
+    PQ_init(&analyzerADCA, SAMPLE_FREQ, NOMINAL_FREQUENCY, ANALYSIS_WINDOW, CROSSING_HYSTERESIS);
+    Interrupt_register(INT_ADCA1, &ADCA1_ISR);
+    Interrupt_enable(INT_ADCA1);
+    ADC_enableConverter(ADCA_BASE);
+    // Initialisation delay
+    DEVICE_DELAY_US(1000);
+}
+
+// Commands doorbell from CPU1
+void configureLinkCPU1() {
+    IPCQ_init(&linkCPU1, IPC_CPU2_L_CPU1_R, DUAL_FLAG_DOORBELL);
+    IPC_registerInterrupt(IPC_CPU2_L_CPU1_R, DUAL_INT_DOORBELL, &CPU2_IPC1_ISR);
+}
+
+// ISR profiler on CPU2's CPU timer 1
+void configureProfilerCPU2() {
+    PROF_initTimebase(CPUTIMER1_BASE);
+    PROF_init(&profileCPU2ADCA1, "CPU2 ADCA1_ISR", SAMPLE_PERIOD);
+    PROF_init(&profileCPU2IPC1, "CPU2 CPU2_IPC1_ISR", SAMPLE_PERIOD * DUAL_BLOCK_LENGTH);
+}
+
+/*------------------------------MAIN------------------------------*/
+
+void main(void) {
+    /*------------------------------DEVICE------------------------------*/
+    // Device initialisation, the clocks and the GPIOs belong to CPU1
+    Device_init();
+    /*------------------------------INTERRUPT------------------------------*/
+    // PIE module initialisation
+    Interrupt_initModule();
+    Interrupt_initVectorTable();
+    /*------------------------------MODULES------------------------------*/
+    // CPU1 has handed ADCA over and cleared its side of the queue
+    IPC_sync(IPC_CPU2_L_CPU1_R, DUAL_FLAG_SYNC);
+    configureADCA();
+    configureLinkCPU1();
+    configureProfilerCPU2();
+    // Ready: CPU1 starts its timer 0, and the conversions with it
+    IPC_sync(IPC_CPU2_L_CPU1_R, DUAL_FLAG_SYNC);
+    // Global interrupts and real-time debugging initialisation
+    EINT;
+    ERTM;
+    // Main loop: the ADCA1_ISR only moves samples, everything else is here
+    while (1) {
+        acquisitionStep();
+#if IPC_BENCHMARK
+        benchmarkStep();
+#endif
+        commandStep();
+    }
+}
@@ -0,0 +1,159 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdint.h>
+#include <stdio.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "adc.h"
+#include "dac.h"
+#include "debug.h"
+#include "device.h"
+#include "inc/hw_types.h"
+#include "interrupt.h"
+#include "cpu.h"
+#include "cputimer.h"
+#include "inc/hw_memmap.h" // Bases
+#include "inc/hw_ints.h" // Interrupt registers
+#include "machine/_types.h"
+#include "sysctl.h"
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "bode.h"
+#include "isrProfiler.h"
+
+/*------------------------------GLOBAL VARIABLES AND MACROS------------------------------*/
+
+// Network analyser: stimulus on DACA (pin AA0), response of the circuit under test on ADCIN14 (pin A14)
+#define SAMPLE_FREQ 10000UL // Hz, timer 0 starts every conversion
+#define TIMER0_PERIOD (DEVICE_SYSCLK_FREQ / SAMPLE_FREQ - 1UL) // PRD register value, the CPU timers count SYSCLK
+#define DAC_OFFSET 2048U // Mid-scale bias of the stimulus, the response is centred on it
+#define SAMPLE_WINDOW 20U // SYSCLK ticks, the input is held at the end of the window
+
+BODE_Analyzer analyzerBode;
+
+// Current settings (may be changed from the debugger), applied when startSweep is set:
+// 10 Hz to 2 kHz in 16 points, one tone, 500 codes peak (room for resonant gain), 20 ms windows,
+// settled within 0.2% and 0.2 degrees
+BODE_Settings settingsBode = {10.0f, 2000.0f, 16U, 1U, 500U, 0.02f, 0.002f, 0.2f, 50U};
+volatile uint16_t startSweep = 1U;
+volatile uint32_t writeDelayDACA; // SYSCLK ticks from the conversion trigger to the DAC write, last sample
+volatile uint16_t dumpBode; // Set from the debugger to print the table on the CCS console, also done after every sweep
+
+// Per-sample cost on the free-running CPU timer 1
+PROF_Profile profileADCA1;
+volatile uint16_t dumpProfiles; // Set from the debugger to print the report on the CCS console
+
+/*------------------------------ISR------------------------------*/
+
+// End of the ADCIN14 conversion started by timer 0: response in, stimulus out for the next sample period
+interrupt void ADCA1_ISR() {
+    PROF_enter(&profileADCA1);
+    const uint16_t sample = ADC_readResult(ADCARESULT_BASE, ADC_SOC_NUMBER0);
+    DAC_setShadowValue(DACA_BASE, BODE_step(&analyzerBode, sample));
+    // Timer 0 reloads as it starts the conversion, so its count gives the time since
+    writeDelayDACA = TIMER0_PERIOD - CPUTimer_getTimerCount(CPUTIMER0_BASE);
+    PROF_exit(&profileADCA1);
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP1);
+    ADC_clearInterruptStatus(ADCA_BASE, ADC_INT_NUMBER1);
+}
+
+/*------------------------------BACKGROUND------------------------------*/
+
+// Report line, CIO console of the debugger
+void printLine(const char *line, void *context) {
+    printf("%s\n", line);
+}
+
+/*------------------------------SETUP------------------------------*/
+
+// DACA (pin AA0) configuration, held at the offset until a sweep starts
+void configureDACA() {
+    DAC_disableOutput(DACA_BASE);
+    DAC_setLoadMode(DACA_BASE, DAC_LOAD_SYSCLK);
+    DAC_setReferenceVoltage(DACA_BASE, DAC_REF_ADC_VREFHI);
+    DAC_enableOutput(DACA_BASE);
+    DAC_setShadowValue(DACA_BASE, DAC_OFFSET);
+    // Initialisation delay
+    DEVICE_DELAY_US(300);
+    BODE_init(&analyzerBode, (float)SAMPLE_FREQ, DAC_OFFSET);
+}
+
+// ADCA configuration on input channel ADCIN14 (pin A14), one conversion per timer 0 period
+void configureADCA() {
+    SysCtl_resetPeripheral(SYSCTL_PERIPH_RES_ADCA);
+    ADC_disableConverter(ADCA_BASE);
+    ADC_setMode(ADCA_BASE, ADC_RESOLUTION_12BIT, ADC_MODE_SINGLE_ENDED);
+    ADC_setPrescaler(ADCA_BASE, ADC_CLK_DIV_4_0);
+    ADC_setSOCPriority(ADCA_BASE, ADC_PRI_ALL_ROUND_ROBIN);
+    ADC_setupSOC(ADCA_BASE, ADC_SOC_NUMBER0, ADC_TRIGGER_CPU1_TINT0, ADC_CH_ADCIN14, SAMPLE_WINDOW);
+    ADC_setInterruptSOCTrigger(ADCA_BASE, ADC_SOC_NUMBER0, ADC_INT_SOC_TRIGGER_NONE);
+    // Interrupt at the end of the conversion, the DAC is written right after the sample
+    ADC_setInterruptPulseMode(ADCA_BASE, ADC_PULSE_END_OF_CONV);
+    ADC_enableContinuousMode(ADCA_BASE, ADC_INT_NUMBER1);
+    ADC_setInterruptSource(ADCA_BASE, ADC_INT_NUMBER1, ADC_SOC_NUMBER0);
+    ADC_enableInterrupt(ADCA_BASE, ADC_INT_NUMBER1);
+    Interrupt_register(INT_ADCA1, &ADCA1_ISR);
+    Interrupt_enable(INT_ADCA1);
+    ADC_enableConverter(ADCA_BASE);
+    // Initialisation delay
+    DEVICE_DELAY_US(1000);
+}
+
+// CPU timer 0 only triggers the ADC, no interrupt of its own
+void configureTimer0() {
+    CPUTimer_stopTimer(CPUTIMER0_BASE);
+    CPUTimer_setPreScaler(CPUTIMER0_BASE, CPUTIMER_CLOCK_PRESCALER_1);
+    CPUTimer_setPeriod(CPUTIMER0_BASE, TIMER0_PERIOD);
+    CPUTimer_reloadTimerCounter(CPUTIMER0_BASE);
+}
+
+// ISR profiler on CPU timer 1, latency measured from the timer 0 period end
+void configureProfiler() {
+    PROF_initTimebase(CPUTIMER1_BASE);
+    PROF_init(&profileADCA1, "ADCA1_ISR", TIMER0_PERIOD + 1UL);
+    PROF_setTriggerTimer(&profileADCA1, CPUTIMER0_BASE, TIMER0_PERIOD);
+}
+
+/*------------------------------MAIN------------------------------*/
+
+void main(void) {
+    /*------------------------------DEVICE------------------------------*/
+    // Device initialisation
+    Device_init();
+    Device_initGPIO();
+    /*------------------------------INTERRUPT------------------------------*/
+    // PIE module initialisation
+    Interrupt_initModule();
+    Interrupt_initVectorTable();
+    /*------------------------------MODULES------------------------------*/
+    configureDACA();
+    configureADCA();
+    configureTimer0();
+    configureProfiler();
+    // Global interrupts and real-time debugging initialisation
+    EINT;
+    ERTM;
+    // Main loop: sweep control, the per-sample work is all in ADCA1_ISR
+    CPUTimer_startTimer(CPUTIMER0_BASE);
+    while (1) {
+        if (startSweep) {
+            startSweep = 0U;
+            BODE_start(&analyzerBode, &settingsBode);
+        }
+        // The phase also lags by the time from the end of the sample window to the DAC write
+        BODE_setDelay(&analyzerBode, (float)((int32_t)writeDelayDACA - (int32_t)SAMPLE_WINDOW) / (float)DEVICE_SYSCLK_FREQ);
+        if (BODE_poll(&analyzerBode)) {
+            dumpBode = 1U;
+        }
+        if (dumpBode) {
+            dumpBode = 0U;
+            BODE_dump(&analyzerBode, &printLine, 0);
+        }
+        if (dumpProfiles) {
+            dumpProfiles = 0U;
+            PROF_dump(&printLine, 0);
+        }
+    }
+}
@@ -0,0 +1,933 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "debug.h"
+#include "device.h"
+#include "inc/hw_types.h"
+#include "interrupt.h"
+#include "cpu.h"
+#include "cputimer.h"
+#include "inc/hw_memmap.h" // Bases
+#include "machine/_types.h"
+#include "sysctl.h"
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "control.h"
+#include "dacDMA.h"
+#include "dds.h"
+#include "filter.h"
+#include "isrProfiler.h"
+#include "modulation.h"
+#include "powerQuality.h"
+#include "pwmUpdate.h"
+#include "ringBuffer.h"
+#include "spectrum.h"
+#include "waveGen.h"
+
+/*------------------------------GLOBAL VARIABLES AND MACROS------------------------------*/
+
+// Cost and correctness of every real-time kernel of src/common, one line each for tools/kernelBenchmark.py.
+// Cost: SYSCLK ticks per sample on the free-running CPU timer 1 (C28x cycles on the board, host time in the
+// simulation), best of REPEATS runs. Correctness: largest error against a double reference signal, with its limit
+#define BLOCK 256U // Samples per timed run
+#define PASSES 16U // Timed passes per run
+#define REPEATS 10U // Runs per kernel, the fastest one counts (preemption on the host, cache on neither)
+#define SAMPLE_FREQUENCY 10000.0f // Hz, rate of the ISR kernels
+#define TIMEBASE_FREQUENCY 100000000UL // EPWM time base, SYSCLK / 2
+
+#define FIR_TAPS 32U
+#define DECIMATION 4U
+#define BIQUAD_STAGES 2U
+#define CIC_ORDER 3U
+#define CIC_RATE_SHIFT 3U
+#define CIC_INPUTS 64U // Accuracy inputs, 2^CIC_RATE_SHIFT outputs each
+#define FFT_CHECKED_BINS 128U // Bins per transform against the double DFT, evenly spread, Nyquist added
+#define WELCH_POINTS 1024U
+#define WELCH_AVERAGES 4U
+#define WELCH_STEPS 8U // SPEC_process calls per block, more than a segment needs per half transform
+
+// C28x cycles per sample estimated from the instruction counts of each kernel at -O2 with the FPU32 and the TMU,
+// code and data in zero-wait RAM: 16x16 MAC 1 (RPT || MAC), 32x32 product 2 (IMPYL, QMPYL) plus 2 for a 64-bit sum,
+// float multiply or add 1 when pipelined (2-cycle latency), load or store 1, taken branch 4, call and return 8.
+// Within a factor of two of a board run; the ticks of a board run replace them, the host ones cannot
+#define ESTIMATE_DDS 28.0f // Mirror 6, two table loads 2, interpolation 6, sign 3, scale 4, clamp 5, phase 2
+#define ESTIMATE_SINF 45.0f // Phase to turns 4, range reduction 10, TMU sine 4, scale and offset 6, rounding 4, clamp 5, call 12
+#define ESTIMATE_WAVE 32.0f // The DDS step plus the frame loop and the strided store
+#define ESTIMATE_CIC 22.0f // Three 32-bit integrators 9, shift and clamp 6, store 2, combs and call over 8 outputs 5
+#define ESTIMATE_MOD 90.0f // Three quarter-wave lookups 3 x 20, scaling 9, min/max 8, common mode 6, clamps 9
+#define ESTIMATE_COMPARE 16.0f // 16x32 product 3, shift 1, mode branch 4, call 8
+// 32-bit unsigned divide: the C28x has no integer divide and the TMU divides floats only, so it is a runtime library
+// call: call and return 8, setup 4, RPT || SUBCUL over 32 quotient bits 33
+#define ESTIMATE_DIVIDE 45.0f
+// The timed carriers (1 to 11 kHz up-down) fit TBPRD unscaled: one divide; call with six arguments 16, frequency and
+// divisor 9, loop test 4, mode and clamps 10, two inlined compares 16, stores 5. Each prescaler step adds a divide and 6
+#define ESTIMATE_COMPUTE (ESTIMATE_DIVIDE + 60.0f)
+#define ESTIMATE_RING 18.0f // Push: index, room check, store, high water, publish 12; pop copy loop 6
+#define ESTIMATE_ADC_TO_Q15 5.0f // Load, subtract, shift, store, loop
+#define ESTIMATE_FIR_Q15 ((float)FIR_TAPS + 26.0f) // RPT || MAC per tap; push 8, round and saturate 8, loop 10
+#define ESTIMATE_FIR_Q31 (4.0f * (float)FIR_TAPS + 30.0f) // QMPYL and a 64-bit add per tap; push 12, shift 6, loop 12
+#define ESTIMATE_FIR_F32 (2.0f * (float)FIR_TAPS + 20.0f) // MPYF32 || MOV32 and ADDF32 per tap, two accumulators
+#define ESTIMATE_DECIMATOR (8.0f + ((float)FIR_TAPS + 18.0f) / (float)DECIMATION) // Push every input, dot product per output
+#define ESTIMATE_BIQUAD_Q31 (35.0f * (float)BIQUAD_STAGES) // Five 32x32 products with 64-bit sums 25, shift 4, moves 6
+#define ESTIMATE_VECTORS 60.0f // The kernels above on a few samples each: init, call and compare outweigh the MACs
+#define ESTIMATE_BIQUAD_F32 (14.0f * (float)BIQUAD_STAGES) // Five MPYF32 and three ADDF32 pipelined 10, load and store 4
+#define ESTIMATE_PI 30.0f // Two Q12 products 4, integral with its clamp 10, saturation 6, gain handover check 4, call 6
+#define ESTIMATE_PR 50.0f // Four Q29 products with 64-bit sums 24, state shifts 8, clamps 12, call 6
+#define ESTIMATE_PQ (14.0f + 8.0f * (float)PQ_HARMONICS) // Sums 6, zero crossing 8, a Goertzel step per harmonic
+#define ESTIMATE_WELCH 95.0f // Push 5, then window 3, 1024-point FFT 38 and power 4 per point, each sample in two segments
+
+#define TWO_PI 6.283185307179586
+#define Q15_LSB (1.0 / 32768.0)
+#define Q31_LSB (1.0 / 2147483648.0)
+#define F32_LSB (1.0 / 16777216.0)
+
+// Signals in every format, filled by prepareInputs
+uint16_t codes[BLOCK];
+int16_t signalQ15[BLOCK];
+int32_t signalQ31[BLOCK];
+float signalF32[BLOCK];
+uint16_t duties[BLOCK];
+
+// Kernel outputs, also what keeps the timed calls from being optimised away
+uint16_t outputCodes[MOD_PHASES * BLOCK];
+int16_t outputQ15[BLOCK];
+int32_t outputQ31[BLOCK];
+float outputF32[BLOCK];
+
+int16_t coefficientsQ15[FIR_TAPS];
+int32_t coefficientsQ31[FIR_TAPS];
+float coefficientsF32[FIR_TAPS];
+int16_t stateQ15[2U * FIR_TAPS];
+int32_t stateQ31[2U * FIR_TAPS];
+float stateF32[2U * FIR_TAPS];
+int32_t biquadQ31[5U * BIQUAD_STAGES];
+float biquadF32[5U * BIQUAD_STAGES];
+int32_t biquadStateQ31[4U * BIQUAD_STAGES];
+float biquadStateF32[2U * BIQUAD_STAGES];
+uint16_t ringStorage[BLOCK];
+
+// Zero-stuffed CIC input and its running sums, accuracy only
+double cicReference[2][(CIC_INPUTS + CIC_ORDER) << CIC_RATE_SHIFT];
+
+// Transform input and the copy transformed in place
+float transformInput[SPEC_MAX_POINTS];
+float transform[SPEC_MAX_POINTS];
+float storageWelch[SPEC_STORAGE(WELCH_POINTS)];
+uint16_t historyWelch[SPEC_HISTORY(WELCH_POINTS)];
+SPEC_Analyzer analyzerWelch; // Global, the host simulation reports it at the end of the run
+
+// Filter golden vectors: outputs worked out in exact integer arithmetic from the documented rounding of each
+// kernel (Q15 rounded half up and saturated, Q31 and biquad floored), independently of filter.c
+#define VECTOR_FIR_TAPS 5U // Odd, the tail loop after the groups of four runs too
+#define VECTOR_FIR_LENGTH 19U
+#define VECTOR_FIR_SPLIT 7U // Two calls, the delay line carries over between them
+#define VECTOR_DECIMATION 3U
+#define VECTOR_DECIMATOR_SPLIT 4U // Mid-phase, the decimator carries its phase over
+#define VECTOR_Q31_TAPS 3U
+#define VECTOR_Q31_LENGTH 8U
+#define VECTOR_BIQUAD_STAGES 2U
+#define VECTOR_BIQUAD_LENGTH 10U
+#define VECTOR_ADC_LENGTH 4U
+#define VECTOR_SAMPLES (2U * VECTOR_FIR_LENGTH + VECTOR_Q31_LENGTH + VECTOR_BIQUAD_LENGTH + VECTOR_ADC_LENGTH)
+
+// 0.5, -0.25, 0.125, 0.25, 0.5: a 1.125 DC gain, so the full-scale runs saturate both ways
+const int16_t vectorFIRCoefficients[VECTOR_FIR_TAPS] = {16384, -8192, 4096, 8192, 16384};
+const int16_t vectorFIRInput[VECTOR_FIR_LENGTH] = {
+    32767, 0, 0, 0, 0, -32768, -32768, -32768, -32768, -32768, -32768, 32767, 32767, 32767, 32767, 32767, 1, -1, 3
+};
+const int16_t vectorFIROutput[VECTOR_FIR_LENGTH] = {
+    16384, -8192, 4096, 8192, 16384, -16384, -8192, -12288, -20480, -32768, -32768, -4096, -20480, -12288, 4095,
+    32767, 20480, 28670, 24577
+};
+// Every third output of the same filter
+const int16_t vectorDecimatorOutput[VECTOR_FIR_LENGTH / VECTOR_DECIMATION] = {4096, -16384, -20480, -4096, 4095, 28670};
+// 0.25, -0.5, 0.125
+const int32_t vectorQ31Coefficients[VECTOR_Q31_TAPS] = {536870912L, -1073741824L, 268435456L};
+const int32_t vectorQ31Input[VECTOR_Q31_LENGTH] = {
+    2147483647L, 1L, -1L, (-2147483647L - 1L), 123456789L, -987654321L, 0L, 0L
+};
+const int32_t vectorQ31Output[VECTOR_Q31_LENGTH] = {
+    536870911L, -1073741824L, 268435455L, -536870912L, 1104606021L, -577077431L, 509259259L, -123456791L
+};
+// Stage 1: b 0.5, 0.25, 0, feedback 0.5, -0.25; stage 2: b 1, -0.5, 0, no feedback. Impulse, then a step
+const int32_t vectorBiquadCoefficients[5U * VECTOR_BIQUAD_STAGES] = {
+    536870912L, 268435456L, 0L, 536870912L, -268435456L, 1073741824L, -536870912L, 0L, 0L, 0L
+};
+const int32_t vectorBiquadInput[VECTOR_BIQUAD_LENGTH] = {
+    268435456L, 0L, 0L, 0L, 0L, 0L, -536870912L, -536870912L, -536870912L, -536870912L
+};
+const int32_t vectorBiquadOutput[VECTOR_BIQUAD_LENGTH] = {
+    134217728L, 67108864L, -33554432L, -33554432L, -8388608L, 4194304L, -264241152L, -401604608L, -336068608L,
+    -268959744L
+};
+const uint16_t vectorADCInput[VECTOR_ADC_LENGTH] = {0U, 2048U, 4095U, 1000U};
+const int16_t vectorADCOutput[VECTOR_ADC_LENGTH] = {-32768, 0, 32752, -16768};
+
+uint32_t randomState = 12345UL;
+uint16_t kernels;
+uint16_t failures;
+
+/*------------------------------HELPERS------------------------------*/
+
+// Linear congruential generator, uniform in [-1, 1)
+float randomUnit(void) {
+    randomState = randomState * 1664525UL + 22695477UL;
+    return (float)(int32_t)randomState * (1.0f / 2147483648.0f);
+}
+
+void trackError(double *maximum, double error) {
+    error = fabs(error);
+    if (error > *maximum) {
+        *maximum = error;
+    }
+}
+
+// C28x cycles per point of a real FFT: bit-reversed load 3, radix-4 stages of N / 2 complex points at 12.5 cycles
+// per complex point (three complex twiddle products and sixteen adds per butterfly), a radix-2 stage at 5 when
+// log2(N / 2) is odd, the real split 6 and the copy 2
+float estimateFFT(uint16_t points) {
+    uint16_t bits = 0U;
+    while ((1U << bits) < points / 2U) {
+        bits ++;
+    }
+    return 11.0f + 6.25f * (float)(bits / 2U) + ((bits & 1U) ? 2.5f : 0.0f);
+}
+
+// One result line: name, cost, C28x estimate, worst error against the reference and its limit
+void printLine(const char *kernel, float ticks, float estimate, double error, double limit, const char *units) {
+    const bool passed = error <= limit;
+    kernels ++;
+    if (!passed) {
+        failures ++;
+    }
+    printf("%-18s %9.1f ns %9.2f ticks (C28x est %6.1f), error max %.3g %s (limit %.3g) %s\n", kernel,
+           ticks * (1.0e9f / (float)DEVICE_SYSCLK_FREQ), ticks, estimate, error, units, limit, passed ? "ok" : "FAIL");
+    // Line by line, a reader may stop the run at the last one
+    fflush(stdout);
+}
+
+/*------------------------------BENCHMARKS------------------------------*/
+
+// Best ticks per sample of the statements, which process samples samples per pass
+#define TIME_KERNEL(ticks, samples, ...) \
+    do { \
+        uint16_t repeat; \
+        ticks = 1.0e30f; \
+        for (repeat = 0; repeat < REPEATS; repeat ++) { \
+            const uint32_t start = PROF_now(); \
+            uint16_t pass; \
+            for (pass = 0; pass < PASSES; pass ++) { \
+                __VA_ARGS__; \
+            } \
+            const float perSample = (float)(PROF_now() - start) / (float)((uint32_t)PASSES * (samples)); \
+            if (perSample < ticks) { \
+                ticks = perSample; \
+            } \
+        } \
+    } while (0)
+
+// The DDS step computed with the library sine, what the quarter-wave table stands in for
+uint16_t sinfStep(DDS_Generator *dds) {
+    const float turn = (float)dds->phase * (1.0f / DDS_PHASE_TURN);
+    float output = (float)dds->offset + 0.5f * (float)dds->amplitude * sinf((float)TWO_PI * turn);
+    dds->phase += dds->phaseIncrement;
+    if (output < 0.0f) {
+        output = 0.0f;
+    } else if (output > (float)DDS_DAC_MAX) {
+        output = (float)DDS_DAC_MAX;
+    }
+    return (uint16_t)(output + 0.5f);
+}
+
+// Waveform generation: DDS sample of the oscilloscope ISR, against sinf in accuracy and cost
+void benchmarkDDS(void) {
+    DDS_Generator dds;
+    float ticks;
+    float ticksSinf;
+    uint16_t n;
+    DDS_init(&dds, SAMPLE_FREQUENCY);
+    DDS_setFrequency(&dds, 1234.5f);
+    DDS_setAmplitude(&dds, 4000U);
+    DDS_setOffset(&dds, 2048U);
+    TIME_KERNEL(ticks, BLOCK, for (n = 0; n < BLOCK; n ++) { outputCodes[n] = DDS_step(&dds); });
+    TIME_KERNEL(ticksSinf, BLOCK, for (n = 0; n < BLOCK; n ++) { outputCodes[n] = sinfStep(&dds); });
+    double error = 0.0;
+    uint32_t index;
+    // Odd increment: every table segment and quadrant visited at a different point
+    DDS_setPhaseIncrement(&dds, 0x00C0FFEEUL | 1UL);
+    for (index = 0; index < 4096UL; index ++) {
+        const float turn = (float)dds.phase * (1.0f / DDS_PHASE_TURN);
+        trackError(&error, DDS_step(&dds) - (2048.0f + 2000.0f * sinf((float)TWO_PI * turn)));
+    }
+    printLine("dds.step", ticks, ESTIMATE_DDS, error, 1.5, "codes");
+    // The table only earns its flash if it beats the library call it replaces
+    printLine("dds.sinf", ticksSinf, ESTIMATE_SINF, ticks / ticksSinf, 1.0, "dds.step/sinf cost");
+}
+
+// Waveform generation: table synthesis at the DAC rate (WAVE_fill of the DMA stream)
+void benchmarkWaveFill(void) {
+    WAVE_Generator generator;
+    float ticks;
+    WAVE_init(&generator, 8.0f * SAMPLE_FREQUENCY);
+    WAVE_Channel *channel = WAVE_addChannel(&generator, DACA_BASE, &WAVE_sine);
+    WAVE_setFrequency(&generator, channel, 1234.5f);
+    WAVE_setAmplitude(channel, 4000U);
+    WAVE_setOffset(channel, 2048U);
+    TIME_KERNEL(ticks, BLOCK, WAVE_fill(&generator, outputCodes, BLOCK));
+    double error = 0.0;
+    uint32_t index;
+    WAVE_setPhaseIncrement(channel, 0x00C0FFEEUL | 1UL);
+    for (index = 0; index < 4096UL; index ++) {
+        const double turn = channel->phase / 4294967296.0;
+        trackError(&error, WAVE_step(channel) - (2048.0 + 2000.0 * sin(TWO_PI * turn)));
+    }
+    printLine("wave.fill", ticks, ESTIMATE_WAVE, error, 1.5, "codes");
+}
+
+// Waveform generation: CIC interpolation of the DDS samples, per output sample.
+// Reference: the zero-stuffed input through CIC_ORDER moving sums of 2^CIC_RATE_SHIFT, over the gain
+void benchmarkInterpolator(void) {
+    DACDMA_Interpolator interpolator;
+    const uint16_t rate = 1U << CIC_RATE_SHIFT;
+    float ticks;
+    uint16_t n;
+    DACDMA_initInterpolator(&interpolator, CIC_ORDER, CIC_RATE_SHIFT, 2048U);
+    TIME_KERNEL(ticks, BLOCK, for (n = 0; n < BLOCK / rate; n ++) {
+        DACDMA_interpolate(&interpolator, codes[n], &outputCodes[n * rate], 1U);
+    });
+    // Settled at mid-scale before the first input, as after DACDMA_initInterpolator
+    DACDMA_initInterpolator(&interpolator, CIC_ORDER, CIC_RATE_SHIFT, 2048U);
+    const uint16_t length = (CIC_INPUTS + CIC_ORDER) << CIC_RATE_SHIFT;
+    uint16_t k;
+    for (k = 0; k < length; k ++) {
+        const uint16_t input = k >> CIC_RATE_SHIFT;
+        cicReference[0][k] = 0.0;
+        if ((k & (rate - 1U)) == 0U) {
+            cicReference[0][k] = input < CIC_ORDER ? 2048.0 : (double)codes[input - CIC_ORDER];
+        }
+    }
+    uint16_t stage;
+    for (stage = 0; stage < CIC_ORDER; stage ++) {
+        double *in = cicReference[stage & 1U];
+        double *out = cicReference[(stage & 1U) ^ 1U];
+        double sum = 0.0;
+        for (k = 0; k < length; k ++) {
+            sum += in[k] - (k >= rate ? in[k - rate] : 0.0);
+            out[k] = sum;
+        }
+    }
+    const double *reference = cicReference[CIC_ORDER & 1U];
+    const double gain = (double)(1UL << ((CIC_ORDER - 1U) * CIC_RATE_SHIFT));
+    double error = 0.0;
+    for (n = 0; n < CIC_INPUTS; n ++) {
+        DACDMA_interpolate(&interpolator, codes[n], outputCodes, 1U);
+        for (k = 0; k < rate; k ++) {
+            trackError(&error, outputCodes[k] - reference[((n + CIC_ORDER) << CIC_RATE_SHIFT) + k] / gain);
+        }
+    }
+    printLine("cic.interpolate", ticks, ESTIMATE_CIC, error, 0.5, "codes");
+}
+
+// PWM math: three-phase space-vector duties of the threePhasePWM ISR
+void benchmarkModulator(void) {
+    MOD_Modulator modulator;
+    float ticks;
+    uint16_t n;
+    MOD_init(&modulator, 2.0f * SAMPLE_FREQUENCY, MOD_SPACE_VECTOR);
+    MOD_setFrequency(&modulator, 50.0f);
+    MOD_setIndex(&modulator, 1.1f);
+    TIME_KERNEL(ticks, BLOCK, for (n = 0; n < BLOCK; n ++) { MOD_step(&modulator, &outputCodes[MOD_PHASES * n]); });
+    const double index = modulator.index / (double)MOD_INDEX_ONE;
+    double error = 0.0;
+    uint32_t step;
+    MOD_setFrequency(&modulator, 987.6f);
+    for (step = 0; step < 4096UL; step ++) {
+        const double turn = modulator.angle.phase / 4294967296.0;
+        MOD_step(&modulator, outputCodes);
+        double references[MOD_PHASES];
+        references[0] = index * sin(TWO_PI * turn);
+        references[1] = index * sin(TWO_PI * (turn - 1.0 / 3.0));
+        references[2] = index * sin(TWO_PI * (turn + 1.0 / 3.0));
+        const double largest = fmax(references[0], fmax(references[1], references[2]));
+        const double smallest = fmin(references[0], fmin(references[1], references[2]));
+        uint16_t phase;
+        for (phase = 0; phase < MOD_PHASES; phase ++) {
+            const double duty = 0.5 + 0.5 * (references[phase] - 0.5 * (largest + smallest));
+            trackError(&error, outputCodes[phase] / 32768.0 - duty);
+        }
+    }
+    printLine("mod.spaceVector", ticks, ESTIMATE_MOD, error / Q15_LSB, 4.0, "LSB");
+}
+
+// PWM math: compare value of a duty cycle (setPWMDutyCycle), high time checked in every count mode
+void benchmarkCompareValue(void) {
+    const EPWM_TimeBaseCountMode modes[3] = {EPWM_COUNTER_MODE_UP, EPWM_COUNTER_MODE_DOWN, EPWM_COUNTER_MODE_UP_DOWN};
+    float ticks;
+    uint16_t n;
+    TIME_KERNEL(ticks, BLOCK, for (n = 0; n < BLOCK; n ++) {
+        outputCodes[n] = PWMUPDATE_compareValue(EPWM_COUNTER_MODE_UP_DOWN, 2500U, duties[n]);
+    });
+    double error = 0.0;
+    uint16_t mode;
+    for (mode = 0; mode < 3U; mode ++) {
+        uint16_t period;
+        for (period = 50U; period < 60000U; period = period * 3U + 7U) {
+            for (n = 0; n < BLOCK; n ++) {
+                const uint16_t compare = PWMUPDATE_compareValue(modes[mode], period, duties[n]);
+                // Counts per period and counts the output is high for, from the actions of PWMUPDATE_configureActions
+                double counts = period + 1.0;
+                double high = period + 1.0 - compare;
+                if (modes[mode] == EPWM_COUNTER_MODE_UP_DOWN) {
+                    counts = period;
+                    high = (double)period - compare;
+                } else if (modes[mode] == EPWM_COUNTER_MODE_DOWN) {
+                    high = compare > period ? 0.0 : compare + 1.0;
+                }
+                trackError(&error, high - counts * duties[n] / (double)PWMUPDATE_DUTY_ONE);
+            }
+        }
+    }
+    printLine("pwm.compareValue", ticks, ESTIMATE_COMPARE, error, 1.0, "counts");
+}
+
+// PWM math: full register image of a frequency and duty (background of baseADCPWM)
+// One PWMUPDATE_compute image against the exact period: the smallest prescaler whose TBPRD fits 16 bits, the period
+// in counts of the prescaled clock (half counts up-down), the high time of both compares and the reachable flag.
+// A wrong prescaler or flag counts as a whole 16-bit period off
+double checkComputedPWM(EPWM_TimeBaseCountMode counterMode, uint32_t frequency, uint16_t dutyA, uint16_t dutyB) {
+    PWMUPDATE_Registers registers;
+    const bool reachable = PWMUPDATE_compute(&registers, counterMode, TIMEBASE_FREQUENCY, frequency, dutyA, dutyB);
+    const bool upDown = counterMode == EPWM_COUNTER_MODE_UP_DOWN;
+    // Clock counts per TBPRD count of the period, and the longest period at one prescaler
+    const double scale = upDown ? 2.0 : 1.0;
+    const double longest = upDown ? 65535.0 : 65536.0;
+    uint16_t divider = 0U;
+    while (divider < 7U && floor((double)TIMEBASE_FREQUENCY / (1UL << divider) / frequency / scale + 0.5) > longest) {
+        divider ++;
+    }
+    const double exact = (double)TIMEBASE_FREQUENCY / (1UL << divider) / frequency / scale;
+    const double rounded = floor(exact + 0.5);
+    const bool fits = rounded <= longest && rounded - (upDown ? 0.0 : 1.0) >= 2.0;
+    if (reachable != fits) {
+        return 65536.0;
+    }
+    if (!fits) {
+        return 0.0;
+    }
+    if (registers.clockDivider != (EPWM_ClockDivider)divider || registers.counterMode != counterMode) {
+        return 65536.0;
+    }
+    double error = 0.0;
+    const double counts = upDown ? registers.period : registers.period + 1.0;
+    trackError(&error, counts - exact);
+    const uint16_t compares[2] = {registers.compareA, registers.compareB};
+    const uint16_t duties[2] = {dutyA, dutyB};
+    uint16_t output;
+    for (output = 0; output < 2U; output ++) {
+        // High counts from the actions of PWMUPDATE_configureActions, as in benchmarkCompareValue
+        double high = registers.period + 1.0 - compares[output];
+        if (upDown) {
+            high = (double)registers.period - compares[output];
+        } else if (counterMode == EPWM_COUNTER_MODE_DOWN) {
+            high = compares[output] > registers.period ? 0.0 : compares[output] + 1.0;
+        }
+        trackError(&error, high - counts * duties[output] / (double)PWMUPDATE_DUTY_ONE);
+    }
+    return error;
+}
+
+void benchmarkComputePWM(void) {
+    const EPWM_TimeBaseCountMode modes[3] = {EPWM_COUNTER_MODE_UP, EPWM_COUNTER_MODE_DOWN, EPWM_COUNTER_MODE_UP_DOWN};
+    PWMUPDATE_Registers registers;
+    float ticks;
+    uint16_t n;
+    TIME_KERNEL(ticks, BLOCK, for (n = 0; n < BLOCK; n ++) {
+        PWMUPDATE_compute(&registers, EPWM_COUNTER_MODE_UP_DOWN, TIMEBASE_FREQUENCY, 1000UL + 40UL * n, duties[n], duties[n]);
+        outputCodes[n] = registers.period;
+    });
+    double error = 0.0;
+    uint16_t mode;
+    n = 0U;
+    for (mode = 0; mode < 3U; mode ++) {
+        const double scale = modes[mode] == EPWM_COUNTER_MODE_UP_DOWN ? 2.0 : 1.0;
+        uint32_t frequency;
+        // 200 Hz to 50 kHz, the carriers in use
+        for (frequency = 200UL; frequency <= 50000UL; frequency += 97UL) {
+            trackError(&error, checkComputedPWM(modes[mode], frequency, duties[n % BLOCK], duties[(n + 1U) % BLOCK]));
+            n ++;
+        }
+        // Both sides of every prescaler step, the slowest reachable period and the fastest (TBPRD of 2)
+        uint16_t divider;
+        for (divider = 0; divider < 8U; divider ++) {
+            const uint32_t step = (uint32_t)((double)TIMEBASE_FREQUENCY / (1UL << divider) / scale / 65535.0);
+            for (frequency = step - 2UL; frequency <= step + 2UL; frequency ++) {
+                trackError(&error, checkComputedPWM(modes[mode], frequency, duties[n % BLOCK], 0U));
+                n ++;
+            }
+        }
+        for (frequency = 1UL; frequency < 8UL; frequency ++) {
+            trackError(&error, checkComputedPWM(modes[mode], frequency, PWMUPDATE_DUTY_ONE, 16384U));
+        }
+        const uint32_t fastest = (uint32_t)((double)TIMEBASE_FREQUENCY / scale / 3.0);
+        for (frequency = fastest - 2000000UL; frequency <= fastest + 2000000UL; frequency += 500000UL) {
+            trackError(&error, checkComputedPWM(modes[mode], frequency, 16384U, PWMUPDATE_DUTY_ONE));
+        }
+    }
+    printLine("pwm.compute", ticks, ESTIMATE_COMPUTE, error, 0.5, "counts");
+}
+
+// Buffer handling: ISR push and background pop of the ADC ring, values checked in order across wraps
+void benchmarkRing(void) {
+    RING_Buffer ring;
+    float ticks;
+    uint16_t n;
+    RING_init(&ring, ringStorage, BLOCK);
+    TIME_KERNEL(ticks, BLOCK, for (n = 0; n < BLOCK; n ++) { RING_push(&ring, codes[n]); }
+                RING_pop(&ring, outputCodes, BLOCK));
+    double error = 0.0;
+    uint16_t next = 0U;
+    uint16_t expected = 0U;
+    uint16_t round;
+    for (round = 0; round < 64U; round ++) {
+        // Uneven chunks, so reads and writes straddle the end of the storage
+        const uint16_t pushes = 37U + (round * 53U) % 150U;
+        for (n = 0; n < pushes; n ++) {
+            RING_push(&ring, next ++);
+        }
+        const uint16_t popped = RING_pop(&ring, outputCodes, BLOCK);
+        for (n = 0; n < popped; n ++) {
+            if (outputCodes[n] != expected ++) {
+                error += 1.0;
+            }
+        }
+        error += (double)(pushes - popped);
+    }
+    error += (double)ring.overruns;
+    printLine("ring.pushPop", ticks, ESTIMATE_RING, error, 0.0, "values");
+}
+
+// Buffer handling: ADC block to Q15, exact
+void benchmarkAdcToQ15(void) {
+    float ticks;
+    uint16_t n;
+    TIME_KERNEL(ticks, BLOCK, FILTER_adcToQ15(codes, outputQ15, BLOCK, 2048U));
+    double error = 0.0;
+    for (n = 0; n < BLOCK; n ++) {
+        trackError(&error, outputQ15[n] - ((double)codes[n] - 2048.0) * 16.0);
+    }
+    printLine("filter.adcToQ15", ticks, ESTIMATE_ADC_TO_Q15, error, 0.0, "LSB");
+}
+
+// Filtering: FIR against the convolution in double with the same (quantised) coefficients
+double firReference(const int16_t *input, uint16_t n) {
+    double sum = 0.0;
+    uint16_t k;
+    for (k = 0; k < FIR_TAPS && k <= n; k ++) {
+        sum += coefficientsF32[k] * (double)input[n - k];
+    }
+    return sum;
+}
+
+void benchmarkFIR(void) {
+    FILTER_FIRQ15 firQ15;
+    FILTER_FIRQ31 firQ31;
+    FILTER_FIRF32 firF32;
+    FILTER_DecimatorQ15 decimator;
+    float ticks;
+    uint16_t n;
+    FILTER_initFIRQ15(&firQ15, coefficientsQ15, stateQ15, FIR_TAPS);
+    TIME_KERNEL(ticks, BLOCK, FILTER_runFIRQ15(&firQ15, signalQ15, outputQ15, BLOCK));
+    FILTER_initFIRQ15(&firQ15, coefficientsQ15, stateQ15, FIR_TAPS);
+    FILTER_runFIRQ15(&firQ15, signalQ15, outputQ15, BLOCK);
+    double error = 0.0;
+    for (n = 0; n < BLOCK; n ++) {
+        trackError(&error, outputQ15[n] - firReference(signalQ15, n));
+    }
+    printLine("fir.q15", ticks, ESTIMATE_FIR_Q15, error, 0.5, "LSB");
+
+    FILTER_initFIRF32(&firF32, coefficientsF32, stateF32, FIR_TAPS);
+    TIME_KERNEL(ticks, BLOCK, FILTER_runFIRF32(&firF32, signalF32, outputF32, BLOCK));
+    FILTER_initFIRF32(&firF32, coefficientsF32, stateF32, FIR_TAPS);
+    FILTER_runFIRF32(&firF32, signalF32, outputF32, BLOCK);
+    error = 0.0;
+    for (n = 0; n < BLOCK; n ++) {
+        // signalF32 is signalQ15 in per unit
+        trackError(&error, outputF32[n] - firReference(signalQ15, n) * Q15_LSB);
+    }
+    printLine("fir.f32", ticks, ESTIMATE_FIR_F32, error / F32_LSB, 16.0, "LSB");
+
+    // Q15 taps and signal widened to Q31, so the same reference holds; the output is floored, under 1 LSB
+    FILTER_initFIRQ31(&firQ31, coefficientsQ31, stateQ31, FIR_TAPS);
+    TIME_KERNEL(ticks, BLOCK, FILTER_runFIRQ31(&firQ31, signalQ31, outputQ31, BLOCK));
+    FILTER_initFIRQ31(&firQ31, coefficientsQ31, stateQ31, FIR_TAPS);
+    FILTER_runFIRQ31(&firQ31, signalQ31, outputQ31, BLOCK);
+    error = 0.0;
+    for (n = 0; n < BLOCK; n ++) {
+        trackError(&error, outputQ31[n] - firReference(signalQ15, n) * 65536.0);
+    }
+    printLine("fir.q31", ticks, ESTIMATE_FIR_Q31, error, 1.0, "LSB");
+
+    // Per input sample; an output after every DECIMATION inputs, the last of them included
+    FILTER_initDecimatorQ15(&decimator, coefficientsQ15, stateQ15, FIR_TAPS, DECIMATION);
+    TIME_KERNEL(ticks, BLOCK, FILTER_runDecimatorQ15(&decimator, signalQ15, outputQ15, BLOCK));
+    FILTER_initDecimatorQ15(&decimator, coefficientsQ15, stateQ15, FIR_TAPS, DECIMATION);
+    const uint16_t produced = FILTER_runDecimatorQ15(&decimator, signalQ15, outputQ15, BLOCK);
+    error = produced == BLOCK / DECIMATION ? 0.0 : 32768.0;
+    for (n = 0; n < produced; n ++) {
+        trackError(&error, outputQ15[n] - firReference(signalQ15, n * DECIMATION + DECIMATION - 1U));
+    }
+    printLine("decimator.q15", ticks, ESTIMATE_DECIMATOR, error, 0.5, "LSB");
+}
+
+// Filtering: biquad cascades against direct form I in double with the same coefficients
+void benchmarkBiquad(void) {
+    FILTER_BiquadQ31 filterQ31;
+    FILTER_BiquadF32 filterF32;
+    double state[4U * BIQUAD_STAGES];
+    float ticks;
+    uint16_t n;
+    uint16_t k;
+    FILTER_initBiquadQ31(&filterQ31, biquadQ31, biquadStateQ31, BIQUAD_STAGES);
+    TIME_KERNEL(ticks, BLOCK, FILTER_runBiquadQ31(&filterQ31, signalQ31, outputQ31, BLOCK));
+    FILTER_initBiquadQ31(&filterQ31, biquadQ31, biquadStateQ31, BIQUAD_STAGES);
+    FILTER_runBiquadQ31(&filterQ31, signalQ31, outputQ31, BLOCK);
+    FILTER_initBiquadF32(&filterF32, biquadF32, biquadStateF32, BIQUAD_STAGES);
+    FILTER_runBiquadF32(&filterF32, signalF32, outputF32, BLOCK);
+    for (k = 0; k < 4U * BIQUAD_STAGES; k ++) {
+        state[k] = 0.0;
+    }
+    double errorQ31 = 0.0;
+    double errorF32 = 0.0;
+    for (n = 0; n < BLOCK; n ++) {
+        double value = signalQ31[n] * Q31_LSB;
+        uint16_t stage;
+        for (stage = 0; stage < BIQUAD_STAGES; stage ++) {
+            const int32_t *coefficients = &biquadQ31[5U * stage];
+            double *x = &state[4U * stage];
+            const double y = (coefficients[0] * value + coefficients[1] * x[0] + coefficients[2] * x[1]
+                              + coefficients[3] * x[2] + coefficients[4] * x[3]) / 1073741824.0;
+            x[1] = x[0];
+            x[0] = value;
+            x[3] = x[2];
+            x[2] = y;
+            value = y;
+        }
+        trackError(&errorQ31, outputQ31[n] * Q31_LSB - value);
+        trackError(&errorF32, outputF32[n] - value);
+    }
+    printLine("biquad.q31", ticks, ESTIMATE_BIQUAD_Q31, errorQ31 / Q31_LSB, 64.0, "LSB");
+    FILTER_initBiquadF32(&filterF32, biquadF32, biquadStateF32, BIQUAD_STAGES);
+    TIME_KERNEL(ticks, BLOCK, FILTER_runBiquadF32(&filterF32, signalF32, outputF32, BLOCK));
+    printLine("biquad.f32", ticks, ESTIMATE_BIQUAD_F32, errorF32 / F32_LSB, 64.0, "LSB");
+}
+
+// Filtering: every filter kernel on its golden vectors, returns the samples that differ
+uint16_t runFilterVectors(void) {
+    FILTER_FIRQ15 firQ15;
+    FILTER_FIRQ31 firQ31;
+    FILTER_DecimatorQ15 decimator;
+    FILTER_BiquadQ31 biquad;
+    int16_t state[2U * VECTOR_FIR_TAPS];
+    int32_t stateQ31[2U * VECTOR_Q31_TAPS];
+    int32_t stateBiquad[4U * VECTOR_BIQUAD_STAGES];
+    int16_t output[VECTOR_FIR_LENGTH];
+    int32_t outputQ31[VECTOR_BIQUAD_LENGTH];
+    uint16_t mismatches = 0U;
+    uint16_t n;
+    FILTER_initFIRQ15(&firQ15, vectorFIRCoefficients, state, VECTOR_FIR_TAPS);
+    FILTER_runFIRQ15(&firQ15, vectorFIRInput, output, VECTOR_FIR_SPLIT);
+    FILTER_runFIRQ15(&firQ15, vectorFIRInput + VECTOR_FIR_SPLIT, output + VECTOR_FIR_SPLIT,
+                     VECTOR_FIR_LENGTH - VECTOR_FIR_SPLIT);
+    for (n = 0; n < VECTOR_FIR_LENGTH; n ++) {
+        mismatches += output[n] != vectorFIROutput[n];
+    }
+    FILTER_initDecimatorQ15(&decimator, vectorFIRCoefficients, state, VECTOR_FIR_TAPS, VECTOR_DECIMATION);
+    uint16_t produced = FILTER_runDecimatorQ15(&decimator, vectorFIRInput, output, VECTOR_DECIMATOR_SPLIT);
+    produced += FILTER_runDecimatorQ15(&decimator, vectorFIRInput + VECTOR_DECIMATOR_SPLIT, output + produced,
+                                       VECTOR_FIR_LENGTH - VECTOR_DECIMATOR_SPLIT);
+    if (produced != VECTOR_FIR_LENGTH / VECTOR_DECIMATION) {
+        mismatches += VECTOR_FIR_LENGTH / VECTOR_DECIMATION;
+        produced = 0U;
+    }
+    for (n = 0; n < produced; n ++) {
+        mismatches += output[n] != vectorDecimatorOutput[n];
+    }
+    FILTER_initFIRQ31(&firQ31, vectorQ31Coefficients, stateQ31, VECTOR_Q31_TAPS);
+    FILTER_runFIRQ31(&firQ31, vectorQ31Input, outputQ31, VECTOR_Q31_LENGTH);
+    for (n = 0; n < VECTOR_Q31_LENGTH; n ++) {
+        mismatches += outputQ31[n] != vectorQ31Output[n];
+    }
+    FILTER_initBiquadQ31(&biquad, vectorBiquadCoefficients, stateBiquad, VECTOR_BIQUAD_STAGES);
+    FILTER_runBiquadQ31(&biquad, vectorBiquadInput, outputQ31, VECTOR_BIQUAD_LENGTH);
+    for (n = 0; n < VECTOR_BIQUAD_LENGTH; n ++) {
+        mismatches += outputQ31[n] != vectorBiquadOutput[n];
+    }
+    FILTER_adcToQ15(vectorADCInput, output, VECTOR_ADC_LENGTH, 2048U);
+    for (n = 0; n < VECTOR_ADC_LENGTH; n ++) {
+        mismatches += output[n] != vectorADCOutput[n];
+    }
+    return mismatches;
+}
+
+void benchmarkFilterVectors(void) {
+    float ticks;
+    uint16_t mismatches = 0U;
+    TIME_KERNEL(ticks, VECTOR_SAMPLES, mismatches = runFilterVectors());
+    printLine("filter.vectors", ticks, ESTIMATE_VECTORS, mismatches, 0.0, "samples off");
+}
+
+// Filtering: PI step of the closed loop, against the same quantised gains in double.
+// The error is biased positive so the integral climbs off the lower limit without reaching the upper one
+void benchmarkPI(void) {
+    CTRL_PI pi;
+    float ticks;
+    uint16_t n;
+    CTRL_initPI(&pi, 0.5f, 100.0f, SAMPLE_FREQUENCY, -32767, 32767);
+    TIME_KERNEL(ticks, BLOCK, for (n = 0; n < BLOCK; n ++) { outputQ15[n] = CTRL_stepPI(&pi, signalQ15[n] >> 3); });
+    CTRL_initPI(&pi, 0.5f, 100.0f, SAMPLE_FREQUENCY, -32767, 32767);
+    const double kp = pi.active.kp / 4096.0;
+    const double ki = pi.active.ki / 32768.0;
+    double integral = pi.minimum;
+    double error = 0.0;
+    uint16_t step;
+    for (step = 0; step < 4U * BLOCK; step ++) {
+        const int16_t input = (int16_t)(3000 + (signalQ15[step % BLOCK] >> 3));
+        integral += ki * input;
+        const double output = kp * input + integral;
+        trackError(&error, CTRL_stepPI(&pi, input) - output);
+    }
+    printLine("ctrl.pi", ticks, ESTIMATE_PI, error, 2.0, "LSB");
+}
+
+// Filtering: PR step at its resonance, against the same quantised coefficients in double
+void benchmarkPR(void) {
+    CTRL_PR pr;
+    float ticks;
+    uint16_t n;
+    CTRL_initPR(&pr, 0.5f, 2.0f, 50.0f, 5.0f, SAMPLE_FREQUENCY, -32767, 32767, 32767);
+    TIME_KERNEL(ticks, BLOCK, for (n = 0; n < BLOCK; n ++) { outputQ15[n] = CTRL_stepPR(&pr, signalQ15[n] >> 3); });
+    CTRL_initPR(&pr, 0.5f, 2.0f, 50.0f, 5.0f, SAMPLE_FREQUENCY, -32767, 32767, 32767);
+    const double kp = pr.active.kp / 4096.0;
+    const double b0 = pr.active.b0 / 536870912.0;
+    const double a1 = pr.active.a1 / 536870912.0;
+    const double a2 = pr.active.a2 / 536870912.0;
+    double errors[2] = {0.0, 0.0};
+    double states[2] = {0.0, 0.0};
+    double error = 0.0;
+    uint16_t step;
+    for (step = 0; step < 8U * BLOCK; step ++) {
+        const int16_t input = (int16_t)(4000.0 * sin(TWO_PI * 50.0 * step / SAMPLE_FREQUENCY));
+        const double state = b0 * (input - errors[1]) - a1 * states[0] - a2 * states[1];
+        errors[1] = errors[0];
+        errors[0] = input;
+        states[1] = states[0];
+        states[0] = state;
+        trackError(&error, CTRL_stepPR(&pr, input) - (kp * input + state));
+    }
+    printLine("ctrl.pr", ticks, ESTIMATE_PR, error, 4.0, "LSB");
+}
+
+// Filtering: power quality analysis of ADCIN14, a 50.3 Hz sine of known amplitude
+void benchmarkPowerQuality(void) {
+    PQ_Analyzer analyzer;
+    PQ_Snapshot snapshot;
+    float ticks;
+    uint16_t n;
+    PQ_init(&analyzer, SAMPLE_FREQUENCY, 50.0f, 200U, 20U);
+    TIME_KERNEL(ticks, BLOCK, for (n = 0; n < BLOCK; n ++) { PQ_update(&analyzer, codes[n]); });
+    PQ_init(&analyzer, SAMPLE_FREQUENCY, 50.0f, 200U, 20U);
+    const double frequency = 50.3;
+    const double amplitude = 1500.0;
+    uint32_t sample;
+    for (sample = 0; sample < 20UL * 200UL; sample ++) {
+        PQ_update(&analyzer, (uint16_t)(2048.5 + amplitude * sin(TWO_PI * frequency * sample / SAMPLE_FREQUENCY)));
+    }
+    PQ_read(&analyzer, &snapshot);
+    double error = 0.0;
+    trackError(&error, snapshot.frequency / frequency - 1.0);
+    trackError(&error, snapshot.acRms / (amplitude / sqrt(2.0)) - 1.0);
+    trackError(&error, snapshot.harmonics[0] / amplitude - 1.0);
+    printLine("pq.update", ticks, ESTIMATE_PQ, 100.0 * error, 0.5, "%");
+}
+
+// Spectrum: real FFT of 256 to 4096 points, per point, the copy of the input included.
+// Reference: the DFT in double of a set of bins (the board has no double-precision FPU), error relative to the peak
+void benchmarkFFT(void) {
+    char name[24];
+    uint16_t points;
+    for (points = SPEC_MIN_POINTS; points <= SPEC_MAX_POINTS; points *= 2U) {
+        float ticks;
+        uint16_t n;
+        for (n = 0; n < points; n ++) {
+            const double time = n / (double)SAMPLE_FREQUENCY;
+            transformInput[n] = (float)(0.5 * sin(TWO_PI * 50.3 * time) + 0.1 * sin(TWO_PI * 1234.5 * time)
+                                        + 0.05 * randomUnit());
+        }
+        TIME_KERNEL(ticks, points, for (n = 0; n < points; n ++) { transform[n] = transformInput[n]; }
+                    SPEC_realFFT(transform, points));
+        double error = 0.0;
+        double peak = 0.0;
+        const uint16_t stride = points / 2U / FFT_CHECKED_BINS;
+        uint16_t bin;
+        for (bin = 0; bin <= points / 2U; bin += stride) {
+            // Twiddle by rotation, its drift over 4096 points stays far below float resolution
+            const double angle = -TWO_PI * bin / points;
+            const double stepR = cos(angle);
+            const double stepI = sin(angle);
+            double wr = 1.0;
+            double wi = 0.0;
+            double re = 0.0;
+            double im = 0.0;
+            for (n = 0; n < points; n ++) {
+                re += transformInput[n] * wr;
+                im += transformInput[n] * wi;
+                const double next = wr * stepR - wi * stepI;
+                wi = wr * stepI + wi * stepR;
+                wr = next;
+            }
+            // Packed output: DC and Nyquist are real, in the first two places
+            const double outR = bin == 0U ? transform[0] : (bin == points / 2U ? transform[1] : transform[2U * bin]);
+            const double outI = bin == 0U || bin == points / 2U ? 0.0 : transform[2U * bin + 1U];
+            trackError(&error, sqrt((outR - re) * (outR - re) + (outI - im) * (outI - im)));
+            peak = fmax(peak, sqrt(re * re + im * im));
+        }
+        snprintf(name, sizeof(name), "fft.real%u", points);
+        printLine(name, ticks, estimateFFT(points), 1.0e6 * error / peak, 2.0, "ppm of peak");
+    }
+}
+
+// Spectrum: Welch analyzer of baseADCPWM, per ADC sample with the background steps of its segments.
+// Reference: amplitudes and frequencies of three tones, peak amplitude errors in percent
+void benchmarkWelch(void) {
+    SPEC_Analyzer *analyzer = &analyzerWelch;
+    SPEC_Peak peaks[3];
+    float ticks;
+    uint16_t n;
+    SPEC_init(analyzer, "spectrumWelch", SAMPLE_FREQUENCY, WELCH_POINTS, SPEC_WINDOW_HANN, WELCH_AVERAGES, storageWelch, historyWelch);
+    TIME_KERNEL(ticks, BLOCK, SPEC_push(analyzer, codes, BLOCK); for (n = 0; n < WELCH_STEPS; n ++) {
+        SPEC_process(analyzer);
+    });
+    const double frequencies[3] = {50.3, 1234.5, 3210.0};
+    const double amplitudes[3] = {1500.0, 300.0, 30.0};
+    SPEC_init(analyzer, "spectrumWelch", SAMPLE_FREQUENCY, WELCH_POINTS, SPEC_WINDOW_HANN, WELCH_AVERAGES, storageWelch, historyWelch);
+    uint32_t sample = 0UL;
+    uint16_t block;
+    // Two spectra; the last one is checked
+    for (block = 0; block < (WELCH_AVERAGES + 1U) * WELCH_POINTS / BLOCK; block ++) {
+        for (n = 0; n < BLOCK; n ++, sample ++) {
+            double value = 2048.5;
+            uint16_t tone;
+            for (tone = 0; tone < 3U; tone ++) {
+                value += amplitudes[tone] * sin(TWO_PI * frequencies[tone] * sample / SAMPLE_FREQUENCY);
+            }
+            outputCodes[n] = (uint16_t)value;
+        }
+        SPEC_push(analyzer, outputCodes, BLOCK);
+        for (n = 0; n < WELCH_STEPS; n ++) {
+            SPEC_process(analyzer);
+        }
+    }
+    const uint16_t found = SPEC_findPeaks(analyzer, peaks, 3U);
+    double error = found == 3U && analyzer->spectra == 2UL && analyzer->dropped == 0UL ? 0.0 : 100.0;
+    const double bin = SAMPLE_FREQUENCY / (double)WELCH_POINTS;
+    for (n = 0; n < found; n ++) {
+        trackError(&error, 100.0 * (peaks[n].amplitude / amplitudes[n] - 1.0));
+        // A tone more than a tenth of a bin off fails the run
+        if (fabs(peaks[n].frequency - frequencies[n]) > 0.1 * bin) {
+            error = 100.0;
+        }
+    }
+    printLine("spec.welch", ticks, ESTIMATE_WELCH, error, 1.0, "%");
+}
+
+/*------------------------------SETUP------------------------------*/
+
+// Test signals: two tones and noise; windowed-sinc low-pass FIR and a Butterworth biquad cascade, both at fs / 10
+void prepareInputs() {
+    uint16_t n;
+    for (n = 0; n < BLOCK; n ++) {
+        const double time = n / (double)SAMPLE_FREQUENCY;
+        const double value = 0.5 * sin(TWO_PI * 310.0 * time) + 0.25 * sin(TWO_PI * 2270.0 * time) + 0.1 * randomUnit();
+        signalQ15[n] = (int16_t)floor(value * 32768.0 + 0.5);
+        signalF32[n] = (float)(signalQ15[n] * Q15_LSB);
+        signalQ31[n] = (int32_t)signalQ15[n] * 65536L;
+        codes[n] = (uint16_t)(2048 + (signalQ15[n] >> 4));
+        duties[n] = (uint16_t)((randomUnit() + 1.0f) * 0.5f * (float)PWMUPDATE_DUTY_ONE);
+    }
+    const double cutoff = 0.1;
+    double sum = 0.0;
+    double taps[FIR_TAPS];
+    uint16_t k;
+    for (k = 0; k < FIR_TAPS; k ++) {
+        const double centre = k - (FIR_TAPS - 1U) / 2.0;
+        const double window = 0.54 - 0.46 * cos(TWO_PI * k / (FIR_TAPS - 1U));
+        taps[k] = window * (centre == 0.0 ? 2.0 * cutoff : sin(TWO_PI * cutoff * centre) / (0.5 * TWO_PI * centre));
+        sum += taps[k];
+    }
+    for (k = 0; k < FIR_TAPS; k ++) {
+        coefficientsQ15[k] = (int16_t)floor(taps[k] / sum * 32768.0 + 0.5);
+        coefficientsQ31[k] = (int32_t)coefficientsQ15[k] * 65536L;
+        // The reference and the float filter use the quantised values, so only the arithmetic is compared
+        coefficientsF32[k] = (float)(coefficientsQ15[k] * Q15_LSB);
+    }
+    // Bilinear transform, prewarped, sections with Q of the 4th order Butterworth poles
+    const double warp = tan(0.5 * TWO_PI * cutoff);
+    const double qualities[BIQUAD_STAGES] = {0.5411961, 1.3065630};
+    uint16_t stage;
+    for (stage = 0; stage < BIQUAD_STAGES; stage ++) {
+        const double a0 = 1.0 + warp / qualities[stage] + warp * warp;
+        const double section[5] = {
+            warp * warp / a0, 2.0 * warp * warp / a0, warp * warp / a0,
+            -2.0 * (warp * warp - 1.0) / a0, -(1.0 - warp / qualities[stage] + warp * warp) / a0
+        };
+        for (k = 0; k < 5U; k ++) {
+            biquadQ31[5U * stage + k] = (int32_t)floor(section[k] * 1073741824.0 + 0.5);
+            biquadF32[5U * stage + k] = (float)(biquadQ31[5U * stage + k] / 1073741824.0);
+        }
+    }
+}
+
+/*------------------------------MAIN------------------------------*/
+
+void main(void) {
+    /*------------------------------DEVICE------------------------------*/
+    // Device initialisation
+    Device_init();
+    /*------------------------------INTERRUPT------------------------------*/
+    // PIE module initialisation, no interrupts: nothing may preempt the timed loops
+    Interrupt_initModule();
+    Interrupt_initVectorTable();
+    /*------------------------------MODULES------------------------------*/
+    PROF_initTimebase(CPUTIMER1_BASE);
+    prepareInputs();
+    // Results on the CIO console of the debugger
+    printf("kernelBenchmark: per sample at %lu Hz SYSCLK, best of %u runs of %u samples\n",
+           (unsigned long)DEVICE_SYSCLK_FREQ, REPEATS, PASSES * BLOCK);
+    benchmarkDDS();
+    benchmarkWaveFill();
+    benchmarkInterpolator();
+    benchmarkModulator();
+    benchmarkCompareValue();
+    benchmarkComputePWM();
+    benchmarkRing();
+    benchmarkAdcToQ15();
+    benchmarkFIR();
+    benchmarkBiquad();
+    benchmarkFilterVectors();
+    benchmarkPI();
+    benchmarkPR();
+    benchmarkPowerQuality();
+    benchmarkFFT();
+    benchmarkWelch();
+    printf("kernelBenchmark: %u kernels, %u failed\n", kernels, failures);
+    fflush(stdout);
+    while (1) {
+    }
+}
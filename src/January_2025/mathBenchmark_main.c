@@ -0,0 +1,339 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "debug.h"
+#include "device.h"
+#include "inc/hw_types.h"
+#include "interrupt.h"
+#include "cpu.h"
+#include "cputimer.h"
+#include "inc/hw_memmap.h" // Bases
+#include "machine/_types.h"
+#include "sysctl.h"
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "isrProfiler.h"
+#include "report.h"
+#include "typedMath.h"
+
+/*------------------------------GLOBAL VARIABLES AND MACROS------------------------------*/
+
+// Cost and accuracy of every typedMath back end, with the double library as the reference it replaces.
+// Cost: SYSCLK ticks per call on the free-running CPU timer 1, loop included. Accuracy: error against double over
+// sweeps of the inputs, in LSBs of the format (float: 2^-24, one LSB of a full-scale value), checked against a
+// limit per operation and format. The cost is only reported: the host has the double hardware the C28x lacks
+#define POINTS 256U // Timed inputs per operation
+#define PASSES 16U // Timed passes over them, the host runs a call in a fraction of a tick
+#define SWEEP 4096U // Accuracy inputs per operation
+#define IQ24_RANGE 8.0f // IQ24 inputs, +-IQ24_RANGE
+#define MAC_LENGTH 16U // Products per checked sum, inputs within +-MAC_INPUT so the sum stays in range
+#define MAC_INPUT 0.24f
+
+// Error limits, LSBs
+#define LIMIT_ROUNDED 0.5 // Correctly rounded: mul, the sat after a mac, sqrt
+#define LIMIT_SLACK 1e-6 // Of the double reference itself
+#define LIMIT_TABLE 4.0 // Q15 sin, interpolated DDS table
+#define LIMIT_SPARE 1.0 // IQ24 sin and atan2, Q15 atan2: the 30-bit series and CORDIC have bits to spare
+#define LIMIT_SERIES 16.0 // Q31 sin and atan2: the series and the CORDIC keep fewer bits than the format
+#define LIMIT_FLOAT 16.0 // F32 sin: the argument in turns is itself rounded to 2^-24
+#define LIMIT_FLOAT_ATAN2 4.0 // F32 atan2
+
+#define TWO_PI 6.283185307179586
+
+typedef struct {
+    double maximum; // Absolute, in LSBs
+    double squares;
+    uint32_t count;
+} ErrorStatistics;
+
+// Inputs in [-1, 1) (sqrt: [0, 1)) in every format, IQ24 scaled by IQ24_RANGE
+float inputsA[POINTS];
+float inputsB[POINTS];
+MATH_Q15 inputsQ15A[POINTS];
+MATH_Q15 inputsQ15B[POINTS];
+MATH_Q31 inputsQ31A[POINTS];
+MATH_Q31 inputsQ31B[POINTS];
+MATH_IQ24 inputsIQ24A[POINTS];
+MATH_IQ24 inputsIQ24B[POINTS];
+
+// Results go here, so the timed calls are not optimised away
+volatile int32_t sinkInteger;
+volatile float sinkFloat;
+volatile double sinkDouble;
+
+uint32_t randomState = 12345UL;
+
+// Accuracy lines, and those over their limit; one verdict at the end, so a run cut short has none
+uint16_t checkedLines;
+uint16_t failedLines;
+
+/*------------------------------HELPERS------------------------------*/
+
+// Linear congruential generator, uniform in [-1, 1)
+float randomUnit(void) {
+    randomState = randomState * 1664525UL + 22695477UL;
+    return (float)(int32_t)randomState * (1.0f / 2147483648.0f);
+}
+
+void addError(ErrorStatistics *statistics, double error, double lsb) {
+    const double lsbs = fabs(error) / lsb;
+    if (lsbs > statistics->maximum) {
+        statistics->maximum = lsbs;
+    }
+    statistics->squares += lsbs * lsbs;
+    statistics->count ++;
+}
+
+// Angle error on the circle, in turns
+double wrapTurn(double error) {
+    return error - floor(error + 0.5);
+}
+
+// Cost, and the error with its verdict when statistics is not 0
+void printLine(const char *operation, const char *format, float ticks, const ErrorStatistics *statistics, double limit) {
+    if (statistics == 0) {
+        printf("%-6s %-6s %8.2f ticks\n", operation, format, ticks);
+        return;
+    }
+    const bool passed = statistics->count > 0UL && statistics->maximum <= limit + LIMIT_SLACK;
+    checkedLines ++;
+    if (!passed) {
+        failedLines ++;
+    }
+    printf("%-6s %-6s %8.2f ticks, error max %.2f rms %.2f LSB (limit %.1f) %s\n", operation, format, ticks,
+           statistics->maximum, sqrt(statistics->squares / (double)statistics->count), limit, passed ? "ok" : "FAIL");
+}
+
+/*------------------------------BENCHMARKS------------------------------*/
+
+// Ticks per call of statement over the POINTS inputs
+#define TIME_LOOP(ticks, statement) \
+    do { \
+        const uint32_t start = PROF_now(); \
+        uint16_t pass; \
+        for (pass = 0; pass < PASSES; pass ++) { \
+            for (point = 0; point < POINTS; point ++) { \
+                statement; \
+            } \
+        } \
+        ticks = (float)(PROF_now() - start) / (float)(PASSES * POINTS); \
+    } while (0)
+
+void benchmarkMul(void) {
+    ErrorStatistics errors[4] = {{0}};
+    float ticks[5];
+    uint16_t point;
+    MATH_AccQ15 accumulatorQ15 = 0L;
+    MATH_AccQ31 accumulatorQ31 = 0;
+    MATH_AccIQ24 accumulatorIQ24 = 0;
+    MATH_AccF32 accumulatorF32 = 0.0f;
+    double accumulatorDouble = 0.0;
+    TIME_LOOP(ticks[0], sinkInteger = MATH_mulQ15(inputsQ15A[point], inputsQ15B[point]));
+    TIME_LOOP(ticks[1], sinkInteger = MATH_mulQ31(inputsQ31A[point], inputsQ31B[point]));
+    TIME_LOOP(ticks[2], sinkInteger = MATH_mulIQ24(inputsIQ24A[point], inputsIQ24B[point]));
+    TIME_LOOP(ticks[3], sinkFloat = MATH_mulF32(inputsA[point], inputsB[point]));
+    TIME_LOOP(ticks[4], sinkDouble = (double)inputsA[point] * (double)inputsB[point]);
+    uint32_t index;
+    for (index = 0; index < SWEEP; index ++) {
+        const float a = randomUnit();
+        const float b = randomUnit();
+        const MATH_Q15 aQ15 = MATH_fromFloatQ15(a), bQ15 = MATH_fromFloatQ15(b);
+        const MATH_Q31 aQ31 = MATH_fromFloatQ31(a), bQ31 = MATH_fromFloatQ31(b);
+        const MATH_IQ24 aIQ24 = MATH_fromFloatIQ24(a * IQ24_RANGE), bIQ24 = MATH_fromFloatIQ24(b * IQ24_RANGE);
+        // Exact products of the quantised inputs: only the error of the operation itself
+        addError(&errors[0], MATH_mulQ15(aQ15, bQ15) / 32768.0 - (aQ15 / 32768.0) * (bQ15 / 32768.0), 1.0 / 32768.0);
+        addError(&errors[1], MATH_mulQ31(aQ31, bQ31) / 2147483648.0 - (aQ31 / 2147483648.0) * (bQ31 / 2147483648.0),
+                 1.0 / 2147483648.0);
+        addError(&errors[2], MATH_mulIQ24(aIQ24, bIQ24) / 16777216.0 - (aIQ24 / 16777216.0) * (bIQ24 / 16777216.0),
+                 1.0 / 16777216.0);
+        addError(&errors[3], (double)MATH_mulF32(a, b) - (double)a * (double)b, 1.0 / 16777216.0);
+    }
+    printLine("mul", "Q15", ticks[0], &errors[0], LIMIT_ROUNDED);
+    printLine("mul", "Q31", ticks[1], &errors[1], LIMIT_ROUNDED);
+    printLine("mul", "IQ24", ticks[2], &errors[2], LIMIT_ROUNDED);
+    printLine("mul", "F32", ticks[3], &errors[3], LIMIT_ROUNDED);
+    printLine("mul", "double", ticks[4], 0, 0.0);
+    TIME_LOOP(ticks[0], accumulatorQ15 = MATH_macQ15(accumulatorQ15, inputsQ15A[point], inputsQ15B[point]));
+    TIME_LOOP(ticks[1], accumulatorQ31 = MATH_macQ31(accumulatorQ31, inputsQ31A[point], inputsQ31B[point]));
+    TIME_LOOP(ticks[2], accumulatorIQ24 = MATH_macIQ24(accumulatorIQ24, inputsIQ24A[point], inputsIQ24B[point]));
+    TIME_LOOP(ticks[3], accumulatorF32 = MATH_macF32(accumulatorF32, inputsA[point], inputsB[point]));
+    TIME_LOOP(ticks[4], accumulatorDouble += (double)inputsA[point] * (double)inputsB[point]);
+    sinkInteger = MATH_satQ15(accumulatorQ15) + MATH_satQ31(accumulatorQ31) + MATH_satIQ24(accumulatorIQ24);
+    sinkFloat = MATH_satF32(accumulatorF32);
+    sinkDouble = accumulatorDouble;
+    // Fixed point is exact until the sat, float rounds every sum
+    ErrorStatistics macErrors[4] = {{0}};
+    for (index = 0; index < SWEEP; index ++) {
+        MATH_AccQ15 sumQ15 = 0L;
+        MATH_AccQ31 sumQ31 = 0;
+        MATH_AccIQ24 sumIQ24 = 0;
+        MATH_AccF32 sumF32 = 0.0f;
+        double exact[4] = {0.0, 0.0, 0.0, 0.0};
+        uint16_t term;
+        for (term = 0; term < MAC_LENGTH; term ++) {
+            const float a = MAC_INPUT * randomUnit();
+            const float b = MAC_INPUT * randomUnit();
+            const MATH_Q15 aQ15 = MATH_fromFloatQ15(a), bQ15 = MATH_fromFloatQ15(b);
+            const MATH_Q31 aQ31 = MATH_fromFloatQ31(a), bQ31 = MATH_fromFloatQ31(b);
+            const MATH_IQ24 aIQ24 = MATH_fromFloatIQ24(a * IQ24_RANGE), bIQ24 = MATH_fromFloatIQ24(b * IQ24_RANGE);
+            sumQ15 = MATH_macQ15(sumQ15, aQ15, bQ15);
+            sumQ31 = MATH_macQ31(sumQ31, aQ31, bQ31);
+            sumIQ24 = MATH_macIQ24(sumIQ24, aIQ24, bIQ24);
+            sumF32 = MATH_macF32(sumF32, a, b);
+            exact[0] += (aQ15 / 32768.0) * (bQ15 / 32768.0);
+            exact[1] += (aQ31 / 2147483648.0) * (bQ31 / 2147483648.0);
+            exact[2] += (aIQ24 / 16777216.0) * (bIQ24 / 16777216.0);
+            exact[3] += (double)a * (double)b;
+        }
+        addError(&macErrors[0], MATH_satQ15(sumQ15) / 32768.0 - exact[0], 1.0 / 32768.0);
+        addError(&macErrors[1], MATH_satQ31(sumQ31) / 2147483648.0 - exact[1], 1.0 / 2147483648.0);
+        addError(&macErrors[2], MATH_satIQ24(sumIQ24) / 16777216.0 - exact[2], 1.0 / 16777216.0);
+        addError(&macErrors[3], (double)MATH_satF32(sumF32) - exact[3], 1.0 / 16777216.0);
+    }
+    printLine("mac", "Q15", ticks[0], &macErrors[0], LIMIT_ROUNDED);
+    printLine("mac", "Q31", ticks[1], &macErrors[1], LIMIT_ROUNDED);
+    printLine("mac", "IQ24", ticks[2], &macErrors[2], LIMIT_ROUNDED);
+    // One rounding per sum, each within half an LSB of the partial sum's exponent
+    printLine("mac", "F32", ticks[3], &macErrors[3], 0.5 * MAC_LENGTH);
+    printLine("mac", "double", ticks[4], 0, 0.0);
+}
+
+void benchmarkSin(void) {
+    ErrorStatistics errors[4] = {{0}};
+    float ticks[5];
+    uint16_t point;
+    TIME_LOOP(ticks[0], sinkInteger = MATH_sinQ15(inputsQ15A[point]));
+    TIME_LOOP(ticks[1], sinkInteger = MATH_sinQ31(inputsQ31A[point]));
+    TIME_LOOP(ticks[2], sinkInteger = MATH_sinIQ24(inputsIQ24A[point]));
+    TIME_LOOP(ticks[3], sinkFloat = MATH_sinF32(inputsA[point]));
+    TIME_LOOP(ticks[4], sinkDouble = sin(TWO_PI * (double)inputsA[point]));
+    uint32_t index;
+    for (index = 0; index < SWEEP; index ++) {
+        // Odd steps, so every table segment and quadrant boundary is crossed at a different point
+        const float angle = (float)(index * 2UL + 1UL) / (float)(2UL * SWEEP) - 0.5f;
+        const MATH_Q15 angleQ15 = MATH_fromFloatQ15(angle);
+        const MATH_Q31 angleQ31 = MATH_fromFloatQ31(angle);
+        const MATH_IQ24 angleIQ24 = MATH_fromFloatIQ24(angle);
+        addError(&errors[0], MATH_sinQ15(angleQ15) / 32768.0 - sin(TWO_PI * angleQ15 / 32768.0), 1.0 / 32768.0);
+        addError(&errors[1], MATH_sinQ31(angleQ31) / 2147483648.0 - sin(TWO_PI * angleQ31 / 2147483648.0), 1.0 / 2147483648.0);
+        addError(&errors[2], MATH_sinIQ24(angleIQ24) / 16777216.0 - sin(TWO_PI * angleIQ24 / 16777216.0), 1.0 / 16777216.0);
+        addError(&errors[3], (double)MATH_sinF32(angle) - sin(TWO_PI * angle), 1.0 / 16777216.0);
+    }
+    printLine("sin", "Q15", ticks[0], &errors[0], LIMIT_TABLE);
+    printLine("sin", "Q31", ticks[1], &errors[1], LIMIT_SERIES);
+    printLine("sin", "IQ24", ticks[2], &errors[2], LIMIT_SPARE);
+    printLine("sin", "F32", ticks[3], &errors[3], LIMIT_FLOAT);
+    printLine("sin", "double", ticks[4], 0, 0.0);
+}
+
+void benchmarkSqrt(void) {
+    ErrorStatistics errors[4] = {{0}};
+    float ticks[5];
+    uint16_t point;
+    // Inputs B are folded to [0, 1) here
+    TIME_LOOP(ticks[0], sinkInteger = MATH_sqrtQ15(inputsQ15B[point] & 0x7FFF));
+    TIME_LOOP(ticks[1], sinkInteger = MATH_sqrtQ31(inputsQ31B[point] & 0x7FFFFFFFL));
+    TIME_LOOP(ticks[2], sinkInteger = MATH_sqrtIQ24(inputsIQ24B[point] & 0x7FFFFFFFL));
+    TIME_LOOP(ticks[3], sinkFloat = MATH_sqrtF32(fabsf(inputsB[point])));
+    TIME_LOOP(ticks[4], sinkDouble = sqrt(fabs((double)inputsB[point])));
+    uint32_t index;
+    for (index = 0; index < SWEEP; index ++) {
+        const float value = (float)(index * 2UL + 1UL) / (float)(2UL * SWEEP);
+        const MATH_Q15 valueQ15 = MATH_fromFloatQ15(value);
+        const MATH_Q31 valueQ31 = MATH_fromFloatQ31(value);
+        const MATH_IQ24 valueIQ24 = MATH_fromFloatIQ24(value * IQ24_RANGE);
+        addError(&errors[0], MATH_sqrtQ15(valueQ15) / 32768.0 - sqrt(valueQ15 / 32768.0), 1.0 / 32768.0);
+        addError(&errors[1], MATH_sqrtQ31(valueQ31) / 2147483648.0 - sqrt(valueQ31 / 2147483648.0), 1.0 / 2147483648.0);
+        addError(&errors[2], MATH_sqrtIQ24(valueIQ24) / 16777216.0 - sqrt(valueIQ24 / 16777216.0), 1.0 / 16777216.0);
+        addError(&errors[3], (double)MATH_sqrtF32(value) - sqrt((double)value), 1.0 / 16777216.0);
+    }
+    printLine("sqrt", "Q15", ticks[0], &errors[0], LIMIT_ROUNDED);
+    printLine("sqrt", "Q31", ticks[1], &errors[1], LIMIT_ROUNDED);
+    printLine("sqrt", "IQ24", ticks[2], &errors[2], LIMIT_ROUNDED);
+    printLine("sqrt", "F32", ticks[3], &errors[3], LIMIT_ROUNDED);
+    printLine("sqrt", "double", ticks[4], 0, 0.0);
+}
+
+void benchmarkAtan2(void) {
+    ErrorStatistics errors[4] = {{0}};
+    float ticks[5];
+    uint16_t point;
+    TIME_LOOP(ticks[0], sinkInteger = MATH_atan2Q15(inputsQ15A[point], inputsQ15B[point]));
+    TIME_LOOP(ticks[1], sinkInteger = MATH_atan2Q31(inputsQ31A[point], inputsQ31B[point]));
+    TIME_LOOP(ticks[2], sinkInteger = MATH_atan2IQ24(inputsIQ24A[point], inputsIQ24B[point]));
+    TIME_LOOP(ticks[3], sinkFloat = MATH_atan2F32(inputsA[point], inputsB[point]));
+    TIME_LOOP(ticks[4], sinkDouble = atan2((double)inputsA[point], (double)inputsB[point]) / TWO_PI);
+    uint32_t index;
+    for (index = 0; index < SWEEP; index ++) {
+        // Around the circle, radius from 0.05 to 0.95 of full scale
+        const double angle = (double)(index * 2UL + 1UL) / (double)(2UL * SWEEP);
+        const double radius = 0.05 + 0.9 * (double)((index * 37UL) % SWEEP) / (double)SWEEP;
+        const float y = (float)(radius * sin(TWO_PI * angle));
+        const float x = (float)(radius * cos(TWO_PI * angle));
+        const MATH_Q15 yQ15 = MATH_fromFloatQ15(y), xQ15 = MATH_fromFloatQ15(x);
+        const MATH_Q31 yQ31 = MATH_fromFloatQ31(y), xQ31 = MATH_fromFloatQ31(x);
+        const MATH_IQ24 yIQ24 = MATH_fromFloatIQ24(y * IQ24_RANGE), xIQ24 = MATH_fromFloatIQ24(x * IQ24_RANGE);
+        addError(&errors[0], wrapTurn(MATH_atan2Q15(yQ15, xQ15) / 32768.0 - atan2((double)yQ15, (double)xQ15) / TWO_PI),
+                 1.0 / 32768.0);
+        addError(&errors[1], wrapTurn(MATH_atan2Q31(yQ31, xQ31) / 2147483648.0 - atan2((double)yQ31, (double)xQ31) / TWO_PI),
+                 1.0 / 2147483648.0);
+        addError(&errors[2], wrapTurn(MATH_atan2IQ24(yIQ24, xIQ24) / 16777216.0 - atan2((double)yIQ24, (double)xIQ24) / TWO_PI),
+                 1.0 / 16777216.0);
+        addError(&errors[3], wrapTurn((double)MATH_atan2F32(y, x) - atan2((double)y, (double)x) / TWO_PI), 1.0 / 16777216.0);
+    }
+    printLine("atan2", "Q15", ticks[0], &errors[0], LIMIT_SPARE);
+    printLine("atan2", "Q31", ticks[1], &errors[1], LIMIT_SERIES);
+    printLine("atan2", "IQ24", ticks[2], &errors[2], LIMIT_SPARE);
+    printLine("atan2", "F32", ticks[3], &errors[3], LIMIT_FLOAT_ATAN2);
+    printLine("atan2", "double", ticks[4], 0, 0.0);
+}
+
+/*------------------------------SETUP------------------------------*/
+
+// Same random inputs in every format
+void prepareInputs() {
+    uint16_t point;
+    for (point = 0; point < POINTS; point ++) {
+        inputsA[point] = randomUnit();
+        inputsB[point] = randomUnit();
+        inputsQ15A[point] = MATH_fromFloatQ15(inputsA[point]);
+        inputsQ15B[point] = MATH_fromFloatQ15(inputsB[point]);
+        inputsQ31A[point] = MATH_fromFloatQ31(inputsA[point]);
+        inputsQ31B[point] = MATH_fromFloatQ31(inputsB[point]);
+        inputsIQ24A[point] = MATH_fromFloatIQ24(inputsA[point] * IQ24_RANGE);
+        inputsIQ24B[point] = MATH_fromFloatIQ24(inputsB[point] * IQ24_RANGE);
+    }
+}
+
+/*------------------------------MAIN------------------------------*/
+
+void main(void) {
+    /*------------------------------DEVICE------------------------------*/
+    // Device initialisation
+    Device_init();
+    /*------------------------------INTERRUPT------------------------------*/
+    // PIE module initialisation, no interrupts: nothing may preempt the timed loops
+    Interrupt_initModule();
+    Interrupt_initVectorTable();
+    /*------------------------------MODULES------------------------------*/
+    PROF_initTimebase(CPUTIMER1_BASE);
+    prepareInputs();
+    // Results on the CIO console of the debugger
+    printf("typedMath: ticks per call at %lu Hz, error in LSBs of each format (F32: 2^-24)\n", (unsigned long)DEVICE_SYSCLK_FREQ);
+    benchmarkMul();
+    benchmarkSin();
+    benchmarkSqrt();
+    benchmarkAtan2();
+    const bool passed = REPORT_check(checkedLines > 0U && failedLines == 0U);
+    printf("typedMath: %u of %u within their limits %s\n", checkedLines - failedLines, checkedLines, passed ? "ok" : "FAIL");
+    fflush(stdout);
+    while (1) {
+    }
+}
@@ -0,0 +1,176 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "cpu.h"
+#include "cputimer.h"
+#include "device.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "interrupt.h"
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "report.h"
+#include "ringBuffer.h"
+
+/*------------------------------GLOBAL VARIABLES AND MACROS------------------------------*/
+
+// Stress of the ADC ring: the timer 0 ISR pushes a numbered sequence in bursts, the background pops and peeks
+// it in uneven sizes. Every value must come out once and in order, and every gap must be values the producer
+// counted as overruns. In the host simulation the ISR runs on another host thread, so both sides truly overlap
+// RING_REAL_RATE 1 runs the ADCA1 path of baseADCPWM instead (ADCA_DMA_MODE 0): one value per 10 kHz interrupt
+// into its 512-value ring, drained every millisecond like its acquisition task. There nothing may be lost, and the
+// high-water mark must stay within MAX_HIGH_WATER
+#ifndef RING_REAL_RATE
+#define RING_REAL_RATE 0
+#endif
+
+#if RING_REAL_RATE
+#define RING_LENGTH 512U
+#define BURST_LENGTH 1U
+#define TIMER0_PERIOD 19999UL // 10 kHz, TIMER0_FREQ of baseADCPWM
+#define TOTAL_VALUES 30000UL // 3 s
+#define DRAIN_PERIOD_US 1000U // Acquisition task period
+#define MAX_HIGH_WATER 32U // Three drain periods of values
+#else
+#define RING_LENGTH 64U // Small, so the ring fills and wraps all the time
+#define BURST_LENGTH 7U // Values per interrupt, prime against the ring length
+#define TIMER0_PERIOD 399UL // Interrupts every PRD + 1 SYSCLK ticks, 500 kHz (3.5 M values/s)
+#define TOTAL_VALUES 2000000UL
+#endif
+#define POP_LENGTH 24U // Largest pop, peeks take what is contiguous
+// Values the producer may run ahead of the consumer, so a gap is never ambiguous in 16 bits
+#define MAX_LEAD 0x4000U
+
+uint16_t storageRing[RING_LENGTH];
+RING_Buffer ring;
+
+// Producer, ISR only
+uint16_t nextValue;
+volatile uint32_t produced; // Values offered to the ring, dropped ones included
+volatile uint16_t producing = 1U;
+volatile uint32_t heldOff; // Interrupts skipped MAX_LEAD values ahead of the consumer
+
+// Consumer, background only
+volatile uint16_t expectedValue; // Read by the producer for its lead
+uint32_t overrunsSeen; // Producer overruns already matched with gaps
+uint32_t consumed;
+uint32_t lost; // Values missing from the sequence
+uint32_t outOfOrder; // Repeated or earlier values, and gaps larger than the overruns behind them
+uint16_t poppedValues[POP_LENGTH];
+
+/*------------------------------ISR------------------------------*/
+
+// Timer 0 ISR
+interrupt void timer0_ISR(void) {
+    uint16_t n;
+    if ((uint16_t)(nextValue - expectedValue) >= MAX_LEAD) {
+        heldOff ++;
+    } else {
+        for (n = 0; n < BURST_LENGTH && producing; n ++) {
+            RING_push(&ring, nextValue ++);
+            if (++ produced >= TOTAL_VALUES) {
+                producing = 0U;
+            }
+        }
+    }
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP1);
+}
+
+/*------------------------------BACKGROUND------------------------------*/
+
+// One value out of the ring: the next one expected, or the next after values the ring dropped
+void checkValue(uint16_t value) {
+    const uint16_t gap = (uint16_t)(value - expectedValue);
+    if (gap != 0U) {
+        // Overruns are counted before the push that follows them, so every drop before value is in already.
+        // A stale slot reads as a value RING_LENGTH pushes old, a gap of nearly 2^16 beyond the producer's lead
+        const uint32_t dropped = ring.overruns - overrunsSeen;
+        if (gap > dropped || gap >= MAX_LEAD) {
+            outOfOrder ++;
+        } else {
+            lost += gap;
+            overrunsSeen += gap;
+        }
+    }
+    expectedValue = value + 1U;
+    consumed ++;
+}
+
+// Alternates copies of 1 to POP_LENGTH values with zero-copy spans released in parts
+void consume(uint16_t round) {
+    uint16_t n;
+    if (round & 1U) {
+        const uint16_t count = RING_pop(&ring, poppedValues, (uint16_t)(1U + round % POP_LENGTH));
+        for (n = 0; n < count; n ++) {
+            checkValue(poppedValues[n]);
+        }
+    } else {
+        const uint16_t *span;
+        uint16_t length = RING_peek(&ring, &span);
+        if (length > 1U + round % 5U) {
+            length = (uint16_t)(1U + round % 5U);
+        }
+        for (n = 0; n < length; n ++) {
+            checkValue(span[n]);
+        }
+        RING_release(&ring, length);
+    }
+}
+
+void main(void) {
+    /*------------------------------DEVICE------------------------------*/
+    // Device initialisation
+    Device_init();
+    /*------------------------------INTERRUPT AND TIMER 0------------------------------*/
+    // PIE configuration and initialisation
+    Interrupt_initModule();
+    Interrupt_initVectorTable();
+    RING_init(&ring, storageRing, RING_LENGTH);
+    // Timer 0 configuration, counting SYSCLK
+    CPUTimer_stopTimer(CPUTIMER0_BASE); // Security measure
+    CPUTimer_setPeriod(CPUTIMER0_BASE, TIMER0_PERIOD);
+    CPUTimer_reloadTimerCounter(CPUTIMER0_BASE);
+    CPUTimer_enableInterrupt(CPUTIMER0_BASE);
+    // Interrupt configuration
+    Interrupt_enable(INT_TIMER0);
+    Interrupt_register(INT_TIMER0, &timer0_ISR);
+    // Global and real-time interrupt activation
+    EINT;
+    ERTM;
+    // Timer 0 start
+    CPUTimer_startTimer(CPUTIMER0_BASE);
+    /*------------------------------MAIN LOOP------------------------------*/
+    // Consumes until the producer is done and the ring is empty
+    uint16_t round = 0U;
+    while (producing || RING_count(&ring) > 0U) {
+#if RING_REAL_RATE
+        // Everything pending, then idle until the next release of the task
+        while (RING_count(&ring) > 0U) {
+            consume(round ++);
+        }
+        DEVICE_DELAY_US(DRAIN_PERIOD_US);
+#else
+        consume(round ++);
+#endif
+    }
+    CPUTimer_stopTimer(CPUTIMER0_BASE);
+    // Values dropped after the last one that came out leave no gap behind them
+    lost += (uint16_t)(nextValue - expectedValue);
+    // Every value offered either came out or was counted as an overrun, and the gaps are exactly those overruns
+    bool passed = outOfOrder == 0UL && consumed + ring.overruns == produced && lost == ring.overruns;
+#if RING_REAL_RATE
+    passed = passed && ring.overruns == 0UL && ring.highWater <= MAX_HIGH_WATER;
+#endif
+    REPORT_check(passed);
+    printf("ringStress: produced %lu consumed %lu lost %lu overruns %lu out of order %lu held off %lu high water %u/%u %s\n",
+           (unsigned long)produced, (unsigned long)consumed, (unsigned long)lost, (unsigned long)ring.overruns,
+           (unsigned long)outOfOrder, (unsigned long)heldOff, ring.highWater, RING_LENGTH, passed ? "ok" : "FAIL");
+    fflush(stdout);
+    // Done: on the board the run stops in the exit of the runtime library, in the simulation the run ends
+}
@@ -0,0 +1,340 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "adc.h"
+#include "debug.h"
+#include "gpio.h"
+#include "epwm.h"
+#include "device.h"
+#include "inc/hw_types.h"
+#include "interrupt.h"
+#include "cpu.h"
+#include "cputimer.h"
+#include "inc/hw_memmap.h" // Bases
+#include "inc/hw_ints.h" // Interrupt registers
+#include "machine/_types.h"
+#include "pin_map.h"
+#include "sysctl.h"
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "adcSequence.h"
+#include "isrProfiler.h"
+#include "modulation.h"
+#include "multiPWM.h"
+#include "report.h"
+#include "typedMath.h"
+
+/*------------------------------GLOBAL VARIABLES AND MACROS------------------------------*/
+
+#define HALF_DEVICE_SYSCLK_FREQ (DEVICE_SYSCLK_FREQ / 2)
+
+// Three-phase inverter: EPWM1, 2 and 3 on GPIO 0 to 5, EPWMxA high side, EPWMxB low side
+#define LEGS 3U
+#define CARRIER_FREQ 20000UL // Hz, one compare update per carrier period
+#define CARRIER_PERIOD (DEVICE_SYSCLK_FREQ / CARRIER_FREQ) // SYSCLK ticks
+
+const uint32_t basesPWM[LEGS] = {EPWM1_BASE, EPWM2_BASE, EPWM3_BASE};
+MPWM_Bank inverter;
+MOD_Modulator modulator;
+uint16_t dutiesPWM[LEGS]; // Q15, written by EPWM1_ISR
+
+// Phase currents on ADCINA2, B2 and C2 converted together, DC bus on ADCINA3 after phase A, all at the carrier valley
+#define CURRENTS 3U
+#define SEQUENCE_CHANNELS 4U
+#define SEQUENCE_BLOCK 400U // Samples per channel and block, one 50 Hz cycle at the carrier frequency
+#define CURRENT_OFFSET 2048 // ADC codes at zero current
+
+const ADCSEQ_Channel channelsADC[SEQUENCE_CHANNELS] = {
+    {ADCA_BASE, ADC_CH_ADCIN2, 4U},
+    {ADCB_BASE, ADC_CH_ADCIN2, 4U},
+    {ADCC_BASE, ADC_CH_ADCIN2, 4U},
+    {ADCA_BASE, ADC_CH_ADCIN3, 4U}
+};
+ADCSEQ_Sequencer sequencerADC;
+uint16_t blocksADC[2U * SEQUENCE_CHANNELS * SEQUENCE_BLOCK]; // Two blocks of one array per channel
+float rmsCurrents[CURRENTS]; // ADC codes, last block
+float meanBusVoltage; // ADC codes, last block
+
+// Parameter history
+float lastFrequencyOutput;
+float lastIndexOutput;
+MOD_Mode lastModeOutput;
+float lastDeadTimePWM;
+float lastPhasePWM[LEGS];
+
+// Current parameters (may be changed from the debugger)
+float frequencyOutput = 50.0f; // Electrical frequency in Hz
+float indexOutput = 1.1f; // Phase peak over half the DC bus, up to 1.0 (sine-triangle) or 1.1547 (space vector)
+MOD_Mode modeOutput = MOD_SPACE_VECTOR;
+float deadTimePWM = 1.0e-6f; // Seconds, both edges
+// Carrier phase of each leg behind EPWM1 in degrees: 0 for an inverter, 0/120/240 interleaves the legs
+#ifndef INTERLEAVED_LEGS
+#define INTERLEAVED_LEGS 0
+#endif
+#if INTERLEAVED_LEGS
+float phasePWM[LEGS] = {0.0f, 120.0f, 240.0f};
+#else
+float phasePWM[LEGS] = {0.0f, 0.0f, 0.0f};
+#endif
+
+// Phase check: every leg's counter against EPWM1's once per carrier period, a verdict after each phase change
+#define PHASE_READINGS 1000U // Carrier periods per verdict, 50 ms
+#define PHASE_LIMIT 1.0f // Degrees, about 14 counts
+volatile uint32_t carrierPeriods; // EPWM1 zeros, counted by EPWM1_ISR
+uint32_t phaseChangePeriod; // Carrier period of the last phase change
+uint32_t lastReadingPeriod;
+uint16_t phaseReadings; // Readings towards the verdict, PHASE_READINGS once given
+float phaseErrorPWM[LEGS]; // Degrees, largest of the readings
+
+// Per-tick cost on the free-running CPU timer 1: the whole ISR and the modulation alone
+PROF_Profile profileEPWM1;
+PROF_Profile profileModulation;
+PROF_Profile profileSequence;
+volatile uint16_t dumpProfiles; // Set from the debugger to print the report on the CCS console
+
+/*------------------------------ISR------------------------------*/
+
+// Every carrier period at counter zero: next duties, loaded by the legs at their next zero
+interrupt void EPWM1_ISR() {
+    PROF_enter(&profileEPWM1);
+    PROF_enter(&profileModulation);
+    MOD_step(&modulator, dutiesPWM);
+    PROF_exit(&profileModulation);
+    MPWM_setDuties(&inverter, dutiesPWM);
+    PROF_exit(&profileEPWM1);
+    carrierPeriods ++;
+    EPWM_clearEventTriggerInterruptFlag(EPWM1_BASE);
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP3);
+}
+
+// End of the ADC sequence, a few conversion times after the valley
+interrupt void ADC_SEQUENCE_ISR() {
+    PROF_enter(&profileSequence);
+    ADCSEQ_handleInterrupt(&sequencerADC);
+    PROF_exit(&profileSequence);
+    // ADCx interrupt 1 of every converter is in group 1
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP1);
+}
+
+// Full block, each channel one contiguous array
+void processBlockADC(const uint16_t *block, uint16_t channels, uint16_t length, void *context) {
+    uint16_t phase;
+    for (phase = 0; phase < CURRENTS; phase ++) {
+        const uint16_t *samples = block + phase * length;
+        int32_t sumSquares = 0L; // Up to 2048^2 * 400, fits
+        uint16_t sample;
+        for (sample = 0; sample < length; sample ++) {
+            const int32_t current = (int32_t)samples[sample] - CURRENT_OFFSET;
+            sumSquares += current * current;
+        }
+        rmsCurrents[phase] = MATH_sqrtF32((float)sumSquares / (float)length);
+    }
+    const uint16_t *bus = block + CURRENTS * length;
+    uint32_t sum = 0UL;
+    uint16_t sample;
+    for (sample = 0; sample < length; sample ++) {
+        sum += bus[sample];
+    }
+    meanBusVoltage = (float)sum / (float)length;
+}
+
+/*------------------------------BACKGROUND------------------------------*/
+
+// Profiler report line, CIO console of the debugger
+void printProfileLine(const char *line, void *context) {
+    printf("%s\n", line);
+}
+
+// Parameters changed from the debugger: applied here, the ISR only reads the results
+void updateParameters() {
+    if (modeOutput != lastModeOutput) {
+        MOD_setMode(&modulator, modeOutput);
+        lastModeOutput = modeOutput;
+        // Index range depends on the mode
+        lastIndexOutput = -1.0f;
+    }
+    if (frequencyOutput != lastFrequencyOutput) {
+        MOD_setFrequency(&modulator, frequencyOutput);
+        lastFrequencyOutput = frequencyOutput;
+    }
+    if (indexOutput != lastIndexOutput) {
+        MOD_setIndex(&modulator, indexOutput);
+        lastIndexOutput = indexOutput;
+    }
+    if (deadTimePWM != lastDeadTimePWM) {
+        REPORT_check(MPWM_setDeadTime(&inverter, deadTimePWM));
+        lastDeadTimePWM = deadTimePWM;
+    }
+    uint16_t leg;
+    for (leg = 1; leg < LEGS; leg ++) {
+        if (phasePWM[leg] != lastPhasePWM[leg]) {
+            MPWM_setPhase(&inverter, leg, phasePWM[leg]);
+            lastPhasePWM[leg] = phasePWM[leg];
+            // Measured again from the next sync on
+            phaseChangePeriod = carrierPeriods;
+            phaseReadings = 0U;
+            phaseErrorPWM[leg] = 0.0f;
+        }
+    }
+}
+
+// Counts since the last zero of an up-down carrier, 0 to 2 TBPRD
+uint16_t carrierPosition(uint32_t base) {
+    const uint16_t count = EPWM_getTimeBaseCounterValue(base);
+    if (EPWM_getTimeBaseCounterDirection(base) == EPWM_TIME_BASE_STATUS_COUNT_UP) {
+        return count;
+    }
+    return (uint16_t)(2U * inverter.period - count);
+}
+
+// Lag of every leg behind EPWM1 from the counters against phasePWM; a new phase loads at the next sync,
+// so the period of the change is skipped
+void checkPhases() {
+    const uint32_t period = carrierPeriods;
+    if (phaseReadings >= PHASE_READINGS || period == lastReadingPeriod || period - phaseChangePeriod < 2UL) {
+        return;
+    }
+    lastReadingPeriod = period;
+    uint16_t positions[LEGS];
+    uint16_t leg;
+    // Interrupts masked, so the counters are read a few cycles apart
+    DINT;
+    for (leg = 0; leg < LEGS; leg ++) {
+        positions[leg] = carrierPosition(basesPWM[leg]);
+    }
+    EINT;
+    const uint16_t carrier = 2U * inverter.period;
+    for (leg = 1; leg < LEGS; leg ++) {
+        const uint16_t lag = (uint16_t)((positions[0] + carrier - positions[leg]) % carrier);
+        float error = (float)lag * 360.0f / (float)carrier - phasePWM[leg];
+        while (error >= 180.0f) {
+            error -= 360.0f;
+        }
+        while (error < -180.0f) {
+            error += 360.0f;
+        }
+        if (fabsf(error) > phaseErrorPWM[leg]) {
+            phaseErrorPWM[leg] = fabsf(error);
+        }
+    }
+    if (++ phaseReadings == PHASE_READINGS) {
+        for (leg = 1; leg < LEGS; leg ++) {
+            const bool passed = REPORT_check(phaseErrorPWM[leg] <= PHASE_LIMIT);
+            printf("EPWM%u phase %.1f deg behind EPWM1, error max %.2f deg over %u carrier periods (limit %.1f) %s\n",
+                   leg + 1U, phasePWM[leg], phaseErrorPWM[leg], PHASE_READINGS, PHASE_LIMIT, passed ? "ok" : "FAIL");
+        }
+    }
+}
+
+/*------------------------------SETUP------------------------------*/
+
+// GPIO 0 to 5 (pins 40, 39, 38, 37, 36, 35) as EPWM1A/B, EPWM2A/B and EPWM3A/B
+void configureGPIO() {
+    const uint32_t pinConfigs[2 * LEGS] = {
+        GPIO_0_EPWM1A, GPIO_1_EPWM1B, GPIO_2_EPWM2A, GPIO_3_EPWM2B, GPIO_4_EPWM3A, GPIO_5_EPWM3B
+    };
+    uint16_t pin;
+    for (pin = 0; pin < 2U * LEGS; pin ++) {
+        GPIO_setPinConfig(pinConfigs[pin]);
+        GPIO_setPadConfig(pin, GPIO_PIN_TYPE_STD);
+        GPIO_setDirectionMode(pin, GPIO_DIR_MODE_OUT);
+    }
+}
+
+// EPWM1 master, EPWM2 and 3 synchronised to it; interrupt at every EPWM1 counter zero
+void configureEPWM() {
+    // EPWM clock frequency is HALF_DEVICE_SYSCLK_FREQ by default (100 MHz)
+    // Carrier and dead time reached as asked, not clamped
+    REPORT_check(MPWM_init(&inverter, basesPWM, LEGS, HALF_DEVICE_SYSCLK_FREQ, CARRIER_FREQ, deadTimePWM));
+    lastDeadTimePWM = deadTimePWM;
+    uint16_t leg;
+    for (leg = 1; leg < LEGS; leg ++) {
+        MPWM_setPhase(&inverter, leg, phasePWM[leg]);
+        lastPhasePWM[leg] = phasePWM[leg];
+    }
+    // Modulator stepped once per carrier period
+    MOD_init(&modulator, (float)CARRIER_FREQ, modeOutput);
+    lastModeOutput = modeOutput;
+    MOD_setFrequency(&modulator, frequencyOutput);
+    lastFrequencyOutput = frequencyOutput;
+    MOD_setIndex(&modulator, indexOutput);
+    lastIndexOutput = indexOutput;
+    // Event-trigger submodule
+    EPWM_setInterruptSource(EPWM1_BASE, EPWM_INT_TBCTR_ZERO);
+    EPWM_setInterruptEventCount(EPWM1_BASE, 1U);
+    EPWM_enableInterrupt(EPWM1_BASE);
+    Interrupt_register(INT_EPWM1, &EPWM1_ISR);
+    Interrupt_enable(INT_EPWM1);
+    // Configuration done, EPWM clocks enabled, then all counters started together
+    SysCtl_enablePeripheral(SYSCTL_PERIPH_CLK_EPWM1);
+    SysCtl_enablePeripheral(SYSCTL_PERIPH_CLK_EPWM2);
+    SysCtl_enablePeripheral(SYSCTL_PERIPH_CLK_EPWM3);
+    MPWM_start(&inverter);
+}
+
+// ADCA, B and C converting in parallel, started by EPWM1 SOCA at every counter zero
+void configureADC() {
+    const uint32_t basesADC[CURRENTS] = {ADCA_BASE, ADCB_BASE, ADCC_BASE};
+    const SysCtl_PeripheralSOFTPRES resetsADC[CURRENTS] = {SYSCTL_PERIPH_RES_ADCA, SYSCTL_PERIPH_RES_ADCB, SYSCTL_PERIPH_RES_ADCC};
+    uint16_t adc;
+    for (adc = 0; adc < CURRENTS; adc ++) {
+        SysCtl_resetPeripheral(resetsADC[adc]);
+        ADC_disableConverter(basesADC[adc]);
+        ADC_setMode(basesADC[adc], ADC_RESOLUTION_12BIT, ADC_MODE_SINGLE_ENDED);
+        ADC_setPrescaler(basesADC[adc], ADC_CLK_DIV_4_0);
+        ADC_enableConverter(basesADC[adc]);
+    }
+    // 20 SYSCLK window on every SOC; ADCA has the most SOCs and ends the sequence
+    ADCSEQ_init(&sequencerADC, channelsADC, SEQUENCE_CHANNELS, EPWM1_BASE, ADCSEQ_AT_VALLEY, 20U, blocksADC,
+                SEQUENCE_BLOCK, &processBlockADC, 0);
+    Interrupt_register(sequencerADC.interruptNumber, &ADC_SEQUENCE_ISR);
+    Interrupt_enable(sequencerADC.interruptNumber);
+    // Initialisation delay
+    DEVICE_DELAY_US(1000);
+    ADCSEQ_start(&sequencerADC);
+}
+
+// ISR profiler on CPU timer 1, no trigger timer (the EPWM time base triggers the ISR)
+void configureProfiler() {
+    PROF_initTimebase(CPUTIMER1_BASE);
+    PROF_init(&profileEPWM1, "EPWM1_ISR", CARRIER_PERIOD);
+    PROF_init(&profileModulation, "MOD_step", CARRIER_PERIOD);
+    PROF_init(&profileSequence, "ADC_SEQUENCE_ISR", CARRIER_PERIOD);
+}
+
+/*------------------------------MAIN------------------------------*/
+
+void main(void) {
+    /*------------------------------DEVICE------------------------------*/
+    // Device initialisation
+    Device_init();
+    Device_initGPIO();
+    /*------------------------------INTERRUPT------------------------------*/
+    // PIE module initialisation
+    Interrupt_initModule();
+    Interrupt_initVectorTable();
+    /*------------------------------MODULES------------------------------*/
+    configureGPIO();
+    configureProfiler();
+    configureADC();
+    configureEPWM();
+    // Global interrupts and real-time debugging initialisation
+    EINT;
+    ERTM;
+    // Main loop
+    while (1) {
+        updateParameters();
+        checkPhases();
+        if (dumpProfiles) {
+            dumpProfiles = 0U;
+            PROF_dump(&printProfileLine, 0);
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*------------------------------STANDARD LIBRARIES------------------------------*/
-#include <math.h>
+#include <stdint.h>
 #include <stdio.h>
 
 /*------------------------------DRIVERLIB------------------------------*/
@@ -10,43 +10,97 @@
 #include "interrupt.h"
 #include "device.h"
 #include "cputimer.h"
+#include "epwm.h"
+#include "dma.h"
+#include "sysctl.h"
 #include "inc/hw_memmap.h"
 #include "inc/hw_ints.h"
 
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+#include "dds.h"
+#include "dacDMA.h"
+#include "report.h"
+
 /*------------------------------MACROS------------------------------*/
-#define TIMER0_FREQUENCY 50000000 // 50 MHz
+#define SAMPLE_FREQUENCY 10000.0f // Timer 0 interrupt rate
+#define TIMER0_PERIOD ((uint32_t)DEVICE_SYSCLK_FREQ / (uint32_t)SAMPLE_FREQUENCY - 1UL) // Interrupts every PRD + 1 SYSCLK ticks, 100 us
 #define DAC_AMPLITUDE 4095 // 12-bit DAC
-#define SINE_INCREMENT M_PI / 180.0 // 1 degree
+#define SINE_INCREMENT 11930465UL // 1 degree, 2^32 / 360
+
+// DAC output: 1 interpolates the samples up and streams them through DMA, 0 writes them from the timer 0 ISR
+#ifndef DAC_STREAM_MODE
+#define DAC_STREAM_MODE 1
+#endif
+
+#if DAC_STREAM_MODE
+#define CIC_ORDER 3U // Parabolic segments, images down by sinc^3
+#define CIC_RATE_SHIFT 3U // 8 DAC updates per sample, 80 kHz
+#define STREAM_FREQUENCY (SAMPLE_FREQUENCY * (1U << CIC_RATE_SHIFT))
+#define EPWM2_PERIOD ((uint16_t)((DEVICE_SYSCLK_FREQ / 2UL) / (uint32_t)STREAM_FREQUENCY) - 1U) // Up count, 100 MHz clock
+#define STREAM_CHANNELS 2U
+#define STREAM_SAMPLES 10U // Per block, 1 ms
+#define STREAM_BLOCK_LENGTH (STREAM_SAMPLES << CIC_RATE_SHIFT) // Frames
+#endif
 
 /*------------------------------GLOBAL VARIABLES------------------------------*/
 uint16_t amplitudeSine0 = DAC_AMPLITUDE;
 uint16_t amplitudeSine1 = DAC_AMPLITUDE / 2;
+DDS_Generator generatorSine0;
+DDS_Generator generatorSine1;
+#if DAC_STREAM_MODE
+// Two blocks of interleaved DACA and DACB codes, the DMA only reaches global shared RAM
+#pragma DATA_SECTION(streamBlocks, "ramgs0")
+uint16_t streamBlocks[2U * STREAM_BLOCK_LENGTH * STREAM_CHANNELS];
+DACDMA_Stream stream;
+DACDMA_Interpolator interpolatorSine0;
+DACDMA_Interpolator interpolatorSine1;
+#endif
 
 /*------------------------------ISR------------------------------*/
+#if DAC_STREAM_MODE
+// One interrupt per block, at the start of each DMA transfer
+interrupt void DMACH1_ISR(void) {
+    // Toggles GPIO 122
+    GPIO_togglePin(122);
+    DACDMA_handleInterrupt(&stream);
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP7);
+}
+#else
 // Timer 0 ISR
 interrupt void timer0_ISR(void) {
     // Toggles GPIO 122
     GPIO_togglePin(122);
-    // Writes to DACA
-    static double angleSine0 = 0;
-    if (angleSine0 < M_PI * 2) {
-        angleSine0 += SINE_INCREMENT;
-    } else {
-        angleSine0 = 0;
-    }
-    uint16_t outputSine0 = (sin(angleSine0) + 1) * amplitudeSine0 / 2;
-    DAC_setShadowValue(DACA_BASE, outputSine0);
+    // Writes to DACA (phase wraps around by itself)
+    DAC_setShadowValue(DACA_BASE, DDS_step(&generatorSine0));
     // Writes to DACB
-    static double angleSine1 = 0;
-    if (angleSine1 < M_PI * 2) {
-        angleSine1 += SINE_INCREMENT;
-    } else {
-        angleSine1 = 0;
-    }
-    uint16_t outputSine1 = (sin(angleSine1) + 1) * amplitudeSine1 / 2;
-    DAC_setShadowValue(DACB_BASE, outputSine1);
+    DAC_setShadowValue(DACB_BASE, DDS_step(&generatorSine1));
     Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP1);
 }
+#endif
+
+#if DAC_STREAM_MODE
+/*------------------------------STREAM FUNCTIONS------------------------------*/
+// EPWM2 only paces the DMA: SOCA at every counter zero, no outputs
+void configureEPWM2(void) {
+    EPWM_setClockPrescaler(EPWM2_BASE, EPWM_CLOCK_DIVIDER_1, EPWM_HSCLOCK_DIVIDER_1);
+    EPWM_setTimeBasePeriod(EPWM2_BASE, EPWM2_PERIOD);
+    EPWM_setTimeBaseCounter(EPWM2_BASE, 0U);
+    EPWM_setTimeBaseCounterMode(EPWM2_BASE, EPWM_COUNTER_MODE_UP);
+    EPWM_setADCTriggerSource(EPWM2_BASE, EPWM_SOC_A, EPWM_SOC_TBCTR_ZERO);
+    EPWM_setADCTriggerEventPrescale(EPWM2_BASE, EPWM_SOC_A, 1U);
+    EPWM_enableADCTrigger(EPWM2_BASE, EPWM_SOC_A);
+}
+
+// STREAM_SAMPLES samples of each sine, every one interpolated into 2^CIC_RATE_SHIFT frames
+void fillBlock(uint16_t *block) {
+    uint16_t sample;
+    for (sample = 0; sample < STREAM_SAMPLES; sample ++) {
+        uint16_t *frames = block + ((uint32_t)sample << CIC_RATE_SHIFT) * STREAM_CHANNELS;
+        DACDMA_interpolate(&interpolatorSine0, DDS_step(&generatorSine0), frames, STREAM_CHANNELS);
+        DACDMA_interpolate(&interpolatorSine1, DDS_step(&generatorSine1), frames + 1U, STREAM_CHANNELS);
+    }
+}
+#endif
 
 void main(void) {
     /*------------------------------DEVICE------------------------------*/
@@ -70,14 +124,61 @@ void main(void) {
     DAC_setShadowValue(DACB_BASE, 800U);
     // DAC initialisation delay
     DEVICE_DELAY_US(300);
+    // Sine generators, both waves centred on half their amplitude
+    DDS_init(&generatorSine0, SAMPLE_FREQUENCY);
+    DDS_setPhaseIncrement(&generatorSine0, SINE_INCREMENT);
+    DDS_setAmplitude(&generatorSine0, amplitudeSine0);
+    DDS_setOffset(&generatorSine0, (amplitudeSine0 + 1U) / 2U);
+    DDS_init(&generatorSine1, SAMPLE_FREQUENCY);
+    DDS_setPhaseIncrement(&generatorSine1, SINE_INCREMENT);
+    DDS_setAmplitude(&generatorSine1, amplitudeSine1);
+    DDS_setOffset(&generatorSine1, (amplitudeSine1 + 1U) / 2U);
+#if DAC_STREAM_MODE
+    /*------------------------------INTERRUPT AND DMA------------------------------*/
+    // PIE configuration and initialisation
+    Interrupt_initModule();
+    Interrupt_initVectorTable();
+    // Interpolators settled at the first codes, no start-up transient
+    REPORT_check(DACDMA_initInterpolator(&interpolatorSine0, CIC_ORDER, CIC_RATE_SHIFT, DDS_step(&generatorSine0)));
+    REPORT_check(DACDMA_initInterpolator(&interpolatorSine1, CIC_ORDER, CIC_RATE_SHIFT, DDS_step(&generatorSine1)));
+    // DMA channel 1 moves a frame into DACVALS of DACA and DACB at every EPWM2 SOCA
+    DMA_initController();
+    DMA_setEmulationMode(DMA_EMULATION_FREE_RUN);
+    DACDMA_init(&stream, DMA_CH1_BASE, DMA_TRIGGER_EPWM2SOCA, DACA_BASE, STREAM_CHANNELS, streamBlocks, STREAM_BLOCK_LENGTH);
+    // Both blocks filled before the first trigger
+    uint16_t *block;
+    while ((block = DACDMA_reserve(&stream)) != 0) {
+        fillBlock(block);
+        DACDMA_commit(&stream);
+    }
+    Interrupt_register(INT_DMA_CH1, &DMACH1_ISR);
+    Interrupt_enable(INT_DMA_CH1);
+    SysCtl_disablePeripheral(SYSCTL_PERIPH_CLK_TBCLKSYNC);
+    configureEPWM2();
+    SysCtl_enablePeripheral(SYSCTL_PERIPH_CLK_EPWM2);
+    DACDMA_start(&stream);
+    // Global and real-time interrupt activation
+    EINT;
+    ERTM;
+    // EPWM2 start
+    SysCtl_enablePeripheral(SYSCTL_PERIPH_CLK_TBCLKSYNC);
+    /*------------------------------MAIN LOOP------------------------------*/
+    // A block is refilled as soon as the DMA moves on to the other one
+    while (true) {
+        block = DACDMA_reserve(&stream);
+        if (block != 0) {
+            fillBlock(block);
+            DACDMA_commit(&stream);
+        }
+    }
+#else
     /*------------------------------INTERRUPT AND TIMER 0------------------------------*/
     // PIE configuration and initialisation
     Interrupt_initModule();
     Interrupt_initVectorTable();
-    // Timer 0 configuration
-    const uint32_t period = (uint32_t)(TIMER0_FREQUENCY / 10000); // 100 us
+    // Timer 0 configuration, counting SYSCLK at the rate the generators were set up for
     CPUTimer_stopTimer(CPUTIMER0_BASE); // Security measure
-    CPUTimer_setPeriod(CPUTIMER0_BASE, period);
+    CPUTimer_setPeriod(CPUTIMER0_BASE, TIMER0_PERIOD);
     CPUTimer_reloadTimerCounter(CPUTIMER0_BASE);
     CPUTimer_enableInterrupt(CPUTIMER0_BASE);
     // Interrupt configuration
@@ -92,4 +193,5 @@ void main(void) {
     while (true) {
         // Do nothing
     }
+#endif
 }
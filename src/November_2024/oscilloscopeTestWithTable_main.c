@@ -1,4 +1,4 @@
-#include <math.h>
+#include <stdint.h>
 #include <stdio.h>
 
 #include "cpu.h"
@@ -8,61 +8,81 @@
 #include "interrupt.h"
 #include "device.h"
 #include "cputimer.h"
+#include "epwm.h"
+#include "dma.h"
+#include "sysctl.h"
 #include "inc/hw_memmap.h"
 #include "inc/hw_ints.h"
 
-#define TIMER0_FREQUENCY 50000000 // 50 MHz
-#define SINE_POINTS 100 // DACA and DACB | AA0 and AA1
+#include "waveGen.h" // Tables generated by tools/generateWaveTables.py
+#include "dacDMA.h"
+
+#define SAMPLE_FREQUENCY 10000.0f // Timer 0 interrupt rate
+#define TIMER0_PERIOD ((uint32_t)DEVICE_SYSCLK_FREQ / (uint32_t)SAMPLE_FREQUENCY - 1UL) // Interrupts every PRD + 1 SYSCLK ticks, 100 us
+#define WAVE_FREQUENCY 100.0f // DACA, DACB and DACC | AA0, AA1 and B1
+
+// DAC output: 1 streams frames through DMA at a multiple of the sample rate, 0 writes them from the timer 0 ISR
+#ifndef DAC_STREAM_MODE
+#define DAC_STREAM_MODE 1
+#endif
+
+#if DAC_STREAM_MODE
+#define STREAM_RATE_SHIFT 3U // 8 DAC updates per sample, 80 kHz
+#define STREAM_FREQUENCY (SAMPLE_FREQUENCY * (1U << STREAM_RATE_SHIFT))
+#define EPWM2_PERIOD ((uint16_t)((DEVICE_SYSCLK_FREQ / 2UL) / (uint32_t)STREAM_FREQUENCY) - 1U) // Up count, 100 MHz clock
+#define STREAM_CHANNELS 3U
+#define STREAM_BLOCK_LENGTH 80U // Frames, 1 ms per block
+
+// Two blocks of interleaved DACA, DACB and DACC codes, the DMA only reaches global shared RAM
+#pragma DATA_SECTION(streamBlocks, "ramgs0")
+uint16_t streamBlocks[2U * STREAM_BLOCK_LENGTH * STREAM_CHANNELS];
+DACDMA_Stream stream;
+#endif
+
+// Waveform generator, one channel per DAC
+WAVE_Generator generator;
 
 // Sine 0 data
-uint16_t sine0Output; // DAC output
-uint16_t sine0Offset = 0; // Wave offset in relation to X axis
+uint16_t sine0Offset = 2048; // Wave offset in relation to X axis
 uint16_t sine0Amplitude = 4095; // Wave amplitude
-int sine0Table[SINE_POINTS]; // Table with points describing the sine wave
 
 // Sine 1 data
-uint16_t sine1Output;
-uint16_t sine1Offset = 0;
+uint16_t sine1Offset = 1024;
 uint16_t sine1Amplitude = 2047; // Half the first amplitude
-int sine1Table[SINE_POINTS];
 
-// Function to populate sine tables
-void populateSineTable(int *table, uint16_t amplitude) {
-    int point;
-    for (point = 0; point < SINE_POINTS; point ++) {
-        // Angle for each point
-        double angle = (2.0 * M_PI * point) / SINE_POINTS;
-        // Creates each point using the sine function
-        table[point] = (int)((sin(angle) + 1) * amplitude / 2);
-    }
+// Triangle data
+uint16_t triangleOffset = 2048;
+uint16_t triangleAmplitude = 4095;
+
+#if DAC_STREAM_MODE
+// One interrupt per block, at the start of each DMA transfer
+interrupt void DMACH1_ISR(void) {
+    // Toggles GPIO 122
+    GPIO_togglePin(122);
+    DACDMA_handleInterrupt(&stream);
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP7);
 }
 
+// EPWM2 only paces the DMA: SOCA at every counter zero, no outputs
+void configureEPWM2(void) {
+    EPWM_setClockPrescaler(EPWM2_BASE, EPWM_CLOCK_DIVIDER_1, EPWM_HSCLOCK_DIVIDER_1);
+    EPWM_setTimeBasePeriod(EPWM2_BASE, EPWM2_PERIOD);
+    EPWM_setTimeBaseCounter(EPWM2_BASE, 0U);
+    EPWM_setTimeBaseCounterMode(EPWM2_BASE, EPWM_COUNTER_MODE_UP);
+    EPWM_setADCTriggerSource(EPWM2_BASE, EPWM_SOC_A, EPWM_SOC_TBCTR_ZERO);
+    EPWM_setADCTriggerEventPrescale(EPWM2_BASE, EPWM_SOC_A, 1U);
+    EPWM_enableADCTrigger(EPWM2_BASE, EPWM_SOC_A);
+}
+#else
 // Timer 0 ISR
 interrupt void timer0_ISR(void) {
     // Toggles GPIO 122
     GPIO_togglePin(122);
-    // Writes to DACA
-    static uint16_t isine0 = 0;
-    sine0Output = sine0Offset + sine0Table[isine0];
-    // Increments or resets the index (cyclic nature)
-    if (isine0 < SINE_POINTS) {
-        isine0 ++;
-    } else {
-        isine0 = 0;
-    }
-    // New output in queue to update DACA
-    DAC_setShadowValue(DACA_BASE, sine0Output);
-    // Writes to DACB
-    static uint16_t isine1 = 0;
-    sine1Output = sine1Offset + sine1Table[isine1];
-    if (isine1 < SINE_POINTS) {
-        isine1 ++;
-    } else {
-        isine1 = 0;
-    }
-    DAC_setShadowValue(DACB_BASE, sine1Output);
+    // Writes to DACA, DACB and DACC (phases wrap around by themselves)
+    WAVE_update(&generator);
     Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP1);
 }
+#endif
 
 void main(void) {
     // Device initialisation
@@ -71,9 +91,6 @@ void main(void) {
     // GPIO 122 configuration
     GPIO_setPadConfig(122, GPIO_PIN_TYPE_STD);
     GPIO_setDirectionMode(122, GPIO_DIR_MODE_OUT);
-    // DAC configuration
-    populateSineTable(sine0Table, sine0Amplitude);
-    populateSineTable(sine1Table, sine1Amplitude);
     // Pin AA0
     DAC_setReferenceVoltage(DACA_BASE, DAC_REF_ADC_VREFHI);
     DAC_setLoadMode(DACA_BASE, DAC_LOAD_SYSCLK);
@@ -84,15 +101,69 @@ void main(void) {
     DAC_setLoadMode(DACB_BASE, DAC_LOAD_SYSCLK);
     DAC_enableOutput(DACB_BASE);
     DAC_setShadowValue(DACB_BASE, 800U);
+    // Pin B1
+    DAC_setReferenceVoltage(DACC_BASE, DAC_REF_ADC_VREFHI);
+    DAC_setLoadMode(DACC_BASE, DAC_LOAD_SYSCLK);
+    DAC_enableOutput(DACC_BASE);
+    DAC_setShadowValue(DACC_BASE, 800U);
     // DAC initialisation delay
     DEVICE_DELAY_US(300);
+    // Waveforms, tables already in flash so nothing is computed at startup
+#if DAC_STREAM_MODE
+    // Synthesised straight at the DAC update rate, no staircase to interpolate
+    WAVE_init(&generator, STREAM_FREQUENCY);
+#else
+    WAVE_init(&generator, SAMPLE_FREQUENCY);
+#endif
+    WAVE_Channel *sine0 = WAVE_addChannel(&generator, DACA_BASE, &WAVE_sine);
+    WAVE_setFrequency(&generator, sine0, WAVE_FREQUENCY);
+    WAVE_setAmplitude(sine0, sine0Amplitude);
+    WAVE_setOffset(sine0, sine0Offset);
+    WAVE_Channel *sine1 = WAVE_addChannel(&generator, DACB_BASE, &WAVE_sine);
+    WAVE_setFrequency(&generator, sine1, WAVE_FREQUENCY);
+    WAVE_setAmplitude(sine1, sine1Amplitude);
+    WAVE_setOffset(sine1, sine1Offset);
+    WAVE_Channel *triangle = WAVE_addChannel(&generator, DACC_BASE, &WAVE_triangle);
+    WAVE_setFrequency(&generator, triangle, WAVE_FREQUENCY);
+    WAVE_setAmplitude(triangle, triangleAmplitude);
+    WAVE_setOffset(triangle, triangleOffset);
     // PIE configuration and initialisation
     Interrupt_initModule();
     Interrupt_initVectorTable();
-    // Timer 0 configuration
-    const uint32_t period = (uint32_t)(TIMER0_FREQUENCY / 10000); // 100 us
+#if DAC_STREAM_MODE
+    // DMA channel 1 moves a frame into the three DACVALS registers at every EPWM2 SOCA
+    DMA_initController();
+    DMA_setEmulationMode(DMA_EMULATION_FREE_RUN);
+    DACDMA_init(&stream, DMA_CH1_BASE, DMA_TRIGGER_EPWM2SOCA, DACA_BASE, STREAM_CHANNELS, streamBlocks, STREAM_BLOCK_LENGTH);
+    // Both blocks filled before the first trigger
+    uint16_t *block;
+    while ((block = DACDMA_reserve(&stream)) != 0) {
+        WAVE_fill(&generator, block, STREAM_BLOCK_LENGTH);
+        DACDMA_commit(&stream);
+    }
+    Interrupt_register(INT_DMA_CH1, &DMACH1_ISR);
+    Interrupt_enable(INT_DMA_CH1);
+    SysCtl_disablePeripheral(SYSCTL_PERIPH_CLK_TBCLKSYNC);
+    configureEPWM2();
+    SysCtl_enablePeripheral(SYSCTL_PERIPH_CLK_EPWM2);
+    DACDMA_start(&stream);
+    // Global and real-time interrupt activation
+    EINT;
+    ERTM;
+    // EPWM2 start
+    SysCtl_enablePeripheral(SYSCTL_PERIPH_CLK_TBCLKSYNC);
+    // Main loop: a block is refilled as soon as the DMA moves on to the other one
+    while (true) {
+        block = DACDMA_reserve(&stream);
+        if (block != 0) {
+            WAVE_fill(&generator, block, STREAM_BLOCK_LENGTH);
+            DACDMA_commit(&stream);
+        }
+    }
+#else
+    // Timer 0 configuration, counting SYSCLK at the rate the generators were set up for
     CPUTimer_stopTimer(CPUTIMER0_BASE); // Security measure
-    CPUTimer_setPeriod(CPUTIMER0_BASE, period);
+    CPUTimer_setPeriod(CPUTIMER0_BASE, TIMER0_PERIOD);
     CPUTimer_reloadTimerCounter(CPUTIMER0_BASE);
     CPUTimer_enableInterrupt(CPUTIMER0_BASE);
     // Interrupt configuration
@@ -107,4 +178,5 @@ void main(void) {
     while (true) {
         // Do nothing
     }
+#endif
 }
@@ -0,0 +1,57 @@
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "adcDMA.h"
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// One burst of one word per ADC interrupt, one transfer per block, interrupt at the start of each transfer
+void ADCDMA_init(ADCDMA_PingPong *acquisition, uint32_t dmaBase, DMA_Trigger trigger, const void *resultAddress,
+                 uint16_t *buffer, uint16_t blockLength, ADCDMA_BlockCallback callback, void *context) {
+    acquisition->dmaBase = dmaBase;
+    acquisition->resultAddress = resultAddress;
+    acquisition->buffer = buffer;
+    acquisition->blockLength = blockLength;
+    acquisition->callback = callback;
+    acquisition->context = context;
+    acquisition->fillingBlock = 0U;
+    acquisition->blockCount = 0UL;
+    acquisition->started = 0U;
+    DMA_configAddresses(dmaBase, buffer, resultAddress);
+    // Result register stays put, destination moves one word per sample
+    DMA_configBurst(dmaBase, 1U, 0, 0);
+    DMA_configTransfer(dmaBase, blockLength, 0, 1);
+    // Wrap larger than the transfer: disabled
+    DMA_configWrap(dmaBase, 0x10000UL, 0, 0x10000UL, 0);
+    DMA_configMode(dmaBase, trigger, DMA_CFG_ONESHOT_DISABLE | DMA_CFG_CONTINUOUS_ENABLE | DMA_CFG_SIZE_16BIT);
+    // At the start of a transfer the shadow address is already copied, so the ISR has a full block to reload it
+    DMA_setInterruptMode(dmaBase, DMA_INT_AT_BEGINNING);
+    DMA_enableInterrupt(dmaBase);
+    DMA_enableTrigger(dmaBase);
+}
+
+void ADCDMA_start(ADCDMA_PingPong *acquisition) {
+    acquisition->fillingBlock = 0U;
+    acquisition->started = 0U;
+    DMA_configAddresses(acquisition->dmaBase, acquisition->buffer, acquisition->resultAddress);
+    DMA_clearTriggerFlag(acquisition->dmaBase);
+    DMA_startChannel(acquisition->dmaBase);
+}
+
+void ADCDMA_stop(ADCDMA_PingPong *acquisition) {
+    DMA_stopChannel(acquisition->dmaBase);
+}
+
+void ADCDMA_handleInterrupt(ADCDMA_PingPong *acquisition) {
+    const uint16_t length = acquisition->blockLength;
+    // A new transfer has started on the other block, so the previous one is complete
+    if (acquisition->started) {
+        acquisition->fillingBlock ^= 1U;
+        acquisition->blockCount ++;
+        if (acquisition->callback != 0) {
+            acquisition->callback(acquisition->buffer + (acquisition->fillingBlock ^ 1U) * length, length, acquisition->context);
+        }
+    }
+    acquisition->started = 1U;
+    // Shadow address for the next transfer: the block just handed out
+    DMA_configAddresses(acquisition->dmaBase, acquisition->buffer + (acquisition->fillingBlock ^ 1U) * length, acquisition->resultAddress);
+}
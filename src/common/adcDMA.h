@@ -0,0 +1,39 @@
+#ifndef ADCDMA_H
+#define ADCDMA_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdint.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "dma.h"
+
+/*------------------------------TYPES------------------------------*/
+
+// Called from the DMA ISR with a full block, which stays untouched for one block time
+typedef void (*ADCDMA_BlockCallback)(const uint16_t *block, uint16_t length, void *context);
+
+typedef struct {
+    uint32_t dmaBase; // DMA_CHx_BASE
+    const void *resultAddress; // ADC result register moved at every trigger
+    uint16_t *buffer; // Two blocks back to back, must be in DMA accessible RAM (GSx)
+    uint16_t blockLength;
+    ADCDMA_BlockCallback callback;
+    void *context;
+    volatile uint16_t fillingBlock; // Block the running transfer writes, 0 or 1
+    volatile uint32_t blockCount; // Full blocks handed to the callback
+    uint16_t started; // First DMA interrupt marks the first transfer start, no block is full yet
+} ADCDMA_PingPong;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+void ADCDMA_init(ADCDMA_PingPong *acquisition, uint32_t dmaBase, DMA_Trigger trigger, const void *resultAddress,
+                 uint16_t *buffer, uint16_t blockLength, ADCDMA_BlockCallback callback, void *context);
+void ADCDMA_start(ADCDMA_PingPong *acquisition);
+void ADCDMA_stop(ADCDMA_PingPong *acquisition);
+
+// To be called from the DMA channel ISR, one call per block
+void ADCDMA_handleInterrupt(ADCDMA_PingPong *acquisition);
+
+#endif
@@ -0,0 +1,190 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdio.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "epwm.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "adcSequence.h"
+#include "report.h"
+
+/*------------------------------TABLES------------------------------*/
+
+static const uint32_t adcInterrupts[ADCSEQ_ADCS] = {INT_ADCA1, INT_ADCB1, INT_ADCC1, INT_ADCD1};
+
+/*------------------------------HELPERS------------------------------*/
+
+// ADC bases are 0x80 apart, their result registers 0x20 apart
+static uint16_t adcIndex(uint32_t adcBase) {
+    return (uint16_t)((adcBase - ADCA_BASE) / 0x80U);
+}
+
+// Oversampling as a shift, 0xFFFF for a count that is not a power of two up to ADCSEQ_MAX_OVERSAMPLING
+static uint16_t shiftOf(uint16_t oversampling) {
+    uint16_t shift = 0U;
+    while ((1U << shift) < oversampling && (1U << shift) < ADCSEQ_MAX_OVERSAMPLING) {
+        shift ++;
+    }
+    return (1U << shift) == oversampling ? shift : 0xFFFFU;
+}
+
+static void report(const void *object, REPORT_Writer write, void *context) {
+    ADCSEQ_dump((const ADCSEQ_Sequencer *)object, write, context);
+}
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+bool ADCSEQ_init(ADCSEQ_Sequencer *sequencer, const ADCSEQ_Channel *channels, uint16_t count, uint32_t epwmBase,
+                 ADCSEQ_Instant instant, uint32_t sampleWindow, uint16_t *buffer, uint16_t blockLength,
+                 ADCSEQ_BlockCallback callback, void *context) {
+    if (count == 0U || count > ADCSEQ_MAX_CHANNELS || blockLength == 0U) {
+        return false;
+    }
+    uint16_t adc;
+    for (adc = 0; adc < ADCSEQ_ADCS; adc ++) {
+        sequencer->socs[adc] = 0U;
+    }
+    // SOCs handed out in channel order, so each ADC converts its channels one after the other
+    uint16_t channel;
+    for (channel = 0; channel < count; channel ++) {
+        const uint16_t index = adcIndex(channels[channel].adcBase);
+        const uint16_t shift = shiftOf(channels[channel].oversampling);
+        if (index >= ADCSEQ_ADCS || shift == 0xFFFFU
+            || sequencer->socs[index] + channels[channel].oversampling > ADCSEQ_SOCS) {
+            return false;
+        }
+        sequencer->slots[channel].resultBase = ADCARESULT_BASE + 0x20U * index;
+        sequencer->slots[channel].firstSOC = sequencer->socs[index];
+        sequencer->slots[channel].shift = shift;
+        sequencer->socs[index] += channels[channel].oversampling;
+    }
+    // ADCs convert in parallel at the same rate: the one with the most SOCs finishes last
+    uint16_t last = 0U;
+    for (adc = 1; adc < ADCSEQ_ADCS; adc ++) {
+        if (sequencer->socs[adc] > sequencer->socs[last]) {
+            last = adc;
+        }
+    }
+    sequencer->channels = count;
+    sequencer->epwmBase = epwmBase;
+    sequencer->interruptBase = ADCA_BASE + 0x80U * last;
+    sequencer->interruptNumber = adcInterrupts[last];
+    sequencer->buffer = buffer;
+    sequencer->blockLength = blockLength;
+    sequencer->position = 0U;
+    sequencer->callback = callback;
+    sequencer->context = context;
+    sequencer->fillingBlock = 0U;
+    sequencer->blockCount = 0UL;
+    sequencer->sequences = 0UL;
+    sequencer->overruns = 0UL;
+    // EPWMx SOCA triggers are numbered from EPWM1 two apart, EPWM bases are 0x100 apart
+    const ADC_Trigger trigger = (ADC_Trigger)(ADC_TRIGGER_EPWM1_SOCA + 2U * ((epwmBase - EPWM1_BASE) / 0x100U));
+    for (channel = 0; channel < count; channel ++) {
+        const uint32_t adcBase = channels[channel].adcBase;
+        uint16_t soc;
+        for (soc = 0; soc < channels[channel].oversampling; soc ++) {
+            const ADC_SOCNumber number = (ADC_SOCNumber)(sequencer->slots[channel].firstSOC + soc);
+            ADC_setupSOC(adcBase, number, trigger, channels[channel].channel, sampleWindow);
+            ADC_setInterruptSOCTrigger(adcBase, number, ADC_INT_SOC_TRIGGER_NONE);
+        }
+    }
+    // Round robin from SOC0: with all SOCs triggered together they convert in number order
+    for (adc = 0; adc < ADCSEQ_ADCS; adc ++) {
+        if (sequencer->socs[adc] > 0U) {
+            ADC_setSOCPriority(ADCA_BASE + 0x80U * adc, ADC_PRI_ALL_ROUND_ROBIN);
+        }
+    }
+    // A single interrupt at the end of the last conversion; not continuous, so a missed one shows as an overflow
+    ADC_setInterruptPulseMode(sequencer->interruptBase, ADC_PULSE_END_OF_CONV);
+    ADC_disableContinuousMode(sequencer->interruptBase, ADC_INT_NUMBER1);
+    ADC_setInterruptSource(sequencer->interruptBase, ADC_INT_NUMBER1, sequencer->socs[last] - 1U);
+    ADC_clearInterruptStatus(sequencer->interruptBase, ADC_INT_NUMBER1);
+    ADC_clearInterruptOverflowStatus(sequencer->interruptBase, ADC_INT_NUMBER1);
+    ADC_enableInterrupt(sequencer->interruptBase, ADC_INT_NUMBER1);
+    // One sequence per carrier period at the chosen instant
+    EPWM_setADCTriggerSource(epwmBase, EPWM_SOC_A, instant == ADCSEQ_AT_PEAK ? EPWM_SOC_TBCTR_PERIOD : EPWM_SOC_TBCTR_ZERO);
+    EPWM_setADCTriggerEventPrescale(epwmBase, EPWM_SOC_A, 1U);
+    REPORT_register("adcSequence", &report, sequencer);
+    return true;
+}
+
+void ADCSEQ_start(ADCSEQ_Sequencer *sequencer) {
+    sequencer->position = 0U;
+    sequencer->fillingBlock = 0U;
+    EPWM_clearADCTriggerFlag(sequencer->epwmBase, EPWM_SOC_A);
+    EPWM_enableADCTrigger(sequencer->epwmBase, EPWM_SOC_A);
+}
+
+void ADCSEQ_stop(ADCSEQ_Sequencer *sequencer) {
+    EPWM_disableADCTrigger(sequencer->epwmBase, EPWM_SOC_A);
+}
+
+void ADCSEQ_handleInterrupt(ADCSEQ_Sequencer *sequencer) {
+    const uint16_t length = sequencer->blockLength;
+    const uint16_t channels = sequencer->channels;
+    uint16_t *sample = sequencer->buffer + sequencer->fillingBlock * channels * length + sequencer->position;
+    uint16_t channel;
+    for (channel = 0; channel < channels; channel ++) {
+        const ADCSEQ_Slot *slot = &sequencer->slots[channel];
+        const uint16_t oversampling = 1U << slot->shift;
+        uint32_t sum = 0UL;
+        uint16_t soc;
+        for (soc = 0; soc < oversampling; soc ++) {
+            sum += ADC_readResult(slot->resultBase, (ADC_SOCNumber)(slot->firstSOC + soc));
+        }
+        // Rounded average, one array per channel
+        *sample = (uint16_t)((sum + (oversampling >> 1)) >> slot->shift);
+        sample += length;
+    }
+    sequencer->sequences ++;
+    if (++ sequencer->position == length) {
+        sequencer->position = 0U;
+        sequencer->fillingBlock ^= 1U;
+        sequencer->blockCount ++;
+        if (sequencer->callback != 0) {
+            sequencer->callback(sequencer->buffer + (sequencer->fillingBlock ^ 1U) * channels * length, channels, length,
+                                sequencer->context);
+        }
+    }
+    if (ADC_getInterruptOverflowStatus(sequencer->interruptBase, ADC_INT_NUMBER1)) {
+        sequencer->overruns ++;
+        ADC_clearInterruptOverflowStatus(sequencer->interruptBase, ADC_INT_NUMBER1);
+    }
+    ADC_clearInterruptStatus(sequencer->interruptBase, ADC_INT_NUMBER1);
+}
+
+void ADCSEQ_dump(const ADCSEQ_Sequencer *sequencer, REPORT_Writer write, void *context) {
+    char line[ADCSEQ_LINE_LENGTH];
+    snprintf(line, sizeof(line), "ADC sequence %u channels SOCs A %u B %u C %u D %u end on ADC%c, sequences %lu blocks %lu overruns %lu",
+             sequencer->channels, sequencer->socs[0], sequencer->socs[1], sequencer->socs[2], sequencer->socs[3],
+             'A' + adcIndex(sequencer->interruptBase), (unsigned long)sequencer->sequences,
+             (unsigned long)sequencer->blockCount, (unsigned long)sequencer->overruns);
+    write(line, context);
+    if (sequencer->blockCount == 0UL) {
+        return;
+    }
+    const uint16_t length = sequencer->blockLength;
+    const uint16_t *block = sequencer->buffer + (sequencer->fillingBlock ^ 1U) * sequencer->channels * length;
+    uint16_t channel;
+    for (channel = 0; channel < sequencer->channels; channel ++) {
+        const uint16_t *samples = block + channel * length;
+        uint32_t sum = 0UL;
+        uint16_t minimum = 0xFFFFU;
+        uint16_t maximum = 0U;
+        uint16_t sample;
+        for (sample = 0; sample < length; sample ++) {
+            sum += samples[sample];
+            minimum = samples[sample] < minimum ? samples[sample] : minimum;
+            maximum = samples[sample] > maximum ? samples[sample] : maximum;
+        }
+        snprintf(line, sizeof(line), "  channel %u x%u last block mean %.1f min %u max %u", channel,
+                 1U << sequencer->slots[channel].shift, (float)sum / (float)length, minimum, maximum);
+        write(line, context);
+    }
+}
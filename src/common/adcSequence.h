@@ -0,0 +1,85 @@
+#ifndef ADCSEQUENCE_H
+#define ADCSEQUENCE_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "adc.h"
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "report.h"
+
+/*------------------------------MACROS------------------------------*/
+
+#define ADCSEQ_ADCS 4U
+#define ADCSEQ_SOCS 16U // Per ADC
+#define ADCSEQ_MAX_CHANNELS 16U
+#define ADCSEQ_MAX_OVERSAMPLING 8U
+#define ADCSEQ_LINE_LENGTH 160U
+
+/*------------------------------TYPES------------------------------*/
+
+// Carrier instant of the conversions, for an up-down counting EPWM
+typedef enum {
+    ADCSEQ_AT_VALLEY, // Counter zero
+    ADCSEQ_AT_PEAK // Counter period
+} ADCSEQ_Instant;
+
+typedef struct {
+    uint32_t adcBase; // ADCA_BASE to ADCD_BASE
+    ADC_Channel channel;
+    uint16_t oversampling; // SOCs converting the channel, averaged into one sample: 1, 2, 4 or 8
+} ADCSEQ_Channel;
+
+// Called from the end-of-sequence ISR with a full block, which stays untouched for one block time;
+// block holds channels arrays of length samples back to back, channel c from block + c * length
+typedef void (*ADCSEQ_BlockCallback)(const uint16_t *block, uint16_t channels, uint16_t length, void *context);
+
+typedef struct {
+    uint32_t resultBase;
+    uint16_t firstSOC;
+    uint16_t shift; // Oversampling as a power of two
+} ADCSEQ_Slot;
+
+typedef struct {
+    ADCSEQ_Slot slots[ADCSEQ_MAX_CHANNELS];
+    uint16_t channels;
+    uint16_t socs[ADCSEQ_ADCS]; // SOCs used on each ADC
+    uint32_t epwmBase; // SOCA source
+    uint32_t interruptBase; // ADC whose last conversion ends the sequence, its ADCINT1 is the interrupt
+    uint32_t interruptNumber; // INT_ADCx1, for Interrupt_register
+    uint16_t *buffer; // Two blocks of channels * blockLength samples
+    uint16_t blockLength;
+    uint16_t position; // Next sample of the filling block
+    ADCSEQ_BlockCallback callback;
+    void *context;
+    volatile uint16_t fillingBlock;
+    volatile uint32_t blockCount;
+    volatile uint32_t sequences;
+    volatile uint32_t overruns; // Sequences lost, the interrupt flag was still set
+} ADCSEQ_Sequencer;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// ADCs already set up (prescaler, resolution) and powered; SOCs are taken from SOC0 on each ADC in channel order,
+// all triggered by the EPWM's SOCA at the instant; false when the channels do not fit or an oversampling is invalid
+bool ADCSEQ_init(ADCSEQ_Sequencer *sequencer, const ADCSEQ_Channel *channels, uint16_t count, uint32_t epwmBase,
+                 ADCSEQ_Instant instant, uint32_t sampleWindow, uint16_t *buffer, uint16_t blockLength,
+                 ADCSEQ_BlockCallback callback, void *context);
+// SOCA pulses on, from the next carrier instant
+void ADCSEQ_start(ADCSEQ_Sequencer *sequencer);
+void ADCSEQ_stop(ADCSEQ_Sequencer *sequencer);
+
+// End-of-sequence ISR: one sample per channel into the filling block, the block callback when it is full;
+// the caller acknowledges the PIE group
+void ADCSEQ_handleInterrupt(ADCSEQ_Sequencer *sequencer);
+
+// Background: SOC usage, lost sequences and the last block of each channel, line by line
+void ADCSEQ_dump(const ADCSEQ_Sequencer *sequencer, REPORT_Writer write, void *context);
+
+#endif
@@ -0,0 +1,282 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <math.h>
+#include <stdio.h>
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "bode.h"
+#include "report.h"
+#include "typedMath.h"
+
+/*------------------------------HELPERS------------------------------*/
+
+static float wrapDegrees(float phase) {
+    while (phase > 180.0f) {
+        phase -= 360.0f;
+    }
+    while (phase <= -180.0f) {
+        phase += 360.0f;
+    }
+    return phase;
+}
+
+// Stimulus of the current point for the ISR; windows of whole periods, so the frequency lands on fs * periods / N
+static void publishPoint(BODE_Analyzer *analyzer) {
+    const BODE_Settings *settings = &analyzer->settings;
+    float frequency = settings->startFrequency;
+    if (settings->points > 1U) {
+        frequency *= powf(settings->stopFrequency / settings->startFrequency,
+                          (float)analyzer->point / (float)(settings->points - 1U));
+    }
+    float periods = floorf(frequency * settings->windowTime + 0.5f);
+    if (periods < 1.0f) {
+        periods = 1.0f;
+    } else if (periods > 65535.0f) {
+        periods = 65535.0f;
+    }
+    analyzer->periods = (uint16_t)periods;
+    const uint32_t length = (uint32_t)(periods * analyzer->sampleFrequency / frequency + 0.5f);
+    const uint16_t idle = analyzer->published ^ 1U;
+    BODE_Stimulus *stimulus = &analyzer->stimuli[idle];
+    stimulus->windowLength = length;
+    // Exact to half a phase step over the window
+    stimulus->phaseIncrement = (uint32_t)((((uint64_t)analyzer->periods << 32) + length / 2U) / length);
+    const uint16_t tones = settings->tones;
+    stimulus->tones = tones;
+    stimulus->peak = (int16_t)(settings->amplitude / tones);
+    uint16_t tone;
+    for (tone = 0; tone < tones; tone ++) {
+        // -pi k (k - 1) / tones for harmonic k, in turns of 2^32
+        const uint32_t numerator = (uint32_t)(tone + 1U) * tone % (2U * tones);
+        stimulus->phaseOffsets[tone] = 0UL - (uint32_t)(((uint64_t)numerator << 32) / (2U * tones));
+    }
+    stimulus->sequence = analyzer->sequence + 1U;
+    analyzer->windowsTaken = 0U;
+    analyzer->published = idle;
+    analyzer->sequence ++;
+}
+
+static void publishIdle(BODE_Analyzer *analyzer) {
+    const uint16_t idle = analyzer->published ^ 1U;
+    analyzer->stimuli[idle].tones = 0U;
+    analyzer->stimuli[idle].windowLength = 0UL;
+    analyzer->stimuli[idle].sequence = analyzer->sequence + 1U;
+    analyzer->published = idle;
+    analyzer->sequence ++;
+}
+
+// Latest complete window, safe against a concurrent BODE_publishWindow
+static void readWindow(const BODE_Analyzer *analyzer, BODE_Window *window) {
+    uint16_t index;
+    uint16_t sequence;
+    do {
+        index = analyzer->windowPublished;
+        sequence = analyzer->windowSequences[index];
+        const volatile BODE_Window *source = &analyzer->windows[index];
+        uint16_t tone;
+        for (tone = 0; tone < BODE_MAX_TONES; tone ++) {
+            window->sine[tone] = source->sine[tone];
+            window->cosine[tone] = source->cosine[tone];
+        }
+        window->samples = source->samples;
+        window->sequence = source->sequence;
+    // Retry if the writer came back to this window while it was copied
+    } while ((sequence & 1U) || analyzer->windowSequences[index] != sequence);
+}
+
+// Row kept in frequency order, the table is short
+static void insertRow(BODE_Analyzer *analyzer, const BODE_Row *row) {
+    uint16_t index = analyzer->rows;
+    while (index > 0U && analyzer->table[index - 1U].frequency > row->frequency) {
+        analyzer->table[index] = analyzer->table[index - 1U];
+        index --;
+    }
+    analyzer->table[index] = *row;
+    analyzer->rows ++;
+}
+
+static void report(const void *object, REPORT_Writer write, void *context) {
+    BODE_dump((const BODE_Analyzer *)object, write, context);
+}
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+void BODE_init(BODE_Analyzer *analyzer, float sampleFrequency, uint16_t offset) {
+    // Sample frequency MUST BE positive
+    analyzer->sampleFrequency = sampleFrequency > 0.0f ? sampleFrequency : 1.0f;
+    analyzer->offset = offset > DDS_DAC_MAX ? DDS_DAC_MAX : offset;
+    analyzer->delay = 0.0f;
+    analyzer->stimuli[0].tones = 0U;
+    analyzer->stimuli[0].windowLength = 0UL;
+    analyzer->stimuli[0].sequence = 0U;
+    analyzer->stimuli[1] = analyzer->stimuli[0];
+    analyzer->active = analyzer->stimuli[0];
+    analyzer->published = 0U;
+    analyzer->sequence = 0U;
+    analyzer->applied = 0U;
+    analyzer->phase = 0UL;
+    analyzer->sums.samples = 0UL;
+    analyzer->windowSequences[0] = 0U;
+    analyzer->windowSequences[1] = 0U;
+    analyzer->windowPublished = 0U;
+    analyzer->windows[0].samples = 0UL;
+    analyzer->windowCount = 0UL;
+    analyzer->running = false;
+    analyzer->point = 0U;
+    analyzer->lastWindow = 0UL;
+    analyzer->rows = 0U;
+    const BODE_Settings none = {0.0f, 0.0f, 0U, 1U, 0U, 0.0f, 0.0f, 0.0f, 0U};
+    analyzer->settings = none;
+    REPORT_register("bode", &report, analyzer);
+}
+
+void BODE_start(BODE_Analyzer *analyzer, const BODE_Settings *settings) {
+    BODE_Settings *next = &analyzer->settings;
+    *next = *settings;
+    // Tones MUST BE 1 to BODE_MAX_TONES and the rows fit the table
+    if (next->tones == 0U) {
+        next->tones = 1U;
+    } else if (next->tones > BODE_MAX_TONES) {
+        next->tones = BODE_MAX_TONES;
+    }
+    if (next->points == 0U) {
+        next->points = 1U;
+    } else if (next->points > BODE_MAX_ROWS / next->tones) {
+        next->points = BODE_MAX_ROWS / next->tones;
+    }
+    // Highest tone MUST BE below the Nyquist frequency, the sweep MUST BE upwards from above 0 Hz
+    const float highest = BODE_MAX_FREQUENCY * analyzer->sampleFrequency / next->tones;
+    if (next->stopFrequency > highest) {
+        next->stopFrequency = highest;
+    }
+    if (next->startFrequency <= 0.0f || next->startFrequency > next->stopFrequency) {
+        next->startFrequency = next->stopFrequency;
+    }
+    // Stimulus MUST BE inside the DAC range around the offset
+    const uint16_t headroom = analyzer->offset < DDS_DAC_MAX - analyzer->offset ? analyzer->offset
+        : DDS_DAC_MAX - analyzer->offset;
+    if (next->amplitude > headroom) {
+        next->amplitude = headroom;
+    }
+    // Two windows at least, the first one holds the switch to the new frequency
+    if (next->maximumWindows < 2U) {
+        next->maximumWindows = 2U;
+    }
+    analyzer->rows = 0U;
+    analyzer->point = 0U;
+    analyzer->lastWindow = analyzer->windowCount;
+    analyzer->running = true;
+    publishPoint(analyzer);
+}
+
+void BODE_setDelay(BODE_Analyzer *analyzer, float delay) {
+    analyzer->delay = delay > 0.0f ? delay : 0.0f;
+}
+
+bool BODE_poll(BODE_Analyzer *analyzer) {
+    if (!analyzer->running || analyzer->windowCount == analyzer->lastWindow) {
+        return false;
+    }
+    analyzer->lastWindow = analyzer->windowCount;
+    BODE_Window window;
+    readWindow(analyzer, &window);
+    // Windows still measuring the previous point
+    if (window.sequence != analyzer->sequence || window.samples == 0UL) {
+        return false;
+    }
+    const BODE_Settings *settings = &analyzer->settings;
+    const BODE_Stimulus *stimulus = &analyzer->stimuli[analyzer->published];
+    const float pi = 3.14159265f;
+    const float fundamental = analyzer->sampleFrequency * analyzer->periods / (float)window.samples;
+    float gains[BODE_MAX_TONES];
+    float phases[BODE_MAX_TONES];
+    bool settled = ++ analyzer->windowsTaken >= 2U;
+    uint16_t tone;
+    for (tone = 0; tone < settings->tones; tone ++) {
+        // Response amplitude A and phase p: sum of x sin is A N cos(p) / 2, sum of x cos is A N sin(p) / 2
+        const float sine = (float)window.sine[tone];
+        const float cosine = (float)window.cosine[tone];
+        const float amplitude = 2.0f * MATH_sqrtF32(sine * sine + cosine * cosine) / ((float)window.samples * 32768.0f);
+        // DAC hold: the stimulus is half a sample late and sinc(hold) smaller than the ideal sine; plus the write delay.
+        // Angles in turns
+        const float frequency = fundamental * (tone + 1U);
+        const float hold = 0.5f * frequency / analyzer->sampleFrequency;
+        gains[tone] = amplitude * 2.0f * pi * hold / (stimulus->peak * MATH_sinF32(hold));
+        phases[tone] = wrapDegrees((MATH_atan2F32(cosine, sine) + hold + frequency * analyzer->delay) * 360.0f);
+        if (fabsf(gains[tone] - analyzer->lastGain[tone]) > settings->tolerance * analyzer->lastGain[tone]
+            || fabsf(wrapDegrees(phases[tone] - analyzer->lastPhase[tone])) > settings->phaseTolerance) {
+            settled = false;
+        }
+        analyzer->lastGain[tone] = gains[tone];
+        analyzer->lastPhase[tone] = phases[tone];
+    }
+    if (!settled && analyzer->windowsTaken < settings->maximumWindows) {
+        return false;
+    }
+    for (tone = 0; tone < settings->tones; tone ++) {
+        BODE_Row row;
+        row.frequency = fundamental * (tone + 1U);
+        row.magnitude = 20.0f * log10f(gains[tone] > 1e-6f ? gains[tone] : 1e-6f);
+        row.phase = phases[tone];
+        row.windows = analyzer->windowsTaken;
+        row.settled = settled;
+        insertRow(analyzer, &row);
+    }
+    if (++ analyzer->point < settings->points) {
+        publishPoint(analyzer);
+        return false;
+    }
+    analyzer->running = false;
+    publishIdle(analyzer);
+    return true;
+}
+
+void BODE_dump(const BODE_Analyzer *analyzer, REPORT_Writer write, void *context) {
+    char line[BODE_LINE_LENGTH];
+    const BODE_Settings *settings = &analyzer->settings;
+    snprintf(line, sizeof(line), "Bode sweep %.1f to %.1f Hz, %u points x %u tones, %u rows%s, delay %.2f us",
+             settings->startFrequency, settings->stopFrequency, settings->points, settings->tones, analyzer->rows,
+             analyzer->running ? ", running" : "", 1e6f * analyzer->delay);
+    write(line, context);
+    write("  frequency (Hz) magnitude (dB) phase (deg) windows", context);
+    uint16_t row;
+    for (row = 0; row < analyzer->rows; row ++) {
+        const BODE_Row *entry = &analyzer->table[row];
+        snprintf(line, sizeof(line), "  %14.2f %14.2f %11.1f %7u%s", entry->frequency, entry->magnitude, entry->phase,
+                 entry->windows, entry->settled ? "" : " not settled");
+        write(line, context);
+    }
+}
+
+void BODE_apply(BODE_Analyzer *analyzer) {
+    analyzer->active = analyzer->stimuli[analyzer->published];
+    analyzer->applied = analyzer->sequence;
+    // Window restarted with the new stimulus, the phase carries on so the DAC does not jump
+    uint16_t tone;
+    for (tone = 0; tone < BODE_MAX_TONES; tone ++) {
+        analyzer->sums.sine[tone] = 0;
+        analyzer->sums.cosine[tone] = 0;
+    }
+    analyzer->sums.samples = 0UL;
+    analyzer->sums.sequence = analyzer->active.sequence;
+}
+
+void BODE_publishWindow(BODE_Analyzer *analyzer) {
+    const uint16_t index = analyzer->windowPublished ^ 1U;
+    volatile BODE_Window *window = &analyzer->windows[index];
+    analyzer->windowSequences[index] ++;
+    uint16_t tone;
+    for (tone = 0; tone < BODE_MAX_TONES; tone ++) {
+        window->sine[tone] = analyzer->sums.sine[tone];
+        window->cosine[tone] = analyzer->sums.cosine[tone];
+        analyzer->sums.sine[tone] = 0;
+        analyzer->sums.cosine[tone] = 0;
+    }
+    window->samples = analyzer->sums.samples;
+    window->sequence = analyzer->sums.sequence;
+    analyzer->windowSequences[index] ++;
+    analyzer->windowPublished = index;
+    analyzer->windowCount ++;
+    analyzer->sums.samples = 0UL;
+}
@@ -0,0 +1,148 @@
+#ifndef BODE_H
+#define BODE_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "dds.h"
+#include "report.h"
+
+/*------------------------------MACROS------------------------------*/
+
+#define BODE_MAX_TONES 4U
+#define BODE_MAX_ROWS 64U // Table rows, points times tones
+#define BODE_MAX_FREQUENCY 0.45f // Of the sample frequency, highest tone
+
+#define BODE_LINE_LENGTH 128U
+
+/*------------------------------TYPES------------------------------*/
+
+typedef struct {
+    float startFrequency; // Hz, fundamental of the first point
+    float stopFrequency; // Hz, fundamental of the last point, log-spaced in between
+    uint16_t points;
+    uint16_t tones; // 1 for a swept sine, else harmonics 1 to tones of every point measured together
+    uint16_t amplitude; // Stimulus peak in DAC codes, shared by the tones
+    float windowTime; // Seconds, lock-in window rounded to whole periods of the fundamental
+    float tolerance; // Relative gain change between two windows for a settled point
+    float phaseTolerance; // Degrees, phase change between two windows for a settled point
+    uint16_t maximumWindows; // Per point, recorded as not settled after them
+} BODE_Settings;
+
+typedef struct {
+    float frequency; // Hz, as generated
+    float magnitude; // dB
+    float phase; // Degrees, -180 to 180
+    uint16_t windows; // Windows until settled
+    bool settled;
+} BODE_Row;
+
+// Stimulus of one point: windowLength samples hold exactly periods periods of the fundamental
+typedef struct {
+    uint32_t phaseIncrement;
+    uint32_t windowLength;
+    uint16_t tones; // 0 holds the DAC at the offset
+    int16_t peak; // Per tone, DAC codes
+    uint32_t phaseOffsets[BODE_MAX_TONES]; // Schroeder phases, low crest factor with several tones
+    uint16_t sequence; // Tags the windows measured with this stimulus
+} BODE_Stimulus;
+
+// Lock-in sums of one window, the response times the sine and the cosine of each tone
+typedef struct {
+    int64_t sine[BODE_MAX_TONES];
+    int64_t cosine[BODE_MAX_TONES];
+    uint32_t samples;
+    uint16_t sequence;
+} BODE_Window;
+
+typedef struct {
+    float sampleFrequency;
+    uint16_t offset; // DAC codes, also the response's zero
+    float delay; // Seconds from the response sample to the stimulus write
+    // Stimulus published by the background, picked up by the ISR at its next sample
+    BODE_Stimulus stimuli[2];
+    volatile uint16_t published;
+    volatile uint16_t sequence;
+    uint16_t applied;
+    BODE_Stimulus active;
+    // Per sample, ISR only
+    uint32_t phase; // Fundamental, 2^32 is one turn, continuous across points
+    BODE_Window sums;
+    // Double-buffered windows: seqlock per window, readers take windows[windowPublished]
+    volatile BODE_Window windows[2];
+    volatile uint16_t windowSequences[2]; // Odd while the window is being written
+    volatile uint16_t windowPublished;
+    volatile uint32_t windowCount;
+    // Sweep, background only
+    BODE_Settings settings;
+    bool running;
+    uint16_t point;
+    uint16_t periods; // Of the fundamental per window
+    uint32_t lastWindow; // windowCount already looked at
+    uint16_t windowsTaken; // For the current point
+    float lastGain[BODE_MAX_TONES];
+    float lastPhase[BODE_MAX_TONES];
+    BODE_Row table[BODE_MAX_ROWS]; // Sorted by frequency
+    uint16_t rows;
+} BODE_Analyzer;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// Idle, the DAC held at offset until a sweep starts
+void BODE_init(BODE_Analyzer *analyzer, float sampleFrequency, uint16_t offset);
+
+// Background: delay from the ADC sample to the DAC write in the ISR, taken out of the measured phase
+void BODE_setDelay(BODE_Analyzer *analyzer, float delay);
+// Background: clears the table and starts a sweep, settings clamped to the sample rate and the DAC range
+void BODE_start(BODE_Analyzer *analyzer, const BODE_Settings *settings);
+// Background: looks at the latest window, records a point once settled and moves on to the next one;
+// true once, when the last point of the sweep is recorded
+bool BODE_poll(BODE_Analyzer *analyzer);
+// Background: table rows, sorted by frequency
+void BODE_dump(const BODE_Analyzer *analyzer, REPORT_Writer write, void *context);
+
+// ISR, rare paths: stimulus picked up, window complete
+void BODE_apply(BODE_Analyzer *analyzer);
+void BODE_publishWindow(BODE_Analyzer *analyzer);
+
+// ISR: one response sample in, the DAC code for this sample period out; O(tones)
+static inline uint16_t BODE_step(BODE_Analyzer *analyzer, uint16_t sample) {
+    if (analyzer->sequence != analyzer->applied) {
+        BODE_apply(analyzer);
+    }
+    const BODE_Stimulus *stimulus = &analyzer->active;
+    if (stimulus->tones == 0U) {
+        return analyzer->offset;
+    }
+    // The response sampled now came from the stimulus held before it: the background takes out the half sample
+    const int32_t response = (int32_t)sample - analyzer->offset;
+    int32_t output = analyzer->offset;
+    uint32_t tonePhase = analyzer->phase;
+    uint16_t tone;
+    for (tone = 0; tone < stimulus->tones; tone ++) {
+        const uint32_t phase = tonePhase + stimulus->phaseOffsets[tone];
+        const int32_t sine = DDS_sinQ15(phase);
+        const int32_t cosine = DDS_cosQ15(phase);
+        output += (sine * stimulus->peak) >> 15;
+        analyzer->sums.sine[tone] += response * sine;
+        analyzer->sums.cosine[tone] += response * cosine;
+        tonePhase += analyzer->phase;
+    }
+    analyzer->phase += stimulus->phaseIncrement;
+    // Whole periods of every tone in the window: the products at twice a tone and between tones sum to zero
+    if (++ analyzer->sums.samples == stimulus->windowLength) {
+        BODE_publishWindow(analyzer);
+    }
+    if (output < 0) {
+        output = 0;
+    } else if (output > DDS_DAC_MAX) {
+        output = DDS_DAC_MAX;
+    }
+    return (uint16_t)output;
+}
+
+#endif
@@ -0,0 +1,169 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <math.h>
+#include <stdio.h>
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "control.h"
+#include "report.h"
+
+/*------------------------------HELPERS------------------------------*/
+
+static int32_t roundToInt(float value) {
+    return (int32_t)(value < 0.0f ? value - 0.5f : value + 0.5f);
+}
+
+static int16_t gainToQ12(float gain) {
+    if (gain > CTRL_MAX_GAIN) {
+        gain = CTRL_MAX_GAIN;
+    } else if (gain < -CTRL_MAX_GAIN) {
+        gain = -CTRL_MAX_GAIN;
+    }
+    return (int16_t)roundToInt(gain * (float)(1L << CTRL_KP_SHIFT));
+}
+
+// Integral gain per sample, Q15 below 1
+static int16_t integralGainToQ15(float ki, float sampleFrequency) {
+    float perSample = ki / sampleFrequency;
+    if (perSample > 0.99996f) {
+        perSample = 0.99996f;
+    } else if (perSample < 0.0f) {
+        perSample = 0.0f;
+    }
+    return (int16_t)roundToInt(perSample * 32768.0f);
+}
+
+static int32_t coefficientToQ29(float coefficient) {
+    return roundToInt(coefficient * (float)(1L << CTRL_COEFFICIENT_SHIFT));
+}
+
+// Tustin transform of 2 kr wc s / (s^2 + 2 wc s + w0^2), prewarped at the resonance
+static void computePRGains(const CTRL_PR *pr, CTRL_PRGains *gains, float kp, float kr) {
+    const float pi = 3.14159265f;
+    const float resonance = 2.0f * pi * pr->resonantFrequency;
+    const float cutoff = 2.0f * pi * pr->cutoffFrequency;
+    const float warp = resonance / tanf(resonance / (2.0f * pr->sampleFrequency));
+    const float a0 = warp * warp + 2.0f * cutoff * warp + resonance * resonance;
+    gains->kp = gainToQ12(kp);
+    gains->b0 = coefficientToQ29(2.0f * kr * cutoff * warp / a0);
+    gains->a1 = coefficientToQ29(2.0f * (resonance * resonance - warp * warp) / a0);
+    gains->a2 = coefficientToQ29((warp * warp - 2.0f * cutoff * warp + resonance * resonance) / a0);
+}
+
+static void report(const void *object, REPORT_Writer write, void *context) {
+    CTRL_dumpStep((const CTRL_StepMonitor *)object, write, context);
+}
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+void CTRL_initPI(CTRL_PI *pi, float kp, float ki, float sampleFrequency, int16_t minimum, int16_t maximum) {
+    pi->sampleFrequency = sampleFrequency > 0.0f ? sampleFrequency : 1.0f;
+    pi->minimum = minimum;
+    pi->maximum = maximum;
+    pi->gains[0].kp = gainToQ12(kp);
+    pi->gains[0].ki = integralGainToQ15(ki, pi->sampleFrequency);
+    pi->gains[1] = pi->gains[0];
+    pi->active = pi->gains[0];
+    pi->published = 0U;
+    pi->sequence = 0U;
+    pi->applied = 0U;
+    // Starts from the lower limit, as a converter starting up
+    pi->integral = (int32_t)minimum * 32768L;
+    pi->error = 0;
+    pi->output = minimum;
+}
+
+void CTRL_setPIGains(CTRL_PI *pi, float kp, float ki) {
+    const uint16_t idle = pi->published ^ 1U;
+    pi->gains[idle].kp = gainToQ12(kp);
+    pi->gains[idle].ki = integralGainToQ15(ki, pi->sampleFrequency);
+    pi->published = idle;
+    pi->sequence ++;
+}
+
+void CTRL_initPR(CTRL_PR *pr, float kp, float kr, float resonantFrequency, float cutoffFrequency, float sampleFrequency,
+                 int16_t minimum, int16_t maximum, int16_t resonantLimit) {
+    pr->sampleFrequency = sampleFrequency > 0.0f ? sampleFrequency : 1.0f;
+    // Resonance MUST BE below the Nyquist frequency
+    if (resonantFrequency > 0.45f * pr->sampleFrequency) {
+        resonantFrequency = 0.45f * pr->sampleFrequency;
+    }
+    pr->resonantFrequency = resonantFrequency;
+    pr->cutoffFrequency = cutoffFrequency;
+    pr->minimum = minimum;
+    pr->maximum = maximum;
+    pr->stateLimit = (int32_t)(resonantLimit < 0 ? -resonantLimit : resonantLimit) << (CTRL_STATE_SHIFT - 15);
+    computePRGains(pr, &pr->gains[0], kp, kr);
+    pr->gains[1] = pr->gains[0];
+    pr->active = pr->gains[0];
+    pr->published = 0U;
+    pr->sequence = 0U;
+    pr->applied = 0U;
+    pr->error1 = 0;
+    pr->error2 = 0;
+    pr->state1 = 0L;
+    pr->state2 = 0L;
+    pr->output = 0;
+}
+
+void CTRL_setPRGains(CTRL_PR *pr, float kp, float kr) {
+    const uint16_t idle = pr->published ^ 1U;
+    computePRGains(pr, &pr->gains[idle], kp, kr);
+    pr->published = idle;
+    pr->sequence ++;
+}
+
+void CTRL_initStepMonitor(CTRL_StepMonitor *monitor, const char *name, float sampleFrequency) {
+    monitor->name = name;
+    monitor->initial = 0;
+    monitor->reference = 0;
+    monitor->elapsed = 0UL;
+    monitor->riseStart = 0UL;
+    monitor->riseEnd = 0UL;
+    monitor->settling = 0UL;
+    monitor->peak = 0;
+    monitor->steps = 0U;
+    monitor->sampleFrequency = sampleFrequency > 0.0f ? sampleFrequency : 1.0f;
+    REPORT_register("stepMonitor", &report, monitor);
+}
+
+bool CTRL_readStep(const CTRL_StepMonitor *monitor, CTRL_StepResult *result) {
+    // Copy first, the ISR keeps updating the monitor
+    const CTRL_StepMonitor step = *monitor;
+    const int32_t magnitude = (int32_t)step.reference - step.initial;
+    if (step.steps == 0U || magnitude == 0) {
+        return false;
+    }
+    const float period = 1.0f / step.sampleFrequency;
+    const float overshoot = 100.0f * (float)((int32_t)step.peak - step.reference) / (float)magnitude;
+    result->steps = step.steps;
+    result->risen = step.riseEnd != 0UL;
+    result->settled = step.settling != step.elapsed;
+    result->overshoot = overshoot > 0.0f ? overshoot : 0.0f;
+    result->riseTime = (float)(step.riseEnd - step.riseStart) * period;
+    result->settlingTime = (float)step.settling * period;
+    return true;
+}
+
+void CTRL_dumpStep(const CTRL_StepMonitor *monitor, REPORT_Writer write, void *context) {
+    char line[CTRL_LINE_LENGTH];
+    const CTRL_StepMonitor step = *monitor;
+    CTRL_StepResult result;
+    if (!CTRL_readStep(&step, &result)) {
+        snprintf(line, sizeof(line), "%s no step yet", step.name);
+        write(line, context);
+        return;
+    }
+    snprintf(line, sizeof(line), "%s step %u from %d to %d codes after %lu samples", step.name, step.steps,
+             step.initial >> 3, step.reference >> 3, (unsigned long)step.elapsed);
+    write(line, context);
+    const int length = snprintf(line, sizeof(line), "  overshoot %.1f%%", result.overshoot);
+    if (result.risen) {
+        snprintf(line + length, sizeof(line) - length, " rise %.0f us (10-90%%) settling %.0f us (2%%)%s",
+                 1e6f * result.riseTime, 1e6f * result.settlingTime, result.settled ? "" : ", not settled");
+    } else {
+        snprintf(line + length, sizeof(line) - length, " 90%% not reached");
+    }
+    write(line, context);
+}
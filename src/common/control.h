@@ -0,0 +1,228 @@
+#ifndef CONTROL_H
+#define CONTROL_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "report.h"
+
+/*------------------------------MACROS------------------------------*/
+
+// Signals (reference, feedback, error, output) are Q15; proportional gains Q12 (up to +-8)
+#define CTRL_KP_SHIFT 12
+#define CTRL_MAX_GAIN 7.999f
+
+// Resonant coefficients Q29 (up to +-4), resonant state Q24
+#define CTRL_COEFFICIENT_SHIFT 29
+#define CTRL_STATE_SHIFT 24
+
+#define CTRL_LINE_LENGTH 128U
+
+/*------------------------------TYPES------------------------------*/
+
+// Gain set published by the background, picked up by the ISR at its next step
+typedef struct {
+    int16_t kp; // Q12
+    int16_t ki; // Q15, integral gain times the sample period
+} CTRL_PIGains;
+
+typedef struct {
+    CTRL_PIGains gains[2];
+    volatile uint16_t published;
+    volatile uint16_t sequence;
+    uint16_t applied;
+    CTRL_PIGains active;
+    int32_t integral; // Q30, clamped to the output limits (anti-windup)
+    int16_t minimum; // Output limits, Q15
+    int16_t maximum;
+    int16_t error; // Last error, for bumpless gain changes
+    int16_t output; // Last output, saturated
+    float sampleFrequency;
+} CTRL_PI;
+
+// Proportional gain and resonant biquad y = b0 (e - e[-2]) - a1 y[-1] - a2 y[-2]
+typedef struct {
+    int16_t kp; // Q12
+    int32_t b0; // Q29
+    int32_t a1;
+    int32_t a2;
+} CTRL_PRGains;
+
+typedef struct {
+    CTRL_PRGains gains[2];
+    volatile uint16_t published;
+    volatile uint16_t sequence;
+    uint16_t applied;
+    CTRL_PRGains active;
+    int16_t error1; // e[-1], e[-2]
+    int16_t error2;
+    int32_t state1; // y[-1], y[-2], Q24
+    int32_t state2;
+    int32_t stateLimit; // Resonant output clamp, Q24 (anti-windup)
+    int16_t minimum;
+    int16_t maximum;
+    int16_t output;
+    float sampleFrequency;
+    float resonantFrequency; // Hz
+    float cutoffFrequency; // Hz, resonance bandwidth
+} CTRL_PR;
+
+// Step response of a loop, measured sample by sample on the reference and the feedback
+typedef struct {
+    const char *name;
+    int16_t initial; // Reference before the step
+    int16_t reference; // Reference after it
+    uint32_t elapsed; // Samples since the step
+    uint32_t riseStart; // Samples to 10 % and 90 % of the step
+    uint32_t riseEnd;
+    uint32_t settling; // Last sample outside the +-2 % band
+    int16_t peak; // Furthest feedback in the step direction
+    uint16_t steps; // Steps seen
+    float sampleFrequency;
+} CTRL_StepMonitor;
+
+// Latest step of a monitor in seconds and percent, for checks against limits
+typedef struct {
+    uint16_t steps; // Steps seen, the latest one included
+    bool risen; // Feedback reached 90 % of the step
+    bool settled; // Inside the +-2 % band at the latest sample
+    float overshoot; // % of the step, 0 when the feedback never passed the reference
+    float riseTime; // s, 10 % to 90 % of the step
+    float settlingTime; // s, to the last sample outside the band
+} CTRL_StepResult;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// ADC code (12-bit) to Q15
+static inline int16_t CTRL_adcToQ15(uint16_t code) {
+    return (int16_t)((code & 0x0FFFU) << 3);
+}
+
+// Background: kp in per unit, ki in 1/s; output limits in Q15
+void CTRL_initPI(CTRL_PI *pi, float kp, float ki, float sampleFrequency, int16_t minimum, int16_t maximum);
+// Background: applied by the ISR without a step in the output (integral recomputed)
+void CTRL_setPIGains(CTRL_PI *pi, float kp, float ki);
+
+// ISR: one sample, error in Q15, returns the saturated output in Q15
+static inline int16_t CTRL_stepPI(CTRL_PI *pi, int16_t error) {
+    int32_t integral = pi->integral;
+    const uint16_t sequence = pi->sequence;
+    if (sequence != pi->applied) {
+        pi->active = pi->gains[pi->published];
+        pi->applied = sequence;
+        // Bumpless: the integral takes up the change of the proportional term
+        int32_t held = (int32_t)pi->output - (((int32_t)pi->active.kp * pi->error) >> CTRL_KP_SHIFT);
+        if (held > pi->maximum) {
+            held = pi->maximum;
+        } else if (held < pi->minimum) {
+            held = pi->minimum;
+        }
+        integral = held * 32768L;
+    }
+    const int32_t upper = (int32_t)pi->maximum * 32768L;
+    const int32_t lower = (int32_t)pi->minimum * 32768L;
+    // Conditional integration: frozen while the output is saturated in the error's direction
+    if (!((pi->output >= pi->maximum && error > 0) || (pi->output <= pi->minimum && error < 0))) {
+        integral += (int32_t)pi->active.ki * error;
+    }
+    if (integral > upper) {
+        integral = upper;
+    } else if (integral < lower) {
+        integral = lower;
+    }
+    pi->integral = integral;
+    int32_t output = (((int32_t)pi->active.kp * error) >> CTRL_KP_SHIFT) + (integral >> 15);
+    if (output > pi->maximum) {
+        output = pi->maximum;
+    } else if (output < pi->minimum) {
+        output = pi->minimum;
+    }
+    pi->error = error;
+    pi->output = (int16_t)output;
+    return (int16_t)output;
+}
+
+// Background: resonance at resonantFrequency with a cutoffFrequency bandwidth, Tustin with prewarping;
+// kr is the resonant gain at resonance, the resonant output is clamped to +-resonantLimit (Q15)
+void CTRL_initPR(CTRL_PR *pr, float kp, float kr, float resonantFrequency, float cutoffFrequency, float sampleFrequency,
+                 int16_t minimum, int16_t maximum, int16_t resonantLimit);
+// Background: new gains, the resonant state carries on so the output stays continuous
+void CTRL_setPRGains(CTRL_PR *pr, float kp, float kr);
+
+// ISR: one sample, error in Q15, returns the saturated output in Q15 (64-bit products, resonance needs them)
+static inline int16_t CTRL_stepPR(CTRL_PR *pr, int16_t error) {
+    const uint16_t sequence = pr->sequence;
+    if (sequence != pr->applied) {
+        pr->active = pr->gains[pr->published];
+        pr->applied = sequence;
+    }
+    // Q29 coefficients times Q24 values, Q53 sums
+    int64_t accumulator = (int64_t)pr->active.b0 * (((int32_t)error - pr->error2) * (1L << (CTRL_STATE_SHIFT - 15)));
+    accumulator -= (int64_t)pr->active.a1 * pr->state1;
+    accumulator -= (int64_t)pr->active.a2 * pr->state2;
+    int32_t state = (int32_t)(accumulator >> CTRL_COEFFICIENT_SHIFT);
+    if (state > pr->stateLimit) {
+        state = pr->stateLimit;
+    } else if (state < -pr->stateLimit) {
+        state = -pr->stateLimit;
+    }
+    pr->state2 = pr->state1;
+    pr->state1 = state;
+    pr->error2 = pr->error1;
+    pr->error1 = error;
+    int32_t output = (((int32_t)pr->active.kp * error) >> CTRL_KP_SHIFT) + (state >> (CTRL_STATE_SHIFT - 15));
+    if (output > pr->maximum) {
+        output = pr->maximum;
+    } else if (output < pr->minimum) {
+        output = pr->minimum;
+    }
+    pr->output = (int16_t)output;
+    return (int16_t)output;
+}
+
+void CTRL_initStepMonitor(CTRL_StepMonitor *monitor, const char *name, float sampleFrequency);
+
+// ISR: one sample; a change of reference starts a new measurement
+static inline void CTRL_updateStep(CTRL_StepMonitor *monitor, int16_t reference, int16_t feedback) {
+    if (reference != monitor->reference) {
+        monitor->initial = monitor->reference;
+        monitor->reference = reference;
+        monitor->elapsed = 0UL;
+        monitor->riseStart = 0UL;
+        monitor->riseEnd = 0UL;
+        monitor->settling = 0UL;
+        monitor->peak = feedback;
+        monitor->steps ++;
+    }
+    monitor->elapsed ++;
+    // Work in the step direction so rising and falling steps share the checks
+    const int32_t step = (int32_t)monitor->reference - monitor->initial;
+    const int32_t sign = step < 0 ? -1 : 1;
+    const int32_t magnitude = step * sign;
+    const int32_t progress = ((int32_t)feedback - monitor->initial) * sign;
+    if (monitor->riseStart == 0UL && progress * 10 >= magnitude) {
+        monitor->riseStart = monitor->elapsed;
+    }
+    if (monitor->riseEnd == 0UL && progress * 10 >= magnitude * 9) {
+        monitor->riseEnd = monitor->elapsed;
+    }
+    if (((int32_t)feedback - monitor->peak) * sign > 0) {
+        monitor->peak = feedback;
+    }
+    const int32_t deviation = (int32_t)feedback - monitor->reference;
+    if ((deviation < 0 ? -deviation : deviation) * 50 > magnitude) {
+        monitor->settling = monitor->elapsed;
+    }
+}
+
+// Background: the latest step, false before the first one
+bool CTRL_readStep(const CTRL_StepMonitor *monitor, CTRL_StepResult *result);
+
+// Rise time, overshoot and settling time of the latest step
+void CTRL_dumpStep(const CTRL_StepMonitor *monitor, REPORT_Writer write, void *context);
+
+#endif
@@ -0,0 +1,181 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdio.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "inc/hw_dac.h"
+#include "inc/hw_memmap.h"
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "dacDMA.h"
+#include "report.h"
+
+/*------------------------------TABLES------------------------------*/
+
+// One report per DMA channel
+static const char *const reportNames[6] = {"dacStream1", "dacStream2", "dacStream3", "dacStream4", "dacStream5",
+                                           "dacStream6"};
+
+/*------------------------------HELPERS------------------------------*/
+
+static uint16_t *blockOf(const DACDMA_Stream *stream, uint16_t block) {
+    return stream->buffer + (uint32_t)block * stream->blockLength * stream->channelCount;
+}
+
+static const void *valsAddress(const DACDMA_Stream *stream) {
+    return (const void *)(uintptr_t)(stream->firstDACBase + DAC_O_VALS);
+}
+
+// DMA channels are 0x20 words apart
+static uint16_t dmaChannelOf(const DACDMA_Stream *stream) {
+    return (uint16_t)((stream->dmaBase - DMA_CH1_BASE) / 0x20U);
+}
+
+static void report(const void *object, REPORT_Writer write, void *context) {
+    DACDMA_dump((const DACDMA_Stream *)object, write, context);
+}
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// One burst of one frame per trigger, one transfer per block, interrupt at the start of each transfer
+void DACDMA_init(DACDMA_Stream *stream, uint32_t dmaBase, DMA_Trigger trigger, uint32_t firstDACBase, uint16_t channelCount,
+                 uint16_t *buffer, uint16_t blockLength) {
+    // Channel count MUST BE between 1 and DACDMA_MAX_CHANNELS
+    if (channelCount == 0U) {
+        channelCount = 1U;
+    } else if (channelCount > DACDMA_MAX_CHANNELS) {
+        channelCount = DACDMA_MAX_CHANNELS;
+    }
+    stream->dmaBase = dmaBase;
+    stream->firstDACBase = firstDACBase;
+    stream->buffer = buffer;
+    stream->blockLength = blockLength;
+    stream->channelCount = channelCount;
+    stream->ready[0] = 0U;
+    stream->ready[1] = 0U;
+    stream->playingBlock = 0U;
+    stream->fillingBlock = 0U;
+    stream->started = 0U;
+    stream->blockCount = 0UL;
+    stream->underruns = 0UL;
+    DMA_configAddresses(dmaBase, valsAddress(stream), buffer);
+    // Frame codes go to the DACVALS of consecutive DACs (0x10 words apart), back to the first one after each frame
+    DMA_configBurst(dmaBase, channelCount, 1, 0x10);
+    DMA_configTransfer(dmaBase, blockLength, 1, -(int16_t)(0x10U * (channelCount - 1U)));
+    // Wrap larger than the transfer: disabled
+    DMA_configWrap(dmaBase, 0x10000UL, 0, 0x10000UL, 0);
+    DMA_configMode(dmaBase, trigger, DMA_CFG_ONESHOT_DISABLE | DMA_CFG_CONTINUOUS_ENABLE | DMA_CFG_SIZE_16BIT);
+    // At the start of a transfer the shadow address is already copied, so the ISR has a full block to reload it
+    DMA_setInterruptMode(dmaBase, DMA_INT_AT_BEGINNING);
+    DMA_enableInterrupt(dmaBase);
+    DMA_enableTrigger(dmaBase);
+    REPORT_register(reportNames[dmaChannelOf(stream)], &report, stream);
+}
+
+void DACDMA_start(DACDMA_Stream *stream) {
+    stream->playingBlock = 0U;
+    stream->started = 0U;
+    DMA_configAddresses(stream->dmaBase, valsAddress(stream), blockOf(stream, 0U));
+    DMA_clearTriggerFlag(stream->dmaBase);
+    DMA_startChannel(stream->dmaBase);
+}
+
+void DACDMA_stop(DACDMA_Stream *stream) {
+    DMA_stopChannel(stream->dmaBase);
+}
+
+uint16_t *DACDMA_reserve(DACDMA_Stream *stream) {
+    const uint16_t block = stream->fillingBlock;
+    // Still queued, or on its way out through the DMA
+    if (stream->ready[block] || (stream->started && block == stream->playingBlock)) {
+        return 0;
+    }
+    return blockOf(stream, block);
+}
+
+void DACDMA_commit(DACDMA_Stream *stream) {
+    const uint16_t block = stream->fillingBlock;
+    // Too late if the transfer has already started on it: counted as an underrun, the block is free again next time
+    if (!(stream->started && block == stream->playingBlock)) {
+        stream->ready[block] = 1U;
+    }
+    stream->fillingBlock = block ^ 1U;
+}
+
+void DACDMA_handleInterrupt(DACDMA_Stream *stream) {
+    const uint16_t block = stream->started ? stream->playingBlock ^ 1U : 0U;
+    stream->started = 1U;
+    if (!stream->ready[block]) {
+        stream->underruns ++;
+    }
+    stream->ready[block] = 0U;
+    stream->playingBlock = block;
+    stream->blockCount ++;
+    // Shadow address for the next transfer: the block that has just finished, refilled meanwhile
+    DMA_configAddresses(stream->dmaBase, valsAddress(stream), blockOf(stream, block ^ 1U));
+}
+
+void DACDMA_dump(const DACDMA_Stream *stream, REPORT_Writer write, void *context) {
+    char line[DACDMA_LINE_LENGTH];
+    snprintf(line, sizeof(line), "DAC stream DMA CH%u: %u DACs, %u frames per block, blocks %lu, underruns %lu",
+             dmaChannelOf(stream) + 1U, stream->channelCount, stream->blockLength, (unsigned long)stream->blockCount,
+             (unsigned long)stream->underruns);
+    write(line, context);
+}
+
+bool DACDMA_initInterpolator(DACDMA_Interpolator *interpolator, uint16_t order, uint16_t rateShift, uint16_t code) {
+    // Order MUST BE between 1 and DACDMA_CIC_MAX_ORDER
+    if (order == 0U) {
+        order = 1U;
+    } else if (order > DACDMA_CIC_MAX_ORDER) {
+        order = DACDMA_CIC_MAX_ORDER;
+    }
+    // A clamped rate would leave part of the caller's block unwritten, so the configuration is refused instead
+    if (rateShift > DACDMA_CIC_MAX_RATE_SHIFT || DACDMA_CODE_BITS + (order - 1U) * rateShift > DACDMA_CIC_MAX_BITS) {
+        return false;
+    }
+    interpolator->order = order;
+    interpolator->rateShift = rateShift;
+    // Settled at code: comb outputs all 0, only the last integrator holds the (gained) level
+    uint16_t stage;
+    for (stage = 0; stage < DACDMA_CIC_MAX_ORDER; stage ++) {
+        interpolator->previous[stage] = 0L;
+        interpolator->integrators[stage] = 0UL;
+    }
+    interpolator->previous[0] = code;
+    interpolator->integrators[order - 1U] = (uint32_t)code << ((order - 1U) * rateShift);
+    return true;
+}
+
+void DACDMA_interpolate(DACDMA_Interpolator *interpolator, uint16_t code, uint16_t *output, uint16_t stride) {
+    const uint16_t order = interpolator->order;
+    // Combs at the input rate
+    int32_t value = code;
+    uint16_t stage;
+    for (stage = 0; stage < order; stage ++) {
+        const int32_t difference = value - interpolator->previous[stage];
+        interpolator->previous[stage] = value;
+        value = difference;
+    }
+    // Zero stuffing and integrators at the output rate, gain 2^((order - 1) * rateShift) taken out with rounding
+    const uint16_t gainShift = (order - 1U) * interpolator->rateShift;
+    const int32_t half = gainShift > 0U ? 1L << (gainShift - 1U) : 0L;
+    const uint16_t length = 1U << interpolator->rateShift;
+    uint16_t sample;
+    for (sample = 0; sample < length; sample ++) {
+        uint32_t level = sample == 0U ? (uint32_t)value : 0UL;
+        for (stage = 0; stage < order; stage ++) {
+            interpolator->integrators[stage] += level;
+            level = interpolator->integrators[stage];
+        }
+        int32_t result = ((int32_t)level + half) >> gainShift;
+        if (result < 0L) {
+            result = 0L;
+        } else if (result > DACDMA_MAX_CODE) {
+            result = DACDMA_MAX_CODE;
+        }
+        output[(uint32_t)sample * stride] = (uint16_t)result;
+    }
+}
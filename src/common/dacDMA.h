@@ -0,0 +1,79 @@
+#ifndef DACDMA_H
+#define DACDMA_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "dma.h"
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "report.h"
+
+/*------------------------------MACROS------------------------------*/
+
+#define DACDMA_MAX_CHANNELS 3U // DACA, DACB and DACC
+#define DACDMA_CIC_MAX_ORDER 4U
+#define DACDMA_MAX_CODE 4095
+// The last integrator holds the 12-bit code times the gain 2^((order - 1) * rateShift), and is read signed
+#define DACDMA_CODE_BITS 12U
+#define DACDMA_CIC_MAX_BITS 31U
+#define DACDMA_CIC_MAX_RATE_SHIFT 15U // 2^rateShift codes out counted in 16 bits
+#define DACDMA_LINE_LENGTH 128U
+
+/*------------------------------TYPES------------------------------*/
+
+// One DMA channel writes a frame (one code per DAC, consecutive DACs from firstDACBase) into DACVALS at every trigger
+typedef struct {
+    uint32_t dmaBase; // DMA_CHx_BASE
+    uint32_t firstDACBase; // DACx_BASE of the first code of a frame
+    uint16_t *buffer; // Two blocks back to back, interleaved frames, must be in DMA accessible RAM (GSx)
+    uint16_t blockLength; // Frames per block
+    uint16_t channelCount;
+    volatile uint16_t ready[2]; // Filled and not played yet
+    volatile uint16_t playingBlock; // Block the running transfer reads
+    uint16_t fillingBlock; // Next block for DACDMA_reserve
+    uint16_t started; // First DMA interrupt marks the first transfer start
+    volatile uint32_t blockCount; // Transfers started
+    volatile uint32_t underruns; // Transfers started on a block not refilled, its old frames played again
+} DACDMA_Stream;
+
+// CIC interpolator: one control-rate code in, 2^rateShift codes out. Order 1 holds, order 2 draws straight lines,
+// higher orders smooth more (images down by sinc^order) at order * 2^rateShift / 2 output samples of delay
+typedef struct {
+    int32_t previous[DACDMA_CIC_MAX_ORDER]; // Comb delays, control rate
+    uint32_t integrators[DACDMA_CIC_MAX_ORDER]; // Output rate, wrap around by design
+    uint16_t order;
+    uint16_t rateShift;
+} DACDMA_Interpolator;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+void DACDMA_init(DACDMA_Stream *stream, uint32_t dmaBase, DMA_Trigger trigger, uint32_t firstDACBase, uint16_t channelCount,
+                 uint16_t *buffer, uint16_t blockLength);
+// Both blocks should be filled first, or the first transfers count as underruns
+void DACDMA_start(DACDMA_Stream *stream);
+void DACDMA_stop(DACDMA_Stream *stream);
+
+// Block to fill next (blockLength frames of channelCount codes), NULL while both are queued
+uint16_t *DACDMA_reserve(DACDMA_Stream *stream);
+// The reserved block is ready to play
+void DACDMA_commit(DACDMA_Stream *stream);
+
+// To be called from the DMA channel ISR, one call per block
+void DACDMA_handleInterrupt(DACDMA_Stream *stream);
+
+// Background: configuration, blocks and underruns, one line
+void DACDMA_dump(const DACDMA_Stream *stream, REPORT_Writer write, void *context);
+
+// Starts settled at code, with no transient. order is clamped to 1 to DACDMA_CIC_MAX_ORDER; false, and the
+// interpolator left as it was, when rateShift is over DACDMA_CIC_MAX_RATE_SHIFT or the gain overflows the register
+bool DACDMA_initInterpolator(DACDMA_Interpolator *interpolator, uint16_t order, uint16_t rateShift, uint16_t code);
+// 2^rateShift codes into output, stride words apart (channelCount in a stream block)
+void DACDMA_interpolate(DACDMA_Interpolator *interpolator, uint16_t code, uint16_t *output, uint16_t stride);
+
+#endif
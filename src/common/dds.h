@@ -0,0 +1,81 @@
+#ifndef DDS_H
+#define DDS_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdint.h>
+
+/*------------------------------MACROS------------------------------*/
+
+// Quarter-wave table resolution (phase bits 29 to 22 select the point)
+#define DDS_QUARTER_BITS 8
+#define DDS_QUARTER_POINTS (1U << DDS_QUARTER_BITS)
+
+// One full turn of the 32-bit phase accumulator
+#define DDS_PHASE_TURN 4294967296.0f
+#define DDS_PHASE_QUARTER 0x40000000UL
+
+// 12-bit DAC output range
+#define DDS_DAC_MAX 4095
+
+/*------------------------------TYPES------------------------------*/
+
+typedef struct {
+    uint32_t phase; // Phase accumulator, 2^32 is one full turn
+    uint32_t phaseIncrement; // Tuning word added at every sample
+    uint16_t amplitude; // Peak-to-peak amplitude in DAC levels
+    uint16_t offset; // Wave centre in DAC levels
+    float sampleFrequency; // Rate at which DDS_step is called in Hz
+} DDS_Generator;
+
+/*------------------------------TABLES------------------------------*/
+
+// sin(0) to sin(pi/2) in Q15, one guard point at the end for interpolation
+extern const int16_t DDS_quarterSineTable[DDS_QUARTER_POINTS + 1];
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+void DDS_init(DDS_Generator *generator, float sampleFrequency);
+void DDS_setFrequency(DDS_Generator *generator, float frequency);
+// Tuning word of a frequency, for settings prepared off the ISR
+uint32_t DDS_computePhaseIncrement(float sampleFrequency, float frequency);
+void DDS_setPhaseIncrement(DDS_Generator *generator, uint32_t phaseIncrement);
+void DDS_setPhase(DDS_Generator *generator, uint32_t phase);
+void DDS_setAmplitude(DDS_Generator *generator, uint16_t amplitude);
+void DDS_setOffset(DDS_Generator *generator, uint16_t offset);
+
+// Sine of a 32-bit phase in Q15, linear interpolation between table points
+static inline int16_t DDS_sinQ15(uint32_t phase) {
+    // Mirror the second and fourth quadrants onto the first one
+    uint32_t quarterPhase = phase & (DDS_PHASE_QUARTER - 1UL);
+    if (phase & DDS_PHASE_QUARTER) {
+        quarterPhase = (DDS_PHASE_QUARTER - 1UL) - quarterPhase;
+    }
+    const uint16_t index = (uint16_t)(quarterPhase >> (30 - DDS_QUARTER_BITS));
+    const int32_t fraction = (int32_t)((quarterPhase >> (15 - DDS_QUARTER_BITS)) & 0x7FFFUL);
+    const int32_t point = DDS_quarterSineTable[index];
+    const int32_t slope = DDS_quarterSineTable[index + 1] - point;
+    const int16_t value = (int16_t)(point + ((slope * fraction) >> 15));
+    // Third and fourth quadrants are negative
+    return (phase & 0x80000000UL) ? (int16_t)-value : value;
+}
+
+static inline int16_t DDS_cosQ15(uint32_t phase) {
+    return DDS_sinQ15(phase + DDS_PHASE_QUARTER);
+}
+
+// Next DAC sample, called once per sample period (ISR)
+static inline uint16_t DDS_step(DDS_Generator *generator) {
+    int32_t output = (int32_t)generator->offset
+        + (((int32_t)DDS_sinQ15(generator->phase) * (int32_t)generator->amplitude) >> 16);
+    generator->phase += generator->phaseIncrement;
+    // Offset and amplitude are free, so keep the result inside the DAC range
+    if (output < 0) {
+        output = 0;
+    } else if (output > DDS_DAC_MAX) {
+        output = DDS_DAC_MAX;
+    }
+    return (uint16_t)output;
+}
+
+#endif
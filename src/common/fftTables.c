@@ -0,0 +1,867 @@
+// Generated by tools/generateFFTTables.py, do not edit
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "fftTables.h"
+
+/*------------------------------TABLES------------------------------*/
+
+// const data is placed in flash (.const) by the linker command file
+const float FFT_sineTable[FFT_MAX_POINTS] = {
+    0.0f, 0.00153398013f, 0.00306795677f, 0.00460192608f, 0.00613588467f, 0.00766982883f,
+    0.00920375437f, 0.0107376594f, 0.0122715384f, 0.0138053885f, 0.015339206f, 0.0168729872f,
+    0.0184067301f, 0.0199404284f, 0.0214740802f, 0.0230076816f, 0.024541229f, 0.0260747187f,
+    0.027608145f, 0.029141508f, 0.030674804f, 0.0322080255f, 0.0337411724f, 0.0352742374f,
+    0.0368072242f, 0.0383401215f, 0.0398729257f, 0.0414056405f, 0.0429382585f, 0.0444707721f,
+    0.0460031815f, 0.0475354828f, 0.0490676761f, 0.0505997501f, 0.052131705f, 0.0536635369f,
+    0.0551952459f, 0.0567268208f, 0.0582582653f, 0.0597895719f, 0.061320737f, 0.0628517568f,
+    0.0643826276f, 0.0659133494f, 0.0674439222f, 0.068974331f, 0.070504576f, 0.0720346496f,
+    0.0735645667f, 0.0750942975f, 0.0766238645f, 0.0781532452f, 0.0796824396f, 0.0812114477f,
+    0.0827402622f, 0.0842688903f, 0.0857973099f, 0.0873255357f, 0.0888535529f, 0.0903813615f,
+    0.0919089541f, 0.093436338f, 0.0949634984f, 0.0964904279f, 0.0980171412f, 0.0995436162f,
+    0.10106986f, 0.102595866f, 0.104121633f, 0.105647154f, 0.107172422f, 0.108697444f,
+    0.110222206f, 0.111746714f, 0.113270953f, 0.114794925f, 0.116318628f, 0.117842063f,
+    0.119365215f, 0.120888084f, 0.122410677f, 0.123932973f, 0.125454977f, 0.126976699f,
+    0.128498107f, 0.130019218f, 0.13154003f, 0.13306053f, 0.134580702f, 0.136100575f,
+    0.137620121f, 0.139139339f, 0.140658244f, 0.142176807f, 0.143695027f, 0.145212919f,
+    0.146730468f, 0.148247674f, 0.149764538f, 0.151281044f, 0.152797192f, 0.154312968f,
+    0.155828401f, 0.157343462f, 0.15885815f, 0.160372451f, 0.161886394f, 0.16339995f,
+    0.164913118f, 0.166425899f, 0.167938292f, 0.169450298f, 0.170961887f, 0.172473088f,
+    0.173983872f, 0.175494254f, 0.177004218f, 0.178513765f, 0.180022895f, 0.181531608f,
+    0.183039889f, 0.184547737f, 0.186055154f, 0.187562123f, 0.18906866f, 0.19057475f,
+    0.192080393f, 0.19358559f, 0.195090324f, 0.196594596f, 0.198098406f, 0.199601755f,
+    0.201104641f, 0.202607036f, 0.204108968f, 0.205610409f, 0.207111374f, 0.208611846f,
+    0.210111842f, 0.211611331f, 0.213110313f, 0.214608818f, 0.216106802f, 0.21760428f,
+    0.219101235f, 0.220597684f, 0.222093627f, 0.223589033f, 0.225083917f, 0.226578265f,
+    0.228072077f, 0.229565367f, 0.231058106f, 0.232550308f, 0.234041959f, 0.235533059f,
+    0.237023607f, 0.238513589f, 0.24000302f, 0.241491884f, 0.242980182f, 0.244467899f,
+    0.24595505f, 0.24744162f, 0.248927608f, 0.250413001f, 0.251897812f, 0.253382027f,
+    0.254865646f, 0.25634867f, 0.257831097f, 0.259312928f, 0.260794103f, 0.262274712f,
+    0.263754666f, 0.265234023f, 0.266712755f, 0.268190861f, 0.269668311f, 0.271145165f,
+    0.272621363f, 0.274096906f, 0.275571823f, 0.277046084f, 0.27851969f, 0.27999264f,
+    0.281464934f, 0.282936573f, 0.284407526f, 0.285877824f, 0.287347466f, 0.288816422f,
+    0.290284663f, 0.291752249f, 0.293219149f, 0.294685364f, 0.296150893f, 0.297615707f,
+    0.299079835f, 0.300543249f, 0.302005947f, 0.303467959f, 0.304929227f, 0.306389809f,
+    0.307849646f, 0.309308767f, 0.310767144f, 0.312224805f, 0.313681751f, 0.315137923f,
+    0.316593379f, 0.31804809f, 0.319502026f, 0.320955247f, 0.322407693f, 0.323859364f,
+    0.32531029f, 0.326760441f, 0.328209847f, 0.329658449f, 0.331106305f, 0.332553357f,
+    0.333999664f, 0.335445136f, 0.336889863f, 0.338333756f, 0.339776874f, 0.341219217f,
+    0.342660725f, 0.344101429f, 0.345541328f, 0.346980423f, 0.348418683f, 0.349856138f,
+    0.351292759f, 0.352728546f, 0.354163527f, 0.355597675f, 0.357030958f, 0.358463407f,
+    0.359895051f, 0.3613258f, 0.362755716f, 0.364184797f, 0.365612984f, 0.367040336f,
+    0.368466824f, 0.369892448f, 0.371317208f, 0.372741073f, 0.374164075f, 0.375586182f,
+    0.377007425f, 0.378427744f, 0.379847199f, 0.381265759f, 0.382683426f, 0.384100199f,
+    0.385516047f, 0.386931002f, 0.388345033f, 0.38975817f, 0.391170382f, 0.392581671f,
+    0.393992037f, 0.395401478f, 0.396809995f, 0.398217559f, 0.399624199f, 0.401029885f,
+    0.402434647f, 0.403838456f, 0.405241311f, 0.406643212f, 0.408044159f, 0.409444153f,
+    0.410843164f, 0.41224122f, 0.413638324f, 0.415034413f, 0.416429549f, 0.417823702f,
+    0.419216901f, 0.420609087f, 0.422000259f, 0.423390478f, 0.424779683f, 0.426167876f,
+    0.427555084f, 0.42894128f, 0.430326492f, 0.43171066f, 0.433093816f, 0.434475958f,
+    0.435857087f, 0.437237173f, 0.438616246f, 0.439994276f, 0.441371262f, 0.442747235f,
+    0.444122136f, 0.445496023f, 0.446868837f, 0.448240608f, 0.449611336f, 0.450980991f,
+    0.452349573f, 0.453717113f, 0.455083579f, 0.456448972f, 0.457813293f, 0.45917654f,
+    0.460538715f, 0.461899787f, 0.463259786f, 0.464618683f, 0.465976506f, 0.467333198f,
+    0.468688816f, 0.470043331f, 0.471396744f, 0.472749025f, 0.474100202f, 0.475450277f,
+    0.47679922f, 0.47814706f, 0.479493767f, 0.480839342f, 0.482183784f, 0.483527064f,
+    0.484869242f, 0.486210287f, 0.487550169f, 0.48888889f, 0.490226477f, 0.491562903f,
+    0.492898196f, 0.494232297f, 0.495565265f, 0.496897042f, 0.498227656f, 0.499557108f,
+    0.500885367f, 0.502212465f, 0.50353837f, 0.504863083f, 0.506186664f, 0.507508993f,
+    0.50883013f, 0.510150075f, 0.511468828f, 0.512786388f, 0.514102757f, 0.515417874f,
+    0.516731799f, 0.518044531f, 0.519356012f, 0.520666242f, 0.521975279f, 0.523283124f,
+    0.524589658f, 0.525895f, 0.527199149f, 0.528501987f, 0.529803634f, 0.531104028f,
+    0.532403111f, 0.533701003f, 0.534997642f, 0.53629297f, 0.537587047f, 0.538879931f,
+    0.540171444f, 0.541461766f, 0.542750776f, 0.544038534f, 0.545324981f, 0.546610177f,
+    0.547894061f, 0.549176633f, 0.550457954f, 0.551737964f, 0.553016722f, 0.554294109f,
+    0.555570245f, 0.556845009f, 0.558118522f, 0.559390724f, 0.560661554f, 0.561931133f,
+    0.563199341f, 0.564466238f, 0.565731823f, 0.566996038f, 0.568258941f, 0.569520533f,
+    0.570780754f, 0.572039604f, 0.573297143f, 0.57455337f, 0.575808167f, 0.577061653f,
+    0.578313768f, 0.579564571f, 0.580813944f, 0.582062006f, 0.583308637f, 0.584553957f,
+    0.585797846f, 0.587040365f, 0.588281572f, 0.589521289f, 0.590759695f, 0.59199667f,
+    0.593232274f, 0.594466507f, 0.59569931f, 0.596930683f, 0.598160684f, 0.599389315f,
+    0.600616455f, 0.601842225f, 0.603066623f, 0.604289532f, 0.605511069f, 0.606731117f,
+    0.607949793f, 0.609167039f, 0.610382795f, 0.61159718f, 0.612810075f, 0.61402154f,
+    0.615231574f, 0.616440177f, 0.61764729f, 0.618852973f, 0.620057225f, 0.621259987f,
+    0.622461259f, 0.623661101f, 0.624859512f, 0.626056373f, 0.627251804f, 0.628445745f,
+    0.629638255f, 0.630829215f, 0.632018745f, 0.633206785f, 0.634393275f, 0.635578334f,
+    0.636761844f, 0.637943923f, 0.639124453f, 0.640303493f, 0.641481042f, 0.642657042f,
+    0.643831551f, 0.645004511f, 0.64617604f, 0.64734596f, 0.64851439f, 0.64968133f,
+    0.65084666f, 0.65201056f, 0.653172851f, 0.654333591f, 0.655492842f, 0.656650543f,
+    0.657806695f, 0.658961296f, 0.660114348f, 0.66126585f, 0.662415802f, 0.663564146f,
+    0.664710999f, 0.665856242f, 0.666999936f, 0.668142021f, 0.669282615f, 0.670421541f,
+    0.671558976f, 0.672694743f, 0.673829019f, 0.674961627f, 0.676092684f, 0.677222192f,
+    0.678350031f, 0.679476321f, 0.680601001f, 0.681724072f, 0.682845533f, 0.683965385f,
+    0.685083687f, 0.686200321f, 0.687315345f, 0.68842876f, 0.689540565f, 0.690650702f,
+    0.691759229f, 0.692866147f, 0.693971455f, 0.695075095f, 0.696177125f, 0.697277486f,
+    0.698376238f, 0.699473321f, 0.700568795f, 0.7016626f, 0.702754736f, 0.703845263f,
+    0.704934061f, 0.706021249f, 0.707106769f, 0.70819062f, 0.709272802f, 0.710353374f,
+    0.711432219f, 0.712509394f, 0.71358484f, 0.714658678f, 0.715730846f, 0.716801286f,
+    0.717870057f, 0.718937099f, 0.720002532f, 0.721066177f, 0.722128212f, 0.72318846f,
+    0.724247098f, 0.725303948f, 0.726359129f, 0.727412641f, 0.728464365f, 0.72951442f,
+    0.730562747f, 0.731609404f, 0.732654274f, 0.733697414f, 0.734738886f, 0.73577857f,
+    0.736816585f, 0.737852812f, 0.73888731f, 0.73992008f, 0.740951121f, 0.741980433f,
+    0.743007958f, 0.744033754f, 0.745057762f, 0.746080101f, 0.747100592f, 0.748119354f,
+    0.749136388f, 0.750151634f, 0.751165152f, 0.752176821f, 0.753186822f, 0.754194975f,
+    0.755201399f, 0.756205976f, 0.757208824f, 0.758209884f, 0.759209216f, 0.760206699f,
+    0.761202395f, 0.762196302f, 0.763188422f, 0.764178753f, 0.765167236f, 0.766153991f,
+    0.767138898f, 0.768122017f, 0.769103348f, 0.770082831f, 0.771060526f, 0.772036374f,
+    0.773010433f, 0.773982704f, 0.774953127f, 0.775921702f, 0.77688849f, 0.777853429f,
+    0.778816521f, 0.779777765f, 0.780737221f, 0.781694829f, 0.78265059f, 0.783604503f,
+    0.784556568f, 0.785506845f, 0.786455214f, 0.787401736f, 0.78834641f, 0.789289236f,
+    0.790230215f, 0.791169345f, 0.792106569f, 0.793041945f, 0.793975472f, 0.794907153f,
+    0.795836926f, 0.796764791f, 0.797690868f, 0.798614979f, 0.799537241f, 0.800457656f,
+    0.801376164f, 0.802292824f, 0.803207517f, 0.804120362f, 0.805031359f, 0.80594039f,
+    0.806847572f, 0.807752848f, 0.808656156f, 0.809557617f, 0.81045717f, 0.811354876f,
+    0.812250614f, 0.813144386f, 0.81403631f, 0.814926326f, 0.815814435f, 0.816700578f,
+    0.817584813f, 0.81846714f, 0.819347501f, 0.820225954f, 0.8211025f, 0.821977139f,
+    0.82284981f, 0.823720515f, 0.824589312f, 0.825456142f, 0.826321065f, 0.827184021f,
+    0.82804507f, 0.828904092f, 0.829761207f, 0.830616415f, 0.831469595f, 0.832320869f,
+    0.833170176f, 0.834017515f, 0.834862888f, 0.835706294f, 0.836547732f, 0.837387204f,
+    0.838224709f, 0.839060247f, 0.839893818f, 0.840725362f, 0.841554999f, 0.84238261f,
+    0.843208253f, 0.84403187f, 0.84485358f, 0.845673263f, 0.84649092f, 0.847306609f,
+    0.848120332f, 0.848932028f, 0.849741757f, 0.850549459f, 0.851355195f, 0.852158904f,
+    0.852960587f, 0.853760302f, 0.854557991f, 0.855353653f, 0.856147349f, 0.856938958f,
+    0.857728601f, 0.858516216f, 0.859301805f, 0.860085368f, 0.860866964f, 0.861646473f,
+    0.862423956f, 0.863199413f, 0.863972843f, 0.864744246f, 0.865513623f, 0.866280973f,
+    0.867046237f, 0.867809474f, 0.868570685f, 0.86932987f, 0.870086968f, 0.87084204f,
+    0.871595085f, 0.872346044f, 0.873094976f, 0.873841822f, 0.874586642f, 0.875329375f,
+    0.876070082f, 0.876808703f, 0.877545297f, 0.878279805f, 0.879012227f, 0.879742622f,
+    0.880470872f, 0.881197095f, 0.881921291f, 0.882643342f, 0.883363366f, 0.884081244f,
+    0.884797096f, 0.885510862f, 0.886222541f, 0.886932135f, 0.887639642f, 0.888345063f,
+    0.889048338f, 0.889749587f, 0.890448749f, 0.891145766f, 0.891840696f, 0.892533541f,
+    0.893224299f, 0.893912971f, 0.894599497f, 0.895283937f, 0.895966232f, 0.8966465f,
+    0.897324562f, 0.898000598f, 0.898674488f, 0.899346232f, 0.900015891f, 0.900683403f,
+    0.901348829f, 0.902012169f, 0.902673304f, 0.903332353f, 0.903989315f, 0.904644072f,
+    0.905296743f, 0.905947268f, 0.906595707f, 0.907242f, 0.907886088f, 0.90852809f,
+    0.909168005f, 0.909805715f, 0.910441279f, 0.911074758f, 0.91170603f, 0.912335157f,
+    0.912962198f, 0.913587034f, 0.914209783f, 0.914830327f, 0.915448725f, 0.916064978f,
+    0.916679084f, 0.917290986f, 0.917900801f, 0.91850841f, 0.919113874f, 0.919717133f,
+    0.920318305f, 0.920917213f, 0.921514034f, 0.92210865f, 0.92270112f, 0.923291445f,
+    0.923879504f, 0.924465477f, 0.925049245f, 0.925630808f, 0.926210225f, 0.926787496f,
+    0.927362502f, 0.927935421f, 0.928506076f, 0.929074585f, 0.929640889f, 0.930205047f,
+    0.93076694f, 0.931326687f, 0.931884289f, 0.932439625f, 0.932992816f, 0.933543801f,
+    0.934092522f, 0.934639156f, 0.935183525f, 0.935725689f, 0.936265647f, 0.93680346f,
+    0.937339008f, 0.93787235f, 0.938403547f, 0.938932478f, 0.939459205f, 0.939983726f,
+    0.940506041f, 0.941026151f, 0.941544056f, 0.942059755f, 0.94257319f, 0.943084419f,
+    0.943593442f, 0.944100261f, 0.944604814f, 0.945107222f, 0.945607305f, 0.946105242f,
+    0.946600914f, 0.947094381f, 0.947585583f, 0.948074579f, 0.94856137f, 0.949045897f,
+    0.949528158f, 0.950008273f, 0.950486064f, 0.950961649f, 0.95143503f, 0.951906145f,
+    0.952374995f, 0.95284164f, 0.953306019f, 0.953768194f, 0.954228103f, 0.954685748f,
+    0.955141187f, 0.955594361f, 0.95604527f, 0.956493914f, 0.956940353f, 0.957384527f,
+    0.957826436f, 0.958266079f, 0.958703458f, 0.959138632f, 0.95957154f, 0.960002124f,
+    0.960430503f, 0.960856616f, 0.961280465f, 0.961702049f, 0.962121427f, 0.962538481f,
+    0.962953269f, 0.963365793f, 0.963776052f, 0.964184046f, 0.964589775f, 0.964993238f,
+    0.965394437f, 0.965793371f, 0.966189981f, 0.966584384f, 0.966976464f, 0.967366278f,
+    0.967753828f, 0.968139112f, 0.968522072f, 0.968902826f, 0.969281256f, 0.969657362f,
+    0.970031261f, 0.970402837f, 0.970772147f, 0.971139133f, 0.971503913f, 0.97186631f,
+    0.972226501f, 0.972584367f, 0.972939968f, 0.973293245f, 0.973644257f, 0.973992944f,
+    0.974339366f, 0.974683523f, 0.975025356f, 0.975364864f, 0.975702107f, 0.976037085f,
+    0.976369739f, 0.976700068f, 0.977028131f, 0.977353871f, 0.977677345f, 0.977998495f,
+    0.97831738f, 0.97863394f, 0.978948176f, 0.979260147f, 0.979569793f, 0.979877114f,
+    0.980182111f, 0.980484843f, 0.980785251f, 0.981083393f, 0.981379211f, 0.981672704f,
+    0.981963873f, 0.982252717f, 0.982539296f, 0.982823551f, 0.983105481f, 0.983385086f,
+    0.983662426f, 0.983937442f, 0.984210074f, 0.984480441f, 0.984748483f, 0.98501426f,
+    0.985277653f, 0.985538721f, 0.985797524f, 0.986053944f, 0.986308098f, 0.986559927f,
+    0.986809373f, 0.987056553f, 0.987301409f, 0.987543941f, 0.987784147f, 0.988022029f,
+    0.988257587f, 0.98849082f, 0.988721669f, 0.988950253f, 0.989176512f, 0.989400446f,
+    0.989621997f, 0.989841282f, 0.990058184f, 0.99027282f, 0.990485072f, 0.990695f,
+    0.990902662f, 0.991107941f, 0.991310835f, 0.991511464f, 0.991709769f, 0.991905689f,
+    0.992099285f, 0.992290616f, 0.992479563f, 0.992666125f, 0.992850423f, 0.993032336f,
+    0.993211925f, 0.993389189f, 0.993564129f, 0.993736744f, 0.993906975f, 0.994074881f,
+    0.994240463f, 0.99440366f, 0.994564593f, 0.994723141f, 0.994879305f, 0.995033205f,
+    0.99518472f, 0.99533391f, 0.995480776f, 0.995625257f, 0.995767415f, 0.995907247f,
+    0.996044695f, 0.996179819f, 0.996312618f, 0.996443033f, 0.996571124f, 0.996696889f,
+    0.996820271f, 0.996941328f, 0.997060061f, 0.997176409f, 0.997290432f, 0.997402132f,
+    0.997511446f, 0.997618437f, 0.997723043f, 0.997825325f, 0.997925282f, 0.998022854f,
+    0.998118103f, 0.998211026f, 0.998301566f, 0.998389721f, 0.998475552f, 0.998559058f,
+    0.998640239f, 0.998719037f, 0.99879545f, 0.998869538f, 0.998941302f, 0.999010682f,
+    0.999077737f, 0.999142408f, 0.999204755f, 0.999264777f, 0.999322355f, 0.999377668f,
+    0.999430597f, 0.999481201f, 0.999529421f, 0.999575317f, 0.999618828f, 0.999660015f,
+    0.999698818f, 0.999735296f, 0.99976939f, 0.999801159f, 0.999830604f, 0.999857664f,
+    0.99988234f, 0.999904692f, 0.999924719f, 0.999942362f, 0.999957621f, 0.999970615f,
+    0.999981165f, 0.99998939f, 0.999995291f, 0.999998808f, 1.0f, 0.999998808f,
+    0.999995291f, 0.99998939f, 0.999981165f, 0.999970615f, 0.999957621f, 0.999942362f,
+    0.999924719f, 0.999904692f, 0.99988234f, 0.999857664f, 0.999830604f, 0.999801159f,
+    0.99976939f, 0.999735296f, 0.999698818f, 0.999660015f, 0.999618828f, 0.999575317f,
+    0.999529421f, 0.999481201f, 0.999430597f, 0.999377668f, 0.999322355f, 0.999264777f,
+    0.999204755f, 0.999142408f, 0.999077737f, 0.999010682f, 0.998941302f, 0.998869538f,
+    0.99879545f, 0.998719037f, 0.998640239f, 0.998559058f, 0.998475552f, 0.998389721f,
+    0.998301566f, 0.998211026f, 0.998118103f, 0.998022854f, 0.997925282f, 0.997825325f,
+    0.997723043f, 0.997618437f, 0.997511446f, 0.997402132f, 0.997290432f, 0.997176409f,
+    0.997060061f, 0.996941328f, 0.996820271f, 0.996696889f, 0.996571124f, 0.996443033f,
+    0.996312618f, 0.996179819f, 0.996044695f, 0.995907247f, 0.995767415f, 0.995625257f,
+    0.995480776f, 0.99533391f, 0.99518472f, 0.995033205f, 0.994879305f, 0.994723141f,
+    0.994564593f, 0.99440366f, 0.994240463f, 0.994074881f, 0.993906975f, 0.993736744f,
+    0.993564129f, 0.993389189f, 0.993211925f, 0.993032336f, 0.992850423f, 0.992666125f,
+    0.992479563f, 0.992290616f, 0.992099285f, 0.991905689f, 0.991709769f, 0.991511464f,
+    0.991310835f, 0.991107941f, 0.990902662f, 0.990695f, 0.990485072f, 0.99027282f,
+    0.990058184f, 0.989841282f, 0.989621997f, 0.989400446f, 0.989176512f, 0.988950253f,
+    0.988721669f, 0.98849082f, 0.988257587f, 0.988022029f, 0.987784147f, 0.987543941f,
+    0.987301409f, 0.987056553f, 0.986809373f, 0.986559927f, 0.986308098f, 0.986053944f,
+    0.985797524f, 0.985538721f, 0.985277653f, 0.98501426f, 0.984748483f, 0.984480441f,
+    0.984210074f, 0.983937442f, 0.983662426f, 0.983385086f, 0.983105481f, 0.982823551f,
+    0.982539296f, 0.982252717f, 0.981963873f, 0.981672704f, 0.981379211f, 0.981083393f,
+    0.980785251f, 0.980484843f, 0.980182111f, 0.979877114f, 0.979569793f, 0.979260147f,
+    0.978948176f, 0.97863394f, 0.97831738f, 0.977998495f, 0.977677345f, 0.977353871f,
+    0.977028131f, 0.976700068f, 0.976369739f, 0.976037085f, 0.975702107f, 0.975364864f,
+    0.975025356f, 0.974683523f, 0.974339366f, 0.973992944f, 0.973644257f, 0.973293245f,
+    0.972939968f, 0.972584367f, 0.972226501f, 0.97186631f, 0.971503913f, 0.971139133f,
+    0.970772147f, 0.970402837f, 0.970031261f, 0.969657362f, 0.969281256f, 0.968902826f,
+    0.968522072f, 0.968139112f, 0.967753828f, 0.967366278f, 0.966976464f, 0.966584384f,
+    0.966189981f, 0.965793371f, 0.965394437f, 0.964993238f, 0.964589775f, 0.964184046f,
+    0.963776052f, 0.963365793f, 0.962953269f, 0.962538481f, 0.962121427f, 0.961702049f,
+    0.961280465f, 0.960856616f, 0.960430503f, 0.960002124f, 0.95957154f, 0.959138632f,
+    0.958703458f, 0.958266079f, 0.957826436f, 0.957384527f, 0.956940353f, 0.956493914f,
+    0.95604527f, 0.955594361f, 0.955141187f, 0.954685748f, 0.954228103f, 0.953768194f,
+    0.953306019f, 0.95284164f, 0.952374995f, 0.951906145f, 0.95143503f, 0.950961649f,
+    0.950486064f, 0.950008273f, 0.949528158f, 0.949045897f, 0.94856137f, 0.948074579f,
+    0.947585583f, 0.947094381f, 0.946600914f, 0.946105242f, 0.945607305f, 0.945107222f,
+    0.944604814f, 0.944100261f, 0.943593442f, 0.943084419f, 0.94257319f, 0.942059755f,
+    0.941544056f, 0.941026151f, 0.940506041f, 0.939983726f, 0.939459205f, 0.938932478f,
+    0.938403547f, 0.93787235f, 0.937339008f, 0.93680346f, 0.936265647f, 0.935725689f,
+    0.935183525f, 0.934639156f, 0.934092522f, 0.933543801f, 0.932992816f, 0.932439625f,
+    0.931884289f, 0.931326687f, 0.93076694f, 0.930205047f, 0.929640889f, 0.929074585f,
+    0.928506076f, 0.927935421f, 0.927362502f, 0.926787496f, 0.926210225f, 0.925630808f,
+    0.925049245f, 0.924465477f, 0.923879504f, 0.923291445f, 0.92270112f, 0.92210865f,
+    0.921514034f, 0.920917213f, 0.920318305f, 0.919717133f, 0.919113874f, 0.91850841f,
+    0.917900801f, 0.917290986f, 0.916679084f, 0.916064978f, 0.915448725f, 0.914830327f,
+    0.914209783f, 0.913587034f, 0.912962198f, 0.912335157f, 0.91170603f, 0.911074758f,
+    0.910441279f, 0.909805715f, 0.909168005f, 0.90852809f, 0.907886088f, 0.907242f,
+    0.906595707f, 0.905947268f, 0.905296743f, 0.904644072f, 0.903989315f, 0.903332353f,
+    0.902673304f, 0.902012169f, 0.901348829f, 0.900683403f, 0.900015891f, 0.899346232f,
+    0.898674488f, 0.898000598f, 0.897324562f, 0.8966465f, 0.895966232f, 0.895283937f,
+    0.894599497f, 0.893912971f, 0.893224299f, 0.892533541f, 0.891840696f, 0.891145766f,
+    0.890448749f, 0.889749587f, 0.889048338f, 0.888345063f, 0.887639642f, 0.886932135f,
+    0.886222541f, 0.885510862f, 0.884797096f, 0.884081244f, 0.883363366f, 0.882643342f,
+    0.881921291f, 0.881197095f, 0.880470872f, 0.879742622f, 0.879012227f, 0.878279805f,
+    0.877545297f, 0.876808703f, 0.876070082f, 0.875329375f, 0.874586642f, 0.873841822f,
+    0.873094976f, 0.872346044f, 0.871595085f, 0.87084204f, 0.870086968f, 0.86932987f,
+    0.868570685f, 0.867809474f, 0.867046237f, 0.866280973f, 0.865513623f, 0.864744246f,
+    0.863972843f, 0.863199413f, 0.862423956f, 0.861646473f, 0.860866964f, 0.860085368f,
+    0.859301805f, 0.858516216f, 0.857728601f, 0.856938958f, 0.856147349f, 0.855353653f,
+    0.854557991f, 0.853760302f, 0.852960587f, 0.852158904f, 0.851355195f, 0.850549459f,
+    0.849741757f, 0.848932028f, 0.848120332f, 0.847306609f, 0.84649092f, 0.845673263f,
+    0.84485358f, 0.84403187f, 0.843208253f, 0.84238261f, 0.841554999f, 0.840725362f,
+    0.839893818f, 0.839060247f, 0.838224709f, 0.837387204f, 0.836547732f, 0.835706294f,
+    0.834862888f, 0.834017515f, 0.833170176f, 0.832320869f, 0.831469595f, 0.830616415f,
+    0.829761207f, 0.828904092f, 0.82804507f, 0.827184021f, 0.826321065f, 0.825456142f,
+    0.824589312f, 0.823720515f, 0.82284981f, 0.821977139f, 0.8211025f, 0.820225954f,
+    0.819347501f, 0.81846714f, 0.817584813f, 0.816700578f, 0.815814435f, 0.814926326f,
+    0.81403631f, 0.813144386f, 0.812250614f, 0.811354876f, 0.81045717f, 0.809557617f,
+    0.808656156f, 0.807752848f, 0.806847572f, 0.80594039f, 0.805031359f, 0.804120362f,
+    0.803207517f, 0.802292824f, 0.801376164f, 0.800457656f, 0.799537241f, 0.798614979f,
+    0.797690868f, 0.796764791f, 0.795836926f, 0.794907153f, 0.793975472f, 0.793041945f,
+    0.792106569f, 0.791169345f, 0.790230215f, 0.789289236f, 0.78834641f, 0.787401736f,
+    0.786455214f, 0.785506845f, 0.784556568f, 0.783604503f, 0.78265059f, 0.781694829f,
+    0.780737221f, 0.779777765f, 0.778816521f, 0.777853429f, 0.77688849f, 0.775921702f,
+    0.774953127f, 0.773982704f, 0.773010433f, 0.772036374f, 0.771060526f, 0.770082831f,
+    0.769103348f, 0.768122017f, 0.767138898f, 0.766153991f, 0.765167236f, 0.764178753f,
+    0.763188422f, 0.762196302f, 0.761202395f, 0.760206699f, 0.759209216f, 0.758209884f,
+    0.757208824f, 0.756205976f, 0.755201399f, 0.754194975f, 0.753186822f, 0.752176821f,
+    0.751165152f, 0.750151634f, 0.749136388f, 0.748119354f, 0.747100592f, 0.746080101f,
+    0.745057762f, 0.744033754f, 0.743007958f, 0.741980433f, 0.740951121f, 0.73992008f,
+    0.73888731f, 0.737852812f, 0.736816585f, 0.73577857f, 0.734738886f, 0.733697414f,
+    0.732654274f, 0.731609404f, 0.730562747f, 0.72951442f, 0.728464365f, 0.727412641f,
+    0.726359129f, 0.725303948f, 0.724247098f, 0.72318846f, 0.722128212f, 0.721066177f,
+    0.720002532f, 0.718937099f, 0.717870057f, 0.716801286f, 0.715730846f, 0.714658678f,
+    0.71358484f, 0.712509394f, 0.711432219f, 0.710353374f, 0.709272802f, 0.70819062f,
+    0.707106769f, 0.706021249f, 0.704934061f, 0.703845263f, 0.702754736f, 0.7016626f,
+    0.700568795f, 0.699473321f, 0.698376238f, 0.697277486f, 0.696177125f, 0.695075095f,
+    0.693971455f, 0.692866147f, 0.691759229f, 0.690650702f, 0.689540565f, 0.68842876f,
+    0.687315345f, 0.686200321f, 0.685083687f, 0.683965385f, 0.682845533f, 0.681724072f,
+    0.680601001f, 0.679476321f, 0.678350031f, 0.677222192f, 0.676092684f, 0.674961627f,
+    0.673829019f, 0.672694743f, 0.671558976f, 0.670421541f, 0.669282615f, 0.668142021f,
+    0.666999936f, 0.665856242f, 0.664710999f, 0.663564146f, 0.662415802f, 0.66126585f,
+    0.660114348f, 0.658961296f, 0.657806695f, 0.656650543f, 0.655492842f, 0.654333591f,
+    0.653172851f, 0.65201056f, 0.65084666f, 0.64968133f, 0.64851439f, 0.64734596f,
+    0.64617604f, 0.645004511f, 0.643831551f, 0.642657042f, 0.641481042f, 0.640303493f,
+    0.639124453f, 0.637943923f, 0.636761844f, 0.635578334f, 0.634393275f, 0.633206785f,
+    0.632018745f, 0.630829215f, 0.629638255f, 0.628445745f, 0.627251804f, 0.626056373f,
+    0.624859512f, 0.623661101f, 0.622461259f, 0.621259987f, 0.620057225f, 0.618852973f,
+    0.61764729f, 0.616440177f, 0.615231574f, 0.61402154f, 0.612810075f, 0.61159718f,
+    0.610382795f, 0.609167039f, 0.607949793f, 0.606731117f, 0.605511069f, 0.604289532f,
+    0.603066623f, 0.601842225f, 0.600616455f, 0.599389315f, 0.598160684f, 0.596930683f,
+    0.59569931f, 0.594466507f, 0.593232274f, 0.59199667f, 0.590759695f, 0.589521289f,
+    0.588281572f, 0.587040365f, 0.585797846f, 0.584553957f, 0.583308637f, 0.582062006f,
+    0.580813944f, 0.579564571f, 0.578313768f, 0.577061653f, 0.575808167f, 0.57455337f,
+    0.573297143f, 0.572039604f, 0.570780754f, 0.569520533f, 0.568258941f, 0.566996038f,
+    0.565731823f, 0.564466238f, 0.563199341f, 0.561931133f, 0.560661554f, 0.559390724f,
+    0.558118522f, 0.556845009f, 0.555570245f, 0.554294109f, 0.553016722f, 0.551737964f,
+    0.550457954f, 0.549176633f, 0.547894061f, 0.546610177f, 0.545324981f, 0.544038534f,
+    0.542750776f, 0.541461766f, 0.540171444f, 0.538879931f, 0.537587047f, 0.53629297f,
+    0.534997642f, 0.533701003f, 0.532403111f, 0.531104028f, 0.529803634f, 0.528501987f,
+    0.527199149f, 0.525895f, 0.524589658f, 0.523283124f, 0.521975279f, 0.520666242f,
+    0.519356012f, 0.518044531f, 0.516731799f, 0.515417874f, 0.514102757f, 0.512786388f,
+    0.511468828f, 0.510150075f, 0.50883013f, 0.507508993f, 0.506186664f, 0.504863083f,
+    0.50353837f, 0.502212465f, 0.500885367f, 0.499557108f, 0.498227656f, 0.496897042f,
+    0.495565265f, 0.494232297f, 0.492898196f, 0.491562903f, 0.490226477f, 0.48888889f,
+    0.487550169f, 0.486210287f, 0.484869242f, 0.483527064f, 0.482183784f, 0.480839342f,
+    0.479493767f, 0.47814706f, 0.47679922f, 0.475450277f, 0.474100202f, 0.472749025f,
+    0.471396744f, 0.470043331f, 0.468688816f, 0.467333198f, 0.465976506f, 0.464618683f,
+    0.463259786f, 0.461899787f, 0.460538715f, 0.45917654f, 0.457813293f, 0.456448972f,
+    0.455083579f, 0.453717113f, 0.452349573f, 0.450980991f, 0.449611336f, 0.448240608f,
+    0.446868837f, 0.445496023f, 0.444122136f, 0.442747235f, 0.441371262f, 0.439994276f,
+    0.438616246f, 0.437237173f, 0.435857087f, 0.434475958f, 0.433093816f, 0.43171066f,
+    0.430326492f, 0.42894128f, 0.427555084f, 0.426167876f, 0.424779683f, 0.423390478f,
+    0.422000259f, 0.420609087f, 0.419216901f, 0.417823702f, 0.416429549f, 0.415034413f,
+    0.413638324f, 0.41224122f, 0.410843164f, 0.409444153f, 0.408044159f, 0.406643212f,
+    0.405241311f, 0.403838456f, 0.402434647f, 0.401029885f, 0.399624199f, 0.398217559f,
+    0.396809995f, 0.395401478f, 0.393992037f, 0.392581671f, 0.391170382f, 0.38975817f,
+    0.388345033f, 0.386931002f, 0.385516047f, 0.384100199f, 0.382683426f, 0.381265759f,
+    0.379847199f, 0.378427744f, 0.377007425f, 0.375586182f, 0.374164075f, 0.372741073f,
+    0.371317208f, 0.369892448f, 0.368466824f, 0.367040336f, 0.365612984f, 0.364184797f,
+    0.362755716f, 0.3613258f, 0.359895051f, 0.358463407f, 0.357030958f, 0.355597675f,
+    0.354163527f, 0.352728546f, 0.351292759f, 0.349856138f, 0.348418683f, 0.346980423f,
+    0.345541328f, 0.344101429f, 0.342660725f, 0.341219217f, 0.339776874f, 0.338333756f,
+    0.336889863f, 0.335445136f, 0.333999664f, 0.332553357f, 0.331106305f, 0.329658449f,
+    0.328209847f, 0.326760441f, 0.32531029f, 0.323859364f, 0.322407693f, 0.320955247f,
+    0.319502026f, 0.31804809f, 0.316593379f, 0.315137923f, 0.313681751f, 0.312224805f,
+    0.310767144f, 0.309308767f, 0.307849646f, 0.306389809f, 0.304929227f, 0.303467959f,
+    0.302005947f, 0.300543249f, 0.299079835f, 0.297615707f, 0.296150893f, 0.294685364f,
+    0.293219149f, 0.291752249f, 0.290284663f, 0.288816422f, 0.287347466f, 0.285877824f,
+    0.284407526f, 0.282936573f, 0.281464934f, 0.27999264f, 0.27851969f, 0.277046084f,
+    0.275571823f, 0.274096906f, 0.272621363f, 0.271145165f, 0.269668311f, 0.268190861f,
+    0.266712755f, 0.265234023f, 0.263754666f, 0.262274712f, 0.260794103f, 0.259312928f,
+    0.257831097f, 0.25634867f, 0.254865646f, 0.253382027f, 0.251897812f, 0.250413001f,
+    0.248927608f, 0.24744162f, 0.24595505f, 0.244467899f, 0.242980182f, 0.241491884f,
+    0.24000302f, 0.238513589f, 0.237023607f, 0.235533059f, 0.234041959f, 0.232550308f,
+    0.231058106f, 0.229565367f, 0.228072077f, 0.226578265f, 0.225083917f, 0.223589033f,
+    0.222093627f, 0.220597684f, 0.219101235f, 0.21760428f, 0.216106802f, 0.214608818f,
+    0.213110313f, 0.211611331f, 0.210111842f, 0.208611846f, 0.207111374f, 0.205610409f,
+    0.204108968f, 0.202607036f, 0.201104641f, 0.199601755f, 0.198098406f, 0.196594596f,
+    0.195090324f, 0.19358559f, 0.192080393f, 0.19057475f, 0.18906866f, 0.187562123f,
+    0.186055154f, 0.184547737f, 0.183039889f, 0.181531608f, 0.180022895f, 0.178513765f,
+    0.177004218f, 0.175494254f, 0.173983872f, 0.172473088f, 0.170961887f, 0.169450298f,
+    0.167938292f, 0.166425899f, 0.164913118f, 0.16339995f, 0.161886394f, 0.160372451f,
+    0.15885815f, 0.157343462f, 0.155828401f, 0.154312968f, 0.152797192f, 0.151281044f,
+    0.149764538f, 0.148247674f, 0.146730468f, 0.145212919f, 0.143695027f, 0.142176807f,
+    0.140658244f, 0.139139339f, 0.137620121f, 0.136100575f, 0.134580702f, 0.13306053f,
+    0.13154003f, 0.130019218f, 0.128498107f, 0.126976699f, 0.125454977f, 0.123932973f,
+    0.122410677f, 0.120888084f, 0.119365215f, 0.117842063f, 0.116318628f, 0.114794925f,
+    0.113270953f, 0.111746714f, 0.110222206f, 0.108697444f, 0.107172422f, 0.105647154f,
+    0.104121633f, 0.102595866f, 0.10106986f, 0.0995436162f, 0.0980171412f, 0.0964904279f,
+    0.0949634984f, 0.093436338f, 0.0919089541f, 0.0903813615f, 0.0888535529f, 0.0873255357f,
+    0.0857973099f, 0.0842688903f, 0.0827402622f, 0.0812114477f, 0.0796824396f, 0.0781532452f,
+    0.0766238645f, 0.0750942975f, 0.0735645667f, 0.0720346496f, 0.070504576f, 0.068974331f,
+    0.0674439222f, 0.0659133494f, 0.0643826276f, 0.0628517568f, 0.061320737f, 0.0597895719f,
+    0.0582582653f, 0.0567268208f, 0.0551952459f, 0.0536635369f, 0.052131705f, 0.0505997501f,
+    0.0490676761f, 0.0475354828f, 0.0460031815f, 0.0444707721f, 0.0429382585f, 0.0414056405f,
+    0.0398729257f, 0.0383401215f, 0.0368072242f, 0.0352742374f, 0.0337411724f, 0.0322080255f,
+    0.030674804f, 0.029141508f, 0.027608145f, 0.0260747187f, 0.024541229f, 0.0230076816f,
+    0.0214740802f, 0.0199404284f, 0.0184067301f, 0.0168729872f, 0.015339206f, 0.0138053885f,
+    0.0122715384f, 0.0107376594f, 0.00920375437f, 0.00766982883f, 0.00613588467f, 0.00460192608f,
+    0.00306795677f, 0.00153398013f, 0.0f, -0.00153398013f, -0.00306795677f, -0.00460192608f,
+    -0.00613588467f, -0.00766982883f, -0.00920375437f, -0.0107376594f, -0.0122715384f, -0.0138053885f,
+    -0.015339206f, -0.0168729872f, -0.0184067301f, -0.0199404284f, -0.0214740802f, -0.0230076816f,
+    -0.024541229f, -0.0260747187f, -0.027608145f, -0.029141508f, -0.030674804f, -0.0322080255f,
+    -0.0337411724f, -0.0352742374f, -0.0368072242f, -0.0383401215f, -0.0398729257f, -0.0414056405f,
+    -0.0429382585f, -0.0444707721f, -0.0460031815f, -0.0475354828f, -0.0490676761f, -0.0505997501f,
+    -0.052131705f, -0.0536635369f, -0.0551952459f, -0.0567268208f, -0.0582582653f, -0.0597895719f,
+    -0.061320737f, -0.0628517568f, -0.0643826276f, -0.0659133494f, -0.0674439222f, -0.068974331f,
+    -0.070504576f, -0.0720346496f, -0.0735645667f, -0.0750942975f, -0.0766238645f, -0.0781532452f,
+    -0.0796824396f, -0.0812114477f, -0.0827402622f, -0.0842688903f, -0.0857973099f, -0.0873255357f,
+    -0.0888535529f, -0.0903813615f, -0.0919089541f, -0.093436338f, -0.0949634984f, -0.0964904279f,
+    -0.0980171412f, -0.0995436162f, -0.10106986f, -0.102595866f, -0.104121633f, -0.105647154f,
+    -0.107172422f, -0.108697444f, -0.110222206f, -0.111746714f, -0.113270953f, -0.114794925f,
+    -0.116318628f, -0.117842063f, -0.119365215f, -0.120888084f, -0.122410677f, -0.123932973f,
+    -0.125454977f, -0.126976699f, -0.128498107f, -0.130019218f, -0.13154003f, -0.13306053f,
+    -0.134580702f, -0.136100575f, -0.137620121f, -0.139139339f, -0.140658244f, -0.142176807f,
+    -0.143695027f, -0.145212919f, -0.146730468f, -0.148247674f, -0.149764538f, -0.151281044f,
+    -0.152797192f, -0.154312968f, -0.155828401f, -0.157343462f, -0.15885815f, -0.160372451f,
+    -0.161886394f, -0.16339995f, -0.164913118f, -0.166425899f, -0.167938292f, -0.169450298f,
+    -0.170961887f, -0.172473088f, -0.173983872f, -0.175494254f, -0.177004218f, -0.178513765f,
+    -0.180022895f, -0.181531608f, -0.183039889f, -0.184547737f, -0.186055154f, -0.187562123f,
+    -0.18906866f, -0.19057475f, -0.192080393f, -0.19358559f, -0.195090324f, -0.196594596f,
+    -0.198098406f, -0.199601755f, -0.201104641f, -0.202607036f, -0.204108968f, -0.205610409f,
+    -0.207111374f, -0.208611846f, -0.210111842f, -0.211611331f, -0.213110313f, -0.214608818f,
+    -0.216106802f, -0.21760428f, -0.219101235f, -0.220597684f, -0.222093627f, -0.223589033f,
+    -0.225083917f, -0.226578265f, -0.228072077f, -0.229565367f, -0.231058106f, -0.232550308f,
+    -0.234041959f, -0.235533059f, -0.237023607f, -0.238513589f, -0.24000302f, -0.241491884f,
+    -0.242980182f, -0.244467899f, -0.24595505f, -0.24744162f, -0.248927608f, -0.250413001f,
+    -0.251897812f, -0.253382027f, -0.254865646f, -0.25634867f, -0.257831097f, -0.259312928f,
+    -0.260794103f, -0.262274712f, -0.263754666f, -0.265234023f, -0.266712755f, -0.268190861f,
+    -0.269668311f, -0.271145165f, -0.272621363f, -0.274096906f, -0.275571823f, -0.277046084f,
+    -0.27851969f, -0.27999264f, -0.281464934f, -0.282936573f, -0.284407526f, -0.285877824f,
+    -0.287347466f, -0.288816422f, -0.290284663f, -0.291752249f, -0.293219149f, -0.294685364f,
+    -0.296150893f, -0.297615707f, -0.299079835f, -0.300543249f, -0.302005947f, -0.303467959f,
+    -0.304929227f, -0.306389809f, -0.307849646f, -0.309308767f, -0.310767144f, -0.312224805f,
+    -0.313681751f, -0.315137923f, -0.316593379f, -0.31804809f, -0.319502026f, -0.320955247f,
+    -0.322407693f, -0.323859364f, -0.32531029f, -0.326760441f, -0.328209847f, -0.329658449f,
+    -0.331106305f, -0.332553357f, -0.333999664f, -0.335445136f, -0.336889863f, -0.338333756f,
+    -0.339776874f, -0.341219217f, -0.342660725f, -0.344101429f, -0.345541328f, -0.346980423f,
+    -0.348418683f, -0.349856138f, -0.351292759f, -0.352728546f, -0.354163527f, -0.355597675f,
+    -0.357030958f, -0.358463407f, -0.359895051f, -0.3613258f, -0.362755716f, -0.364184797f,
+    -0.365612984f, -0.367040336f, -0.368466824f, -0.369892448f, -0.371317208f, -0.372741073f,
+    -0.374164075f, -0.375586182f, -0.377007425f, -0.378427744f, -0.379847199f, -0.381265759f,
+    -0.382683426f, -0.384100199f, -0.385516047f, -0.386931002f, -0.388345033f, -0.38975817f,
+    -0.391170382f, -0.392581671f, -0.393992037f, -0.395401478f, -0.396809995f, -0.398217559f,
+    -0.399624199f, -0.401029885f, -0.402434647f, -0.403838456f, -0.405241311f, -0.406643212f,
+    -0.408044159f, -0.409444153f, -0.410843164f, -0.41224122f, -0.413638324f, -0.415034413f,
+    -0.416429549f, -0.417823702f, -0.419216901f, -0.420609087f, -0.422000259f, -0.423390478f,
+    -0.424779683f, -0.426167876f, -0.427555084f, -0.42894128f, -0.430326492f, -0.43171066f,
+    -0.433093816f, -0.434475958f, -0.435857087f, -0.437237173f, -0.438616246f, -0.439994276f,
+    -0.441371262f, -0.442747235f, -0.444122136f, -0.445496023f, -0.446868837f, -0.448240608f,
+    -0.449611336f, -0.450980991f, -0.452349573f, -0.453717113f, -0.455083579f, -0.456448972f,
+    -0.457813293f, -0.45917654f, -0.460538715f, -0.461899787f, -0.463259786f, -0.464618683f,
+    -0.465976506f, -0.467333198f, -0.468688816f, -0.470043331f, -0.471396744f, -0.472749025f,
+    -0.474100202f, -0.475450277f, -0.47679922f, -0.47814706f, -0.479493767f, -0.480839342f,
+    -0.482183784f, -0.483527064f, -0.484869242f, -0.486210287f, -0.487550169f, -0.48888889f,
+    -0.490226477f, -0.491562903f, -0.492898196f, -0.494232297f, -0.495565265f, -0.496897042f,
+    -0.498227656f, -0.499557108f, -0.500885367f, -0.502212465f, -0.50353837f, -0.504863083f,
+    -0.506186664f, -0.507508993f, -0.50883013f, -0.510150075f, -0.511468828f, -0.512786388f,
+    -0.514102757f, -0.515417874f, -0.516731799f, -0.518044531f, -0.519356012f, -0.520666242f,
+    -0.521975279f, -0.523283124f, -0.524589658f, -0.525895f, -0.527199149f, -0.528501987f,
+    -0.529803634f, -0.531104028f, -0.532403111f, -0.533701003f, -0.534997642f, -0.53629297f,
+    -0.537587047f, -0.538879931f, -0.540171444f, -0.541461766f, -0.542750776f, -0.544038534f,
+    -0.545324981f, -0.546610177f, -0.547894061f, -0.549176633f, -0.550457954f, -0.551737964f,
+    -0.553016722f, -0.554294109f, -0.555570245f, -0.556845009f, -0.558118522f, -0.559390724f,
+    -0.560661554f, -0.561931133f, -0.563199341f, -0.564466238f, -0.565731823f, -0.566996038f,
+    -0.568258941f, -0.569520533f, -0.570780754f, -0.572039604f, -0.573297143f, -0.57455337f,
+    -0.575808167f, -0.577061653f, -0.578313768f, -0.579564571f, -0.580813944f, -0.582062006f,
+    -0.583308637f, -0.584553957f, -0.585797846f, -0.587040365f, -0.588281572f, -0.589521289f,
+    -0.590759695f, -0.59199667f, -0.593232274f, -0.594466507f, -0.59569931f, -0.596930683f,
+    -0.598160684f, -0.599389315f, -0.600616455f, -0.601842225f, -0.603066623f, -0.604289532f,
+    -0.605511069f, -0.606731117f, -0.607949793f, -0.609167039f, -0.610382795f, -0.61159718f,
+    -0.612810075f, -0.61402154f, -0.615231574f, -0.616440177f, -0.61764729f, -0.618852973f,
+    -0.620057225f, -0.621259987f, -0.622461259f, -0.623661101f, -0.624859512f, -0.626056373f,
+    -0.627251804f, -0.628445745f, -0.629638255f, -0.630829215f, -0.632018745f, -0.633206785f,
+    -0.634393275f, -0.635578334f, -0.636761844f, -0.637943923f, -0.639124453f, -0.640303493f,
+    -0.641481042f, -0.642657042f, -0.643831551f, -0.645004511f, -0.64617604f, -0.64734596f,
+    -0.64851439f, -0.64968133f, -0.65084666f, -0.65201056f, -0.653172851f, -0.654333591f,
+    -0.655492842f, -0.656650543f, -0.657806695f, -0.658961296f, -0.660114348f, -0.66126585f,
+    -0.662415802f, -0.663564146f, -0.664710999f, -0.665856242f, -0.666999936f, -0.668142021f,
+    -0.669282615f, -0.670421541f, -0.671558976f, -0.672694743f, -0.673829019f, -0.674961627f,
+    -0.676092684f, -0.677222192f, -0.678350031f, -0.679476321f, -0.680601001f, -0.681724072f,
+    -0.682845533f, -0.683965385f, -0.685083687f, -0.686200321f, -0.687315345f, -0.68842876f,
+    -0.689540565f, -0.690650702f, -0.691759229f, -0.692866147f, -0.693971455f, -0.695075095f,
+    -0.696177125f, -0.697277486f, -0.698376238f, -0.699473321f, -0.700568795f, -0.7016626f,
+    -0.702754736f, -0.703845263f, -0.704934061f, -0.706021249f, -0.707106769f, -0.70819062f,
+    -0.709272802f, -0.710353374f, -0.711432219f, -0.712509394f, -0.71358484f, -0.714658678f,
+    -0.715730846f, -0.716801286f, -0.717870057f, -0.718937099f, -0.720002532f, -0.721066177f,
+    -0.722128212f, -0.72318846f, -0.724247098f, -0.725303948f, -0.726359129f, -0.727412641f,
+    -0.728464365f, -0.72951442f, -0.730562747f, -0.731609404f, -0.732654274f, -0.733697414f,
+    -0.734738886f, -0.73577857f, -0.736816585f, -0.737852812f, -0.73888731f, -0.73992008f,
+    -0.740951121f, -0.741980433f, -0.743007958f, -0.744033754f, -0.745057762f, -0.746080101f,
+    -0.747100592f, -0.748119354f, -0.749136388f, -0.750151634f, -0.751165152f, -0.752176821f,
+    -0.753186822f, -0.754194975f, -0.755201399f, -0.756205976f, -0.757208824f, -0.758209884f,
+    -0.759209216f, -0.760206699f, -0.761202395f, -0.762196302f, -0.763188422f, -0.764178753f,
+    -0.765167236f, -0.766153991f, -0.767138898f, -0.768122017f, -0.769103348f, -0.770082831f,
+    -0.771060526f, -0.772036374f, -0.773010433f, -0.773982704f, -0.774953127f, -0.775921702f,
+    -0.77688849f, -0.777853429f, -0.778816521f, -0.779777765f, -0.780737221f, -0.781694829f,
+    -0.78265059f, -0.783604503f, -0.784556568f, -0.785506845f, -0.786455214f, -0.787401736f,
+    -0.78834641f, -0.789289236f, -0.790230215f, -0.791169345f, -0.792106569f, -0.793041945f,
+    -0.793975472f, -0.794907153f, -0.795836926f, -0.796764791f, -0.797690868f, -0.798614979f,
+    -0.799537241f, -0.800457656f, -0.801376164f, -0.802292824f, -0.803207517f, -0.804120362f,
+    -0.805031359f, -0.80594039f, -0.806847572f, -0.807752848f, -0.808656156f, -0.809557617f,
+    -0.81045717f, -0.811354876f, -0.812250614f, -0.813144386f, -0.81403631f, -0.814926326f,
+    -0.815814435f, -0.816700578f, -0.817584813f, -0.81846714f, -0.819347501f, -0.820225954f,
+    -0.8211025f, -0.821977139f, -0.82284981f, -0.823720515f, -0.824589312f, -0.825456142f,
+    -0.826321065f, -0.827184021f, -0.82804507f, -0.828904092f, -0.829761207f, -0.830616415f,
+    -0.831469595f, -0.832320869f, -0.833170176f, -0.834017515f, -0.834862888f, -0.835706294f,
+    -0.836547732f, -0.837387204f, -0.838224709f, -0.839060247f, -0.839893818f, -0.840725362f,
+    -0.841554999f, -0.84238261f, -0.843208253f, -0.84403187f, -0.84485358f, -0.845673263f,
+    -0.84649092f, -0.847306609f, -0.848120332f, -0.848932028f, -0.849741757f, -0.850549459f,
+    -0.851355195f, -0.852158904f, -0.852960587f, -0.853760302f, -0.854557991f, -0.855353653f,
+    -0.856147349f, -0.856938958f, -0.857728601f, -0.858516216f, -0.859301805f, -0.860085368f,
+    -0.860866964f, -0.861646473f, -0.862423956f, -0.863199413f, -0.863972843f, -0.864744246f,
+    -0.865513623f, -0.866280973f, -0.867046237f, -0.867809474f, -0.868570685f, -0.86932987f,
+    -0.870086968f, -0.87084204f, -0.871595085f, -0.872346044f, -0.873094976f, -0.873841822f,
+    -0.874586642f, -0.875329375f, -0.876070082f, -0.876808703f, -0.877545297f, -0.878279805f,
+    -0.879012227f, -0.879742622f, -0.880470872f, -0.881197095f, -0.881921291f, -0.882643342f,
+    -0.883363366f, -0.884081244f, -0.884797096f, -0.885510862f, -0.886222541f, -0.886932135f,
+    -0.887639642f, -0.888345063f, -0.889048338f, -0.889749587f, -0.890448749f, -0.891145766f,
+    -0.891840696f, -0.892533541f, -0.893224299f, -0.893912971f, -0.894599497f, -0.895283937f,
+    -0.895966232f, -0.8966465f, -0.897324562f, -0.898000598f, -0.898674488f, -0.899346232f,
+    -0.900015891f, -0.900683403f, -0.901348829f, -0.902012169f, -0.902673304f, -0.903332353f,
+    -0.903989315f, -0.904644072f, -0.905296743f, -0.905947268f, -0.906595707f, -0.907242f,
+    -0.907886088f, -0.90852809f, -0.909168005f, -0.909805715f, -0.910441279f, -0.911074758f,
+    -0.91170603f, -0.912335157f, -0.912962198f, -0.913587034f, -0.914209783f, -0.914830327f,
+    -0.915448725f, -0.916064978f, -0.916679084f, -0.917290986f, -0.917900801f, -0.91850841f,
+    -0.919113874f, -0.919717133f, -0.920318305f, -0.920917213f, -0.921514034f, -0.92210865f,
+    -0.92270112f, -0.923291445f, -0.923879504f, -0.924465477f, -0.925049245f, -0.925630808f,
+    -0.926210225f, -0.926787496f, -0.927362502f, -0.927935421f, -0.928506076f, -0.929074585f,
+    -0.929640889f, -0.930205047f, -0.93076694f, -0.931326687f, -0.931884289f, -0.932439625f,
+    -0.932992816f, -0.933543801f, -0.934092522f, -0.934639156f, -0.935183525f, -0.935725689f,
+    -0.936265647f, -0.93680346f, -0.937339008f, -0.93787235f, -0.938403547f, -0.938932478f,
+    -0.939459205f, -0.939983726f, -0.940506041f, -0.941026151f, -0.941544056f, -0.942059755f,
+    -0.94257319f, -0.943084419f, -0.943593442f, -0.944100261f, -0.944604814f, -0.945107222f,
+    -0.945607305f, -0.946105242f, -0.946600914f, -0.947094381f, -0.947585583f, -0.948074579f,
+    -0.94856137f, -0.949045897f, -0.949528158f, -0.950008273f, -0.950486064f, -0.950961649f,
+    -0.95143503f, -0.951906145f, -0.952374995f, -0.95284164f, -0.953306019f, -0.953768194f,
+    -0.954228103f, -0.954685748f, -0.955141187f, -0.955594361f, -0.95604527f, -0.956493914f,
+    -0.956940353f, -0.957384527f, -0.957826436f, -0.958266079f, -0.958703458f, -0.959138632f,
+    -0.95957154f, -0.960002124f, -0.960430503f, -0.960856616f, -0.961280465f, -0.961702049f,
+    -0.962121427f, -0.962538481f, -0.962953269f, -0.963365793f, -0.963776052f, -0.964184046f,
+    -0.964589775f, -0.964993238f, -0.965394437f, -0.965793371f, -0.966189981f, -0.966584384f,
+    -0.966976464f, -0.967366278f, -0.967753828f, -0.968139112f, -0.968522072f, -0.968902826f,
+    -0.969281256f, -0.969657362f, -0.970031261f, -0.970402837f, -0.970772147f, -0.971139133f,
+    -0.971503913f, -0.97186631f, -0.972226501f, -0.972584367f, -0.972939968f, -0.973293245f,
+    -0.973644257f, -0.973992944f, -0.974339366f, -0.974683523f, -0.975025356f, -0.975364864f,
+    -0.975702107f, -0.976037085f, -0.976369739f, -0.976700068f, -0.977028131f, -0.977353871f,
+    -0.977677345f, -0.977998495f, -0.97831738f, -0.97863394f, -0.978948176f, -0.979260147f,
+    -0.979569793f, -0.979877114f, -0.980182111f, -0.980484843f, -0.980785251f, -0.981083393f,
+    -0.981379211f, -0.981672704f, -0.981963873f, -0.982252717f, -0.982539296f, -0.982823551f,
+    -0.983105481f, -0.983385086f, -0.983662426f, -0.983937442f, -0.984210074f, -0.984480441f,
+    -0.984748483f, -0.98501426f, -0.985277653f, -0.985538721f, -0.985797524f, -0.986053944f,
+    -0.986308098f, -0.986559927f, -0.986809373f, -0.987056553f, -0.987301409f, -0.987543941f,
+    -0.987784147f, -0.988022029f, -0.988257587f, -0.98849082f, -0.988721669f, -0.988950253f,
+    -0.989176512f, -0.989400446f, -0.989621997f, -0.989841282f, -0.990058184f, -0.99027282f,
+    -0.990485072f, -0.990695f, -0.990902662f, -0.991107941f, -0.991310835f, -0.991511464f,
+    -0.991709769f, -0.991905689f, -0.992099285f, -0.992290616f, -0.992479563f, -0.992666125f,
+    -0.992850423f, -0.993032336f, -0.993211925f, -0.993389189f, -0.993564129f, -0.993736744f,
+    -0.993906975f, -0.994074881f, -0.994240463f, -0.99440366f, -0.994564593f, -0.994723141f,
+    -0.994879305f, -0.995033205f, -0.99518472f, -0.99533391f, -0.995480776f, -0.995625257f,
+    -0.995767415f, -0.995907247f, -0.996044695f, -0.996179819f, -0.996312618f, -0.996443033f,
+    -0.996571124f, -0.996696889f, -0.996820271f, -0.996941328f, -0.997060061f, -0.997176409f,
+    -0.997290432f, -0.997402132f, -0.997511446f, -0.997618437f, -0.997723043f, -0.997825325f,
+    -0.997925282f, -0.998022854f, -0.998118103f, -0.998211026f, -0.998301566f, -0.998389721f,
+    -0.998475552f, -0.998559058f, -0.998640239f, -0.998719037f, -0.99879545f, -0.998869538f,
+    -0.998941302f, -0.999010682f, -0.999077737f, -0.999142408f, -0.999204755f, -0.999264777f,
+    -0.999322355f, -0.999377668f, -0.999430597f, -0.999481201f, -0.999529421f, -0.999575317f,
+    -0.999618828f, -0.999660015f, -0.999698818f, -0.999735296f, -0.99976939f, -0.999801159f,
+    -0.999830604f, -0.999857664f, -0.99988234f, -0.999904692f, -0.999924719f, -0.999942362f,
+    -0.999957621f, -0.999970615f, -0.999981165f, -0.99998939f, -0.999995291f, -0.999998808f,
+    -1.0f, -0.999998808f, -0.999995291f, -0.99998939f, -0.999981165f, -0.999970615f,
+    -0.999957621f, -0.999942362f, -0.999924719f, -0.999904692f, -0.99988234f, -0.999857664f,
+    -0.999830604f, -0.999801159f, -0.99976939f, -0.999735296f, -0.999698818f, -0.999660015f,
+    -0.999618828f, -0.999575317f, -0.999529421f, -0.999481201f, -0.999430597f, -0.999377668f,
+    -0.999322355f, -0.999264777f, -0.999204755f, -0.999142408f, -0.999077737f, -0.999010682f,
+    -0.998941302f, -0.998869538f, -0.99879545f, -0.998719037f, -0.998640239f, -0.998559058f,
+    -0.998475552f, -0.998389721f, -0.998301566f, -0.998211026f, -0.998118103f, -0.998022854f,
+    -0.997925282f, -0.997825325f, -0.997723043f, -0.997618437f, -0.997511446f, -0.997402132f,
+    -0.997290432f, -0.997176409f, -0.997060061f, -0.996941328f, -0.996820271f, -0.996696889f,
+    -0.996571124f, -0.996443033f, -0.996312618f, -0.996179819f, -0.996044695f, -0.995907247f,
+    -0.995767415f, -0.995625257f, -0.995480776f, -0.99533391f, -0.99518472f, -0.995033205f,
+    -0.994879305f, -0.994723141f, -0.994564593f, -0.99440366f, -0.994240463f, -0.994074881f,
+    -0.993906975f, -0.993736744f, -0.993564129f, -0.993389189f, -0.993211925f, -0.993032336f,
+    -0.992850423f, -0.992666125f, -0.992479563f, -0.992290616f, -0.992099285f, -0.991905689f,
+    -0.991709769f, -0.991511464f, -0.991310835f, -0.991107941f, -0.990902662f, -0.990695f,
+    -0.990485072f, -0.99027282f, -0.990058184f, -0.989841282f, -0.989621997f, -0.989400446f,
+    -0.989176512f, -0.988950253f, -0.988721669f, -0.98849082f, -0.988257587f, -0.988022029f,
+    -0.987784147f, -0.987543941f, -0.987301409f, -0.987056553f, -0.986809373f, -0.986559927f,
+    -0.986308098f, -0.986053944f, -0.985797524f, -0.985538721f, -0.985277653f, -0.98501426f,
+    -0.984748483f, -0.984480441f, -0.984210074f, -0.983937442f, -0.983662426f, -0.983385086f,
+    -0.983105481f, -0.982823551f, -0.982539296f, -0.982252717f, -0.981963873f, -0.981672704f,
+    -0.981379211f, -0.981083393f, -0.980785251f, -0.980484843f, -0.980182111f, -0.979877114f,
+    -0.979569793f, -0.979260147f, -0.978948176f, -0.97863394f, -0.97831738f, -0.977998495f,
+    -0.977677345f, -0.977353871f, -0.977028131f, -0.976700068f, -0.976369739f, -0.976037085f,
+    -0.975702107f, -0.975364864f, -0.975025356f, -0.974683523f, -0.974339366f, -0.973992944f,
+    -0.973644257f, -0.973293245f, -0.972939968f, -0.972584367f, -0.972226501f, -0.97186631f,
+    -0.971503913f, -0.971139133f, -0.970772147f, -0.970402837f, -0.970031261f, -0.969657362f,
+    -0.969281256f, -0.968902826f, -0.968522072f, -0.968139112f, -0.967753828f, -0.967366278f,
+    -0.966976464f, -0.966584384f, -0.966189981f, -0.965793371f, -0.965394437f, -0.964993238f,
+    -0.964589775f, -0.964184046f, -0.963776052f, -0.963365793f, -0.962953269f, -0.962538481f,
+    -0.962121427f, -0.961702049f, -0.961280465f, -0.960856616f, -0.960430503f, -0.960002124f,
+    -0.95957154f, -0.959138632f, -0.958703458f, -0.958266079f, -0.957826436f, -0.957384527f,
+    -0.956940353f, -0.956493914f, -0.95604527f, -0.955594361f, -0.955141187f, -0.954685748f,
+    -0.954228103f, -0.953768194f, -0.953306019f, -0.95284164f, -0.952374995f, -0.951906145f,
+    -0.95143503f, -0.950961649f, -0.950486064f, -0.950008273f, -0.949528158f, -0.949045897f,
+    -0.94856137f, -0.948074579f, -0.947585583f, -0.947094381f, -0.946600914f, -0.946105242f,
+    -0.945607305f, -0.945107222f, -0.944604814f, -0.944100261f, -0.943593442f, -0.943084419f,
+    -0.94257319f, -0.942059755f, -0.941544056f, -0.941026151f, -0.940506041f, -0.939983726f,
+    -0.939459205f, -0.938932478f, -0.938403547f, -0.93787235f, -0.937339008f, -0.93680346f,
+    -0.936265647f, -0.935725689f, -0.935183525f, -0.934639156f, -0.934092522f, -0.933543801f,
+    -0.932992816f, -0.932439625f, -0.931884289f, -0.931326687f, -0.93076694f, -0.930205047f,
+    -0.929640889f, -0.929074585f, -0.928506076f, -0.927935421f, -0.927362502f, -0.926787496f,
+    -0.926210225f, -0.925630808f, -0.925049245f, -0.924465477f, -0.923879504f, -0.923291445f,
+    -0.92270112f, -0.92210865f, -0.921514034f, -0.920917213f, -0.920318305f, -0.919717133f,
+    -0.919113874f, -0.91850841f, -0.917900801f, -0.917290986f, -0.916679084f, -0.916064978f,
+    -0.915448725f, -0.914830327f, -0.914209783f, -0.913587034f, -0.912962198f, -0.912335157f,
+    -0.91170603f, -0.911074758f, -0.910441279f, -0.909805715f, -0.909168005f, -0.90852809f,
+    -0.907886088f, -0.907242f, -0.906595707f, -0.905947268f, -0.905296743f, -0.904644072f,
+    -0.903989315f, -0.903332353f, -0.902673304f, -0.902012169f, -0.901348829f, -0.900683403f,
+    -0.900015891f, -0.899346232f, -0.898674488f, -0.898000598f, -0.897324562f, -0.8966465f,
+    -0.895966232f, -0.895283937f, -0.894599497f, -0.893912971f, -0.893224299f, -0.892533541f,
+    -0.891840696f, -0.891145766f, -0.890448749f, -0.889749587f, -0.889048338f, -0.888345063f,
+    -0.887639642f, -0.886932135f, -0.886222541f, -0.885510862f, -0.884797096f, -0.884081244f,
+    -0.883363366f, -0.882643342f, -0.881921291f, -0.881197095f, -0.880470872f, -0.879742622f,
+    -0.879012227f, -0.878279805f, -0.877545297f, -0.876808703f, -0.876070082f, -0.875329375f,
+    -0.874586642f, -0.873841822f, -0.873094976f, -0.872346044f, -0.871595085f, -0.87084204f,
+    -0.870086968f, -0.86932987f, -0.868570685f, -0.867809474f, -0.867046237f, -0.866280973f,
+    -0.865513623f, -0.864744246f, -0.863972843f, -0.863199413f, -0.862423956f, -0.861646473f,
+    -0.860866964f, -0.860085368f, -0.859301805f, -0.858516216f, -0.857728601f, -0.856938958f,
+    -0.856147349f, -0.855353653f, -0.854557991f, -0.853760302f, -0.852960587f, -0.852158904f,
+    -0.851355195f, -0.850549459f, -0.849741757f, -0.848932028f, -0.848120332f, -0.847306609f,
+    -0.84649092f, -0.845673263f, -0.84485358f, -0.84403187f, -0.843208253f, -0.84238261f,
+    -0.841554999f, -0.840725362f, -0.839893818f, -0.839060247f, -0.838224709f, -0.837387204f,
+    -0.836547732f, -0.835706294f, -0.834862888f, -0.834017515f, -0.833170176f, -0.832320869f,
+    -0.831469595f, -0.830616415f, -0.829761207f, -0.828904092f, -0.82804507f, -0.827184021f,
+    -0.826321065f, -0.825456142f, -0.824589312f, -0.823720515f, -0.82284981f, -0.821977139f,
+    -0.8211025f, -0.820225954f, -0.819347501f, -0.81846714f, -0.817584813f, -0.816700578f,
+    -0.815814435f, -0.814926326f, -0.81403631f, -0.813144386f, -0.812250614f, -0.811354876f,
+    -0.81045717f, -0.809557617f, -0.808656156f, -0.807752848f, -0.806847572f, -0.80594039f,
+    -0.805031359f, -0.804120362f, -0.803207517f, -0.802292824f, -0.801376164f, -0.800457656f,
+    -0.799537241f, -0.798614979f, -0.797690868f, -0.796764791f, -0.795836926f, -0.794907153f,
+    -0.793975472f, -0.793041945f, -0.792106569f, -0.791169345f, -0.790230215f, -0.789289236f,
+    -0.78834641f, -0.787401736f, -0.786455214f, -0.785506845f, -0.784556568f, -0.783604503f,
+    -0.78265059f, -0.781694829f, -0.780737221f, -0.779777765f, -0.778816521f, -0.777853429f,
+    -0.77688849f, -0.775921702f, -0.774953127f, -0.773982704f, -0.773010433f, -0.772036374f,
+    -0.771060526f, -0.770082831f, -0.769103348f, -0.768122017f, -0.767138898f, -0.766153991f,
+    -0.765167236f, -0.764178753f, -0.763188422f, -0.762196302f, -0.761202395f, -0.760206699f,
+    -0.759209216f, -0.758209884f, -0.757208824f, -0.756205976f, -0.755201399f, -0.754194975f,
+    -0.753186822f, -0.752176821f, -0.751165152f, -0.750151634f, -0.749136388f, -0.748119354f,
+    -0.747100592f, -0.746080101f, -0.745057762f, -0.744033754f, -0.743007958f, -0.741980433f,
+    -0.740951121f, -0.73992008f, -0.73888731f, -0.737852812f, -0.736816585f, -0.73577857f,
+    -0.734738886f, -0.733697414f, -0.732654274f, -0.731609404f, -0.730562747f, -0.72951442f,
+    -0.728464365f, -0.727412641f, -0.726359129f, -0.725303948f, -0.724247098f, -0.72318846f,
+    -0.722128212f, -0.721066177f, -0.720002532f, -0.718937099f, -0.717870057f, -0.716801286f,
+    -0.715730846f, -0.714658678f, -0.71358484f, -0.712509394f, -0.711432219f, -0.710353374f,
+    -0.709272802f, -0.70819062f, -0.707106769f, -0.706021249f, -0.704934061f, -0.703845263f,
+    -0.702754736f, -0.7016626f, -0.700568795f, -0.699473321f, -0.698376238f, -0.697277486f,
+    -0.696177125f, -0.695075095f, -0.693971455f, -0.692866147f, -0.691759229f, -0.690650702f,
+    -0.689540565f, -0.68842876f, -0.687315345f, -0.686200321f, -0.685083687f, -0.683965385f,
+    -0.682845533f, -0.681724072f, -0.680601001f, -0.679476321f, -0.678350031f, -0.677222192f,
+    -0.676092684f, -0.674961627f, -0.673829019f, -0.672694743f, -0.671558976f, -0.670421541f,
+    -0.669282615f, -0.668142021f, -0.666999936f, -0.665856242f, -0.664710999f, -0.663564146f,
+    -0.662415802f, -0.66126585f, -0.660114348f, -0.658961296f, -0.657806695f, -0.656650543f,
+    -0.655492842f, -0.654333591f, -0.653172851f, -0.65201056f, -0.65084666f, -0.64968133f,
+    -0.64851439f, -0.64734596f, -0.64617604f, -0.645004511f, -0.643831551f, -0.642657042f,
+    -0.641481042f, -0.640303493f, -0.639124453f, -0.637943923f, -0.636761844f, -0.635578334f,
+    -0.634393275f, -0.633206785f, -0.632018745f, -0.630829215f, -0.629638255f, -0.628445745f,
+    -0.627251804f, -0.626056373f, -0.624859512f, -0.623661101f, -0.622461259f, -0.621259987f,
+    -0.620057225f, -0.618852973f, -0.61764729f, -0.616440177f, -0.615231574f, -0.61402154f,
+    -0.612810075f, -0.61159718f, -0.610382795f, -0.609167039f, -0.607949793f, -0.606731117f,
+    -0.605511069f, -0.604289532f, -0.603066623f, -0.601842225f, -0.600616455f, -0.599389315f,
+    -0.598160684f, -0.596930683f, -0.59569931f, -0.594466507f, -0.593232274f, -0.59199667f,
+    -0.590759695f, -0.589521289f, -0.588281572f, -0.587040365f, -0.585797846f, -0.584553957f,
+    -0.583308637f, -0.582062006f, -0.580813944f, -0.579564571f, -0.578313768f, -0.577061653f,
+    -0.575808167f, -0.57455337f, -0.573297143f, -0.572039604f, -0.570780754f, -0.569520533f,
+    -0.568258941f, -0.566996038f, -0.565731823f, -0.564466238f, -0.563199341f, -0.561931133f,
+    -0.560661554f, -0.559390724f, -0.558118522f, -0.556845009f, -0.555570245f, -0.554294109f,
+    -0.553016722f, -0.551737964f, -0.550457954f, -0.549176633f, -0.547894061f, -0.546610177f,
+    -0.545324981f, -0.544038534f, -0.542750776f, -0.541461766f, -0.540171444f, -0.538879931f,
+    -0.537587047f, -0.53629297f, -0.534997642f, -0.533701003f, -0.532403111f, -0.531104028f,
+    -0.529803634f, -0.528501987f, -0.527199149f, -0.525895f, -0.524589658f, -0.523283124f,
+    -0.521975279f, -0.520666242f, -0.519356012f, -0.518044531f, -0.516731799f, -0.515417874f,
+    -0.514102757f, -0.512786388f, -0.511468828f, -0.510150075f, -0.50883013f, -0.507508993f,
+    -0.506186664f, -0.504863083f, -0.50353837f, -0.502212465f, -0.500885367f, -0.499557108f,
+    -0.498227656f, -0.496897042f, -0.495565265f, -0.494232297f, -0.492898196f, -0.491562903f,
+    -0.490226477f, -0.48888889f, -0.487550169f, -0.486210287f, -0.484869242f, -0.483527064f,
+    -0.482183784f, -0.480839342f, -0.479493767f, -0.47814706f, -0.47679922f, -0.475450277f,
+    -0.474100202f, -0.472749025f, -0.471396744f, -0.470043331f, -0.468688816f, -0.467333198f,
+    -0.465976506f, -0.464618683f, -0.463259786f, -0.461899787f, -0.460538715f, -0.45917654f,
+    -0.457813293f, -0.456448972f, -0.455083579f, -0.453717113f, -0.452349573f, -0.450980991f,
+    -0.449611336f, -0.448240608f, -0.446868837f, -0.445496023f, -0.444122136f, -0.442747235f,
+    -0.441371262f, -0.439994276f, -0.438616246f, -0.437237173f, -0.435857087f, -0.434475958f,
+    -0.433093816f, -0.43171066f, -0.430326492f, -0.42894128f, -0.427555084f, -0.426167876f,
+    -0.424779683f, -0.423390478f, -0.422000259f, -0.420609087f, -0.419216901f, -0.417823702f,
+    -0.416429549f, -0.415034413f, -0.413638324f, -0.41224122f, -0.410843164f, -0.409444153f,
+    -0.408044159f, -0.406643212f, -0.405241311f, -0.403838456f, -0.402434647f, -0.401029885f,
+    -0.399624199f, -0.398217559f, -0.396809995f, -0.395401478f, -0.393992037f, -0.392581671f,
+    -0.391170382f, -0.38975817f, -0.388345033f, -0.386931002f, -0.385516047f, -0.384100199f,
+    -0.382683426f, -0.381265759f, -0.379847199f, -0.378427744f, -0.377007425f, -0.375586182f,
+    -0.374164075f, -0.372741073f, -0.371317208f, -0.369892448f, -0.368466824f, -0.367040336f,
+    -0.365612984f, -0.364184797f, -0.362755716f, -0.3613258f, -0.359895051f, -0.358463407f,
+    -0.357030958f, -0.355597675f, -0.354163527f, -0.352728546f, -0.351292759f, -0.349856138f,
+    -0.348418683f, -0.346980423f, -0.345541328f, -0.344101429f, -0.342660725f, -0.341219217f,
+    -0.339776874f, -0.338333756f, -0.336889863f, -0.335445136f, -0.333999664f, -0.332553357f,
+    -0.331106305f, -0.329658449f, -0.328209847f, -0.326760441f, -0.32531029f, -0.323859364f,
+    -0.322407693f, -0.320955247f, -0.319502026f, -0.31804809f, -0.316593379f, -0.315137923f,
+    -0.313681751f, -0.312224805f, -0.310767144f, -0.309308767f, -0.307849646f, -0.306389809f,
+    -0.304929227f, -0.303467959f, -0.302005947f, -0.300543249f, -0.299079835f, -0.297615707f,
+    -0.296150893f, -0.294685364f, -0.293219149f, -0.291752249f, -0.290284663f, -0.288816422f,
+    -0.287347466f, -0.285877824f, -0.284407526f, -0.282936573f, -0.281464934f, -0.27999264f,
+    -0.27851969f, -0.277046084f, -0.275571823f, -0.274096906f, -0.272621363f, -0.271145165f,
+    -0.269668311f, -0.268190861f, -0.266712755f, -0.265234023f, -0.263754666f, -0.262274712f,
+    -0.260794103f, -0.259312928f, -0.257831097f, -0.25634867f, -0.254865646f, -0.253382027f,
+    -0.251897812f, -0.250413001f, -0.248927608f, -0.24744162f, -0.24595505f, -0.244467899f,
+    -0.242980182f, -0.241491884f, -0.24000302f, -0.238513589f, -0.237023607f, -0.235533059f,
+    -0.234041959f, -0.232550308f, -0.231058106f, -0.229565367f, -0.228072077f, -0.226578265f,
+    -0.225083917f, -0.223589033f, -0.222093627f, -0.220597684f, -0.219101235f, -0.21760428f,
+    -0.216106802f, -0.214608818f, -0.213110313f, -0.211611331f, -0.210111842f, -0.208611846f,
+    -0.207111374f, -0.205610409f, -0.204108968f, -0.202607036f, -0.201104641f, -0.199601755f,
+    -0.198098406f, -0.196594596f, -0.195090324f, -0.19358559f, -0.192080393f, -0.19057475f,
+    -0.18906866f, -0.187562123f, -0.186055154f, -0.184547737f, -0.183039889f, -0.181531608f,
+    -0.180022895f, -0.178513765f, -0.177004218f, -0.175494254f, -0.173983872f, -0.172473088f,
+    -0.170961887f, -0.169450298f, -0.167938292f, -0.166425899f, -0.164913118f, -0.16339995f,
+    -0.161886394f, -0.160372451f, -0.15885815f, -0.157343462f, -0.155828401f, -0.154312968f,
+    -0.152797192f, -0.151281044f, -0.149764538f, -0.148247674f, -0.146730468f, -0.145212919f,
+    -0.143695027f, -0.142176807f, -0.140658244f, -0.139139339f, -0.137620121f, -0.136100575f,
+    -0.134580702f, -0.13306053f, -0.13154003f, -0.130019218f, -0.128498107f, -0.126976699f,
+    -0.125454977f, -0.123932973f, -0.122410677f, -0.120888084f, -0.119365215f, -0.117842063f,
+    -0.116318628f, -0.114794925f, -0.113270953f, -0.111746714f, -0.110222206f, -0.108697444f,
+    -0.107172422f, -0.105647154f, -0.104121633f, -0.102595866f, -0.10106986f, -0.0995436162f,
+    -0.0980171412f, -0.0964904279f, -0.0949634984f, -0.093436338f, -0.0919089541f, -0.0903813615f,
+    -0.0888535529f, -0.0873255357f, -0.0857973099f, -0.0842688903f, -0.0827402622f, -0.0812114477f,
+    -0.0796824396f, -0.0781532452f, -0.0766238645f, -0.0750942975f, -0.0735645667f, -0.0720346496f,
+    -0.070504576f, -0.068974331f, -0.0674439222f, -0.0659133494f, -0.0643826276f, -0.0628517568f,
+    -0.061320737f, -0.0597895719f, -0.0582582653f, -0.0567268208f, -0.0551952459f, -0.0536635369f,
+    -0.052131705f, -0.0505997501f, -0.0490676761f, -0.0475354828f, -0.0460031815f, -0.0444707721f,
+    -0.0429382585f, -0.0414056405f, -0.0398729257f, -0.0383401215f, -0.0368072242f, -0.0352742374f,
+    -0.0337411724f, -0.0322080255f, -0.030674804f, -0.029141508f, -0.027608145f, -0.0260747187f,
+    -0.024541229f, -0.0230076816f, -0.0214740802f, -0.0199404284f, -0.0184067301f, -0.0168729872f,
+    -0.015339206f, -0.0138053885f, -0.0122715384f, -0.0107376594f, -0.00920375437f, -0.00766982883f,
+    -0.00613588467f, -0.00460192608f, -0.00306795677f, -0.00153398013f
+};
+
+const uint16_t FFT_bitReverseTable[FFT_MAX_POINTS / 2U] = {
+    0, 1024, 512, 1536, 256, 1280, 768, 1792, 128, 1152, 640, 1664,
+    384, 1408, 896, 1920, 64, 1088, 576, 1600, 320, 1344, 832, 1856,
+    192, 1216, 704, 1728, 448, 1472, 960, 1984, 32, 1056, 544, 1568,
+    288, 1312, 800, 1824, 160, 1184, 672, 1696, 416, 1440, 928, 1952,
+    96, 1120, 608, 1632, 352, 1376, 864, 1888, 224, 1248, 736, 1760,
+    480, 1504, 992, 2016, 16, 1040, 528, 1552, 272, 1296, 784, 1808,
+    144, 1168, 656, 1680, 400, 1424, 912, 1936, 80, 1104, 592, 1616,
+    336, 1360, 848, 1872, 208, 1232, 720, 1744, 464, 1488, 976, 2000,
+    48, 1072, 560, 1584, 304, 1328, 816, 1840, 176, 1200, 688, 1712,
+    432, 1456, 944, 1968, 112, 1136, 624, 1648, 368, 1392, 880, 1904,
+    240, 1264, 752, 1776, 496, 1520, 1008, 2032, 8, 1032, 520, 1544,
+    264, 1288, 776, 1800, 136, 1160, 648, 1672, 392, 1416, 904, 1928,
+    72, 1096, 584, 1608, 328, 1352, 840, 1864, 200, 1224, 712, 1736,
+    456, 1480, 968, 1992, 40, 1064, 552, 1576, 296, 1320, 808, 1832,
+    168, 1192, 680, 1704, 424, 1448, 936, 1960, 104, 1128, 616, 1640,
+    360, 1384, 872, 1896, 232, 1256, 744, 1768, 488, 1512, 1000, 2024,
+    24, 1048, 536, 1560, 280, 1304, 792, 1816, 152, 1176, 664, 1688,
+    408, 1432, 920, 1944, 88, 1112, 600, 1624, 344, 1368, 856, 1880,
+    216, 1240, 728, 1752, 472, 1496, 984, 2008, 56, 1080, 568, 1592,
+    312, 1336, 824, 1848, 184, 1208, 696, 1720, 440, 1464, 952, 1976,
+    120, 1144, 632, 1656, 376, 1400, 888, 1912, 248, 1272, 760, 1784,
+    504, 1528, 1016, 2040, 4, 1028, 516, 1540, 260, 1284, 772, 1796,
+    132, 1156, 644, 1668, 388, 1412, 900, 1924, 68, 1092, 580, 1604,
+    324, 1348, 836, 1860, 196, 1220, 708, 1732, 452, 1476, 964, 1988,
+    36, 1060, 548, 1572, 292, 1316, 804, 1828, 164, 1188, 676, 1700,
+    420, 1444, 932, 1956, 100, 1124, 612, 1636, 356, 1380, 868, 1892,
+    228, 1252, 740, 1764, 484, 1508, 996, 2020, 20, 1044, 532, 1556,
+    276, 1300, 788, 1812, 148, 1172, 660, 1684, 404, 1428, 916, 1940,
+    84, 1108, 596, 1620, 340, 1364, 852, 1876, 212, 1236, 724, 1748,
+    468, 1492, 980, 2004, 52, 1076, 564, 1588, 308, 1332, 820, 1844,
+    180, 1204, 692, 1716, 436, 1460, 948, 1972, 116, 1140, 628, 1652,
+    372, 1396, 884, 1908, 244, 1268, 756, 1780, 500, 1524, 1012, 2036,
+    12, 1036, 524, 1548, 268, 1292, 780, 1804, 140, 1164, 652, 1676,
+    396, 1420, 908, 1932, 76, 1100, 588, 1612, 332, 1356, 844, 1868,
+    204, 1228, 716, 1740, 460, 1484, 972, 1996, 44, 1068, 556, 1580,
+    300, 1324, 812, 1836, 172, 1196, 684, 1708, 428, 1452, 940, 1964,
+    108, 1132, 620, 1644, 364, 1388, 876, 1900, 236, 1260, 748, 1772,
+    492, 1516, 1004, 2028, 28, 1052, 540, 1564, 284, 1308, 796, 1820,
+    156, 1180, 668, 1692, 412, 1436, 924, 1948, 92, 1116, 604, 1628,
+    348, 1372, 860, 1884, 220, 1244, 732, 1756, 476, 1500, 988, 2012,
+    60, 1084, 572, 1596, 316, 1340, 828, 1852, 188, 1212, 700, 1724,
+    444, 1468, 956, 1980, 124, 1148, 636, 1660, 380, 1404, 892, 1916,
+    252, 1276, 764, 1788, 508, 1532, 1020, 2044, 2, 1026, 514, 1538,
+    258, 1282, 770, 1794, 130, 1154, 642, 1666, 386, 1410, 898, 1922,
+    66, 1090, 578, 1602, 322, 1346, 834, 1858, 194, 1218, 706, 1730,
+    450, 1474, 962, 1986, 34, 1058, 546, 1570, 290, 1314, 802, 1826,
+    162, 1186, 674, 1698, 418, 1442, 930, 1954, 98, 1122, 610, 1634,
+    354, 1378, 866, 1890, 226, 1250, 738, 1762, 482, 1506, 994, 2018,
+    18, 1042, 530, 1554, 274, 1298, 786, 1810, 146, 1170, 658, 1682,
+    402, 1426, 914, 1938, 82, 1106, 594, 1618, 338, 1362, 850, 1874,
+    210, 1234, 722, 1746, 466, 1490, 978, 2002, 50, 1074, 562, 1586,
+    306, 1330, 818, 1842, 178, 1202, 690, 1714, 434, 1458, 946, 1970,
+    114, 1138, 626, 1650, 370, 1394, 882, 1906, 242, 1266, 754, 1778,
+    498, 1522, 1010, 2034, 10, 1034, 522, 1546, 266, 1290, 778, 1802,
+    138, 1162, 650, 1674, 394, 1418, 906, 1930, 74, 1098, 586, 1610,
+    330, 1354, 842, 1866, 202, 1226, 714, 1738, 458, 1482, 970, 1994,
+    42, 1066, 554, 1578, 298, 1322, 810, 1834, 170, 1194, 682, 1706,
+    426, 1450, 938, 1962, 106, 1130, 618, 1642, 362, 1386, 874, 1898,
+    234, 1258, 746, 1770, 490, 1514, 1002, 2026, 26, 1050, 538, 1562,
+    282, 1306, 794, 1818, 154, 1178, 666, 1690, 410, 1434, 922, 1946,
+    90, 1114, 602, 1626, 346, 1370, 858, 1882, 218, 1242, 730, 1754,
+    474, 1498, 986, 2010, 58, 1082, 570, 1594, 314, 1338, 826, 1850,
+    186, 1210, 698, 1722, 442, 1466, 954, 1978, 122, 1146, 634, 1658,
+    378, 1402, 890, 1914, 250, 1274, 762, 1786, 506, 1530, 1018, 2042,
+    6, 1030, 518, 1542, 262, 1286, 774, 1798, 134, 1158, 646, 1670,
+    390, 1414, 902, 1926, 70, 1094, 582, 1606, 326, 1350, 838, 1862,
+    198, 1222, 710, 1734, 454, 1478, 966, 1990, 38, 1062, 550, 1574,
+    294, 1318, 806, 1830, 166, 1190, 678, 1702, 422, 1446, 934, 1958,
+    102, 1126, 614, 1638, 358, 1382, 870, 1894, 230, 1254, 742, 1766,
+    486, 1510, 998, 2022, 22, 1046, 534, 1558, 278, 1302, 790, 1814,
+    150, 1174, 662, 1686, 406, 1430, 918, 1942, 86, 1110, 598, 1622,
+    342, 1366, 854, 1878, 214, 1238, 726, 1750, 470, 1494, 982, 2006,
+    54, 1078, 566, 1590, 310, 1334, 822, 1846, 182, 1206, 694, 1718,
+    438, 1462, 950, 1974, 118, 1142, 630, 1654, 374, 1398, 886, 1910,
+    246, 1270, 758, 1782, 502, 1526, 1014, 2038, 14, 1038, 526, 1550,
+    270, 1294, 782, 1806, 142, 1166, 654, 1678, 398, 1422, 910, 1934,
+    78, 1102, 590, 1614, 334, 1358, 846, 1870, 206, 1230, 718, 1742,
+    462, 1486, 974, 1998, 46, 1070, 558, 1582, 302, 1326, 814, 1838,
+    174, 1198, 686, 1710, 430, 1454, 942, 1966, 110, 1134, 622, 1646,
+    366, 1390, 878, 1902, 238, 1262, 750, 1774, 494, 1518, 1006, 2030,
+    30, 1054, 542, 1566, 286, 1310, 798, 1822, 158, 1182, 670, 1694,
+    414, 1438, 926, 1950, 94, 1118, 606, 1630, 350, 1374, 862, 1886,
+    222, 1246, 734, 1758, 478, 1502, 990, 2014, 62, 1086, 574, 1598,
+    318, 1342, 830, 1854, 190, 1214, 702, 1726, 446, 1470, 958, 1982,
+    126, 1150, 638, 1662, 382, 1406, 894, 1918, 254, 1278, 766, 1790,
+    510, 1534, 1022, 2046, 1, 1025, 513, 1537, 257, 1281, 769, 1793,
+    129, 1153, 641, 1665, 385, 1409, 897, 1921, 65, 1089, 577, 1601,
+    321, 1345, 833, 1857, 193, 1217, 705, 1729, 449, 1473, 961, 1985,
+    33, 1057, 545, 1569, 289, 1313, 801, 1825, 161, 1185, 673, 1697,
+    417, 1441, 929, 1953, 97, 1121, 609, 1633, 353, 1377, 865, 1889,
+    225, 1249, 737, 1761, 481, 1505, 993, 2017, 17, 1041, 529, 1553,
+    273, 1297, 785, 1809, 145, 1169, 657, 1681, 401, 1425, 913, 1937,
+    81, 1105, 593, 1617, 337, 1361, 849, 1873, 209, 1233, 721, 1745,
+    465, 1489, 977, 2001, 49, 1073, 561, 1585, 305, 1329, 817, 1841,
+    177, 1201, 689, 1713, 433, 1457, 945, 1969, 113, 1137, 625, 1649,
+    369, 1393, 881, 1905, 241, 1265, 753, 1777, 497, 1521, 1009, 2033,
+    9, 1033, 521, 1545, 265, 1289, 777, 1801, 137, 1161, 649, 1673,
+    393, 1417, 905, 1929, 73, 1097, 585, 1609, 329, 1353, 841, 1865,
+    201, 1225, 713, 1737, 457, 1481, 969, 1993, 41, 1065, 553, 1577,
+    297, 1321, 809, 1833, 169, 1193, 681, 1705, 425, 1449, 937, 1961,
+    105, 1129, 617, 1641, 361, 1385, 873, 1897, 233, 1257, 745, 1769,
+    489, 1513, 1001, 2025, 25, 1049, 537, 1561, 281, 1305, 793, 1817,
+    153, 1177, 665, 1689, 409, 1433, 921, 1945, 89, 1113, 601, 1625,
+    345, 1369, 857, 1881, 217, 1241, 729, 1753, 473, 1497, 985, 2009,
+    57, 1081, 569, 1593, 313, 1337, 825, 1849, 185, 1209, 697, 1721,
+    441, 1465, 953, 1977, 121, 1145, 633, 1657, 377, 1401, 889, 1913,
+    249, 1273, 761, 1785, 505, 1529, 1017, 2041, 5, 1029, 517, 1541,
+    261, 1285, 773, 1797, 133, 1157, 645, 1669, 389, 1413, 901, 1925,
+    69, 1093, 581, 1605, 325, 1349, 837, 1861, 197, 1221, 709, 1733,
+    453, 1477, 965, 1989, 37, 1061, 549, 1573, 293, 1317, 805, 1829,
+    165, 1189, 677, 1701, 421, 1445, 933, 1957, 101, 1125, 613, 1637,
+    357, 1381, 869, 1893, 229, 1253, 741, 1765, 485, 1509, 997, 2021,
+    21, 1045, 533, 1557, 277, 1301, 789, 1813, 149, 1173, 661, 1685,
+    405, 1429, 917, 1941, 85, 1109, 597, 1621, 341, 1365, 853, 1877,
+    213, 1237, 725, 1749, 469, 1493, 981, 2005, 53, 1077, 565, 1589,
+    309, 1333, 821, 1845, 181, 1205, 693, 1717, 437, 1461, 949, 1973,
+    117, 1141, 629, 1653, 373, 1397, 885, 1909, 245, 1269, 757, 1781,
+    501, 1525, 1013, 2037, 13, 1037, 525, 1549, 269, 1293, 781, 1805,
+    141, 1165, 653, 1677, 397, 1421, 909, 1933, 77, 1101, 589, 1613,
+    333, 1357, 845, 1869, 205, 1229, 717, 1741, 461, 1485, 973, 1997,
+    45, 1069, 557, 1581, 301, 1325, 813, 1837, 173, 1197, 685, 1709,
+    429, 1453, 941, 1965, 109, 1133, 621, 1645, 365, 1389, 877, 1901,
+    237, 1261, 749, 1773, 493, 1517, 1005, 2029, 29, 1053, 541, 1565,
+    285, 1309, 797, 1821, 157, 1181, 669, 1693, 413, 1437, 925, 1949,
+    93, 1117, 605, 1629, 349, 1373, 861, 1885, 221, 1245, 733, 1757,
+    477, 1501, 989, 2013, 61, 1085, 573, 1597, 317, 1341, 829, 1853,
+    189, 1213, 701, 1725, 445, 1469, 957, 1981, 125, 1149, 637, 1661,
+    381, 1405, 893, 1917, 253, 1277, 765, 1789, 509, 1533, 1021, 2045,
+    3, 1027, 515, 1539, 259, 1283, 771, 1795, 131, 1155, 643, 1667,
+    387, 1411, 899, 1923, 67, 1091, 579, 1603, 323, 1347, 835, 1859,
+    195, 1219, 707, 1731, 451, 1475, 963, 1987, 35, 1059, 547, 1571,
+    291, 1315, 803, 1827, 163, 1187, 675, 1699, 419, 1443, 931, 1955,
+    99, 1123, 611, 1635, 355, 1379, 867, 1891, 227, 1251, 739, 1763,
+    483, 1507, 995, 2019, 19, 1043, 531, 1555, 275, 1299, 787, 1811,
+    147, 1171, 659, 1683, 403, 1427, 915, 1939, 83, 1107, 595, 1619,
+    339, 1363, 851, 1875, 211, 1235, 723, 1747, 467, 1491, 979, 2003,
+    51, 1075, 563, 1587, 307, 1331, 819, 1843, 179, 1203, 691, 1715,
+    435, 1459, 947, 1971, 115, 1139, 627, 1651, 371, 1395, 883, 1907,
+    243, 1267, 755, 1779, 499, 1523, 1011, 2035, 11, 1035, 523, 1547,
+    267, 1291, 779, 1803, 139, 1163, 651, 1675, 395, 1419, 907, 1931,
+    75, 1099, 587, 1611, 331, 1355, 843, 1867, 203, 1227, 715, 1739,
+    459, 1483, 971, 1995, 43, 1067, 555, 1579, 299, 1323, 811, 1835,
+    171, 1195, 683, 1707, 427, 1451, 939, 1963, 107, 1131, 619, 1643,
+    363, 1387, 875, 1899, 235, 1259, 747, 1771, 491, 1515, 1003, 2027,
+    27, 1051, 539, 1563, 283, 1307, 795, 1819, 155, 1179, 667, 1691,
+    411, 1435, 923, 1947, 91, 1115, 603, 1627, 347, 1371, 859, 1883,
+    219, 1243, 731, 1755, 475, 1499, 987, 2011, 59, 1083, 571, 1595,
+    315, 1339, 827, 1851, 187, 1211, 699, 1723, 443, 1467, 955, 1979,
+    123, 1147, 635, 1659, 379, 1403, 891, 1915, 251, 1275, 763, 1787,
+    507, 1531, 1019, 2043, 7, 1031, 519, 1543, 263, 1287, 775, 1799,
+    135, 1159, 647, 1671, 391, 1415, 903, 1927, 71, 1095, 583, 1607,
+    327, 1351, 839, 1863, 199, 1223, 711, 1735, 455, 1479, 967, 1991,
+    39, 1063, 551, 1575, 295, 1319, 807, 1831, 167, 1191, 679, 1703,
+    423, 1447, 935, 1959, 103, 1127, 615, 1639, 359, 1383, 871, 1895,
+    231, 1255, 743, 1767, 487, 1511, 999, 2023, 23, 1047, 535, 1559,
+    279, 1303, 791, 1815, 151, 1175, 663, 1687, 407, 1431, 919, 1943,
+    87, 1111, 599, 1623, 343, 1367, 855, 1879, 215, 1239, 727, 1751,
+    471, 1495, 983, 2007, 55, 1079, 567, 1591, 311, 1335, 823, 1847,
+    183, 1207, 695, 1719, 439, 1463, 951, 1975, 119, 1143, 631, 1655,
+    375, 1399, 887, 1911, 247, 1271, 759, 1783, 503, 1527, 1015, 2039,
+    15, 1039, 527, 1551, 271, 1295, 783, 1807, 143, 1167, 655, 1679,
+    399, 1423, 911, 1935, 79, 1103, 591, 1615, 335, 1359, 847, 1871,
+    207, 1231, 719, 1743, 463, 1487, 975, 1999, 47, 1071, 559, 1583,
+    303, 1327, 815, 1839, 175, 1199, 687, 1711, 431, 1455, 943, 1967,
+    111, 1135, 623, 1647, 367, 1391, 879, 1903, 239, 1263, 751, 1775,
+    495, 1519, 1007, 2031, 31, 1055, 543, 1567, 287, 1311, 799, 1823,
+    159, 1183, 671, 1695, 415, 1439, 927, 1951, 95, 1119, 607, 1631,
+    351, 1375, 863, 1887, 223, 1247, 735, 1759, 479, 1503, 991, 2015,
+    63, 1087, 575, 1599, 319, 1343, 831, 1855, 191, 1215, 703, 1727,
+    447, 1471, 959, 1983, 127, 1151, 639, 1663, 383, 1407, 895, 1919,
+    255, 1279, 767, 1791, 511, 1535, 1023, 2047
+};
@@ -0,0 +1,21 @@
+// Generated by tools/generateFFTTables.py, do not edit
+#ifndef FFTTABLES_H
+#define FFTTABLES_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdint.h>
+
+/*------------------------------MACROS------------------------------*/
+
+#define FFT_MAX_BITS 12U
+#define FFT_MAX_POINTS (1U << FFT_MAX_BITS) // Largest real transform
+
+/*------------------------------TABLES------------------------------*/
+
+// sin(2 pi i / FFT_MAX_POINTS), cos(x) is FFT_sineTable[i + FFT_MAX_POINTS / 4]
+extern const float FFT_sineTable[FFT_MAX_POINTS];
+// Bit-reversed indices of a complex transform of FFT_MAX_POINTS / 2 points
+extern const uint16_t FFT_bitReverseTable[FFT_MAX_POINTS / 2U];
+
+#endif
@@ -0,0 +1,279 @@
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "filter.h"
+
+/*------------------------------HELPERS------------------------------*/
+
+static inline int16_t saturateQ15(int32_t value) {
+    value = value > 32767L ? 32767L : value;
+    return (int16_t)(value < -32768L ? -32768L : value);
+}
+
+// Pushes one sample into a doubled delay line and returns the new newest position
+#define PUSH_SAMPLE(state, index, taps, sample) \
+    do { \
+        (index) = ((index) == 0U) ? (uint16_t)((taps) - 1U) : (uint16_t)((index) - 1U); \
+        (state)[(index)] = (sample); \
+        (state)[(index) + (taps)] = (sample); \
+    } while (0)
+
+// Q30 dot product of a contiguous window, four MACs per iteration
+static inline int32_t dotQ15(const int16_t *coefficients, const int16_t *window, uint16_t taps) {
+    int32_t accumulator0 = 0L;
+    int32_t accumulator1 = 0L;
+    uint16_t quads = taps >> 2;
+    while (quads --) {
+        accumulator0 += (int32_t)coefficients[0] * window[0];
+        accumulator1 += (int32_t)coefficients[1] * window[1];
+        accumulator0 += (int32_t)coefficients[2] * window[2];
+        accumulator1 += (int32_t)coefficients[3] * window[3];
+        coefficients += 4;
+        window += 4;
+    }
+    uint16_t rest = taps & 3U;
+    while (rest --) {
+        accumulator0 += (int32_t)*coefficients ++ * *window ++;
+    }
+    return accumulator0 + accumulator1;
+}
+
+/*------------------------------CONVERSION------------------------------*/
+
+void FILTER_adcToQ15(const uint16_t *input, int16_t *output, uint16_t length, uint16_t midScale) {
+    uint16_t n;
+    for (n = 0; n < length; n ++) {
+        // 12 bits left-aligned into 16
+        output[n] = (int16_t)(((int32_t)input[n] - (int32_t)midScale) << 4);
+    }
+}
+
+/*------------------------------FIR------------------------------*/
+
+void FILTER_initFIRQ15(FILTER_FIRQ15 *filter, const int16_t *coefficients, int16_t *state, uint16_t numTaps) {
+    uint16_t k;
+    filter->coefficients = coefficients;
+    filter->state = state;
+    filter->numTaps = numTaps;
+    filter->index = 0U;
+    for (k = 0; k < 2U * numTaps; k ++) {
+        state[k] = 0;
+    }
+}
+
+void FILTER_runFIRQ15(FILTER_FIRQ15 *filter, const int16_t *input, int16_t *output, uint16_t length) {
+    const uint16_t taps = filter->numTaps;
+    int16_t *state = filter->state;
+    uint16_t index = filter->index;
+    uint16_t n;
+    for (n = 0; n < length; n ++) {
+        PUSH_SAMPLE(state, index, taps, input[n]);
+        // Rounded back from Q30 to Q15
+        output[n] = saturateQ15((dotQ15(filter->coefficients, &state[index], taps) + (1L << 14)) >> 15);
+    }
+    filter->index = index;
+}
+
+void FILTER_initFIRQ31(FILTER_FIRQ31 *filter, const int32_t *coefficients, int32_t *state, uint16_t numTaps) {
+    uint16_t k;
+    filter->coefficients = coefficients;
+    filter->state = state;
+    filter->numTaps = numTaps;
+    filter->index = 0U;
+    for (k = 0; k < 2U * numTaps; k ++) {
+        state[k] = 0L;
+    }
+}
+
+void FILTER_runFIRQ31(FILTER_FIRQ31 *filter, const int32_t *input, int32_t *output, uint16_t length) {
+    const uint16_t taps = filter->numTaps;
+    int32_t *state = filter->state;
+    uint16_t index = filter->index;
+    uint16_t n;
+    for (n = 0; n < length; n ++) {
+        PUSH_SAMPLE(state, index, taps, input[n]);
+        const int32_t *coefficients = filter->coefficients;
+        const int32_t *window = &state[index];
+        int64_t accumulator0 = 0;
+        int64_t accumulator1 = 0;
+        uint16_t quads = taps >> 2;
+        while (quads --) {
+            accumulator0 += (int64_t)coefficients[0] * window[0];
+            accumulator1 += (int64_t)coefficients[1] * window[1];
+            accumulator0 += (int64_t)coefficients[2] * window[2];
+            accumulator1 += (int64_t)coefficients[3] * window[3];
+            coefficients += 4;
+            window += 4;
+        }
+        uint16_t rest = taps & 3U;
+        while (rest --) {
+            accumulator0 += (int64_t)*coefficients ++ * *window ++;
+        }
+        output[n] = (int32_t)((accumulator0 + accumulator1) >> 31);
+    }
+    filter->index = index;
+}
+
+void FILTER_initFIRF32(FILTER_FIRF32 *filter, const float *coefficients, float *state, uint16_t numTaps) {
+    uint16_t k;
+    filter->coefficients = coefficients;
+    filter->state = state;
+    filter->numTaps = numTaps;
+    filter->index = 0U;
+    for (k = 0; k < 2U * numTaps; k ++) {
+        state[k] = 0.0f;
+    }
+}
+
+void FILTER_runFIRF32(FILTER_FIRF32 *filter, const float *input, float *output, uint16_t length) {
+    const uint16_t taps = filter->numTaps;
+    float *state = filter->state;
+    uint16_t index = filter->index;
+    uint16_t n;
+    for (n = 0; n < length; n ++) {
+        PUSH_SAMPLE(state, index, taps, input[n]);
+        const float *coefficients = filter->coefficients;
+        const float *window = &state[index];
+        float accumulator0 = 0.0f;
+        float accumulator1 = 0.0f;
+        uint16_t quads = taps >> 2;
+        while (quads --) {
+            accumulator0 += coefficients[0] * window[0];
+            accumulator1 += coefficients[1] * window[1];
+            accumulator0 += coefficients[2] * window[2];
+            accumulator1 += coefficients[3] * window[3];
+            coefficients += 4;
+            window += 4;
+        }
+        uint16_t rest = taps & 3U;
+        while (rest --) {
+            accumulator0 += *coefficients ++ * *window ++;
+        }
+        output[n] = accumulator0 + accumulator1;
+    }
+    filter->index = index;
+}
+
+/*------------------------------DECIMATION------------------------------*/
+
+void FILTER_initDecimatorQ15(FILTER_DecimatorQ15 *decimator, const int16_t *coefficients, int16_t *state, uint16_t numTaps, uint16_t factor) {
+    FILTER_initFIRQ15(&decimator->fir, coefficients, state, numTaps);
+    // Factor MUST BE positive
+    decimator->factor = factor == 0U ? 1U : factor;
+    decimator->phase = 0U;
+}
+
+uint16_t FILTER_runDecimatorQ15(FILTER_DecimatorQ15 *decimator, const int16_t *input, int16_t *output, uint16_t length) {
+    const uint16_t taps = decimator->fir.numTaps;
+    int16_t *state = decimator->fir.state;
+    uint16_t index = decimator->fir.index;
+    uint16_t produced = 0U;
+    uint16_t n = 0U;
+    while (n < length) {
+        // Push up to the next output instant, the dropped outputs are never computed
+        uint16_t push = decimator->factor - decimator->phase;
+        if (push > length - n) {
+            push = length - n;
+        }
+        decimator->phase += push;
+        while (push --) {
+            PUSH_SAMPLE(state, index, taps, input[n]);
+            n ++;
+        }
+        if (decimator->phase == decimator->factor) {
+            decimator->phase = 0U;
+            output[produced ++] = saturateQ15((dotQ15(decimator->fir.coefficients, &state[index], taps) + (1L << 14)) >> 15);
+        }
+    }
+    decimator->fir.index = index;
+    return produced;
+}
+
+/*------------------------------IIR------------------------------*/
+
+void FILTER_initBiquadQ31(FILTER_BiquadQ31 *filter, const int32_t *coefficients, int32_t *state, uint16_t numStages) {
+    uint16_t k;
+    filter->coefficients = coefficients;
+    filter->state = state;
+    filter->numStages = numStages;
+    for (k = 0; k < 4U * numStages; k ++) {
+        state[k] = 0L;
+    }
+}
+
+// Stage by stage over the whole block so each stage's coefficients stay in registers
+void FILTER_runBiquadQ31(FILTER_BiquadQ31 *filter, const int32_t *input, int32_t *output, uint16_t length) {
+    const int32_t *coefficients = filter->coefficients;
+    int32_t *state = filter->state;
+    const int32_t *source = input;
+    uint16_t stage;
+    for (stage = 0; stage < filter->numStages; stage ++) {
+        const int32_t b0 = coefficients[0];
+        const int32_t b1 = coefficients[1];
+        const int32_t b2 = coefficients[2];
+        const int32_t a1 = coefficients[3];
+        const int32_t a2 = coefficients[4];
+        int32_t x1 = state[0];
+        int32_t x2 = state[1];
+        int32_t y1 = state[2];
+        int32_t y2 = state[3];
+        uint16_t n;
+        for (n = 0; n < length; n ++) {
+            const int32_t x0 = source[n];
+            const int64_t accumulator = (int64_t)b0 * x0 + (int64_t)b1 * x1 + (int64_t)b2 * x2
+                + (int64_t)a1 * y1 + (int64_t)a2 * y2;
+            const int32_t y0 = (int32_t)(accumulator >> 30);
+            x2 = x1;
+            x1 = x0;
+            y2 = y1;
+            y1 = y0;
+            output[n] = y0;
+        }
+        state[0] = x1;
+        state[1] = x2;
+        state[2] = y1;
+        state[3] = y2;
+        coefficients += 5;
+        state += 4;
+        // Later stages work in place on the output
+        source = output;
+    }
+}
+
+void FILTER_initBiquadF32(FILTER_BiquadF32 *filter, const float *coefficients, float *state, uint16_t numStages) {
+    uint16_t k;
+    filter->coefficients = coefficients;
+    filter->state = state;
+    filter->numStages = numStages;
+    for (k = 0; k < 2U * numStages; k ++) {
+        state[k] = 0.0f;
+    }
+}
+
+void FILTER_runBiquadF32(FILTER_BiquadF32 *filter, const float *input, float *output, uint16_t length) {
+    const float *coefficients = filter->coefficients;
+    float *state = filter->state;
+    const float *source = input;
+    uint16_t stage;
+    for (stage = 0; stage < filter->numStages; stage ++) {
+        const float b0 = coefficients[0];
+        const float b1 = coefficients[1];
+        const float b2 = coefficients[2];
+        const float a1 = coefficients[3];
+        const float a2 = coefficients[4];
+        float s1 = state[0];
+        float s2 = state[1];
+        uint16_t n;
+        for (n = 0; n < length; n ++) {
+            const float x0 = source[n];
+            const float y0 = b0 * x0 + s1;
+            s1 = b1 * x0 + a1 * y0 + s2;
+            s2 = b2 * x0 + a2 * y0;
+            output[n] = y0;
+        }
+        state[0] = s1;
+        state[1] = s2;
+        coefficients += 5;
+        state += 2;
+        source = output;
+    }
+}
@@ -0,0 +1,80 @@
+#ifndef FILTER_H
+#define FILTER_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdint.h>
+
+/*------------------------------TYPES------------------------------*/
+
+// Delay lines are twice the tap count: every sample is written twice so the newest window is always contiguous
+
+// Q15 FIR, int32 accumulator: the sum of |coefficients| must stay below 2.0
+typedef struct {
+    const int16_t *coefficients; // h[0] applies to the newest sample
+    int16_t *state; // 2 * numTaps
+    uint16_t numTaps;
+    uint16_t index; // Newest sample position
+} FILTER_FIRQ15;
+
+// Q31 FIR, int64 accumulator
+typedef struct {
+    const int32_t *coefficients;
+    int32_t *state; // 2 * numTaps
+    uint16_t numTaps;
+    uint16_t index;
+} FILTER_FIRQ31;
+
+typedef struct {
+    const float *coefficients;
+    float *state; // 2 * numTaps
+    uint16_t numTaps;
+    uint16_t index;
+} FILTER_FIRF32;
+
+// FIR decimator by factor, only every factor-th output is computed (taps / factor MACs per input)
+typedef struct {
+    FILTER_FIRQ15 fir;
+    uint16_t factor;
+    uint16_t phase; // Inputs since the last output
+} FILTER_DecimatorQ15;
+
+// Biquad cascade, direct form I, per stage {b0, b1, b2, -a1, -a2} in Q30 and state {x1, x2, y1, y2}
+typedef struct {
+    const int32_t *coefficients; // 5 * numStages
+    int32_t *state; // 4 * numStages
+    uint16_t numStages;
+} FILTER_BiquadQ31;
+
+// Biquad cascade, transposed direct form II, per stage {b0, b1, b2, -a1, -a2} and state {s1, s2}
+typedef struct {
+    const float *coefficients; // 5 * numStages
+    float *state; // 2 * numStages
+    uint16_t numStages;
+} FILTER_BiquadF32;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// 12-bit ADC codes to Q15 around midScale (2048 for a centred input)
+void FILTER_adcToQ15(const uint16_t *input, int16_t *output, uint16_t length, uint16_t midScale);
+
+void FILTER_initFIRQ15(FILTER_FIRQ15 *filter, const int16_t *coefficients, int16_t *state, uint16_t numTaps);
+void FILTER_runFIRQ15(FILTER_FIRQ15 *filter, const int16_t *input, int16_t *output, uint16_t length);
+
+void FILTER_initFIRQ31(FILTER_FIRQ31 *filter, const int32_t *coefficients, int32_t *state, uint16_t numTaps);
+void FILTER_runFIRQ31(FILTER_FIRQ31 *filter, const int32_t *input, int32_t *output, uint16_t length);
+
+void FILTER_initFIRF32(FILTER_FIRF32 *filter, const float *coefficients, float *state, uint16_t numTaps);
+void FILTER_runFIRF32(FILTER_FIRF32 *filter, const float *input, float *output, uint16_t length);
+
+// Returns the number of outputs written, at most (length + factor - 1) / factor
+void FILTER_initDecimatorQ15(FILTER_DecimatorQ15 *decimator, const int16_t *coefficients, int16_t *state, uint16_t numTaps, uint16_t factor);
+uint16_t FILTER_runDecimatorQ15(FILTER_DecimatorQ15 *decimator, const int16_t *input, int16_t *output, uint16_t length);
+
+void FILTER_initBiquadQ31(FILTER_BiquadQ31 *filter, const int32_t *coefficients, int32_t *state, uint16_t numStages);
+void FILTER_runBiquadQ31(FILTER_BiquadQ31 *filter, const int32_t *input, int32_t *output, uint16_t length);
+
+void FILTER_initBiquadF32(FILTER_BiquadF32 *filter, const float *coefficients, float *state, uint16_t numStages);
+void FILTER_runBiquadF32(FILTER_BiquadF32 *filter, const float *input, float *output, uint16_t length);
+
+#endif
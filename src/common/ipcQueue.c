@@ -0,0 +1,189 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "device.h"
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "ipcQueue.h"
+#include "report.h"
+
+/*------------------------------GLOBAL VARIABLES------------------------------*/
+
+// Writable by CPU1 only, read by CPU2
+#pragma DATA_SECTION(IPCQ_cpu1ToCPU2, "MSGRAM_CPU1_TO_CPU2")
+IPCQ_MessageRAM IPCQ_cpu1ToCPU2;
+// Writable by CPU2 only, read by CPU1
+#pragma DATA_SECTION(IPCQ_cpu2ToCPU1, "MSGRAM_CPU2_TO_CPU1")
+IPCQ_MessageRAM IPCQ_cpu2ToCPU1;
+
+/*------------------------------HELPERS------------------------------*/
+
+// Bit length of value (0 for 0), clamped to the last bin
+static uint16_t binOf(uint32_t value) {
+    uint16_t bin = 0U;
+    while (value != 0UL && bin < IPCQ_BINS - 1U) {
+        value >>= 1;
+        bin ++;
+    }
+    return bin;
+}
+
+static void report(const void *object, REPORT_Writer write, void *context) {
+    IPCQ_dump((const IPCQ_Link *)object, write, context);
+}
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+void IPCQ_init(IPCQ_Link *link, IPC_Type_t ipcType, uint32_t flag) {
+    link->ipcType = ipcType;
+    link->flag = flag;
+    const bool onCPU1 = ipcType == IPC_CPU1_L_CPU2_R;
+    link->local = onCPU1 ? &IPCQ_cpu1ToCPU2 : &IPCQ_cpu2ToCPU1;
+    link->remote = onCPU1 ? &IPCQ_cpu2ToCPU1 : &IPCQ_cpu1ToCPU2;
+    // Only this core's side: the other one is read-only from here and cleared by its owner
+    link->local->head = 0U;
+    link->local->tail = 0U;
+    link->sequence = 0U;
+    link->expected = 0U;
+    link->measured = 0U;
+    memset(&link->statistics, 0, sizeof(link->statistics));
+    link->statistics.minimumLatency = 0xFFFFFFFFUL;
+    // Both ends share one registry in a host simulation, each core has its own on the target
+    REPORT_register(onCPU1 ? "ipcCPU1" : "ipcCPU2", &report, link);
+}
+
+void IPCQ_commit(IPCQ_Link *link, uint16_t type, uint16_t length) {
+    IPCQ_MessageRAM *local = link->local;
+    const uint16_t head = local->head;
+    IPCQ_Block *block = &local->slots[head & IPCQ_MASK];
+    block->type = type;
+    block->length = length;
+    block->sequence = link->sequence ++;
+    block->stamp = (uint32_t)IPC_getCounter(link->ipcType);
+    // Block written before the other core can see it
+    IPCQ_BARRIER();
+    local->head = head + 1U;
+    IPCQ_Statistics *statistics = &link->statistics;
+    statistics->sent ++;
+    statistics->sentWords += length;
+    const uint16_t used = (uint16_t)(head + 1U - link->remote->tail);
+    if (used > statistics->highWater) {
+        statistics->highWater = used;
+    }
+    // A pending doorbell already wakes the other core, which drains everything committed
+    if (!IPC_isFlagBusyLtoR(link->ipcType, link->flag)) {
+        IPC_setFlagLtoR(link->ipcType, link->flag);
+        statistics->doorbells ++;
+    }
+}
+
+bool IPCQ_send(IPCQ_Link *link, uint16_t type, const uint16_t *words, uint16_t length) {
+    if (length > IPCQ_PAYLOAD) {
+        length = IPCQ_PAYLOAD;
+    }
+    IPCQ_Block *block = IPCQ_reserve(link);
+    if (block == 0) {
+        return false;
+    }
+    memcpy(block->payload, words, length * sizeof(uint16_t));
+    IPCQ_commit(link, type, length);
+    return true;
+}
+
+const IPCQ_Block *IPCQ_peek(IPCQ_Link *link) {
+    const uint16_t tail = link->local->tail;
+    if (link->remote->head == tail) {
+        return 0;
+    }
+    // Index read before the block it publishes
+    IPCQ_BARRIER();
+    const IPCQ_Block *block = &link->remote->slots[tail & IPCQ_MASK];
+    if (link->measured == tail) {
+        // First look at this block: latency from its commit, sequence and throughput
+        const uint64_t now = IPC_getCounter(link->ipcType);
+        const uint32_t latency = (uint32_t)now - block->stamp;
+        IPCQ_Statistics *statistics = &link->statistics;
+        if (statistics->received == 0UL) {
+            statistics->firstArrival = now;
+        }
+        statistics->lastArrival = now;
+        statistics->received ++;
+        statistics->receivedWords += block->length;
+        if (block->sequence != link->expected) {
+            statistics->sequenceErrors ++;
+        }
+        link->expected = block->sequence + 1U;
+        statistics->totalLatency += latency;
+        statistics->latencyHistogram[binOf(latency)] ++;
+        if (latency < statistics->minimumLatency) {
+            statistics->minimumLatency = latency;
+        }
+        if (latency > statistics->maximumLatency) {
+            statistics->maximumLatency = latency;
+        }
+        link->measured = tail + 1U;
+    }
+    return block;
+}
+
+void IPCQ_release(IPCQ_Link *link) {
+    // Block read before the other core may overwrite it
+    IPCQ_BARRIER();
+    link->local->tail ++;
+}
+
+void IPCQ_handleInterrupt(IPCQ_Link *link) {
+    IPC_ackFlagRtoL(link->ipcType, link->flag);
+    link->statistics.interrupts ++;
+}
+
+void IPCQ_dump(const IPCQ_Link *link, REPORT_Writer write, void *context) {
+    const IPCQ_Statistics *statistics = &link->statistics;
+    char line[IPCQ_LINE_LENGTH];
+    const bool onCPU1 = link->ipcType == IPC_CPU1_L_CPU2_R;
+    snprintf(line, sizeof(line), "IPC %s: sent %lu blocks %lu words, full %lu, high water %u/%u, doorbells %lu",
+             onCPU1 ? "CPU1 to CPU2" : "CPU2 to CPU1", (unsigned long)statistics->sent, (unsigned long)statistics->sentWords,
+             (unsigned long)statistics->full, statistics->highWater, IPCQ_SLOTS, (unsigned long)statistics->doorbells);
+    write(line, context);
+    if (statistics->received == 0UL) {
+        return;
+    }
+    // Throughput over the receiving time, in SYSCLK ticks of the IPC counter
+    const float span = (float)(statistics->lastArrival - statistics->firstArrival) / (float)DEVICE_SYSCLK_FREQ;
+    const float rate = span > 0.0f ? (float)(statistics->received - 1UL) / span : 0.0f;
+    snprintf(line, sizeof(line), "IPC %s: received %lu blocks (%.0f/s, %.0f words/s), sequence errors %lu, interrupts %lu",
+             onCPU1 ? "CPU2 to CPU1" : "CPU1 to CPU2", (unsigned long)statistics->received, rate,
+             rate * (float)statistics->receivedWords / (float)statistics->received, (unsigned long)statistics->sequenceErrors,
+             (unsigned long)statistics->interrupts);
+    write(line, context);
+    snprintf(line, sizeof(line), "  latency min %lu mean %lu max %lu ticks",
+             (unsigned long)statistics->minimumLatency, (unsigned long)(statistics->totalLatency / statistics->received),
+             (unsigned long)statistics->maximumLatency);
+    write(line, context);
+    // Bin upper bounds as powers of two, the last one open
+    int length = snprintf(line, sizeof(line), "  latency");
+    uint16_t bin;
+    for (bin = 0; bin < IPCQ_BINS; bin ++) {
+        if (statistics->latencyHistogram[bin] == 0UL) {
+            continue;
+        }
+        const int added = (bin == IPCQ_BINS - 1U)
+            ? snprintf(line + length, sizeof(line) - length, " >=2^%u:%lu", bin - 1U, (unsigned long)statistics->latencyHistogram[bin])
+            : snprintf(line + length, sizeof(line) - length, " <2^%u:%lu", bin, (unsigned long)statistics->latencyHistogram[bin]);
+        if (added < 0 || length + added >= (int)sizeof(line)) {
+            // Line full: flush it and carry on with the bin that did not fit
+            line[length] = '\0';
+            write(line, context);
+            length = snprintf(line, sizeof(line), "   ");
+            bin --;
+            continue;
+        }
+        length += added;
+    }
+    write(line, context);
+}
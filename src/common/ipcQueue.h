@@ -0,0 +1,133 @@
+#ifndef IPCQUEUE_H
+#define IPCQUEUE_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "ipc.h"
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "report.h"
+
+/*------------------------------MACROS------------------------------*/
+
+// Ring of blocks each way, one IPCQ_MessageRAM must fit a 1K-word MSGRAM
+#define IPCQ_SLOTS 8U // Power of two
+#define IPCQ_PAYLOAD 64U // Words per block
+#define IPCQ_MASK (IPCQ_SLOTS - 1U)
+
+// Latency histogram bin n counts values in [2^(n - 1), 2^n) SYSCLK ticks, the last bin everything above
+#define IPCQ_BINS 24U
+#define IPCQ_LINE_LENGTH 128U
+
+// Orders the block before the index that publishes it, as the other core sees them. On the C28x both cores
+// reach the MSGRAM in program order and volatile keeps the compiler's; host threads need a full fence
+#if defined(__GNUC__)
+#define IPCQ_BARRIER() __sync_synchronize()
+#else
+#define IPCQ_BARRIER()
+#endif
+
+/*------------------------------TYPES------------------------------*/
+
+typedef struct {
+    uint16_t type; // Defined by the programs on both ends
+    uint16_t length; // Payload words used
+    uint16_t sequence; // Per link, checked by the receiver
+    uint32_t stamp; // IPC counter at commit, low word
+    uint16_t payload[IPCQ_PAYLOAD];
+} IPCQ_Block;
+
+// Everything one core writes for a link: its outgoing ring, and how far it has read the other core's ring.
+// Each core writes only its own MSGRAM, so the head and the tail of a ring live on different sides
+typedef struct {
+    IPCQ_Block slots[IPCQ_SLOTS];
+    volatile uint16_t head; // Free-running, blocks committed to the other core
+    volatile uint16_t tail; // Free-running, blocks of the other core released
+} IPCQ_MessageRAM;
+
+typedef struct {
+    // Sent
+    uint32_t sent;
+    uint32_t sentWords;
+    uint32_t full; // Blocks refused on a full ring
+    uint16_t highWater; // Most blocks waiting in the outgoing ring
+    uint32_t doorbells; // IPC flags raised on the other core
+    // Received
+    uint32_t received;
+    uint32_t receivedWords;
+    uint32_t sequenceErrors;
+    uint32_t interrupts; // IPC interrupts taken
+    uint32_t minimumLatency; // Commit to first look, SYSCLK ticks
+    uint32_t maximumLatency;
+    uint64_t totalLatency;
+    uint32_t latencyHistogram[IPCQ_BINS];
+    uint64_t firstArrival; // IPC counter, throughput over the receiving time
+    uint64_t lastArrival;
+} IPCQ_Statistics;
+
+// One core's end of the link: sends on its own ring, receives on the other core's
+typedef struct {
+    IPC_Type_t ipcType;
+    uint32_t flag; // Doorbell, one of IPC_FLAG0 to IPC_FLAG3: raised after a commit, acknowledged when the other core rings
+    IPCQ_MessageRAM *local;
+    const IPCQ_MessageRAM *remote;
+    uint16_t sequence; // Next block sent
+    uint16_t expected; // Next block received
+    uint16_t measured; // Received blocks whose latency is already counted, free-running
+    IPCQ_Statistics statistics; // Written by the background of this core only
+} IPCQ_Link;
+
+/*------------------------------GLOBAL VARIABLES------------------------------*/
+
+// Message RAMs, placed by the linker command files of both programs at the same addresses (NOINIT sections)
+extern IPCQ_MessageRAM IPCQ_cpu1ToCPU2;
+extern IPCQ_MessageRAM IPCQ_cpu2ToCPU1;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// Clears this core's side, then both cores must meet in IPC_sync before the first send; both ends use the same flag
+void IPCQ_init(IPCQ_Link *link, IPC_Type_t ipcType, uint32_t flag);
+
+// Background: copies length words (up to IPCQ_PAYLOAD) into a block; false when the ring is full
+bool IPCQ_send(IPCQ_Link *link, uint16_t type, const uint16_t *words, uint16_t length);
+
+// Background: one block received, or 0; peek again returns the same block until IPCQ_release
+const IPCQ_Block *IPCQ_peek(IPCQ_Link *link);
+void IPCQ_release(IPCQ_Link *link);
+
+// IPC ISR of the link's flag: acknowledges it, the background drains the ring
+void IPCQ_handleInterrupt(IPCQ_Link *link);
+
+// Background: counters, latency histogram and throughput, line by line
+void IPCQ_dump(const IPCQ_Link *link, REPORT_Writer write, void *context);
+
+// Zero copy send: the next free block or 0 (counted as full), filled in place and then committed
+static inline IPCQ_Block *IPCQ_reserve(IPCQ_Link *link) {
+    const uint16_t used = (uint16_t)(link->local->head - link->remote->tail);
+    if (used >= IPCQ_SLOTS) {
+        link->statistics.full ++;
+        return 0;
+    }
+    return &link->local->slots[link->local->head & IPCQ_MASK];
+}
+
+// Publishes the reserved block and rings the other core, unless its doorbell is still pending
+void IPCQ_commit(IPCQ_Link *link, uint16_t type, uint16_t length);
+
+// Blocks that can be reserved without being refused
+static inline uint16_t IPCQ_free(const IPCQ_Link *link) {
+    return (uint16_t)(IPCQ_SLOTS - (uint16_t)(link->local->head - link->remote->tail));
+}
+
+// Blocks waiting from the other core
+static inline uint16_t IPCQ_pending(const IPCQ_Link *link) {
+    return (uint16_t)(link->remote->head - link->local->tail);
+}
+
+#endif
@@ -0,0 +1,209 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdio.h>
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "isrProfiler.h"
+#include "report.h"
+
+/*------------------------------GLOBAL VARIABLES------------------------------*/
+
+uint32_t PROF_timebaseBase;
+
+// Profiles reported by PROF_dump
+static PROF_Profile *profiles[PROF_MAX_PROFILES];
+static uint16_t profileCount;
+
+/*------------------------------HELPERS------------------------------*/
+
+// Bit length of value (0 for 0), clamped to the last bin; binary search, constant time
+static uint16_t binOf(uint32_t value) {
+    uint16_t bin = 0U;
+    if (value >= 0x10000UL) {
+        value >>= 16;
+        bin += 16U;
+    }
+    if (value >= 0x100UL) {
+        value >>= 8;
+        bin += 8U;
+    }
+    if (value >= 0x10UL) {
+        value >>= 4;
+        bin += 4U;
+    }
+    if (value >= 0x4UL) {
+        value >>= 2;
+        bin += 2U;
+    }
+    if (value >= 0x2UL) {
+        value >>= 1;
+        bin += 1U;
+    }
+    bin += (uint16_t)value;
+    return bin < PROF_BINS ? bin : PROF_BINS - 1U;
+}
+
+static void dumpHistogram(const char *title, const uint32_t *histogram, REPORT_Writer write, void *context) {
+    char line[PROF_LINE_LENGTH];
+    int length = snprintf(line, sizeof(line), "  %s", title);
+    uint16_t bin;
+    for (bin = 0; bin < PROF_BINS; bin ++) {
+        if (histogram[bin] == 0UL) {
+            continue;
+        }
+        // Bin upper bounds as powers of two, the last one open
+        const int added = (bin == PROF_BINS - 1U)
+            ? snprintf(line + length, sizeof(line) - length, " >=2^%u:%lu", bin - 1U, (unsigned long)histogram[bin])
+            : snprintf(line + length, sizeof(line) - length, " <2^%u:%lu", bin, (unsigned long)histogram[bin]);
+        if (added < 0 || length + added >= (int)sizeof(line)) {
+            // Line full: flush it and carry on with the bin that did not fit
+            line[length] = '\0';
+            write(line, context);
+            length = snprintf(line, sizeof(line), "   ");
+            bin --;
+            continue;
+        }
+        length += added;
+    }
+    write(line, context);
+}
+
+// Every profile in one report, the list is the module's
+static void report(const void *object, REPORT_Writer write, void *context) {
+    (void)object;
+    PROF_dump(write, context);
+}
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+void PROF_initTimebase(uint32_t timerBase) {
+    PROF_timebaseBase = timerBase;
+    CPUTimer_stopTimer(timerBase);
+    CPUTimer_setPreScaler(timerBase, CPUTIMER_CLOCK_PRESCALER_1);
+    CPUTimer_setPeriod(timerBase, 0xFFFFFFFFUL);
+    CPUTimer_disableInterrupt(timerBase);
+    CPUTimer_reloadTimerCounter(timerBase);
+    CPUTimer_startTimer(timerBase);
+}
+
+void PROF_init(PROF_Profile *profile, const char *name, uint32_t expectedPeriod) {
+    profile->name = name;
+    profile->expectedPeriod = expectedPeriod;
+    profile->triggerTimerBase = 0UL;
+    profile->triggerTimerPeriod = 0UL;
+    profile->entry = 0UL;
+    profile->latency = 0UL;
+    profile->lastEntry = 0UL;
+    profile->started = 0U;
+    profile->sequence = 0U;
+    volatile PROF_Statistics *statistics = &profile->statistics;
+    statistics->calls = 0UL;
+    statistics->overruns = 0UL;
+    statistics->lateArrivals = 0UL;
+    statistics->minimumExecution = 0xFFFFFFFFUL;
+    statistics->maximumExecution = 0UL;
+    statistics->maximumJitter = 0UL;
+    statistics->maximumLatency = 0UL;
+    statistics->totalExecution = 0ULL;
+    uint16_t bin;
+    for (bin = 0; bin < PROF_BINS; bin ++) {
+        statistics->executionHistogram[bin] = 0UL;
+        statistics->jitterHistogram[bin] = 0UL;
+    }
+    if (profileCount < PROF_MAX_PROFILES) {
+        if (profileCount == 0U) {
+            REPORT_register("profiler", &report, 0);
+        }
+        profiles[profileCount ++] = profile;
+    }
+}
+
+void PROF_setTriggerTimer(PROF_Profile *profile, uint32_t timerBase, uint32_t timerPeriod) {
+    profile->triggerTimerBase = timerBase;
+    profile->triggerTimerPeriod = timerPeriod;
+}
+
+void PROF_exit(PROF_Profile *profile) {
+    const uint32_t entry = profile->entry;
+    const uint32_t execution = PROF_now() - entry;
+    volatile PROF_Statistics *statistics = &profile->statistics;
+    profile->sequence ++;
+    statistics->calls ++;
+    statistics->totalExecution += execution;
+    statistics->executionHistogram[binOf(execution)] ++;
+    if (execution < statistics->minimumExecution) {
+        statistics->minimumExecution = execution;
+    }
+    if (execution > statistics->maximumExecution) {
+        statistics->maximumExecution = execution;
+    }
+    if (execution > profile->expectedPeriod) {
+        statistics->overruns ++;
+    }
+    if (profile->triggerTimerBase != 0UL && profile->latency > statistics->maximumLatency) {
+        statistics->maximumLatency = profile->latency;
+    }
+    // Jitter needs two entries
+    if (profile->started) {
+        // Signed: an entry stamped before the last one is early, not 2^32 ticks late
+        const int32_t interArrival = (int32_t)(entry - profile->lastEntry);
+        const int32_t deviation = interArrival - (int32_t)profile->expectedPeriod;
+        const uint32_t jitter = deviation < 0L ? (uint32_t)(-deviation) : (uint32_t)deviation;
+        statistics->jitterHistogram[binOf(jitter)] ++;
+        if (jitter > statistics->maximumJitter) {
+            statistics->maximumJitter = jitter;
+        }
+        if (interArrival > (int32_t)(profile->expectedPeriod + profile->expectedPeriod / 2UL)) {
+            statistics->lateArrivals ++;
+        }
+    }
+    profile->lastEntry = entry;
+    profile->started = 1U;
+    profile->sequence ++;
+}
+
+void PROF_read(const PROF_Profile *profile, PROF_Statistics *statistics) {
+    uint16_t sequence;
+    do {
+        sequence = profile->sequence;
+        const volatile PROF_Statistics *source = &profile->statistics;
+        statistics->calls = source->calls;
+        statistics->overruns = source->overruns;
+        statistics->lateArrivals = source->lateArrivals;
+        statistics->minimumExecution = source->minimumExecution;
+        statistics->maximumExecution = source->maximumExecution;
+        statistics->maximumJitter = source->maximumJitter;
+        statistics->maximumLatency = source->maximumLatency;
+        statistics->totalExecution = source->totalExecution;
+        uint16_t bin;
+        for (bin = 0; bin < PROF_BINS; bin ++) {
+            statistics->executionHistogram[bin] = source->executionHistogram[bin];
+            statistics->jitterHistogram[bin] = source->jitterHistogram[bin];
+        }
+    // Retry if the ISR ran while the statistics were copied
+    } while ((sequence & 1U) || profile->sequence != sequence);
+}
+
+void PROF_dump(REPORT_Writer write, void *context) {
+    // One profile at a time, too big for the stack of every caller
+    static PROF_Statistics statistics;
+    char line[PROF_LINE_LENGTH];
+    uint16_t index;
+    for (index = 0; index < profileCount; index ++) {
+        const PROF_Profile *profile = profiles[index];
+        PROF_read(profile, &statistics);
+        const uint32_t mean = statistics.calls ? (uint32_t)(statistics.totalExecution / statistics.calls) : 0UL;
+        snprintf(line, sizeof(line), "%s calls %lu period %lu overruns %lu late %lu (SYSCLK ticks)", profile->name,
+                 (unsigned long)statistics.calls, (unsigned long)profile->expectedPeriod,
+                 (unsigned long)statistics.overruns, (unsigned long)statistics.lateArrivals);
+        write(line, context);
+        snprintf(line, sizeof(line), "  execution min %lu mean %lu max %lu jitter max %lu latency max %lu",
+                 statistics.calls ? (unsigned long)statistics.minimumExecution : 0UL, (unsigned long)mean,
+                 (unsigned long)statistics.maximumExecution, (unsigned long)statistics.maximumJitter,
+                 (unsigned long)statistics.maximumLatency);
+        write(line, context);
+        dumpHistogram("execution", statistics.executionHistogram, write, context);
+        dumpHistogram("jitter", statistics.jitterHistogram, write, context);
+    }
+}
@@ -0,0 +1,91 @@
+#ifndef ISRPROFILER_H
+#define ISRPROFILER_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdint.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "cputimer.h"
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "report.h"
+
+/*------------------------------MACROS------------------------------*/
+
+// Histogram bin n counts values in [2^(n - 1), 2^n) SYSCLK ticks, the last bin everything above
+#define PROF_BINS 24U
+#define PROF_MAX_PROFILES 8U
+#define PROF_LINE_LENGTH 128U
+
+/*------------------------------TYPES------------------------------*/
+
+// Statistics of one ISR, written only by that ISR
+typedef struct {
+    uint32_t calls;
+    uint32_t overruns; // Execution time above the expected period
+    uint32_t lateArrivals; // Inter-arrival time above 1.5 expected periods (missed or delayed trigger)
+    uint32_t minimumExecution;
+    uint32_t maximumExecution; // Watermarks in SYSCLK ticks
+    uint32_t maximumJitter; // |inter-arrival - expected period|
+    uint32_t maximumLatency; // Trigger timer reload to ISR entry, when a trigger timer is set
+    uint64_t totalExecution;
+    uint32_t executionHistogram[PROF_BINS];
+    uint32_t jitterHistogram[PROF_BINS];
+} PROF_Statistics;
+
+typedef struct {
+    const char *name;
+    uint32_t expectedPeriod; // SYSCLK ticks between calls
+    // Optional CPU timer that triggers the ISR, for the entry latency
+    uint32_t triggerTimerBase;
+    uint32_t triggerTimerPeriod; // PRD register value
+    // ISR side
+    uint32_t entry;
+    uint32_t latency;
+    uint32_t lastEntry;
+    uint16_t started;
+    volatile uint16_t sequence; // Odd while the statistics are being written
+    volatile PROF_Statistics statistics;
+} PROF_Profile;
+
+/*------------------------------GLOBAL VARIABLES------------------------------*/
+
+// Free-running time base, set by PROF_initTimebase
+extern uint32_t PROF_timebaseBase;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// Starts a CPU timer (1 or 2) counting SYSCLK ticks from 0xFFFFFFFF, its interrupt stays off
+void PROF_initTimebase(uint32_t timerBase);
+
+// Also adds the profile to the report of PROF_dump
+void PROF_init(PROF_Profile *profile, const char *name, uint32_t expectedPeriod);
+void PROF_setTriggerTimer(PROF_Profile *profile, uint32_t timerBase, uint32_t timerPeriod);
+
+// Increasing timestamp in SYSCLK ticks, wraps every 2^32 ticks
+static inline uint32_t PROF_now(void) {
+    return 0xFFFFFFFFUL - CPUTimer_getTimerCount(PROF_timebaseBase);
+}
+
+// First statement of the ISR
+static inline void PROF_enter(PROF_Profile *profile) {
+    profile->entry = PROF_now();
+    if (profile->triggerTimerBase != 0UL) {
+        // The trigger timer counts down from its period after the interrupt
+        profile->latency = profile->triggerTimerPeriod - CPUTimer_getTimerCount(profile->triggerTimerBase);
+    }
+}
+
+// Last statement of the ISR, before the group acknowledge
+void PROF_exit(PROF_Profile *profile);
+
+// Copies the statistics, safe against a concurrent PROF_exit
+void PROF_read(const PROF_Profile *profile, PROF_Statistics *statistics);
+
+// Background: one text report of every profile, line by line
+void PROF_dump(REPORT_Writer write, void *context);
+
+#endif
@@ -0,0 +1,42 @@
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "modulation.h"
+
+/*------------------------------HELPERS------------------------------*/
+
+static uint16_t maximumIndex(MOD_Mode mode) {
+    return mode == MOD_SPACE_VECTOR ? MOD_INDEX_MAX_SPACE_VECTOR : MOD_INDEX_ONE;
+}
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+void MOD_init(MOD_Modulator *modulator, float tickFrequency, MOD_Mode mode) {
+    DDS_init(&modulator->angle, tickFrequency);
+    modulator->index = 0U;
+    modulator->mode = mode;
+}
+
+void MOD_setFrequency(MOD_Modulator *modulator, float frequency) {
+    // Tuning word written in one 32-bit store, the ISR never sees half of it
+    DDS_setFrequency(&modulator->angle, frequency);
+}
+
+void MOD_setIndex(MOD_Modulator *modulator, float index) {
+    const uint16_t maximum = maximumIndex(modulator->mode);
+    if (index <= 0.0f) {
+        modulator->index = 0U;
+    } else if (index * (float)MOD_INDEX_ONE >= (float)maximum) {
+        // Above the linear range the legs would clip
+        modulator->index = maximum;
+    } else {
+        modulator->index = (uint16_t)(index * (float)MOD_INDEX_ONE + 0.5f);
+    }
+}
+
+void MOD_setMode(MOD_Modulator *modulator, MOD_Mode mode) {
+    modulator->mode = mode;
+    // Back to sine-triangle: keep the index in its narrower range
+    if (modulator->index > maximumIndex(mode)) {
+        modulator->index = maximumIndex(mode);
+    }
+}
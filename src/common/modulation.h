@@ -0,0 +1,87 @@
+#ifndef MODULATION_H
+#define MODULATION_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdint.h>
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "dds.h"
+
+/*------------------------------MACROS------------------------------*/
+
+#define MOD_PHASES 3U
+
+// Modulation index in Q14: 1.0 is a phase voltage peak of half the DC bus
+#define MOD_INDEX_ONE 16384U
+// Linear range: 1.0 for sine-triangle, 2/sqrt(3) with the space-vector zero sequence
+#define MOD_INDEX_MAX_SPACE_VECTOR 18918U
+
+// 120 degrees of the 32-bit angle
+#define MOD_THIRD_TURN 0x55555555UL
+
+// Duty cycle in Q15 (PWMUPDATE_DUTY_ONE is 100 %), 50 % is the zero voltage of a leg
+#define MOD_DUTY_ONE 32768L
+#define MOD_DUTY_HALF 16384L
+
+/*------------------------------TYPES------------------------------*/
+
+typedef enum {
+    MOD_SINE_TRIANGLE, // Sine references straight onto the carrier
+    MOD_SPACE_VECTOR // Min-max zero sequence added, same duties as symmetric SVPWM
+} MOD_Mode;
+
+typedef struct {
+    DDS_Generator angle; // Electrical angle, advanced once per tick
+    volatile uint16_t index; // Q14, clamped to the linear range of the mode
+    volatile MOD_Mode mode;
+} MOD_Modulator;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// tickFrequency is the rate of MOD_step, one compare update per carrier period or half period
+void MOD_init(MOD_Modulator *modulator, float tickFrequency, MOD_Mode mode);
+
+// Background: electrical frequency in Hz, index as a fraction of half the DC bus
+void MOD_setFrequency(MOD_Modulator *modulator, float frequency);
+void MOD_setIndex(MOD_Modulator *modulator, float index);
+void MOD_setMode(MOD_Modulator *modulator, MOD_Mode mode);
+
+// Reference (Q15 of half the DC bus) to a duty cycle (Q15), clamped
+static inline uint16_t MOD_toDuty(int32_t reference) {
+    int32_t duty = MOD_DUTY_HALF + (reference >> 1);
+    if (duty < 0L) {
+        duty = 0L;
+    } else if (duty > MOD_DUTY_ONE) {
+        duty = MOD_DUTY_ONE;
+    }
+    return (uint16_t)duty;
+}
+
+// ISR: duties of the three legs for this tick; table lookups only, no trig call
+static inline void MOD_step(MOD_Modulator *modulator, uint16_t duties[MOD_PHASES]) {
+    const uint32_t angle = modulator->angle.phase;
+    modulator->angle.phase = angle + modulator->angle.phaseIncrement;
+    const int32_t index = modulator->index;
+    // Phase references 120 degrees apart, Q15 of half the DC bus (up to 2/sqrt(3))
+    int32_t a = ((int32_t)DDS_sinQ15(angle) * index) >> 14;
+    int32_t b = ((int32_t)DDS_sinQ15(angle - MOD_THIRD_TURN) * index) >> 14;
+    int32_t c = ((int32_t)DDS_sinQ15(angle + MOD_THIRD_TURN) * index) >> 14;
+    if (modulator->mode == MOD_SPACE_VECTOR) {
+        // Centres the references between the rails: common mode only, line voltages untouched
+        int32_t largest = a > b ? a : b;
+        int32_t smallest = a < b ? a : b;
+        largest = c > largest ? c : largest;
+        smallest = c < smallest ? c : smallest;
+        const int32_t common = (largest + smallest) >> 1;
+        a -= common;
+        b -= common;
+        c -= common;
+    }
+    duties[0] = MOD_toDuty(a);
+    duties[1] = MOD_toDuty(b);
+    duties[2] = MOD_toDuty(c);
+}
+
+#endif
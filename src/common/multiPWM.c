@@ -0,0 +1,122 @@
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "multiPWM.h"
+
+/*------------------------------HELPERS------------------------------*/
+
+// Carrier, compares and actions of one leg, all loaded at counter zero
+static void configureLeg(const MPWM_Bank *bank, uint32_t base) {
+    EPWM_setClockPrescaler(base, bank->clockDivider, EPWM_HSCLOCK_DIVIDER_1);
+    EPWM_setPeriodLoadMode(base, EPWM_PERIOD_SHADOW_LOAD);
+    EPWM_setTimeBasePeriod(base, bank->period);
+    EPWM_setTimeBaseCounter(base, 0U);
+    EPWM_setTimeBaseCounterMode(base, EPWM_COUNTER_MODE_UP_DOWN);
+    EPWM_setCounterCompareShadowLoadMode(base, EPWM_COUNTER_COMPARE_A, EPWM_COMP_LOAD_ON_CNTR_ZERO);
+    EPWM_setCounterCompareValue(base, EPWM_COUNTER_COMPARE_A,
+                                PWMUPDATE_compareValue(EPWM_COUNTER_MODE_UP_DOWN, bank->period, PWMUPDATE_DUTY_ONE / 2U));
+    EPWM_setActionQualifierShadowLoadMode(base, EPWM_ACTION_QUALIFIER_A, EPWM_AQ_LOAD_ON_CNTR_ZERO);
+    PWMUPDATE_configureActions(base, EPWM_COUNTER_MODE_UP_DOWN);
+    // Dead band, active high complementary: EPWMxA rises late, EPWMxB is A inverted and falls early
+    EPWM_setRisingEdgeDeadBandDelayInput(base, EPWM_DB_INPUT_EPWMA);
+    EPWM_setFallingEdgeDeadBandDelayInput(base, EPWM_DB_INPUT_EPWMA);
+    EPWM_setDeadBandDelayPolarity(base, EPWM_DB_RED, EPWM_DB_POLARITY_ACTIVE_HIGH);
+    EPWM_setDeadBandDelayPolarity(base, EPWM_DB_FED, EPWM_DB_POLARITY_ACTIVE_LOW);
+    EPWM_setDeadBandCounterClock(base, EPWM_DB_COUNTER_CLOCK_FULL_CYCLE);
+    EPWM_setDeadBandDelayMode(base, EPWM_DB_RED, true);
+    EPWM_setDeadBandDelayMode(base, EPWM_DB_FED, true);
+}
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+bool MPWM_init(MPWM_Bank *bank, const uint32_t *bases, uint16_t legs, uint32_t epwmClock, uint32_t frequency,
+               float deadTime) {
+    // Legs MUST BE between 1 and MPWM_MAX_LEGS
+    if (legs == 0U) {
+        legs = 1U;
+    } else if (legs > MPWM_MAX_LEGS) {
+        legs = MPWM_MAX_LEGS;
+    }
+    bank->legs = legs;
+    // Same period and prescaler as a single channel would get
+    PWMUPDATE_Registers registers;
+    bool reachable = PWMUPDATE_compute(&registers, EPWM_COUNTER_MODE_UP_DOWN, epwmClock, frequency,
+                                       PWMUPDATE_DUTY_ONE / 2U, PWMUPDATE_DUTY_ONE / 2U);
+    bank->period = registers.period;
+    bank->clockDivider = registers.clockDivider;
+    bank->timeBaseClock = epwmClock >> registers.clockDivider;
+    // Counters held until MPWM_start
+    SysCtl_disablePeripheral(SYSCTL_PERIPH_CLK_TBCLKSYNC);
+    uint16_t leg;
+    for (leg = 0; leg < legs; leg ++) {
+        const uint32_t base = bases[leg];
+        bank->bases[leg] = base;
+        configureLeg(bank, base);
+        if (leg == 0U) {
+            // Master: free running, sync pulse at every period start
+            EPWM_disablePhaseShiftLoad(base);
+            EPWM_setPhaseShift(base, 0U);
+            EPWM_setSyncOutPulseMode(base, EPWM_SYNC_OUT_PULSE_ON_COUNTER_ZERO);
+        } else {
+            // Slaves: counter reloaded from TBPHS, pulse passed on to the next module of the chain
+            EPWM_setPhaseShift(base, 0U);
+            EPWM_setCountModeAfterSync(base, EPWM_COUNT_MODE_UP_AFTER_SYNC);
+            EPWM_enablePhaseShiftLoad(base);
+            EPWM_setSyncOutPulseMode(base, EPWM_SYNC_OUT_PULSE_ON_EPWMxSYNCIN);
+        }
+    }
+    if (!MPWM_setDeadTime(bank, deadTime)) {
+        reachable = false;
+    }
+    return reachable;
+}
+
+void MPWM_start(MPWM_Bank *bank) {
+    (void)bank;
+    // Every enabled time base starts from its TBCTR on the same clock edge
+    SysCtl_enablePeripheral(SYSCTL_PERIPH_CLK_TBCLKSYNC);
+}
+
+bool MPWM_setDeadTime(MPWM_Bank *bank, float deadTime) {
+    bool reachable = true;
+    // Dead-band counters run at the time-base clock
+    float counts = deadTime * (float)bank->timeBaseClock + 0.5f;
+    if (counts < 0.0f) {
+        counts = 0.0f;
+    } else if (counts > (float)MPWM_MAX_DEAD_BAND) {
+        counts = (float)MPWM_MAX_DEAD_BAND;
+        reachable = false;
+    }
+    bank->deadBand = (uint16_t)counts;
+    uint16_t leg;
+    for (leg = 0; leg < bank->legs; leg ++) {
+        EPWM_setRisingEdgeDelayCount(bank->bases[leg], bank->deadBand);
+        EPWM_setFallingEdgeDelayCount(bank->bases[leg], bank->deadBand);
+    }
+    return reachable;
+}
+
+void MPWM_setPhase(MPWM_Bank *bank, uint16_t leg, float degrees) {
+    // The master sets the reference, it has no phase of its own
+    if (leg == 0U || leg >= bank->legs) {
+        return;
+    }
+    while (degrees >= 360.0f) {
+        degrees -= 360.0f;
+    }
+    while (degrees < 0.0f) {
+        degrees += 360.0f;
+    }
+    // At the master's zero a leg lagging by degrees is that far before its own zero: on the way down
+    // up to 180 degrees, on the way up beyond
+    const uint32_t base = bank->bases[leg];
+    float counts = degrees / 180.0f * (float)bank->period;
+    if (degrees == 0.0f) {
+        EPWM_setCountModeAfterSync(base, EPWM_COUNT_MODE_UP_AFTER_SYNC);
+    } else if (degrees <= 180.0f) {
+        EPWM_setCountModeAfterSync(base, EPWM_COUNT_MODE_DOWN_AFTER_SYNC);
+    } else {
+        counts = 2.0f * (float)bank->period - counts;
+        EPWM_setCountModeAfterSync(base, EPWM_COUNT_MODE_UP_AFTER_SYNC);
+    }
+    EPWM_setPhaseShift(base, (uint16_t)(counts + 0.5f));
+}
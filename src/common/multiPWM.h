@@ -0,0 +1,62 @@
+#ifndef MULTIPWM_H
+#define MULTIPWM_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "epwm.h"
+#include "sysctl.h"
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "pwmUpdate.h"
+
+/*------------------------------MACROS------------------------------*/
+
+#define MPWM_MAX_LEGS 6U
+
+// DBRED and DBFED are 14-bit counters
+#define MPWM_MAX_DEAD_BAND 0x3FFFU
+
+/*------------------------------TYPES------------------------------*/
+
+// Half-bridge legs on EPWM modules with a common up-down carrier; the first one is the sync master
+// and the others follow it down the sync chain (EPWM1 -> 2 -> 3, EPWM1 -> 4 -> 5 -> 6)
+typedef struct {
+    uint32_t bases[MPWM_MAX_LEGS];
+    uint16_t legs;
+    uint16_t period; // TBPRD, one carrier period is 2 * TBPRD counts
+    EPWM_ClockDivider clockDivider;
+    uint32_t timeBaseClock; // Hz, after the prescaler
+    uint16_t deadBand; // Rising and falling edge delays in time-base counts
+} MPWM_Bank;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// Stops the time-base clocks and sets up every leg: carrier, complementary outputs with dead band,
+// sync chain; 50 % duty until MPWM_setDuties. False when the frequency cannot be reached (clamped).
+// The EPWM clocks are enabled by the caller, then MPWM_start starts all counters on the same edge
+bool MPWM_init(MPWM_Bank *bank, const uint32_t *bases, uint16_t legs, uint32_t epwmClock, uint32_t frequency,
+               float deadTime);
+void MPWM_start(MPWM_Bank *bank);
+
+// Dead time in seconds, both edges; false when clamped to MPWM_MAX_DEAD_BAND
+bool MPWM_setDeadTime(MPWM_Bank *bank, float deadTime);
+
+// Carrier of a leg behind the master's by degrees (0 to 360), loaded at every master period start
+void MPWM_setPhase(MPWM_Bank *bank, uint16_t leg, float degrees);
+
+// ISR: one duty (Q15) per leg to CMPA, high-side on EPWMxA, low-side its complement on EPWMxB
+static inline void MPWM_setDuties(const MPWM_Bank *bank, const uint16_t *duties) {
+    uint16_t leg;
+    for (leg = 0; leg < bank->legs; leg ++) {
+        EPWM_setCounterCompareValue(bank->bases[leg], EPWM_COUNTER_COMPARE_A,
+                                    PWMUPDATE_compareValue(EPWM_COUNTER_MODE_UP_DOWN, bank->period, duties[leg]));
+    }
+}
+
+#endif
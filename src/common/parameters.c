@@ -0,0 +1,243 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "parameters.h"
+#include "report.h"
+
+/*------------------------------HELPERS------------------------------*/
+
+// C28x float is IEEE 754 single precision, sent as its bits
+typedef union {
+    float value;
+    uint32_t bits;
+} FloatBits;
+
+static void *fieldOf(void *settings, const PARAM_Descriptor *descriptor) {
+    return (char *)settings + descriptor->offset;
+}
+
+static uint32_t readField(const void *settings, const PARAM_Descriptor *descriptor) {
+    const void *field = (const char *)settings + descriptor->offset;
+    if (descriptor->type == PARAM_TYPE_FLOAT) {
+        FloatBits cast;
+        cast.value = *(const float *)field;
+        return cast.bits;
+    }
+    return *(const uint16_t *)field;
+}
+
+static uint16_t getWord(const uint16_t *bytes) {
+    return (uint16_t)((bytes[0] & 0xFFU) | ((bytes[1] & 0xFFU) << 8));
+}
+
+static uint32_t getLong(const uint16_t *bytes) {
+    return (uint32_t)getWord(bytes) | ((uint32_t)getWord(bytes + 2) << 16);
+}
+
+static uint16_t putWord(uint16_t *bytes, uint16_t value) {
+    bytes[0] = value & 0xFFU;
+    bytes[1] = value >> 8;
+    return 2U;
+}
+
+static uint16_t putLong(uint16_t *bytes, uint32_t value) {
+    putWord(bytes, (uint16_t)(value & 0xFFFFUL));
+    return putWord(bytes + 2, (uint16_t)(value >> 16)) + 2U;
+}
+
+// Up to PARAM_MAX_TEXT characters and the terminating zero
+static uint16_t putText(uint16_t *bytes, const char *text) {
+    uint16_t length = 0U;
+    while (text[length] != '\0' && length < PARAM_MAX_TEXT) {
+        bytes[length] = (uint16_t)text[length] & 0xFFU;
+        length ++;
+    }
+    bytes[length ++] = 0U;
+    return length;
+}
+
+static void report(const void *object, REPORT_Writer write, void *context) {
+    PARAM_dump((const PARAM_Registry *)object, write, context);
+}
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+void PARAM_init(PARAM_Registry *registry, const PARAM_Descriptor *descriptors, uint16_t count, void *copies,
+                uint16_t size, PARAM_Prepare prepare, void *context) {
+    registry->descriptors = descriptors;
+    registry->count = count;
+    registry->size = size;
+    registry->staging = copies;
+    registry->images[0] = (char *)copies + size;
+    registry->images[1] = (char *)copies + 2U * size;
+    registry->prepare = prepare;
+    registry->context = context;
+    // Both images hold the defaults, taken by the ISR at its first sample
+    memcpy(registry->images[0], registry->staging, size);
+    if (prepare != 0) {
+        prepare(registry->images[0], context);
+    }
+    memcpy(registry->images[1], registry->images[0], size);
+    registry->published = 0U;
+    registry->active = 0U;
+    registry->acquired = 0U;
+    registry->sequence = 1U;
+    registry->commits = 0UL;
+    registry->busy = 0UL;
+    registry->rejected = 0UL;
+    REPORT_register("parameters", &report, registry);
+}
+
+uint16_t PARAM_set(PARAM_Registry *registry, uint16_t index, uint32_t value) {
+    if (index >= registry->count) {
+        registry->rejected ++;
+        return PARAM_STATUS_BAD_INDEX;
+    }
+    const PARAM_Descriptor *descriptor = &registry->descriptors[index];
+    void *field = fieldOf(registry->staging, descriptor);
+    if (descriptor->type == PARAM_TYPE_FLOAT) {
+        FloatBits cast;
+        cast.bits = value;
+        // NaN fails both comparisons
+        if (!(cast.value >= descriptor->minimum && cast.value <= descriptor->maximum)) {
+            registry->rejected ++;
+            return PARAM_STATUS_OUT_OF_RANGE;
+        }
+        *(float *)field = cast.value;
+    } else {
+        if (value > 0xFFFFUL || (float)value < descriptor->minimum || (float)value > descriptor->maximum) {
+            registry->rejected ++;
+            return PARAM_STATUS_OUT_OF_RANGE;
+        }
+        *(uint16_t *)field = (uint16_t)value;
+    }
+    return PARAM_STATUS_OK;
+}
+
+uint32_t PARAM_get(const PARAM_Registry *registry, uint16_t index, bool committed) {
+    if (index >= registry->count) {
+        return 0UL;
+    }
+    // The background is the only writer of the published image, no need to go through the ISR's copy
+    const void *settings = committed ? registry->images[registry->published] : registry->staging;
+    return readField(settings, &registry->descriptors[index]);
+}
+
+uint16_t PARAM_commit(PARAM_Registry *registry) {
+    // The idle image may still be the ISR's until it has taken the latest commit
+    if (registry->acquired != registry->sequence) {
+        registry->busy ++;
+        return PARAM_STATUS_BUSY;
+    }
+    const uint16_t idle = registry->published ^ 1U;
+    memcpy(registry->images[idle], registry->staging, registry->size);
+    if (registry->prepare != 0) {
+        registry->prepare(registry->images[idle], registry->context);
+    }
+    // Image complete before it is published
+    PARAM_BARRIER();
+    registry->published = idle;
+    registry->sequence ++;
+    registry->commits ++;
+    return PARAM_STATUS_OK;
+}
+
+void PARAM_revert(PARAM_Registry *registry) {
+    memcpy(registry->staging, registry->images[registry->published], registry->size);
+}
+
+uint16_t PARAM_handleCommand(PARAM_Registry *registry, uint16_t type, uint16_t sequence, const uint16_t *payload,
+                             uint16_t length, uint16_t *reply) {
+    uint16_t status = PARAM_STATUS_OK;
+    uint16_t replyLength = 4U;
+    // Commands addressing a parameter start with its index
+    const uint16_t index = length > 0U ? payload[0] & 0xFFU : 0U;
+    switch (type) {
+        case PARAM_COMMAND_DESCRIBE:
+            if (length != 1U) {
+                status = PARAM_STATUS_BAD_LENGTH;
+            } else if (index >= registry->count) {
+                status = PARAM_STATUS_BAD_INDEX;
+            } else {
+                const PARAM_Descriptor *descriptor = &registry->descriptors[index];
+                FloatBits minimum;
+                FloatBits maximum;
+                minimum.value = descriptor->minimum;
+                maximum.value = descriptor->maximum;
+                reply[replyLength ++] = index;
+                reply[replyLength ++] = (uint16_t)descriptor->type;
+                replyLength += putLong(&reply[replyLength], minimum.bits);
+                replyLength += putLong(&reply[replyLength], maximum.bits);
+                replyLength += putText(&reply[replyLength], descriptor->name);
+                replyLength += putText(&reply[replyLength], descriptor->units);
+            }
+            break;
+        case PARAM_COMMAND_GET:
+            if (length != 1U) {
+                status = PARAM_STATUS_BAD_LENGTH;
+            } else if (index >= registry->count) {
+                status = PARAM_STATUS_BAD_INDEX;
+            } else {
+                reply[replyLength ++] = index;
+                replyLength += putLong(&reply[replyLength], PARAM_get(registry, index, false));
+                replyLength += putLong(&reply[replyLength], PARAM_get(registry, index, true));
+            }
+            break;
+        case PARAM_COMMAND_SET:
+            if (length != 5U) {
+                status = PARAM_STATUS_BAD_LENGTH;
+            } else {
+                status = PARAM_set(registry, index, getLong(&payload[1]));
+                reply[replyLength ++] = index;
+                replyLength += putLong(&reply[replyLength], PARAM_get(registry, index, false));
+            }
+            break;
+        case PARAM_COMMAND_COMMIT:
+            if (length != 0U) {
+                status = PARAM_STATUS_BAD_LENGTH;
+            } else {
+                status = PARAM_commit(registry);
+                replyLength += putLong(&reply[replyLength], registry->commits);
+            }
+            break;
+        case PARAM_COMMAND_REVERT:
+            if (length != 0U) {
+                status = PARAM_STATUS_BAD_LENGTH;
+            } else {
+                PARAM_revert(registry);
+            }
+            break;
+        default:
+            status = PARAM_STATUS_UNKNOWN_COMMAND;
+            break;
+    }
+    reply[0] = type & 0xFFU;
+    reply[1] = status;
+    putWord(&reply[2], sequence);
+    return replyLength;
+}
+
+void PARAM_dump(const PARAM_Registry *registry, REPORT_Writer write, void *context) {
+    char line[PARAM_LINE_LENGTH];
+    snprintf(line, sizeof(line), "Parameters %u commits %lu busy %lu rejected %lu, ISR on commit %u of %u", registry->count,
+             (unsigned long)registry->commits, (unsigned long)registry->busy, (unsigned long)registry->rejected,
+             registry->acquired, registry->sequence);
+    write(line, context);
+    uint16_t index;
+    for (index = 0; index < registry->count; index ++) {
+        const PARAM_Descriptor *descriptor = &registry->descriptors[index];
+        const uint32_t value = PARAM_get(registry, index, true);
+        if (descriptor->type == PARAM_TYPE_FLOAT) {
+            FloatBits cast;
+            cast.bits = value;
+            snprintf(line, sizeof(line), "  %s %g %s", descriptor->name, cast.value, descriptor->units);
+        } else {
+            snprintf(line, sizeof(line), "  %s %lu %s", descriptor->name, (unsigned long)value, descriptor->units);
+        }
+        write(line, context);
+    }
+}
@@ -0,0 +1,123 @@
+#ifndef PARAMETERS_H
+#define PARAMETERS_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "report.h"
+
+/*------------------------------MACROS------------------------------*/
+
+// Settings structures a registry needs: staging copy (holding the defaults at PARAM_init) and two committed images
+#define PARAM_COPIES 3U
+
+// Compiler barrier between an image and the indices publishing it; C28x is one core and keeps volatile order
+#if defined(__GNUC__)
+#define PARAM_BARRIER() __asm__ __volatile__("" ::: "memory")
+#else
+#define PARAM_BARRIER()
+#endif
+
+// Command frame types (host to target), answered by a reply frame each
+#define PARAM_COMMAND_DESCRIBE 0x10U // index -> type, range, name and units
+#define PARAM_COMMAND_GET 0x11U // index -> staged and committed values
+#define PARAM_COMMAND_SET 0x12U // index, value -> staged value
+#define PARAM_COMMAND_COMMIT 0x13U // -> commit count, every staged value taken at the next sample
+#define PARAM_COMMAND_REVERT 0x14U // Staged values back to the committed ones
+
+// Reply payload: command type, status, command sequence (16-bit), then the command's fields.
+// Values are 32-bit little endian: IEEE 754 bits for floats, zero-extended integers
+#define PARAM_STATUS_OK 0U
+#define PARAM_STATUS_UNKNOWN_COMMAND 1U
+#define PARAM_STATUS_BAD_LENGTH 2U
+#define PARAM_STATUS_BAD_INDEX 3U
+#define PARAM_STATUS_OUT_OF_RANGE 4U // Nothing staged
+#define PARAM_STATUS_BUSY 5U // Previous commit not taken by the ISR yet, try again
+
+#define PARAM_MAX_TEXT 23U // Characters of a name or units string sent by DESCRIBE
+#define PARAM_MAX_REPLY (16U + 2U * (PARAM_MAX_TEXT + 1U))
+#define PARAM_LINE_LENGTH 128U
+
+/*------------------------------TYPES------------------------------*/
+
+typedef enum {
+    PARAM_TYPE_UINT16,
+    PARAM_TYPE_FLOAT
+} PARAM_Type;
+
+// One tunable field of the settings structure
+typedef struct {
+    const char *name;
+    const char *units;
+    PARAM_Type type;
+    uint16_t offset; // offsetof in the settings structure
+    float minimum;
+    float maximum;
+} PARAM_Descriptor;
+
+// Fills the derived fields of an image about to be committed (tuning words, register images), background
+typedef void (*PARAM_Prepare)(void *image, void *context);
+
+// Commands edit the staging copy, a commit copies it into the idle image and publishes it,
+// the ISR switches images only at the start of a sample
+typedef struct {
+    const PARAM_Descriptor *descriptors;
+    uint16_t count;
+    uint16_t size; // sizeof the settings structure
+    void *staging; // Every value already range-checked
+    void *images[2];
+    PARAM_Prepare prepare;
+    void *context;
+    volatile uint16_t published; // Image of the latest commit
+    volatile uint16_t sequence; // Bumped by every commit
+    volatile uint16_t acquired; // Sequence the ISR runs with (ISR)
+    uint16_t active; // Image the ISR reads (ISR)
+    // Statistics, background only
+    uint32_t commits;
+    uint32_t busy; // Commits refused while the ISR had not taken the previous one
+    uint32_t rejected; // Sets out of range or of an unknown index
+} PARAM_Registry;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// copies: array of PARAM_COPIES settings structures of sizeof size, the first holding the defaults (which must be in range)
+void PARAM_init(PARAM_Registry *registry, const PARAM_Descriptor *descriptors, uint16_t count, void *copies,
+                uint16_t size, PARAM_Prepare prepare, void *context);
+
+// Background: PARAM_STATUS_OK, PARAM_STATUS_BAD_INDEX or PARAM_STATUS_OUT_OF_RANGE
+uint16_t PARAM_set(PARAM_Registry *registry, uint16_t index, uint32_t value);
+// Background: staged or committed value, in the wire format
+uint32_t PARAM_get(const PARAM_Registry *registry, uint16_t index, bool committed);
+// Background: PARAM_STATUS_OK or PARAM_STATUS_BUSY
+uint16_t PARAM_commit(PARAM_Registry *registry);
+void PARAM_revert(PARAM_Registry *registry);
+
+// Background: runs one command frame, fills reply (PARAM_MAX_REPLY bytes) and returns its length
+uint16_t PARAM_handleCommand(PARAM_Registry *registry, uint16_t type, uint16_t sequence, const uint16_t *payload,
+                             uint16_t length, uint16_t *reply);
+
+// Background: command statistics and every committed value, line by line
+void PARAM_dump(const PARAM_Registry *registry, REPORT_Writer write, void *context);
+
+// ISR, once at the start of a sample before any PARAM_image read: true when a new commit was taken
+static inline bool PARAM_acquire(PARAM_Registry *registry) {
+    const uint16_t sequence = registry->sequence;
+    if (sequence == registry->acquired) {
+        return false;
+    }
+    // published is written before sequence, so it belongs to this commit or a later one
+    registry->active = registry->published;
+    registry->acquired = sequence;
+    return true;
+}
+
+// ISR: settings of the image taken by the last PARAM_acquire
+static inline const void *PARAM_image(const PARAM_Registry *registry) {
+    return registry->images[registry->active];
+}
+
+#endif
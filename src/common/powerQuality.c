@@ -0,0 +1,202 @@
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "powerQuality.h"
+#include "typedMath.h"
+
+/*------------------------------MACROS------------------------------*/
+
+#define MID_SCALE 2048
+
+/*------------------------------HELPERS------------------------------*/
+
+// One cosine per window: 2 cos((h + 1) w) = 2 cos(w) 2 cos(h w) - 2 cos((h - 1) w) gives the other harmonics
+static void setGoertzelFrequency(PQ_Analyzer *analyzer, float frequency) {
+    // Angle per sample in turns
+    const float first = 2.0f * MATH_cosF32(frequency / analyzer->sampleFrequency);
+    float previous = 2.0f;
+    float current = first;
+    uint16_t harmonic;
+    for (harmonic = 0; harmonic < PQ_HARMONICS; harmonic ++) {
+        analyzer->coefficients[harmonic] = current;
+        const float next = first * current - previous;
+        previous = current;
+        current = next;
+    }
+}
+
+// End of window: raw sums and Goertzel state into the unpublished window, then swap. Square roots are left to PQ_read
+static void publish(PQ_Analyzer *analyzer) {
+    const uint16_t length = analyzer->windowLength;
+    if (analyzer->periodCount > 0U) {
+        analyzer->frequency = analyzer->sampleFrequency * (float)analyzer->periodCount / analyzer->periodSum;
+    }
+    const uint16_t target = analyzer->published ^ 1U;
+    volatile PQ_Window *result = &analyzer->results[target];
+    analyzer->sequences[target] ++;
+    result->sum = analyzer->sum;
+    result->sumSquares = analyzer->sumSquares;
+    result->length = length;
+    result->frequency = analyzer->frequency;
+    uint16_t harmonic;
+    for (harmonic = 0; harmonic < PQ_HARMONICS; harmonic ++) {
+        result->goertzel1[harmonic] = analyzer->goertzel1[harmonic];
+        result->goertzel2[harmonic] = analyzer->goertzel2[harmonic];
+        result->coefficients[harmonic] = analyzer->coefficients[harmonic];
+        analyzer->goertzel1[harmonic] = 0.0f;
+        analyzer->goertzel2[harmonic] = 0.0f;
+    }
+    result->window = analyzer->windows ++;
+    analyzer->sequences[target] ++;
+    analyzer->published = target;
+    // Next window: one measured period long (whole periods keep leakage out of the bins), crossings use the new mean
+    float period = analyzer->sampleFrequency / analyzer->frequency + 0.5f;
+    if (period < (float)PQ_MIN_WINDOW) {
+        period = (float)PQ_MIN_WINDOW;
+    } else if (period > (float)PQ_MAX_WINDOW) {
+        period = (float)PQ_MAX_WINDOW;
+    }
+    analyzer->windowLength = (uint16_t)period;
+    setGoertzelFrequency(analyzer, analyzer->frequency);
+    analyzer->threshold = (int16_t)((analyzer->sum + length / 2U) / length);
+    analyzer->count = 0U;
+    analyzer->sum = 0UL;
+    analyzer->sumSquares = 0UL;
+    analyzer->periodSum = 0.0f;
+    analyzer->periodCount = 0U;
+}
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+void PQ_init(PQ_Analyzer *analyzer, float sampleFrequency, float nominalFrequency, uint16_t windowLength, uint16_t hysteresis) {
+    // Window MUST BE between PQ_MIN_WINDOW and PQ_MAX_WINDOW samples
+    if (windowLength < PQ_MIN_WINDOW) {
+        windowLength = PQ_MIN_WINDOW;
+    } else if (windowLength > PQ_MAX_WINDOW) {
+        windowLength = PQ_MAX_WINDOW;
+    }
+    analyzer->sampleFrequency = sampleFrequency;
+    analyzer->windowLength = windowLength;
+    analyzer->count = 0U;
+    analyzer->sum = 0UL;
+    analyzer->sumSquares = 0UL;
+    uint16_t harmonic;
+    for (harmonic = 0; harmonic < PQ_HARMONICS; harmonic ++) {
+        analyzer->goertzel1[harmonic] = 0.0f;
+        analyzer->goertzel2[harmonic] = 0.0f;
+    }
+    analyzer->threshold = MID_SCALE;
+    analyzer->previous = 0;
+    analyzer->armed = 0U;
+    analyzer->hysteresis = hysteresis;
+    analyzer->sinceCrossing = 0UL;
+    analyzer->crossingFraction = 0.0f;
+    analyzer->crossingValid = 0U;
+    analyzer->periodSum = 0.0f;
+    analyzer->periodCount = 0U;
+    analyzer->frequency = nominalFrequency;
+    setGoertzelFrequency(analyzer, nominalFrequency);
+    // Empty windows until the first one ends: zero levels at the nominal frequency
+    uint16_t index;
+    for (index = 0; index < 2U; index ++) {
+        volatile PQ_Window *result = &analyzer->results[index];
+        result->sum = 0UL;
+        result->sumSquares = 0UL;
+        result->length = windowLength;
+        result->frequency = nominalFrequency;
+        for (harmonic = 0; harmonic < PQ_HARMONICS; harmonic ++) {
+            result->goertzel1[harmonic] = 0.0f;
+            result->goertzel2[harmonic] = 0.0f;
+            result->coefficients[harmonic] = analyzer->coefficients[harmonic];
+        }
+        result->window = 0UL;
+        analyzer->sequences[index] = 0U;
+    }
+    analyzer->published = 0U;
+    analyzer->windows = 0UL;
+}
+
+void PQ_update(PQ_Analyzer *analyzer, uint16_t sample) {
+    // Running sums
+    analyzer->sum += sample;
+    analyzer->sumSquares += (uint32_t)sample * sample;
+    // Goertzel bank, input centred on the previous mean
+    const int16_t centred = (int16_t)sample - analyzer->threshold;
+    const float input = (float)centred;
+    uint16_t harmonic;
+    for (harmonic = 0; harmonic < PQ_HARMONICS; harmonic ++) {
+        const float s0 = input + analyzer->coefficients[harmonic] * analyzer->goertzel1[harmonic] - analyzer->goertzel2[harmonic];
+        analyzer->goertzel2[harmonic] = analyzer->goertzel1[harmonic];
+        analyzer->goertzel1[harmonic] = s0;
+    }
+    // Rising zero crossing, linearly interpolated between the two samples around it
+    analyzer->sinceCrossing ++;
+    if (centred < -(int16_t)analyzer->hysteresis) {
+        analyzer->armed = 1U;
+    } else if (analyzer->armed && centred >= 0 && analyzer->previous < 0) {
+        const float fraction = (float)analyzer->previous / (float)(analyzer->previous - centred);
+        if (analyzer->crossingValid) {
+            analyzer->periodSum += (float)analyzer->sinceCrossing + fraction - analyzer->crossingFraction;
+            analyzer->periodCount ++;
+        }
+        analyzer->sinceCrossing = 0UL;
+        analyzer->crossingFraction = fraction;
+        analyzer->crossingValid = 1U;
+        analyzer->armed = 0U;
+    }
+    analyzer->previous = centred;
+    if (++ analyzer->count >= analyzer->windowLength) {
+        publish(analyzer);
+    }
+}
+
+void PQ_read(const PQ_Analyzer *analyzer, PQ_Snapshot *snapshot) {
+    PQ_Window result;
+    uint16_t index;
+    uint16_t sequence;
+    uint16_t harmonic;
+    do {
+        index = analyzer->published;
+        sequence = analyzer->sequences[index];
+        const volatile PQ_Window *source = &analyzer->results[index];
+        result.sum = source->sum;
+        result.sumSquares = source->sumSquares;
+        result.length = source->length;
+        result.frequency = source->frequency;
+        for (harmonic = 0; harmonic < PQ_HARMONICS; harmonic ++) {
+            result.goertzel1[harmonic] = source->goertzel1[harmonic];
+            result.goertzel2[harmonic] = source->goertzel2[harmonic];
+            result.coefficients[harmonic] = source->coefficients[harmonic];
+        }
+        result.window = source->window;
+    // Retry if the writer came back to this window while it was copied
+    } while ((sequence & 1U) || analyzer->sequences[index] != sequence);
+    // The window's results, off the ISR
+    const float length = (float)result.length;
+    const float mean = (float)result.sum / length;
+    const float meanSquare = (float)result.sumSquares / length;
+    float variance = meanSquare - mean * mean;
+    if (variance < 0.0f) {
+        variance = 0.0f;
+    }
+    snapshot->mean = mean;
+    snapshot->rms = MATH_sqrtF32(meanSquare);
+    snapshot->acRms = MATH_sqrtF32(variance);
+    snapshot->frequency = result.frequency;
+    // Goertzel magnitude, scaled to a peak amplitude
+    float harmonicPower = 0.0f;
+    for (harmonic = 0; harmonic < PQ_HARMONICS; harmonic ++) {
+        const float s1 = result.goertzel1[harmonic];
+        const float s2 = result.goertzel2[harmonic];
+        float power = s1 * s1 + s2 * s2 - result.coefficients[harmonic] * s1 * s2;
+        if (power < 0.0f) {
+            power = 0.0f;
+        }
+        const float amplitude = 2.0f * MATH_sqrtF32(power) / length;
+        snapshot->harmonics[harmonic] = amplitude;
+        if (harmonic > 0U) {
+            harmonicPower += amplitude * amplitude;
+        }
+    }
+    snapshot->thd = snapshot->harmonics[0] > 0.0f ? MATH_sqrtF32(harmonicPower) / snapshot->harmonics[0] : 0.0f;
+    snapshot->window = result.window;
+}
@@ -0,0 +1,84 @@
+#ifndef POWERQUALITY_H
+#define POWERQUALITY_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdint.h>
+
+/*------------------------------MACROS------------------------------*/
+
+// Fundamental plus harmonics 2 to PQ_HARMONICS
+#ifndef PQ_HARMONICS
+#define PQ_HARMONICS 7
+#endif
+
+// Sum of squares of 12-bit codes must fit 32 bits
+#define PQ_MAX_WINDOW 256U
+#define PQ_MIN_WINDOW 8U
+
+/*------------------------------TYPES------------------------------*/
+
+// Results of one window, values in ADC codes
+typedef struct {
+    float mean;
+    float rms; // Including DC
+    float acRms; // DC removed
+    float frequency; // Hz, from interpolated rising zero crossings
+    float harmonics[PQ_HARMONICS]; // Peak amplitudes, [0] is the fundamental
+    float thd; // sqrt(sum of harmonics 2..N squared) / fundamental
+    uint32_t window; // Window number
+} PQ_Snapshot;
+
+// Raw state of one window as the ISR leaves it, PQ_read works the snapshot out of it
+typedef struct {
+    uint32_t sum;
+    uint32_t sumSquares;
+    uint16_t length; // Samples
+    float frequency;
+    float goertzel1[PQ_HARMONICS];
+    float goertzel2[PQ_HARMONICS];
+    float coefficients[PQ_HARMONICS];
+    uint32_t window;
+} PQ_Window;
+
+typedef struct {
+    // Configuration
+    float sampleFrequency;
+    uint16_t windowLength; // Follows the measured period
+    // Window accumulators, reset every windowLength samples
+    uint16_t count;
+    uint32_t sum;
+    uint32_t sumSquares;
+    float goertzel1[PQ_HARMONICS]; // s[n - 1]
+    float goertzel2[PQ_HARMONICS]; // s[n - 2]
+    float coefficients[PQ_HARMONICS]; // 2 cos(2 pi h f / fs), tracks the measured frequency
+    // Zero-crossing tracker
+    int16_t threshold; // Previous window mean
+    int16_t previous; // Previous centred sample
+    uint16_t armed; // Signal went below the hysteresis band since the last crossing
+    uint16_t hysteresis;
+    uint32_t sinceCrossing; // Samples since the last crossing sample
+    float crossingFraction; // Sub-sample position of the last crossing
+    uint16_t crossingValid;
+    float periodSum;
+    uint16_t periodCount;
+    float frequency;
+    // Double-buffered output: seqlock per window, readers take results[published]
+    volatile PQ_Window results[2];
+    volatile uint16_t sequences[2]; // Odd while the window is being written
+    volatile uint16_t published;
+    uint32_t windows;
+} PQ_Analyzer;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// Initial window length is one nominal period in samples, later windows follow the measured period
+void PQ_init(PQ_Analyzer *analyzer, float sampleFrequency, float nominalFrequency, uint16_t windowLength, uint16_t hysteresis);
+
+// One ADC sample, O(PQ_HARMONICS); publishes the raw window at its end, no square roots
+void PQ_update(PQ_Analyzer *analyzer, uint16_t sample);
+
+// Background: snapshot of the latest complete window, safe against a concurrent PQ_update
+void PQ_read(const PQ_Analyzer *analyzer, PQ_Snapshot *snapshot);
+
+#endif
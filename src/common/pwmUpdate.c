@@ -0,0 +1,105 @@
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "pwmUpdate.h"
+
+/*------------------------------MACROS------------------------------*/
+
+#define MAX_CLOCK_DIVIDER 7U // EPWM_CLOCK_DIVIDER_128
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+bool PWMUPDATE_compute(PWMUPDATE_Registers *registers, EPWM_TimeBaseCountMode counterMode, uint32_t timeBaseClock,
+                       uint32_t frequency, uint16_t dutyA, uint16_t dutyB) {
+    bool reachable = true;
+    // Frequency MUST BE positive
+    if (frequency == 0UL) {
+        frequency = 1UL;
+        reachable = false;
+    }
+    // Symmetric waveform: one period is 2 * TBPRD counts, asymmetric: TBPRD + 1 counts
+    const uint32_t divisor = (counterMode == EPWM_COUNTER_MODE_UP_DOWN) ? 2UL * frequency : frequency;
+    uint16_t divider = 0U;
+    uint32_t counts = (timeBaseClock + divisor / 2UL) / divisor;
+    // Smallest prescaler whose period fits 16 bits keeps the best resolution
+    while (counts > 65535UL && divider < MAX_CLOCK_DIVIDER) {
+        divider ++;
+        counts = ((timeBaseClock >> divider) + divisor / 2UL) / divisor;
+    }
+    if (counterMode != EPWM_COUNTER_MODE_UP_DOWN && counts > 0UL) {
+        counts --;
+    }
+    if (counts > 65535UL) {
+        counts = 65535UL;
+        reachable = false;
+    } else if (counts < 2UL) {
+        counts = 2UL;
+        reachable = false;
+    }
+    registers->counterMode = counterMode;
+    registers->clockDivider = (EPWM_ClockDivider)divider;
+    registers->period = (uint16_t)counts;
+    registers->compareA = PWMUPDATE_compareValue(counterMode, registers->period, dutyA);
+    registers->compareB = PWMUPDATE_compareValue(counterMode, registers->period, dutyB);
+    return reachable;
+}
+
+uint16_t PWMUPDATE_dutyToQ15(float dutyCycle) {
+    // Duty cycle MUST BE between 0 and 1
+    if (dutyCycle <= 0.0f) {
+        return 0U;
+    } else if (dutyCycle >= 1.0f) {
+        return PWMUPDATE_DUTY_ONE;
+    }
+    return (uint16_t)(dutyCycle * (float)PWMUPDATE_DUTY_ONE + 0.5f);
+}
+
+void PWMUPDATE_configureActions(uint32_t base, EPWM_TimeBaseCountMode counterMode) {
+    EPWM_ActionQualifierOutputEvent setEvent;
+    EPWM_ActionQualifierOutputEvent clearEvent;
+    if (counterMode == EPWM_COUNTER_MODE_UP_DOWN) {
+        setEvent = EPWM_AQ_OUTPUT_ON_TIMEBASE_UP_CMPA;
+        clearEvent = EPWM_AQ_OUTPUT_ON_TIMEBASE_DOWN_CMPA;
+    } else if (counterMode == EPWM_COUNTER_MODE_UP) {
+        setEvent = EPWM_AQ_OUTPUT_ON_TIMEBASE_UP_CMPA;
+        clearEvent = EPWM_AQ_OUTPUT_ON_TIMEBASE_ZERO;
+    } else {
+        setEvent = EPWM_AQ_OUTPUT_ON_TIMEBASE_DOWN_CMPA;
+        clearEvent = EPWM_AQ_OUTPUT_ON_TIMEBASE_PERIOD;
+    }
+    // Events of the other modes do nothing
+    const EPWM_ActionQualifierOutputEvent events[6] = {
+        EPWM_AQ_OUTPUT_ON_TIMEBASE_ZERO, EPWM_AQ_OUTPUT_ON_TIMEBASE_PERIOD,
+        EPWM_AQ_OUTPUT_ON_TIMEBASE_UP_CMPA, EPWM_AQ_OUTPUT_ON_TIMEBASE_DOWN_CMPA,
+        EPWM_AQ_OUTPUT_ON_TIMEBASE_UP_CMPB, EPWM_AQ_OUTPUT_ON_TIMEBASE_DOWN_CMPB
+    };
+    uint16_t event;
+    for (event = 0; event < 6U; event ++) {
+        EPWM_setActionQualifierAction(base, EPWM_AQ_OUTPUT_A, EPWM_AQ_OUTPUT_NO_CHANGE, events[event]);
+        EPWM_setActionQualifierAction(base, EPWM_AQ_OUTPUT_B, EPWM_AQ_OUTPUT_NO_CHANGE, events[event]);
+    }
+    EPWM_setActionQualifierAction(base, EPWM_AQ_OUTPUT_A, EPWM_AQ_OUTPUT_HIGH, setEvent);
+    EPWM_setActionQualifierAction(base, EPWM_AQ_OUTPUT_A, EPWM_AQ_OUTPUT_LOW, clearEvent);
+    // EPWMxB as a complement to A (inverse actions)
+    EPWM_setActionQualifierAction(base, EPWM_AQ_OUTPUT_B, EPWM_AQ_OUTPUT_LOW, setEvent);
+    EPWM_setActionQualifierAction(base, EPWM_AQ_OUTPUT_B, EPWM_AQ_OUTPUT_HIGH, clearEvent);
+}
+
+void PWMUPDATE_init(PWMUPDATE_Channel *channel, uint32_t base, const PWMUPDATE_Registers *registers) {
+    channel->base = base;
+    channel->images[0] = *registers;
+    channel->images[1] = *registers;
+    channel->published = 0U;
+    channel->sequence = 1U;
+    channel->applied = 0U;
+    // Force the mode, prescaler and actions on the first apply
+    channel->appliedMode = EPWM_COUNTER_MODE_STOP_FREEZE;
+    channel->appliedDivider = (EPWM_ClockDivider)(MAX_CLOCK_DIVIDER + 1U);
+    channel->appliedPeriod = registers->period;
+}
+
+void PWMUPDATE_publish(PWMUPDATE_Channel *channel, const PWMUPDATE_Registers *registers) {
+    const uint16_t idle = channel->published ^ 1U;
+    channel->images[idle] = *registers;
+    channel->published = idle;
+    channel->sequence ++;
+}
@@ -0,0 +1,104 @@
+#ifndef PWMUPDATE_H
+#define PWMUPDATE_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "epwm.h"
+
+/*------------------------------MACROS------------------------------*/
+
+// Duty cycle in Q15, PWMUPDATE_DUTY_ONE is 100 %
+#define PWMUPDATE_DUTY_ONE 32768U
+
+/*------------------------------TYPES------------------------------*/
+
+// Register image of one EPWM module, computed in the background
+typedef struct {
+    EPWM_TimeBaseCountMode counterMode;
+    EPWM_ClockDivider clockDivider;
+    uint16_t period; // TBPRD
+    uint16_t compareA; // CMPA
+    uint16_t compareB; // CMPB
+} PWMUPDATE_Registers;
+
+// Two register images: the background fills the idle one, the ISR copies the published one
+typedef struct {
+    uint32_t base;
+    PWMUPDATE_Registers images[2];
+    volatile uint16_t published; // Image the ISR may read
+    volatile uint16_t sequence; // Bumped after every publish
+    uint16_t applied; // Sequence last written to the registers
+    EPWM_TimeBaseCountMode appliedMode;
+    EPWM_ClockDivider appliedDivider;
+    uint16_t appliedPeriod; // TBPRD last written, for PWMUPDATE_setDuty
+} PWMUPDATE_Channel;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// Compare value giving a high time of duty (Q15) with the actions of PWMUPDATE_configureActions
+static inline uint16_t PWMUPDATE_compareValue(EPWM_TimeBaseCountMode counterMode, uint16_t period, uint16_t duty) {
+    if (duty > PWMUPDATE_DUTY_ONE) {
+        duty = PWMUPDATE_DUTY_ONE;
+    }
+    // High while the counter is above CMPA: TBPRD counts (up-down) or TBPRD + 1 counts (up, down)
+    const uint32_t counts = (counterMode == EPWM_COUNTER_MODE_UP_DOWN) ? period : (uint32_t)period + 1UL;
+    const uint32_t lowCounts = (counts * (PWMUPDATE_DUTY_ONE - duty) + (PWMUPDATE_DUTY_ONE / 2U)) >> 15;
+    if (counterMode == EPWM_COUNTER_MODE_DOWN) {
+        // Down count: high from CMPA down to zero; for 0 % a CMPA above TBPRD never matches and the output stays low
+        if (counts == lowCounts) {
+            return (uint16_t)(counts > 65535UL ? 65535UL : counts);
+        }
+        return (uint16_t)(counts - lowCounts - 1UL);
+    }
+    return (uint16_t)lowCounts;
+}
+
+// Background: frequency in Hz, duties in Q15; false when the frequency cannot be reached (result clamped)
+bool PWMUPDATE_compute(PWMUPDATE_Registers *registers, EPWM_TimeBaseCountMode counterMode, uint32_t timeBaseClock,
+                       uint32_t frequency, uint16_t dutyA, uint16_t dutyB);
+uint16_t PWMUPDATE_dutyToQ15(float dutyCycle);
+
+// Action qualifiers for complementary A/B outputs whose high time is the duty cycle in every count mode
+void PWMUPDATE_configureActions(uint32_t base, EPWM_TimeBaseCountMode counterMode);
+
+void PWMUPDATE_init(PWMUPDATE_Channel *channel, uint32_t base, const PWMUPDATE_Registers *registers);
+void PWMUPDATE_publish(PWMUPDATE_Channel *channel, const PWMUPDATE_Registers *registers);
+
+// ISR side: register writes only, and only when a new image was published
+static inline void PWMUPDATE_apply(PWMUPDATE_Channel *channel) {
+    const uint16_t sequence = channel->sequence;
+    if (sequence == channel->applied) {
+        return;
+    }
+    const PWMUPDATE_Registers *registers = &channel->images[channel->published];
+    // Mode and prescaler changes are rare and cannot be shadowed
+    if (registers->counterMode != channel->appliedMode) {
+        EPWM_setTimeBaseCounterMode(channel->base, registers->counterMode);
+        PWMUPDATE_configureActions(channel->base, registers->counterMode);
+        channel->appliedMode = registers->counterMode;
+    }
+    if (registers->clockDivider != channel->appliedDivider) {
+        EPWM_setClockPrescaler(channel->base, registers->clockDivider, EPWM_HSCLOCK_DIVIDER_1);
+        channel->appliedDivider = registers->clockDivider;
+    }
+    // Shadowed: loaded together at the next counter zero/period
+    EPWM_setTimeBasePeriod(channel->base, registers->period);
+    channel->appliedPeriod = registers->period;
+    EPWM_setCounterCompareValue(channel->base, EPWM_COUNTER_COMPARE_A, registers->compareA);
+    EPWM_setCounterCompareValue(channel->base, EPWM_COUNTER_COMPARE_B, registers->compareB);
+    channel->applied = sequence;
+}
+
+// ISR side, closed loop: duty (Q15) straight to CMPA and CMPB for the period and mode in use
+static inline void PWMUPDATE_setDuty(PWMUPDATE_Channel *channel, uint16_t duty) {
+    const uint16_t compare = PWMUPDATE_compareValue(channel->appliedMode, channel->appliedPeriod, duty);
+    EPWM_setCounterCompareValue(channel->base, EPWM_COUNTER_COMPARE_A, compare);
+    EPWM_setCounterCompareValue(channel->base, EPWM_COUNTER_COMPARE_B, compare);
+}
+
+#endif
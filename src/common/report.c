@@ -0,0 +1,85 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <string.h>
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "report.h"
+
+/*------------------------------VARIABLES------------------------------*/
+
+// Filled by init code before interrupts are enabled, read by the background
+static REPORT_Entry entries[REPORT_MAX_ENTRIES];
+static uint16_t entryCount;
+// Self-check verdicts, from the background or the host simulation's report
+static volatile uint16_t checkCount;
+static volatile uint16_t failureCount;
+
+/*------------------------------HELPERS------------------------------*/
+
+static REPORT_Entry *findEntry(const char *name) {
+    uint16_t index;
+    for (index = 0; index < entryCount; index ++) {
+        if (strcmp(entries[index].name, name) == 0) {
+            return &entries[index];
+        }
+    }
+    return 0;
+}
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+bool REPORT_register(const char *name, REPORT_Dump dump, const void *object) {
+    REPORT_Entry *entry = findEntry(name);
+    if (entry != 0) {
+        entry->dump = dump;
+        entry->object = object;
+        return true;
+    }
+    if (entryCount >= REPORT_MAX_ENTRIES) {
+        return false;
+    }
+    // Counted once complete, a reader never sees a half-written entry
+    entry = &entries[entryCount];
+    entry->name = name;
+    entry->dump = dump;
+    entry->object = object;
+    entryCount ++;
+    return true;
+}
+
+const void *REPORT_find(const char *name) {
+    const REPORT_Entry *entry = findEntry(name);
+    return entry != 0 ? entry->object : 0;
+}
+
+uint16_t REPORT_count(void) {
+    return entryCount;
+}
+
+const REPORT_Entry *REPORT_entry(uint16_t index) {
+    return index < entryCount ? &entries[index] : 0;
+}
+
+void REPORT_dumpAll(REPORT_Writer write, void *context) {
+    uint16_t index;
+    for (index = 0; index < entryCount; index ++) {
+        entries[index].dump(entries[index].object, write, context);
+    }
+}
+
+bool REPORT_check(bool passed) {
+    checkCount ++;
+    if (!passed) {
+        failureCount ++;
+    }
+    return passed;
+}
+
+uint16_t REPORT_checkCount(void) {
+    return checkCount;
+}
+
+uint16_t REPORT_failureCount(void) {
+    return failureCount;
+}
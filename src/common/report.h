@@ -0,0 +1,48 @@
+#ifndef REPORT_H
+#define REPORT_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*------------------------------MACROS------------------------------*/
+
+#define REPORT_MAX_ENTRIES 16U
+
+/*------------------------------TYPES------------------------------*/
+
+// Receives one report line, without the line break
+typedef void (*REPORT_Writer)(const char *line, void *context);
+
+// Writes the report of one object, line by line
+typedef void (*REPORT_Dump)(const void *object, REPORT_Writer write, void *context);
+
+typedef struct {
+    const char *name;
+    REPORT_Dump dump;
+    const void *object;
+} REPORT_Entry;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// Init code: object reported under name; a name already registered reports the new object instead.
+// false when the registry is full
+bool REPORT_register(const char *name, REPORT_Dump dump, const void *object);
+
+// Object registered under name, 0 if none
+const void *REPORT_find(const char *name);
+
+uint16_t REPORT_count(void);
+const REPORT_Entry *REPORT_entry(uint16_t index);
+
+// Background: every registered report, in registration order
+void REPORT_dumpAll(REPORT_Writer write, void *context);
+
+// Self checks: every verdict is counted and one failed check fails the run (the exit status of the host
+// simulation; on the DSP, the counts in a watch window). Returns passed
+bool REPORT_check(bool passed);
+uint16_t REPORT_checkCount(void);
+uint16_t REPORT_failureCount(void);
+
+#endif
@@ -0,0 +1,58 @@
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "ringBuffer.h"
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+bool RING_init(RING_Buffer *ring, uint16_t *storage, uint16_t capacity) {
+    if (capacity == 0U || capacity > RING_MAX_CAPACITY || (capacity & (capacity - 1U)) != 0U) {
+        return false;
+    }
+    ring->buffer = storage;
+    ring->capacity = capacity;
+    ring->mask = capacity - 1U;
+    ring->head = 0U;
+    ring->tail = 0U;
+    ring->overruns = 0UL;
+    ring->highWater = 0U;
+    return true;
+}
+
+uint16_t RING_pop(RING_Buffer *ring, uint16_t *values, uint16_t maxCount) {
+    uint16_t copied = 0U;
+    // At most two spans: up to the end of the storage, then from its start
+    while (copied < maxCount) {
+        const uint16_t *span;
+        uint16_t length = RING_peek(ring, &span);
+        if (length == 0U) {
+            break;
+        }
+        if (length > maxCount - copied) {
+            length = maxCount - copied;
+        }
+        uint16_t index;
+        for (index = 0; index < length; index ++) {
+            values[copied + index] = span[index];
+        }
+        RING_release(ring, length);
+        copied += length;
+    }
+    return copied;
+}
+
+uint16_t RING_peek(const RING_Buffer *ring, const uint16_t **span) {
+    const uint16_t tail = ring->tail;
+    const uint16_t used = (uint16_t)(ring->head - tail);
+    // Head read before the values it covers
+    RING_BARRIER();
+    const uint16_t start = tail & ring->mask;
+    const uint16_t untilEnd = ring->capacity - start;
+    *span = &ring->buffer[start];
+    return used < untilEnd ? used : untilEnd;
+}
+
+void RING_release(RING_Buffer *ring, uint16_t count) {
+    // Values read before their slots are handed back to the producer
+    RING_BARRIER();
+    ring->tail = ring->tail + count;
+}
@@ -0,0 +1,71 @@
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*------------------------------MACROS------------------------------*/
+
+// Largest capacity, free-running 16-bit indices must tell full from empty
+#define RING_MAX_CAPACITY 32768U
+
+// Compiler barrier between data and index accesses; C28x is one core and keeps volatile order
+#if defined(__GNUC__)
+#define RING_BARRIER() __asm__ __volatile__("" ::: "memory")
+#else
+#define RING_BARRIER()
+#endif
+
+/*------------------------------TYPES------------------------------*/
+
+// Single producer (ISR), single consumer (background), no locks and no interrupt masking
+typedef struct {
+    uint16_t *buffer;
+    uint16_t capacity; // Power of two
+    uint16_t mask; // capacity - 1
+    volatile uint16_t head; // Written by the producer only, free-running
+    volatile uint16_t tail; // Written by the consumer only, free-running
+    volatile uint32_t overruns; // Values dropped on a full ring (producer)
+    volatile uint16_t highWater; // Highest fill level seen by the producer
+} RING_Buffer;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// false when capacity is not a power of two up to RING_MAX_CAPACITY
+bool RING_init(RING_Buffer *ring, uint16_t *storage, uint16_t capacity);
+
+// Producer: false (and one overrun counted) when the ring is full, the new value is dropped
+static inline bool RING_push(RING_Buffer *ring, uint16_t value) {
+    const uint16_t head = ring->head;
+    const uint16_t used = (uint16_t)(head - ring->tail);
+    if (used >= ring->capacity) {
+        ring->overruns ++;
+        return false;
+    }
+    ring->buffer[head & ring->mask] = value;
+    if (used + 1U > ring->highWater) {
+        ring->highWater = used + 1U;
+    }
+    // Value stored before it is published
+    RING_BARRIER();
+    ring->head = head + 1U;
+    return true;
+}
+
+// Consumer: values ready to read
+static inline uint16_t RING_count(const RING_Buffer *ring) {
+    return (uint16_t)(ring->head - ring->tail);
+}
+
+// Consumer: copies up to maxCount values, returns how many
+uint16_t RING_pop(RING_Buffer *ring, uint16_t *values, uint16_t maxCount);
+
+// Consumer, zero copy: oldest contiguous span (stops at the end of the storage), returns its length
+uint16_t RING_peek(const RING_Buffer *ring, const uint16_t **span);
+
+// Consumer: frees count values after a RING_peek
+void RING_release(RING_Buffer *ring, uint16_t count);
+
+#endif
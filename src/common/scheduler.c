@@ -0,0 +1,154 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdio.h>
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "report.h"
+#include "scheduler.h"
+
+/*------------------------------HELPERS------------------------------*/
+
+static void updateUtilisation(SCHED_Scheduler *scheduler) {
+    const uint32_t tick = scheduler->ticks;
+    if ((uint32_t)(tick - scheduler->windowStartTick) < scheduler->windowTicks) {
+        return;
+    }
+    const uint32_t now = scheduler->clock();
+    const float elapsed = (float)(uint32_t)(now - scheduler->windowStart);
+    if (elapsed > 0.0f) {
+        const uint32_t realTimeBusy = scheduler->realTimeBusyTicks;
+        scheduler->realTimeUtilisation = 100.0f * (float)(uint32_t)(realTimeBusy - scheduler->windowRealTimeBusy) / elapsed;
+        scheduler->windowRealTimeBusy = realTimeBusy;
+        uint16_t index;
+        for (index = 0; index < scheduler->taskCount; index ++) {
+            SCHED_Task *task = &scheduler->tasks[index];
+            task->utilisation = 100.0f * (float)(uint32_t)(task->busyTicks - scheduler->windowTaskBusy[index]) / elapsed;
+            scheduler->windowTaskBusy[index] = task->busyTicks;
+        }
+    }
+    scheduler->windowStartTick = tick;
+    scheduler->windowStart = now;
+}
+
+static void report(const void *object, REPORT_Writer write, void *context) {
+    SCHED_dump((const SCHED_Scheduler *)object, write, context);
+}
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+void SCHED_init(SCHED_Scheduler *scheduler, float tickFrequency, SCHED_Clock clock, uint16_t windowTicks) {
+    scheduler->clock = clock;
+    scheduler->tickFrequency = tickFrequency;
+    scheduler->realTimeFunction = 0;
+    scheduler->realTimeContext = 0;
+    scheduler->ticks = 0UL;
+    scheduler->realTimeBusyTicks = 0UL;
+    scheduler->realTimeMaximumTicks = 0UL;
+    scheduler->realTimeUtilisation = 0.0f;
+    scheduler->taskCount = 0U;
+    scheduler->windowTicks = windowTicks;
+    scheduler->windowStartTick = 0UL;
+    scheduler->windowStart = clock();
+    scheduler->windowRealTimeBusy = 0UL;
+    REPORT_register("scheduler", &report, scheduler);
+}
+
+void SCHED_setRealTime(SCHED_Scheduler *scheduler, SCHED_Function function, void *context) {
+    scheduler->realTimeContext = context;
+    scheduler->realTimeFunction = function;
+}
+
+SCHED_Task *SCHED_addTask(SCHED_Scheduler *scheduler, const char *name, float frequency, SCHED_Function function, void *context) {
+    if (scheduler->taskCount >= SCHED_MAX_TASKS || frequency <= 0.0f) {
+        return 0;
+    }
+    // Divider MUST BE at least one tick
+    float divider = scheduler->tickFrequency / frequency + 0.5f;
+    if (divider < 1.0f) {
+        divider = 1.0f;
+    } else if (divider > 65535.0f) {
+        divider = 65535.0f;
+    }
+    SCHED_Task *task = &scheduler->tasks[scheduler->taskCount];
+    task->name = name;
+    task->function = function;
+    task->context = context;
+    task->divider = (uint16_t)divider;
+    task->countdown = task->divider;
+    task->releases = 0UL;
+    task->runs = 0UL;
+    task->misses = 0UL;
+    task->busyTicks = 0UL;
+    task->maximumTicks = 0UL;
+    task->utilisation = 0.0f;
+    scheduler->windowTaskBusy[scheduler->taskCount] = 0UL;
+    // Published last, the tick ISR may already be running
+    scheduler->taskCount ++;
+    return task;
+}
+
+void SCHED_tick(SCHED_Scheduler *scheduler) {
+    if (scheduler->realTimeFunction != 0) {
+        const uint32_t start = scheduler->clock();
+        scheduler->realTimeFunction(scheduler->realTimeContext);
+        const uint32_t elapsed = scheduler->clock() - start;
+        scheduler->realTimeBusyTicks += elapsed;
+        if (elapsed > scheduler->realTimeMaximumTicks) {
+            scheduler->realTimeMaximumTicks = elapsed;
+        }
+    }
+    scheduler->ticks ++;
+    uint16_t index;
+    for (index = 0; index < scheduler->taskCount; index ++) {
+        SCHED_Task *task = &scheduler->tasks[index];
+        if (-- task->countdown == 0U) {
+            task->countdown = task->divider;
+            task->releases ++;
+        }
+    }
+}
+
+void SCHED_runPending(SCHED_Scheduler *scheduler) {
+    uint16_t index;
+    for (index = 0; index < scheduler->taskCount; index ++) {
+        SCHED_Task *task = &scheduler->tasks[index];
+        const uint32_t releases = task->releases;
+        if (releases == task->runs) {
+            continue;
+        }
+        // Only the latest release is served, older ones missed their deadline
+        task->misses += releases - task->runs - 1UL;
+        const uint32_t start = scheduler->clock();
+        task->function(task->context);
+        const uint32_t elapsed = scheduler->clock() - start;
+        task->busyTicks += elapsed;
+        if (elapsed > task->maximumTicks) {
+            task->maximumTicks = elapsed;
+        }
+        // Still running when the next release came, that one runs on the next call
+        if (task->releases != releases) {
+            task->misses ++;
+        }
+        task->runs = releases;
+        // One task per call so a faster task released meanwhile goes first
+        break;
+    }
+    updateUtilisation(scheduler);
+}
+
+void SCHED_dump(const SCHED_Scheduler *scheduler, REPORT_Writer write, void *context) {
+    char line[SCHED_LINE_LENGTH];
+    snprintf(line, sizeof(line), "Scheduler ticks %lu real-time max %lu ticks utilisation %.2f%%",
+             (unsigned long)scheduler->ticks, (unsigned long)scheduler->realTimeMaximumTicks,
+             (double)scheduler->realTimeUtilisation);
+    write(line, context);
+    uint16_t index;
+    for (index = 0; index < scheduler->taskCount; index ++) {
+        const SCHED_Task *task = &scheduler->tasks[index];
+        snprintf(line, sizeof(line), "  %s every %u ticks releases %lu runs %lu misses %lu max %lu ticks utilisation %.2f%%",
+                 task->name, task->divider, (unsigned long)task->releases, (unsigned long)task->runs,
+                 (unsigned long)task->misses, (unsigned long)task->maximumTicks, (double)task->utilisation);
+        write(line, context);
+    }
+}
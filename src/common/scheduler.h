@@ -0,0 +1,77 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdint.h>
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "report.h"
+
+/*------------------------------MACROS------------------------------*/
+
+#define SCHED_MAX_TASKS 8U
+#define SCHED_LINE_LENGTH 128U
+
+/*------------------------------TYPES------------------------------*/
+
+typedef void (*SCHED_Function)(void *context);
+
+// Free-running timestamp in SYSCLK ticks (e.g. PROF_now)
+typedef uint32_t (*SCHED_Clock)(void);
+
+typedef struct {
+    const char *name;
+    SCHED_Function function;
+    void *context;
+    uint16_t divider; // Ticks per release
+    uint16_t countdown; // Ticks to the next release, ISR only
+    volatile uint32_t releases; // Written by SCHED_tick only
+    uint32_t runs; // Releases served, main loop only
+    uint32_t misses; // Releases skipped or finished after the next release
+    uint32_t busyTicks; // Free-running, wraps
+    uint32_t maximumTicks;
+    float utilisation; // % of the CPU over the last window
+} SCHED_Task;
+
+typedef struct {
+    SCHED_Clock clock;
+    float tickFrequency;
+    // Hard real-time slot, runs inside SCHED_tick before any release
+    SCHED_Function realTimeFunction;
+    void *realTimeContext;
+    volatile uint32_t ticks;
+    volatile uint32_t realTimeBusyTicks; // Free-running, wraps
+    uint32_t realTimeMaximumTicks;
+    float realTimeUtilisation;
+    // Tasks in priority order, the first one has the highest priority
+    SCHED_Task tasks[SCHED_MAX_TASKS];
+    uint16_t taskCount;
+    // Utilisation window, main loop only
+    uint16_t windowTicks;
+    uint32_t windowStartTick;
+    uint32_t windowStart;
+    uint32_t windowRealTimeBusy;
+    uint32_t windowTaskBusy[SCHED_MAX_TASKS];
+} SCHED_Scheduler;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// Utilisation refreshed every windowTicks ticks
+void SCHED_init(SCHED_Scheduler *scheduler, float tickFrequency, SCHED_Clock clock, uint16_t windowTicks);
+void SCHED_setRealTime(SCHED_Scheduler *scheduler, SCHED_Function function, void *context);
+
+// Released every tickFrequency / frequency ticks; add the fastest first, it gets the highest priority; NULL when full
+SCHED_Task *SCHED_addTask(SCHED_Scheduler *scheduler, const char *name, float frequency, SCHED_Function function, void *context);
+
+// Tick ISR: real-time slot, then task releases
+void SCHED_tick(SCHED_Scheduler *scheduler);
+
+// Main loop: runs the highest-priority released task, if any, and refreshes the utilisation
+void SCHED_runPending(SCHED_Scheduler *scheduler);
+
+// Background: releases, runs, deadline misses, worst case and utilisation of every task, line by line
+void SCHED_dump(const SCHED_Scheduler *scheduler, REPORT_Writer write, void *context);
+
+#endif
@@ -0,0 +1,148 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdio.h>
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "report.h"
+#include "scope.h"
+
+/*------------------------------HELPERS------------------------------*/
+
+// Fresh capture in the filling frame with the active settings
+static void startCapture(SCOPE_Scope *scope) {
+    const SCOPE_Settings *settings = &scope->active;
+    scope->state = settings->mode == SCOPE_OFF ? SCOPE_STATE_IDLE
+        : settings->preTrigger == 0U ? SCOPE_STATE_ARMED : SCOPE_STATE_HISTORY;
+    // Edges must first see the other side of the level
+    scope->ready = false;
+    scope->position = 0U;
+    scope->stored = 0U;
+    scope->remaining = 0U;
+    scope->count = 0U;
+    scope->waited = 0U;
+    scope->forced = false;
+}
+
+static void report(const void *object, REPORT_Writer write, void *context) {
+    SCOPE_dump((const SCOPE_Scope *)object, write, context);
+}
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+bool SCOPE_init(SCOPE_Scope *scope, uint16_t *storage, uint16_t length) {
+    if (length == 0U || length > SCOPE_MAX_LENGTH) {
+        return false;
+    }
+    const SCOPE_Settings off = {SCOPE_OFF, SCOPE_RISING, 0U, 0U, 0U, 0U, 0U, 1U, false, 0U};
+    scope->settings[0] = off;
+    scope->settings[1] = off;
+    scope->active = off;
+    scope->published = 0U;
+    scope->sequence = 0U;
+    scope->applied = 0U;
+    scope->length = length;
+    uint16_t frame;
+    for (frame = 0; frame < 2U; frame ++) {
+        scope->frames[frame].points = storage + frame * 2U * length;
+        scope->frames[frame].length = length;
+        scope->frames[frame].start = 0U;
+        scope->frames[frame].triggerPoint = 0U;
+        scope->frames[frame].decimation = 1U;
+        scope->frames[frame].minMax = false;
+        scope->frames[frame].forced = false;
+        scope->frames[frame].triggerSample = 0UL;
+    }
+    scope->filling = 0U;
+    scope->samples = 0UL;
+    scope->triggerSample = 0UL;
+    scope->frozenFrame = 0U;
+    scope->frozen = 0U;
+    scope->released = 0U;
+    scope->triggers = 0UL;
+    scope->forcedFrames = 0UL;
+    scope->framesDropped = 0UL;
+    scope->framesFrozen = 0UL;
+    startCapture(scope);
+    REPORT_register("scope", &report, scope);
+    return true;
+}
+
+void SCOPE_arm(SCOPE_Scope *scope, const SCOPE_Settings *settings) {
+    const uint16_t idle = scope->published ^ 1U;
+    SCOPE_Settings *next = &scope->settings[idle];
+    *next = *settings;
+    // Pre-trigger MUST BE below the frame length, decimation and timeout at least 1
+    if (next->preTrigger >= scope->length) {
+        next->preTrigger = scope->length - 1U;
+    }
+    if (next->decimation == 0U) {
+        next->decimation = 1U;
+    }
+    if (next->autoTimeout == 0U) {
+        next->autoTimeout = scope->length;
+    }
+    if (next->windowHigh < next->windowLow) {
+        next->windowHigh = next->windowLow;
+    }
+    scope->published = idle;
+    scope->sequence ++;
+}
+
+void SCOPE_restart(SCOPE_Scope *scope) {
+    scope->active = scope->settings[scope->published];
+    scope->applied = scope->sequence;
+    scope->samples = 0UL;
+    startCapture(scope);
+}
+
+void SCOPE_freeze(SCOPE_Scope *scope) {
+    SCOPE_Frame *frame = &scope->frames[scope->filling];
+    // Ring full: the next slot holds the oldest point
+    frame->start = scope->position;
+    frame->triggerPoint = scope->active.preTrigger;
+    frame->decimation = scope->active.decimation;
+    frame->minMax = scope->active.minMax;
+    frame->forced = scope->forced;
+    frame->triggerSample = scope->triggerSample;
+    if (scope->frozen == scope->released) {
+        // Background holds nothing: hand this frame over, capture into the other one
+        scope->frozenFrame = scope->filling;
+        scope->frozen ++;
+        scope->filling ^= 1U;
+        scope->framesFrozen ++;
+    } else {
+        scope->framesDropped ++;
+    }
+    if (scope->active.mode == SCOPE_SINGLE) {
+        scope->active.mode = SCOPE_OFF;
+    }
+    startCapture(scope);
+}
+
+void SCOPE_dump(const SCOPE_Scope *scope, REPORT_Writer write, void *context) {
+    char line[SCOPE_LINE_LENGTH];
+    snprintf(line, sizeof(line), "Scope length %u decimation %u%s pre-trigger %u triggers %lu forced %lu frames %lu dropped %lu",
+             scope->length, scope->active.decimation, scope->active.minMax ? " min/max" : "", scope->active.preTrigger,
+             (unsigned long)scope->triggers, (unsigned long)scope->forcedFrames, (unsigned long)scope->framesFrozen,
+             (unsigned long)scope->framesDropped);
+    write(line, context);
+    if (scope->framesFrozen == 0UL) {
+        return;
+    }
+    const SCOPE_Frame *frame = &scope->frames[scope->frozenFrame];
+    const uint16_t trigger = frame->triggerPoint;
+    int length = snprintf(line, sizeof(line), "  last frame%s at sample %lu, points around the trigger",
+                          frame->forced ? " (forced)" : "", (unsigned long)frame->triggerSample);
+    uint16_t index = trigger >= 2U ? trigger - 2U : 0U;
+    for (; index < frame->length && index <= trigger + 2U && length < (int)sizeof(line); index ++) {
+        if (frame->minMax) {
+            length += snprintf(line + length, sizeof(line) - length, " %s%u/%u", index == trigger ? "*" : "",
+                               SCOPE_point(frame, index, false), SCOPE_point(frame, index, true));
+        } else {
+            length += snprintf(line + length, sizeof(line) - length, " %s%u", index == trigger ? "*" : "",
+                               SCOPE_point(frame, index, false));
+        }
+    }
+    write(line, context);
+}
@@ -0,0 +1,243 @@
+#ifndef SCOPE_H
+#define SCOPE_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "report.h"
+
+/*------------------------------MACROS------------------------------*/
+
+// Storage words for frames of length points: two frames of min and max pairs
+#define SCOPE_STORAGE(length) (4U * (length))
+#define SCOPE_MAX_LENGTH 8192U
+#define SCOPE_LINE_LENGTH 160U
+
+// Capture states, ISR only
+#define SCOPE_STATE_IDLE 0U
+#define SCOPE_STATE_HISTORY 1U // Filling the pre-trigger points, trigger ignored
+#define SCOPE_STATE_ARMED 2U // History kept rolling, waiting for the trigger
+#define SCOPE_STATE_POST 3U // Filling the post-trigger points
+
+/*------------------------------TYPES------------------------------*/
+
+// Edges and the window need the signal back by the hysteresis first, levels fire on any sample past them
+typedef enum {
+    SCOPE_RISING, // Crosses level upwards, after being below level - hysteresis
+    SCOPE_FALLING, // Crosses level downwards, after being above level + hysteresis
+    SCOPE_ABOVE, // At or above level
+    SCOPE_BELOW, // At or below level
+    SCOPE_OUTSIDE_WINDOW // Leaves [windowLow, windowHigh], after being inside by hysteresis
+} SCOPE_Trigger;
+
+typedef enum {
+    SCOPE_OFF,
+    SCOPE_SINGLE, // One frame, then off until armed again
+    SCOPE_NORMAL, // A frame at every trigger
+    SCOPE_AUTO // As normal, plus a forced frame after autoTimeout points without a trigger
+} SCOPE_Mode;
+
+typedef struct {
+    SCOPE_Mode mode;
+    SCOPE_Trigger trigger;
+    uint16_t level;
+    uint16_t hysteresis;
+    uint16_t windowLow;
+    uint16_t windowHigh;
+    uint16_t preTrigger; // Points before the trigger point, below the frame length
+    uint16_t decimation; // Samples per point, 1 keeps every sample
+    bool minMax; // Points as the minimum and maximum of their samples, else their first sample
+    uint16_t autoTimeout; // Points, SCOPE_AUTO only
+} SCOPE_Settings;
+
+// Frozen frame, read in place: point i is at (start + i) modulo length
+typedef struct {
+    uint16_t *points; // length points, or length minimum and maximum pairs
+    uint16_t length;
+    uint16_t start; // Oldest point
+    uint16_t triggerPoint; // Points before the trigger point
+    uint16_t decimation;
+    bool minMax;
+    bool forced; // SCOPE_AUTO timeout, no trigger
+    uint32_t triggerSample; // Samples from arming to the trigger
+} SCOPE_Frame;
+
+typedef struct {
+    // Settings published by the background, applied by the ISR at its next sample
+    SCOPE_Settings settings[2];
+    volatile uint16_t published;
+    volatile uint16_t sequence;
+    uint16_t applied;
+    SCOPE_Settings active;
+    uint16_t length; // Points per frame
+    SCOPE_Frame frames[2];
+    uint16_t filling; // Frame the ISR writes
+    // Capture, ISR only
+    uint16_t state;
+    bool ready; // Edge or window trigger re-armed
+    uint16_t position; // Next point in the filling frame
+    uint16_t stored; // History points, up to preTrigger
+    uint16_t remaining; // Post-trigger points still to store
+    uint16_t count; // Samples in the current point
+    uint16_t first;
+    uint16_t minimum;
+    uint16_t maximum;
+    uint16_t waited; // Armed points without a trigger
+    bool forced;
+    uint32_t samples;
+    uint32_t triggerSample;
+    // Handoff: a frame is with the background while frozen differs from released
+    volatile uint16_t frozenFrame;
+    volatile uint16_t frozen; // ISR
+    volatile uint16_t released; // Background
+    volatile uint32_t triggers;
+    volatile uint32_t forcedFrames;
+    volatile uint32_t framesFrozen;
+    volatile uint32_t framesDropped; // Frozen while the background still held the previous one
+} SCOPE_Scope;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// storage holds SCOPE_STORAGE(length) words; off until armed; false for a length of 0 or above SCOPE_MAX_LENGTH
+bool SCOPE_init(SCOPE_Scope *scope, uint16_t *storage, uint16_t length);
+
+// Background: new settings, the ISR restarts the capture with them at its next sample
+void SCOPE_arm(SCOPE_Scope *scope, const SCOPE_Settings *settings);
+
+// ISR, rare path: settings picked up, capture restarted
+void SCOPE_restart(SCOPE_Scope *scope);
+// ISR, once per frame: last post-trigger point stored
+void SCOPE_freeze(SCOPE_Scope *scope);
+
+// Background: settings, trigger counts and the points around the trigger of the last frame, line by line
+void SCOPE_dump(const SCOPE_Scope *scope, REPORT_Writer write, void *context);
+
+// Background, zero copy: the frozen frame or 0, untouched by the ISR until released
+static inline const SCOPE_Frame *SCOPE_takeFrame(const SCOPE_Scope *scope) {
+    return scope->frozen != scope->released ? &scope->frames[scope->frozenFrame] : 0;
+}
+
+// Background: frame read, the ISR may freeze the next one
+static inline void SCOPE_releaseFrame(SCOPE_Scope *scope) {
+    scope->released = scope->frozen;
+}
+
+// Background: point of a frame in time order, the maximum of min and max pairs when high is set
+static inline uint16_t SCOPE_point(const SCOPE_Frame *frame, uint16_t index, bool high) {
+    uint16_t slot = frame->start + index;
+    if (slot >= frame->length) {
+        slot -= frame->length;
+    }
+    return frame->minMax ? frame->points[2U * slot + (high ? 1U : 0U)] : frame->points[slot];
+}
+
+// Trigger on one sample: O(1); edges seen while the history fills are spent, so a frame never starts late on one
+static inline bool SCOPE_detect(SCOPE_Scope *scope, uint16_t sample, bool armed) {
+    const SCOPE_Settings *settings = &scope->active;
+    const int32_t value = sample;
+    const int32_t level = settings->level;
+    const int32_t hysteresis = settings->hysteresis;
+    bool outside;
+    switch (settings->trigger) {
+        case SCOPE_RISING:
+        case SCOPE_ABOVE:
+            if (value < level - hysteresis) {
+                scope->ready = true;
+            }
+            outside = value >= level;
+            break;
+        case SCOPE_FALLING:
+        case SCOPE_BELOW:
+            if (value > level + hysteresis) {
+                scope->ready = true;
+            }
+            outside = value <= level;
+            break;
+        default:
+            if (value >= (int32_t)settings->windowLow + hysteresis && value <= (int32_t)settings->windowHigh - hysteresis) {
+                scope->ready = true;
+            }
+            outside = value < settings->windowLow || value > settings->windowHigh;
+            break;
+    }
+    if (settings->trigger == SCOPE_ABOVE || settings->trigger == SCOPE_BELOW) {
+        return armed && outside;
+    }
+    if (scope->ready && outside) {
+        scope->ready = false;
+        return armed;
+    }
+    return false;
+}
+
+// ISR: one sample, O(1) whatever the settings
+static inline void SCOPE_update(SCOPE_Scope *scope, uint16_t sample) {
+    if (scope->sequence != scope->applied) {
+        SCOPE_restart(scope);
+    }
+    if (scope->state == SCOPE_STATE_IDLE) {
+        return;
+    }
+    scope->samples ++;
+    // Looked at on every sample, not only every point, so fast edges are not missed between points
+    if (scope->state != SCOPE_STATE_POST && SCOPE_detect(scope, sample, scope->state == SCOPE_STATE_ARMED)) {
+        scope->state = SCOPE_STATE_POST;
+        scope->remaining = scope->length - scope->active.preTrigger;
+        scope->triggerSample = scope->samples;
+        scope->forced = false;
+        scope->triggers ++;
+    }
+    if (scope->count == 0U) {
+        scope->first = sample;
+        scope->minimum = sample;
+        scope->maximum = sample;
+    } else if (sample < scope->minimum) {
+        scope->minimum = sample;
+    } else if (sample > scope->maximum) {
+        scope->maximum = sample;
+    }
+    if (++ scope->count < scope->active.decimation) {
+        return;
+    }
+    // Point complete: into the filling frame, which is a ring until the trigger
+    scope->count = 0U;
+    uint16_t *points = scope->frames[scope->filling].points;
+    if (scope->active.minMax) {
+        points[2U * scope->position] = scope->minimum;
+        points[2U * scope->position + 1U] = scope->maximum;
+    } else {
+        points[scope->position] = scope->first;
+    }
+    if (++ scope->position == scope->length) {
+        scope->position = 0U;
+    }
+    switch (scope->state) {
+        case SCOPE_STATE_HISTORY:
+            if (++ scope->stored >= scope->active.preTrigger) {
+                scope->state = SCOPE_STATE_ARMED;
+                scope->waited = 0U;
+            }
+            break;
+        case SCOPE_STATE_ARMED:
+            if (scope->active.mode == SCOPE_AUTO && ++ scope->waited >= scope->active.autoTimeout) {
+                // No trigger in time: the next point stands in for it
+                scope->state = SCOPE_STATE_POST;
+                scope->remaining = scope->length - scope->active.preTrigger;
+                scope->triggerSample = scope->samples + 1UL;
+                scope->forced = true;
+                scope->forcedFrames ++;
+            }
+            break;
+        default:
+            if (-- scope->remaining == 0U) {
+                SCOPE_freeze(scope);
+            }
+            break;
+    }
+}
+
+#endif
@@ -0,0 +1,396 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <math.h>
+#include <stdio.h>
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "report.h"
+#include "spectrum.h"
+
+/*------------------------------MACROS------------------------------*/
+
+// Cosine of table index i is FFT_sineTable[i + QUARTER_PERIOD]
+#define QUARTER_PERIOD (FFT_MAX_POINTS / 4U)
+
+// Background steps of one segment
+enum {
+    STEP_LOAD, // Window and bit-reverse the next segment into the transform
+    STEP_RADIX2, // First stage when log2 of the complex length is odd
+    STEP_RADIX4, // One stage per step
+    STEP_POWER, // Real split and power accumulation
+    STEP_PUBLISH
+};
+
+/*------------------------------HELPERS------------------------------*/
+
+// log2 of a power of two, 0 otherwise
+static uint16_t log2Of(uint16_t points) {
+    uint16_t bits = 0U;
+    while ((1U << bits) < points) {
+        bits ++;
+    }
+    return (1U << bits) == points ? bits : 0U;
+}
+
+// Butterflies of adjacent complex points, no twiddles
+static void radix2Stage(float *data, uint16_t complexPoints) {
+    uint16_t point;
+    for (point = 0U; point < complexPoints; point += 2U) {
+        float *a = &data[2U * point];
+        const float br = a[2];
+        const float bi = a[3];
+        a[2] = a[0] - br;
+        a[3] = a[1] - bi;
+        a[0] += br;
+        a[1] += bi;
+    }
+}
+
+// Decimation-in-time radix-4 stage on bit-reversed input: the two radix-2 stages of half spans span and
+// 2 span in one pass, three complex multiplies per four points
+static void radix4Stage(float *data, uint16_t complexPoints, uint16_t span) {
+    const uint16_t stride = (uint16_t)(FFT_MAX_POINTS / (4U * span));
+    uint16_t k;
+    uint16_t point;
+    for (k = 0U; k < span; k ++) {
+        // W^k, W^2k and W^3k of a transform of 4 span points
+        const uint16_t index = k * stride;
+        const float w1r = FFT_sineTable[index + QUARTER_PERIOD];
+        const float w1i = -FFT_sineTable[index];
+        const float w2r = FFT_sineTable[2U * index + QUARTER_PERIOD];
+        const float w2i = -FFT_sineTable[2U * index];
+        const float w3r = FFT_sineTable[3U * index + QUARTER_PERIOD];
+        const float w3i = -FFT_sineTable[3U * index];
+        for (point = k; point < complexPoints; point += 4U * span) {
+            float *a = &data[2U * point];
+            float *b = a + 2U * span;
+            float *c = b + 2U * span;
+            float *d = c + 2U * span;
+            const float br = b[0] * w2r - b[1] * w2i;
+            const float bi = b[0] * w2i + b[1] * w2r;
+            const float cr = c[0] * w1r - c[1] * w1i;
+            const float ci = c[0] * w1i + c[1] * w1r;
+            const float dr = d[0] * w3r - d[1] * w3i;
+            const float di = d[0] * w3i + d[1] * w3r;
+            const float sumR = a[0] + br;
+            const float sumI = a[1] + bi;
+            const float differenceR = a[0] - br;
+            const float differenceI = a[1] - bi;
+            const float outerR = cr + dr;
+            const float outerI = ci + di;
+            const float innerR = cr - dr;
+            const float innerI = ci - di;
+            a[0] = sumR + outerR;
+            a[1] = sumI + outerI;
+            c[0] = sumR - outerR;
+            c[1] = sumI - outerI;
+            // -j and +j times (c - d)
+            b[0] = differenceR + innerI;
+            b[1] = differenceI - innerR;
+            d[0] = differenceR - innerI;
+            d[1] = differenceI + innerR;
+        }
+    }
+}
+
+// Complex transform of points / 2 points on bit-reversed input
+static void runStages(float *data, uint16_t bits) {
+    const uint16_t complexPoints = 1U << (bits - 1U);
+    uint16_t span = 1U;
+    if (((bits - 1U) & 1U) != 0U) {
+        radix2Stage(data, complexPoints);
+        span = 2U;
+    }
+    for (; 4U * span <= complexPoints; span *= 4U) {
+        radix4Stage(data, complexPoints, span);
+    }
+}
+
+// Spectrum of the real sequence from the complex transform of its even and odd samples, packed in place
+static void splitReal(float *data, uint16_t points) {
+    const uint16_t half = points / 2U;
+    const uint16_t stride = (uint16_t)(FFT_MAX_POINTS / points);
+    uint16_t k;
+    const float z0r = data[0];
+    const float z0i = data[1];
+    data[0] = z0r + z0i;
+    data[1] = z0r - z0i;
+    for (k = 1U; k <= half / 2U; k ++) {
+        float *low = &data[2U * k];
+        float *high = &data[2U * (half - k)];
+        // Transforms of the even (E) and j times the odd (O) samples
+        const float evenR = 0.5f * (low[0] + high[0]);
+        const float evenI = 0.5f * (low[1] - high[1]);
+        const float oddR = 0.5f * (low[0] - high[0]);
+        const float oddI = 0.5f * (low[1] + high[1]);
+        const uint16_t index = k * stride;
+        const float wr = FFT_sineTable[index + QUARTER_PERIOD];
+        const float wi = -FFT_sineTable[index];
+        const float tr = wr * oddR - wi * oddI;
+        const float ti = wr * oddI + wi * oddR;
+        // X[k] = E - jWO, X[half - k] = conj(E) - j conj(WO)
+        low[0] = evenR + ti;
+        low[1] = evenI - tr;
+        high[0] = evenR - ti;
+        high[1] = -evenI - tr;
+    }
+}
+
+// Windowed copy of the next segment in bit-reversed order, false when none is complete or it was overwritten
+static bool loadSegment(SPEC_Analyzer *analyzer) {
+    const uint16_t points = analyzer->points;
+    const uint16_t hop = points / 2U;
+    const uint32_t available = analyzer->head - analyzer->next;
+    uint16_t point;
+    SPEC_BARRIER();
+    if (available < points) {
+        return false;
+    }
+    // Fell behind: skip to the newest complete segment, keeping a hop of margin for the producer
+    if (available > SPEC_HISTORY(points) - hop) {
+        const uint32_t skipped = (available - points) / hop;
+        analyzer->next += skipped * hop;
+        analyzer->dropped += skipped;
+    }
+    const uint16_t shift = FFT_MAX_BITS - analyzer->bits;
+    const uint16_t start = (uint16_t)analyzer->next;
+    const uint16_t mask = analyzer->mask;
+    const uint16_t *history = analyzer->history;
+    const float *coefficients = analyzer->coefficients;
+    float *work = analyzer->work;
+    // Even samples are the real parts, odd ones the imaginary parts of the complex transform
+    for (point = 0U; point < hop; point ++) {
+        const uint16_t target = 2U * (FFT_bitReverseTable[point] >> shift);
+        const uint16_t sample = start + 2U * point;
+        work[target] = ((float)history[sample & mask] - SPEC_ADC_MIDSCALE) * coefficients[2U * point];
+        work[target + 1U] = ((float)history[(sample + 1U) & mask] - SPEC_ADC_MIDSCALE) * coefficients[2U * point + 1U];
+    }
+    SPEC_BARRIER();
+    const bool overwritten = analyzer->head - analyzer->next > SPEC_HISTORY(points);
+    analyzer->next += hop;
+    if (overwritten) {
+        analyzer->dropped ++;
+        return false;
+    }
+    return true;
+}
+
+// Adds the one-sided power of the packed transform, DC and Nyquist are not folded
+static void accumulatePower(SPEC_Analyzer *analyzer) {
+    const uint16_t half = analyzer->points / 2U;
+    const float *work = analyzer->work;
+    float *accumulator = analyzer->accumulator;
+    uint16_t bin;
+    accumulator[0] += 0.5f * work[0] * work[0];
+    accumulator[half] += 0.5f * work[1] * work[1];
+    for (bin = 1U; bin < half; bin ++) {
+        accumulator[bin] += work[2U * bin] * work[2U * bin] + work[2U * bin + 1U] * work[2U * bin + 1U];
+    }
+}
+
+static void publish(SPEC_Analyzer *analyzer) {
+    const uint16_t bins = SPEC_BINS(analyzer->points);
+    const float factor = analyzer->scale / (float)analyzer->accumulated;
+    uint16_t bin;
+    for (bin = 0U; bin < bins; bin ++) {
+        analyzer->power[bin] = analyzer->accumulator[bin] * factor;
+        analyzer->accumulator[bin] = 0.0f;
+    }
+    analyzer->accumulated = 0U;
+    analyzer->spectra ++;
+}
+
+static void report(const void *object, REPORT_Writer write, void *context) {
+    SPEC_dump((const SPEC_Analyzer *)object, write, context);
+}
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+bool SPEC_realFFT(float *data, uint16_t points) {
+    const uint16_t bits = log2Of(points);
+    uint16_t point;
+    if (bits < 2U || points > SPEC_MAX_POINTS) {
+        return false;
+    }
+    const uint16_t complexPoints = points / 2U;
+    const uint16_t shift = FFT_MAX_BITS - bits;
+    for (point = 1U; point < complexPoints; point ++) {
+        const uint16_t reversed = FFT_bitReverseTable[point] >> shift;
+        if (reversed > point) {
+            const float re = data[2U * point];
+            const float im = data[2U * point + 1U];
+            data[2U * point] = data[2U * reversed];
+            data[2U * point + 1U] = data[2U * reversed + 1U];
+            data[2U * reversed] = re;
+            data[2U * reversed + 1U] = im;
+        }
+    }
+    runStages(data, bits);
+    splitReal(data, points);
+    return true;
+}
+
+bool SPEC_init(SPEC_Analyzer *analyzer, const char *name, float sampleFrequency, uint16_t points, SPEC_Window window,
+               uint16_t averages, float *storage, uint16_t *history) {
+    const uint16_t bits = log2Of(points);
+    uint16_t point;
+    uint16_t bin;
+    if (bits == 0U || points < SPEC_MIN_POINTS || points > SPEC_MAX_POINTS || averages == 0U) {
+        return false;
+    }
+    const float twoPi = 6.28318531f;
+    analyzer->name = name;
+    analyzer->sampleFrequency = sampleFrequency;
+    analyzer->points = points;
+    analyzer->bits = bits;
+    analyzer->averages = averages;
+    analyzer->window = window;
+    analyzer->work = storage;
+    analyzer->coefficients = storage + points;
+    analyzer->accumulator = storage + 2U * points;
+    analyzer->power = analyzer->accumulator + SPEC_BINS(points);
+    // Periodic windows, Welch segments join without a repeated end point
+    float sumSquares = 0.0f;
+    for (point = 0U; point < points; point ++) {
+        const float angle = twoPi * (float)point / (float)points;
+        float coefficient = 1.0f;
+        if (window == SPEC_WINDOW_HANN) {
+            coefficient = 0.5f - 0.5f * cosf(angle);
+        } else if (window == SPEC_WINDOW_BLACKMAN_HARRIS) {
+            coefficient = 0.35875f - 0.48829f * cosf(angle) + 0.14128f * cosf(2.0f * angle) - 0.01168f * cosf(3.0f * angle);
+        }
+        analyzer->coefficients[point] = coefficient;
+        sumSquares += coefficient * coefficient;
+    }
+    analyzer->lobe = window == SPEC_WINDOW_BLACKMAN_HARRIS ? 4U : (window == SPEC_WINDOW_HANN ? 2U : 1U);
+    // A tone's main lobe then adds up to its mean square, white noise to its variance over all bins
+    analyzer->scale = 2.0f / ((float)points * sumSquares);
+    for (bin = 0U; bin < SPEC_BINS(points); bin ++) {
+        analyzer->accumulator[bin] = 0.0f;
+        analyzer->power[bin] = 0.0f;
+    }
+    analyzer->history = history;
+    analyzer->mask = SPEC_HISTORY(points) - 1U;
+    analyzer->head = 0UL;
+    analyzer->next = 0UL;
+    analyzer->step = STEP_LOAD;
+    analyzer->span = 1U;
+    analyzer->accumulated = 0U;
+    analyzer->segments = 0UL;
+    analyzer->dropped = 0UL;
+    analyzer->spectra = 0UL;
+    REPORT_register(name, &report, analyzer);
+    return true;
+}
+
+void SPEC_push(SPEC_Analyzer *analyzer, const uint16_t *samples, uint16_t length) {
+    uint32_t head = analyzer->head;
+    uint16_t sample;
+    for (sample = 0U; sample < length; sample ++) {
+        analyzer->history[(uint16_t)head & analyzer->mask] = samples[sample];
+        head ++;
+    }
+    // Samples stored before they are published
+    SPEC_BARRIER();
+    analyzer->head = head;
+}
+
+bool SPEC_process(SPEC_Analyzer *analyzer) {
+    const uint16_t complexPoints = analyzer->points / 2U;
+    switch (analyzer->step) {
+        case STEP_LOAD:
+            if (loadSegment(analyzer)) {
+                analyzer->span = 1U;
+                analyzer->step = ((analyzer->bits - 1U) & 1U) != 0U ? STEP_RADIX2 : STEP_RADIX4;
+            }
+            break;
+        case STEP_RADIX2:
+            radix2Stage(analyzer->work, complexPoints);
+            analyzer->span = 2U;
+            analyzer->step = STEP_RADIX4;
+            break;
+        case STEP_RADIX4:
+            radix4Stage(analyzer->work, complexPoints, analyzer->span);
+            analyzer->span *= 4U;
+            if (4U * analyzer->span > complexPoints) {
+                analyzer->step = STEP_POWER;
+            }
+            break;
+        case STEP_POWER:
+            splitReal(analyzer->work, analyzer->points);
+            accumulatePower(analyzer);
+            analyzer->segments ++;
+            analyzer->accumulated ++;
+            analyzer->step = analyzer->accumulated >= analyzer->averages ? STEP_PUBLISH : STEP_LOAD;
+            break;
+        default:
+            publish(analyzer);
+            analyzer->step = STEP_LOAD;
+            return true;
+    }
+    return false;
+}
+
+uint16_t SPEC_findPeaks(const SPEC_Analyzer *analyzer, SPEC_Peak *peaks, uint16_t maxPeaks) {
+    const float *power = analyzer->power;
+    const uint16_t last = analyzer->points / 2U;
+    const uint16_t lobe = analyzer->lobe;
+    uint16_t count = 0U;
+    uint16_t bin;
+    uint16_t neighbour;
+    if (maxPeaks == 0U) {
+        return 0U;
+    }
+    // DC and its lobe hold the ADC offset
+    for (bin = lobe + 1U; bin < last; bin ++) {
+        if (!(power[bin] > power[bin - 1U] && power[bin] >= power[bin + 1U])) {
+            continue;
+        }
+        // Main-lobe power gives the amplitude whatever the scalloping, its centroid the frequency
+        const uint16_t end = bin + lobe < last ? bin + lobe : last;
+        float sum = 0.0f;
+        float moment = 0.0f;
+        for (neighbour = bin - lobe; neighbour <= end; neighbour ++) {
+            sum += power[neighbour];
+            moment += (float)neighbour * power[neighbour];
+        }
+        const float amplitude = sqrtf(2.0f * sum);
+        if (count < maxPeaks) {
+            count ++;
+        } else if (amplitude <= peaks[count - 1U].amplitude) {
+            continue;
+        }
+        // Sorted insert, the weakest falls off the end
+        uint16_t position = count - 1U;
+        while (position > 0U && peaks[position - 1U].amplitude < amplitude) {
+            peaks[position] = peaks[position - 1U];
+            position --;
+        }
+        peaks[position].frequency = moment / sum * analyzer->sampleFrequency / (float)analyzer->points;
+        peaks[position].amplitude = amplitude;
+        peaks[position].level = 20.0f * log10f(amplitude / SPEC_ADC_MIDSCALE);
+    }
+    return count;
+}
+
+void SPEC_dump(const SPEC_Analyzer *analyzer, REPORT_Writer write, void *context) {
+    static const char *const windows[] = {"rectangular", "Hann", "Blackman-Harris"};
+    char line[SPEC_LINE_LENGTH];
+    uint16_t peak;
+    snprintf(line, sizeof(line), "%s %u points, %s window, bin %.2f Hz, %lu spectra of %u segments, %lu dropped",
+             analyzer->name, analyzer->points, windows[analyzer->window], SPEC_binFrequency(analyzer, 1U),
+             (unsigned long)analyzer->spectra, analyzer->averages, (unsigned long)analyzer->dropped);
+    write(line, context);
+    if (analyzer->spectra == 0UL) {
+        write("  no spectrum yet", context);
+        return;
+    }
+    SPEC_Peak peaks[SPEC_MAX_PEAKS];
+    const uint16_t count = SPEC_findPeaks(analyzer, peaks, SPEC_MAX_PEAKS);
+    for (peak = 0U; peak < count; peak ++) {
+        snprintf(line, sizeof(line), "  %9.2f Hz %8.2f codes %7.1f dBFS", peaks[peak].frequency,
+                 peaks[peak].amplitude, peaks[peak].level);
+        write(line, context);
+    }
+}
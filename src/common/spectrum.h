@@ -0,0 +1,115 @@
+#ifndef SPECTRUM_H
+#define SPECTRUM_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "fftTables.h"
+#include "report.h"
+
+/*------------------------------MACROS------------------------------*/
+
+// Real transform lengths, powers of two; the tables set the largest
+#define SPEC_MIN_POINTS 256U
+#define SPEC_MAX_POINTS FFT_MAX_POINTS
+
+// One-sided bins of a transform, DC to Nyquist
+#define SPEC_BINS(points) ((points) / 2U + 1U)
+// Floats of an analyzer's storage: transform, window, accumulator and published spectrum
+#define SPEC_STORAGE(points) (2U * (points) + 2U * SPEC_BINS(points))
+// Samples of an analyzer's history: two transforms, segments overlap by half
+#define SPEC_HISTORY(points) (2U * (points))
+
+// 12-bit ADC codes are centred on mid-scale, a full-scale sine has this peak amplitude (0 dBFS)
+#define SPEC_ADC_MIDSCALE 2048.0f
+
+#define SPEC_MAX_PEAKS 8U
+#define SPEC_LINE_LENGTH 128U
+
+// Compiler barrier between history and index accesses; C28x is one core and keeps volatile order
+#if defined(__GNUC__)
+#define SPEC_BARRIER() __asm__ __volatile__("" ::: "memory")
+#else
+#define SPEC_BARRIER()
+#endif
+
+/*------------------------------TYPES------------------------------*/
+
+typedef enum {
+    SPEC_WINDOW_RECTANGULAR,
+    SPEC_WINDOW_HANN,
+    SPEC_WINDOW_BLACKMAN_HARRIS // 4-term, -92 dB sidelobes
+} SPEC_Window;
+
+// Tone found in the published spectrum
+typedef struct {
+    float frequency; // Hz, power centroid of the main lobe
+    float amplitude; // Peak amplitude in ADC codes, from the power of the main lobe
+    float level; // dBFS
+} SPEC_Peak;
+
+// Welch analyzer: the producer pushes ADC samples into the history, the background transforms every
+// half-overlapping segment in bounded steps and publishes the average of every `averages` segments
+typedef struct {
+    // Configuration
+    const char *name; // Report entry and dump prefix
+    float sampleFrequency;
+    uint16_t points;
+    uint16_t bits; // log2(points)
+    uint16_t averages; // Segments per published spectrum
+    SPEC_Window window;
+    uint16_t lobe; // Main-lobe half width of the window, bins
+    float scale; // Power of one segment to codes squared (RMS) per bin
+    float *work; // points floats, the transform in place
+    float *coefficients; // points floats, window
+    float *accumulator; // SPEC_BINS floats, power summed over the segments
+    float *power; // SPEC_BINS floats, published spectrum in codes squared (RMS) per bin
+    // History, single producer and single consumer
+    uint16_t *history;
+    uint16_t mask; // SPEC_HISTORY - 1
+    volatile uint32_t head; // Samples pushed, written by the producer only
+    uint32_t next; // First sample of the next segment, written by the consumer only
+    // Background steps
+    uint16_t step;
+    uint16_t span; // Quarter span of the next radix-4 stage, complex points
+    uint16_t accumulated; // Segments in the accumulator
+    // Statistics, background only
+    uint32_t segments; // Segments transformed
+    uint32_t dropped; // Segments overwritten before the background reached them
+    uint32_t spectra; // Spectra published
+} SPEC_Analyzer;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// data: points floats, transformed in place; points a power of two from 4 to SPEC_MAX_POINTS.
+// Output is packed: data[0] DC, data[1] Nyquist, data[2k], data[2k + 1] real and imaginary parts of bin k
+bool SPEC_realFFT(float *data, uint16_t points);
+
+// storage: SPEC_STORAGE(points) floats, history: SPEC_HISTORY(points) samples; name registers the report.
+// false when points is not a power of two from SPEC_MIN_POINTS to SPEC_MAX_POINTS or averages is 0
+bool SPEC_init(SPEC_Analyzer *analyzer, const char *name, float sampleFrequency, uint16_t points, SPEC_Window window,
+               uint16_t averages, float *storage, uint16_t *history);
+
+// Producer (ISR or background): ADC codes, never waits for the background
+void SPEC_push(SPEC_Analyzer *analyzer, const uint16_t *samples, uint16_t length);
+
+// Background: one O(points) step (window, a butterfly stage, power or publish), true when a spectrum was
+// published. Segments the background falls behind on are dropped, acquisition is never held up
+bool SPEC_process(SPEC_Analyzer *analyzer);
+
+// Background: up to maxPeaks strongest tones of the published spectrum, strongest first, DC excluded
+uint16_t SPEC_findPeaks(const SPEC_Analyzer *analyzer, SPEC_Peak *peaks, uint16_t maxPeaks);
+
+// Background: settings, statistics and the strongest tones, one line each
+void SPEC_dump(const SPEC_Analyzer *analyzer, REPORT_Writer write, void *context);
+
+// Hz of a bin
+static inline float SPEC_binFrequency(const SPEC_Analyzer *analyzer, uint16_t bin) {
+    return (float)bin * analyzer->sampleFrequency / (float)analyzer->points;
+}
+
+#endif
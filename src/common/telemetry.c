@@ -0,0 +1,362 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdio.h>
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "report.h"
+#include "telemetry.h"
+
+/*------------------------------TABLES------------------------------*/
+
+// CRC-16/CCITT-FALSE of each nibble, two lookups per byte instead of eight shifts
+static const uint16_t crcNibbleTable[16] = {
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU
+};
+
+/*------------------------------HELPERS------------------------------*/
+
+static void putByte(TLM_Streamer *streamer, uint16_t value) {
+    streamer->frame[streamer->length ++] = value & 0xFFU;
+}
+
+static void putWord(TLM_Streamer *streamer, uint16_t value) {
+    putByte(streamer, value);
+    putByte(streamer, value >> 8);
+}
+
+static void putLong(TLM_Streamer *streamer, uint32_t value) {
+    putWord(streamer, (uint16_t)(value & 0xFFFFU));
+    putWord(streamer, (uint16_t)(value >> 16));
+}
+
+static void putFloat(TLM_Streamer *streamer, float value) {
+    // C28x float is IEEE 754 single precision
+    union {
+        float value;
+        uint32_t bits;
+    } cast;
+    cast.value = value;
+    putLong(streamer, cast.bits);
+}
+
+// Appends the lowest width bits of value, width up to 16
+static void putBits(TLM_Streamer *streamer, uint16_t value, uint16_t width) {
+    streamer->bits |= (uint32_t)value << streamer->bitCount;
+    streamer->bitCount += width;
+    while (streamer->bitCount >= 8U) {
+        putByte(streamer, (uint16_t)(streamer->bits & 0xFFU));
+        streamer->bits >>= 8;
+        streamer->bitCount -= 8U;
+    }
+}
+
+static void flushBits(TLM_Streamer *streamer) {
+    if (streamer->bitCount > 0U) {
+        putByte(streamer, (uint16_t)(streamer->bits & 0xFFU));
+    }
+    streamer->bits = 0UL;
+    streamer->bitCount = 0U;
+}
+
+// Bit length of value (0 for 0)
+static uint16_t widthOf(uint16_t value) {
+    uint16_t width = 0U;
+    while (value != 0U) {
+        value >>= 1;
+        width ++;
+    }
+    return width;
+}
+
+// Count, first sample and the delta groups of count 12-bit samples, taken from first then from second
+static void putSamples(TLM_Streamer *streamer, const uint16_t *first, uint16_t firstCount, const uint16_t *second,
+                       uint16_t count) {
+    putWord(streamer, count);
+    uint16_t previous = (firstCount > 0U ? first[0] : second[0]) & 0x0FFFU;
+    putWord(streamer, previous);
+    // Deltas of a 12-bit signal are within +-4095; zigzag keeps small magnitudes in few bits
+    uint16_t sample = 1U;
+    while (sample < count) {
+        uint16_t codes[TLM_GROUP_LENGTH];
+        uint16_t groupLength = count - sample;
+        if (groupLength > TLM_GROUP_LENGTH) {
+            groupLength = TLM_GROUP_LENGTH;
+        }
+        uint16_t largest = 0U;
+        uint16_t index;
+        for (index = 0; index < groupLength; index ++) {
+            const uint16_t position = sample + index;
+            const uint16_t current = (position < firstCount ? first[position] : second[position - firstCount]) & 0x0FFFU;
+            const int16_t delta = (int16_t)current - (int16_t)previous;
+            codes[index] = delta < 0 ? (uint16_t)(-2 * delta - 1) : (uint16_t)(2 * delta);
+            largest |= codes[index];
+            previous = current;
+        }
+        const uint16_t width = widthOf(largest);
+        putBits(streamer, width, 4U);
+        for (index = 0; index < groupLength; index ++) {
+            putBits(streamer, codes[index], width);
+        }
+        sample += groupLength;
+    }
+    flushBits(streamer);
+}
+
+static void beginFrame(TLM_Streamer *streamer, uint16_t type) {
+    streamer->length = 0U;
+    putByte(streamer, TLM_SYNC1);
+    putByte(streamer, TLM_SYNC2);
+    putByte(streamer, type);
+    putWord(streamer, streamer->sequence);
+    // Payload length, filled in by endFrame
+    putWord(streamer, 0U);
+}
+
+// Completes the header and CRC and queues the whole frame, or drops it
+static bool endFrame(TLM_Streamer *streamer) {
+    const uint16_t payloadLength = streamer->length - TLM_HEADER_LENGTH;
+    streamer->frame[5] = payloadLength & 0xFFU;
+    streamer->frame[6] = payloadLength >> 8;
+    const uint16_t crc = TLM_crc16(0xFFFFU, &streamer->frame[2], streamer->length - 2U);
+    putWord(streamer, crc);
+    // Never a partial frame: the decoder would lose sync until the next one
+    // The sequence advances either way, so the host counts dropped frames as gaps
+    streamer->sequence ++;
+    RING_Buffer *queue = &streamer->queue;
+    if ((uint16_t)(queue->capacity - RING_count(queue)) < streamer->length) {
+        streamer->framesDropped ++;
+        return false;
+    }
+    uint16_t index;
+    for (index = 0; index < streamer->length; index ++) {
+        RING_push(queue, streamer->frame[index]);
+    }
+    streamer->framesQueued ++;
+    // TX ISR masks itself when the queue runs empty
+    SCI_enableInterrupt(streamer->sciBase, SCI_INT_TXFF);
+    return true;
+}
+
+static void reportStreamer(const void *object, REPORT_Writer write, void *context) {
+    TLM_dump((const TLM_Streamer *)object, write, context);
+}
+
+static void reportReceiver(const void *object, REPORT_Writer write, void *context) {
+    TLM_dumpReceiver((const TLM_Receiver *)object, write, context);
+}
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+bool TLM_init(TLM_Streamer *streamer, uint32_t sciBase, uint16_t *storage, uint16_t capacity) {
+    if (!RING_init(&streamer->queue, storage, capacity)) {
+        return false;
+    }
+    streamer->sciBase = sciBase;
+    streamer->length = 0U;
+    streamer->bits = 0UL;
+    streamer->bitCount = 0U;
+    streamer->sequence = 0U;
+    streamer->framesQueued = 0UL;
+    streamer->framesDropped = 0UL;
+    streamer->samplesQueued = 0UL;
+    streamer->rawBytes = 0UL;
+    streamer->encodedBytes = 0UL;
+    // Interrupt enabled with the first frame
+    SCI_disableInterrupt(sciBase, SCI_INT_TXFF);
+    REPORT_register("telemetry", &reportStreamer, streamer);
+    return true;
+}
+
+bool TLM_sendCapture(TLM_Streamer *streamer, uint16_t channel, const uint16_t *samples, uint16_t count) {
+    if (count == 0U) {
+        return true;
+    }
+    if (count > TLM_MAX_SAMPLES) {
+        count = TLM_MAX_SAMPLES;
+    }
+    beginFrame(streamer, TLM_FRAME_CAPTURE);
+    putByte(streamer, channel);
+    putSamples(streamer, samples, count, samples, count);
+    if (!endFrame(streamer)) {
+        return false;
+    }
+    streamer->samplesQueued += count;
+    streamer->rawBytes += 2UL * count;
+    streamer->encodedBytes += streamer->length;
+    return true;
+}
+
+bool TLM_sendScope(TLM_Streamer *streamer, uint16_t channel, const SCOPE_Frame *frame) {
+    // Straight from the frame's ring, oldest point first: no copy of the frozen frame
+    const uint16_t wordsPerPoint = frame->minMax ? 2U : 1U;
+    const uint16_t *oldest = frame->points + wordsPerPoint * frame->start;
+    uint16_t firstCount = wordsPerPoint * (frame->length - frame->start);
+    uint16_t count = wordsPerPoint * frame->length;
+    if (count > TLM_MAX_SAMPLES) {
+        count = TLM_MAX_SAMPLES;
+    }
+    if (firstCount > count) {
+        firstCount = count;
+    }
+    beginFrame(streamer, TLM_FRAME_SCOPE);
+    putByte(streamer, channel);
+    putByte(streamer, (frame->minMax ? 0x01U : 0U) | (frame->forced ? 0x02U : 0U));
+    putWord(streamer, frame->decimation);
+    putWord(streamer, frame->triggerPoint);
+    putSamples(streamer, oldest, firstCount, frame->points, count);
+    if (!endFrame(streamer)) {
+        return false;
+    }
+    streamer->samplesQueued += count;
+    return true;
+}
+
+bool TLM_sendSnapshot(TLM_Streamer *streamer, const PQ_Snapshot *snapshot) {
+    beginFrame(streamer, TLM_FRAME_SNAPSHOT);
+    putLong(streamer, snapshot->window);
+    putFloat(streamer, snapshot->mean);
+    putFloat(streamer, snapshot->rms);
+    putFloat(streamer, snapshot->acRms);
+    putFloat(streamer, snapshot->frequency);
+    putFloat(streamer, snapshot->thd);
+    putByte(streamer, PQ_HARMONICS);
+    uint16_t harmonic;
+    for (harmonic = 0; harmonic < PQ_HARMONICS; harmonic ++) {
+        putFloat(streamer, snapshot->harmonics[harmonic]);
+    }
+    return endFrame(streamer);
+}
+
+bool TLM_sendReply(TLM_Streamer *streamer, const uint16_t *payload, uint16_t length) {
+    beginFrame(streamer, TLM_FRAME_REPLY);
+    uint16_t index;
+    for (index = 0; index < length; index ++) {
+        putByte(streamer, payload[index]);
+    }
+    return endFrame(streamer);
+}
+
+void TLM_handleTxInterrupt(TLM_Streamer *streamer) {
+    uint16_t room = SCI_FIFO_TX16 - (uint16_t)SCI_getTxFIFOStatus(streamer->sciBase);
+    const uint16_t *span;
+    uint16_t length = RING_peek(&streamer->queue, &span);
+    while (room > 0U && length > 0U) {
+        if (length > room) {
+            length = room;
+        }
+        uint16_t index;
+        for (index = 0; index < length; index ++) {
+            SCI_writeCharNonBlocking(streamer->sciBase, span[index]);
+        }
+        RING_release(&streamer->queue, length);
+        room -= length;
+        length = RING_peek(&streamer->queue, &span);
+    }
+    // Nothing left: masked until the background queues the next frame
+    if (RING_count(&streamer->queue) == 0U) {
+        SCI_disableInterrupt(streamer->sciBase, SCI_INT_TXFF);
+    }
+    SCI_clearInterruptStatus(streamer->sciBase, SCI_INT_TXFF);
+}
+
+void TLM_dump(const TLM_Streamer *streamer, REPORT_Writer write, void *context) {
+    char line[TLM_LINE_LENGTH];
+    snprintf(line, sizeof(line), "Telemetry frames %lu dropped %lu samples %lu queue high-water %u/%u",
+             (unsigned long)streamer->framesQueued, (unsigned long)streamer->framesDropped,
+             (unsigned long)streamer->samplesQueued, streamer->queue.highWater, streamer->queue.capacity);
+    write(line, context);
+    if (streamer->encodedBytes) {
+        snprintf(line, sizeof(line), "Telemetry captures raw %lu B encoded %lu B ratio %.2f (%.2f bits/sample)",
+                 (unsigned long)streamer->rawBytes, (unsigned long)streamer->encodedBytes,
+                 (float)streamer->rawBytes / (float)streamer->encodedBytes,
+                 8.0f * (float)streamer->encodedBytes / (float)(streamer->rawBytes / 2U));
+        write(line, context);
+    }
+}
+
+bool TLM_initReceiver(TLM_Receiver *receiver, uint32_t sciBase, uint16_t *storage, uint16_t capacity) {
+    if (!RING_init(&receiver->queue, storage, capacity)) {
+        return false;
+    }
+    receiver->sciBase = sciBase;
+    receiver->length = 0U;
+    receiver->framesReceived = 0UL;
+    receiver->crcErrors = 0UL;
+    receiver->bytesSkipped = 0UL;
+    SCI_resetRxFIFO(sciBase);
+    SCI_enableInterrupt(sciBase, SCI_INT_RXFF);
+    REPORT_register("commands", &reportReceiver, receiver);
+    return true;
+}
+
+void TLM_handleRxInterrupt(TLM_Receiver *receiver) {
+    // Bytes that do not fit are counted as queue overruns, the frame they belong to fails its CRC
+    while (SCI_getRxFIFOStatus(receiver->sciBase) != SCI_FIFO_RX0) {
+        RING_push(&receiver->queue, SCI_readCharNonBlocking(receiver->sciBase) & 0xFFU);
+    }
+    SCI_clearOverflowStatus(receiver->sciBase);
+    SCI_clearInterruptStatus(receiver->sciBase, SCI_INT_RXFF);
+}
+
+bool TLM_receive(TLM_Receiver *receiver, TLM_Command *command) {
+    uint16_t byte;
+    while (RING_pop(&receiver->queue, &byte, 1U) == 1U) {
+        const uint16_t length = receiver->length;
+        // Sync: a second 0x55 may be the real start of the frame
+        if ((length == 0U && byte != TLM_SYNC1) || (length == 1U && byte != TLM_SYNC2)) {
+            receiver->bytesSkipped ++;
+            receiver->length = (byte == TLM_SYNC1) ? 1U : 0U;
+            continue;
+        }
+        receiver->frame[receiver->length ++] = byte;
+        if (receiver->length < TLM_HEADER_LENGTH) {
+            continue;
+        }
+        const uint16_t payloadLength = receiver->frame[5] | (receiver->frame[6] << 8);
+        if (payloadLength > TLM_MAX_COMMAND_PAYLOAD) {
+            receiver->bytesSkipped += receiver->length;
+            receiver->length = 0U;
+            continue;
+        }
+        if (receiver->length < payloadLength + TLM_FRAME_OVERHEAD) {
+            continue;
+        }
+        receiver->length = 0U;
+        const uint16_t crc = receiver->frame[TLM_HEADER_LENGTH + payloadLength]
+                             | (receiver->frame[TLM_HEADER_LENGTH + payloadLength + 1U] << 8);
+        if (TLM_crc16(0xFFFFU, &receiver->frame[2], payloadLength + TLM_HEADER_LENGTH - 2U) != crc) {
+            receiver->crcErrors ++;
+            continue;
+        }
+        receiver->framesReceived ++;
+        command->type = receiver->frame[2];
+        command->sequence = receiver->frame[3] | (receiver->frame[4] << 8);
+        command->payload = &receiver->frame[TLM_HEADER_LENGTH];
+        command->length = payloadLength;
+        return true;
+    }
+    return false;
+}
+
+void TLM_dumpReceiver(const TLM_Receiver *receiver, REPORT_Writer write, void *context) {
+    if (!receiver->framesReceived && !receiver->crcErrors && !receiver->bytesSkipped) {
+        return;
+    }
+    char line[TLM_LINE_LENGTH];
+    snprintf(line, sizeof(line), "Commands frames %lu CRC errors %lu bytes skipped %lu queue overruns %lu",
+             (unsigned long)receiver->framesReceived, (unsigned long)receiver->crcErrors,
+             (unsigned long)receiver->bytesSkipped, (unsigned long)receiver->queue.overruns);
+    write(line, context);
+}
+
+uint16_t TLM_crc16(uint16_t crc, const uint16_t *bytes, uint16_t length) {
+    uint16_t index;
+    for (index = 0; index < length; index ++) {
+        const uint16_t byte = bytes[index] & 0xFFU;
+        crc = (uint16_t)(crc << 4) ^ crcNibbleTable[(crc >> 12) ^ (byte >> 4)];
+        crc = (uint16_t)(crc << 4) ^ crcNibbleTable[(crc >> 12) ^ (byte & 0x0FU)];
+    }
+    return crc;
+}
@@ -0,0 +1,128 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "sci.h"
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "powerQuality.h"
+#include "report.h"
+#include "ringBuffer.h"
+#include "scope.h"
+
+/*------------------------------MACROS------------------------------*/
+
+// Frame: 0x55 0xAA, type, sequence (16-bit), payload length (16-bit), payload, CRC-16/CCITT-FALSE
+// of type to payload; multi-byte fields little endian, one byte per uint16_t (C28x char is 16 bits)
+#define TLM_SYNC1 0x55U
+#define TLM_SYNC2 0xAAU
+#define TLM_HEADER_LENGTH 7U
+#define TLM_FRAME_OVERHEAD 9U
+
+#define TLM_FRAME_CAPTURE 0x01U
+#define TLM_FRAME_SNAPSHOT 0x02U
+#define TLM_FRAME_SCOPE 0x03U
+#define TLM_FRAME_REPLY 0x04U // Answer to a host command, payload from the command's handler
+
+// Capture payload: channel, count (16-bit), first sample (16-bit), then a bit stream (LSB first) of
+// groups of TLM_GROUP_LENGTH zigzag-coded deltas, each group a 4-bit width and the deltas in that width
+#define TLM_GROUP_LENGTH 16U
+#define TLM_MAX_SAMPLES 256U
+
+// Scope payload: channel, flags (bit 0 min/max pairs, bit 1 forced), decimation (16-bit), trigger point (16-bit),
+// then the points (pairs as two samples) coded as a capture from its count on
+
+// Worst case capture or scope frame: 12-bit deltas need 13 bits zigzag-coded, plus 4 bits per group
+#define TLM_MAX_PAYLOAD (10U + (TLM_MAX_SAMPLES / TLM_GROUP_LENGTH * 4U + TLM_MAX_SAMPLES * 13U + 7U) / 8U)
+#define TLM_MAX_FRAME (TLM_MAX_PAYLOAD + TLM_FRAME_OVERHEAD)
+
+// Host commands use the same framing the other way, with short payloads
+#define TLM_MAX_COMMAND_PAYLOAD 32U
+
+#define TLM_LINE_LENGTH 128U
+
+/*------------------------------TYPES------------------------------*/
+
+// Background encodes whole frames into the queue, the SCI TX FIFO interrupt drains it
+typedef struct {
+    uint32_t sciBase;
+    RING_Buffer queue; // Frame bytes, background to TX ISR
+    uint16_t frame[TLM_MAX_FRAME]; // Frame being built
+    uint16_t length; // Bytes in frame
+    uint32_t bits; // Bit packer, not yet stored bits from the LSB
+    uint16_t bitCount;
+    uint16_t sequence;
+    // Statistics, background only
+    uint32_t framesQueued;
+    uint32_t framesDropped; // No room in the queue, the whole frame is lost
+    uint32_t samplesQueued;
+    uint32_t rawBytes; // Capture samples as 16-bit words
+    uint32_t encodedBytes; // Capture frames, header and CRC included
+} TLM_Streamer;
+
+// Host commands: the SCI RX FIFO interrupt queues the bytes, the background parses whole frames
+typedef struct {
+    uint32_t sciBase;
+    RING_Buffer queue; // Received bytes, RX ISR to background
+    uint16_t frame[TLM_MAX_COMMAND_PAYLOAD + TLM_FRAME_OVERHEAD]; // Frame being received
+    uint16_t length; // Bytes in frame
+    // Statistics, background only
+    uint32_t framesReceived;
+    uint32_t crcErrors; // Whole frame dropped, the host sends it again
+    uint32_t bytesSkipped; // Outside a frame, or in a header with a bad length
+} TLM_Receiver;
+
+// One received command frame, payload valid until the next TLM_receive
+typedef struct {
+    uint16_t type;
+    uint16_t sequence;
+    const uint16_t *payload; // One byte per uint16_t
+    uint16_t length;
+} TLM_Command;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// SCI module and its FIFO must already be configured; false when capacity is not a power of two
+bool TLM_init(TLM_Streamer *streamer, uint32_t sciBase, uint16_t *storage, uint16_t capacity);
+
+// Background: up to TLM_MAX_SAMPLES 12-bit samples, false when the frame was dropped
+bool TLM_sendCapture(TLM_Streamer *streamer, uint16_t channel, const uint16_t *samples, uint16_t count);
+
+// Background: frozen scope frame, up to TLM_MAX_SAMPLES words; false when the frame was dropped
+bool TLM_sendScope(TLM_Streamer *streamer, uint16_t channel, const SCOPE_Frame *frame);
+
+// Background: analytics snapshot as IEEE 754 floats, false when the frame was dropped
+bool TLM_sendSnapshot(TLM_Streamer *streamer, const PQ_Snapshot *snapshot);
+
+// Background: reply to a host command, false when the frame was dropped
+bool TLM_sendReply(TLM_Streamer *streamer, const uint16_t *payload, uint16_t length);
+
+// SCI TX FIFO ISR: tops up the FIFO, masks the interrupt when the queue runs empty
+void TLM_handleTxInterrupt(TLM_Streamer *streamer);
+
+// Background: frames, samples and compression, line by line
+void TLM_dump(const TLM_Streamer *streamer, REPORT_Writer write, void *context);
+
+// SCI module and its FIFO must already be configured; false when capacity is not a power of two
+bool TLM_initReceiver(TLM_Receiver *receiver, uint32_t sciBase, uint16_t *storage, uint16_t capacity);
+
+// SCI RX FIFO ISR: moves every received byte to the queue
+void TLM_handleRxInterrupt(TLM_Receiver *receiver);
+
+// Background: true when a whole command frame with a good CRC has been received
+bool TLM_receive(TLM_Receiver *receiver, TLM_Command *command);
+
+// Background: frames received and errors, one line once anything arrived
+void TLM_dumpReceiver(const TLM_Receiver *receiver, REPORT_Writer write, void *context);
+
+// CRC-16/CCITT-FALSE (polynomial 0x1021, initial 0xFFFF) of bytes held one per uint16_t
+uint16_t TLM_crc16(uint16_t crc, const uint16_t *bytes, uint16_t length);
+
+#endif
@@ -0,0 +1,180 @@
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "typedMath.h"
+
+/*------------------------------TABLES------------------------------*/
+
+// Odd Taylor series of sin(pi/2 * x) over a quarter turn, Q30: round((pi/2)^k / k! * 2^30), k = 1, 3 ... 13
+#define SINE_TERMS 7U
+
+static const int32_t sineCoefficients[SINE_TERMS] = {
+    1686629713L, -693598668L, 85569306L, -5026995L, 172272L, -3864L, 61L
+};
+
+// CORDIC angles, round(atan(2^-i) / 2pi * 2^32): a full turn is 2^32
+#define CORDIC_STEPS 30U
+
+static const uint32_t cordicAngles[CORDIC_STEPS] = {
+    536870912UL, 316933406UL, 167458907UL, 85004756UL, 42667331UL, 21354465UL, 10679838UL, 5340245UL,
+    2670163UL, 1335087UL, 667544UL, 333772UL, 166886UL, 83443UL, 41722UL, 20861UL,
+    10430UL, 5215UL, 2608UL, 1304UL, 652UL, 326UL, 163UL, 81UL,
+    41UL, 20UL, 10UL, 5UL, 3UL, 1UL
+};
+
+/*------------------------------HELPERS------------------------------*/
+
+// Phase of a full turn over 2^32 to Q31 sine, the series only ever sees the first quadrant
+static int32_t sinePhase(uint32_t phase) {
+    const uint16_t quadrant = (uint16_t)(phase >> 30);
+    uint32_t x = (phase & 0x3FFFFFFFUL) << 1; // Q31, 1 is a quarter turn
+    if (quadrant & 1U) {
+        x = 0x80000000UL - x;
+    }
+    const int64_t x2 = ((int64_t)x * x) >> 31;
+    int64_t accumulator = sineCoefficients[SINE_TERMS - 1U];
+    int16_t term;
+    for (term = (int16_t)SINE_TERMS - 2; term >= 0; term --) {
+        accumulator = sineCoefficients[term] + ((accumulator * x2) >> 31);
+    }
+    int64_t value = (accumulator * (int64_t)x) >> 30;
+    if (value > INT32_MAX) {
+        value = INT32_MAX;
+    }
+    return (quadrant & 2U) ? -(int32_t)value : (int32_t)value;
+}
+
+// Rounded square roots: floor first, then up if value is past (root + 1/2)^2
+static uint32_t squareRoot32(uint32_t value) {
+    uint32_t root = 0UL;
+    uint32_t bit = 1UL << 30;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0UL) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    // value is now the remainder
+    return value > root ? root + 1UL : root;
+}
+
+static uint32_t squareRoot64(uint64_t value) {
+    uint64_t root = 0U;
+    uint64_t bit = (uint64_t)1U << 62;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0U) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)(value > root ? root + 1U : root);
+}
+
+// CORDIC vectoring: angle of (x, y) over 2^32 per turn, from -1/2 up to 1/2
+static int32_t anglePhase(int32_t y, int32_t x, uint16_t steps) {
+    if (x == 0L && y == 0L) {
+        return 0L;
+    }
+    int64_t wideX = x;
+    int64_t wideY = y;
+    uint32_t phase = 0UL;
+    // Left half plane turned by half a turn, the iterations only converge within +-99 degrees
+    if (wideX < 0) {
+        wideX = -wideX;
+        wideY = -wideY;
+        phase = 0x80000000UL;
+    }
+    // Normalised to 2^28 up to 2^29: resolution for short vectors, headroom for the CORDIC gain of 1.647
+    int64_t magnitude = wideX > (wideY < 0 ? -wideY : wideY) ? wideX : (wideY < 0 ? -wideY : wideY);
+    while (magnitude >= (1L << 29)) {
+        magnitude >>= 1;
+        wideX >>= 1;
+        wideY >>= 1;
+    }
+    while (magnitude < (1L << 28)) {
+        magnitude <<= 1;
+        wideX <<= 1;
+        wideY <<= 1;
+    }
+    int32_t rotatedX = (int32_t)wideX;
+    int32_t rotatedY = (int32_t)wideY;
+    uint16_t step;
+    for (step = 0; step < steps; step ++) {
+        const int32_t shiftedX = rotatedX >> step;
+        const int32_t shiftedY = rotatedY >> step;
+        if (rotatedY > 0L) {
+            rotatedX += shiftedY;
+            rotatedY -= shiftedX;
+            phase += cordicAngles[step];
+        } else {
+            rotatedX -= shiftedY;
+            rotatedY += shiftedX;
+            phase -= cordicAngles[step];
+        }
+    }
+    return (int32_t)phase;
+}
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+MATH_Q31 MATH_sinQ31(MATH_Q31 angle) {
+    // Fraction of a turn only
+    return sinePhase((uint32_t)angle << 1);
+}
+
+MATH_IQ24 MATH_sinIQ24(MATH_IQ24 angle) {
+    // Fraction of a turn only, Q31 result rounded to 24 bits
+    const int32_t value = sinePhase((uint32_t)angle << 8);
+    return ((value >> 6) + 1L) >> 1;
+}
+
+MATH_Q15 MATH_sqrtQ15(MATH_Q15 value) {
+    // Negative values MUST NOT reach a root
+    if (value <= 0) {
+        return 0;
+    }
+    const uint32_t root = squareRoot32((uint32_t)value << 15);
+    return root > 32767UL ? 32767 : (MATH_Q15)root;
+}
+
+MATH_Q31 MATH_sqrtQ31(MATH_Q31 value) {
+    if (value <= 0L) {
+        return 0L;
+    }
+    const uint32_t root = squareRoot64((uint64_t)value << 31);
+    return root > (uint32_t)INT32_MAX ? INT32_MAX : (MATH_Q31)root;
+}
+
+MATH_IQ24 MATH_sqrtIQ24(MATH_IQ24 value) {
+    if (value <= 0L) {
+        return 0L;
+    }
+    return (MATH_IQ24)squareRoot64((uint64_t)value << 24);
+}
+
+MATH_Q15 MATH_atan2Q15(MATH_Q15 y, MATH_Q15 x) {
+    // 16 steps are all 15 bits of output can use, rounded
+    const int32_t phase = anglePhase(y, x, 16U);
+    return (MATH_Q15)(((phase >> 16) + 1L) >> 1);
+}
+
+MATH_Q31 MATH_atan2Q31(MATH_Q31 y, MATH_Q31 x) {
+    const int32_t phase = anglePhase(y, x, CORDIC_STEPS);
+    return (phase >> 1) + (phase & 1L);
+}
+
+MATH_IQ24 MATH_atan2IQ24(MATH_IQ24 y, MATH_IQ24 x) {
+    const int32_t phase = anglePhase(y, x, CORDIC_STEPS);
+    return ((phase >> 7) + 1L) >> 1;
+}
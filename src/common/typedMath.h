@@ -0,0 +1,274 @@
+#ifndef TYPEDMATH_H
+#define TYPEDMATH_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <math.h>
+#include <stdint.h>
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "dds.h"
+
+/*------------------------------MACROS------------------------------*/
+
+// One API, four back ends: MATH_<op>Q15, MATH_<op>Q31, MATH_<op>IQ24 and MATH_<op>F32. Angles are per unit of a
+// turn in the format itself (0.25 is a quarter turn, the integer part is ignored), so sin, cos and atan2 mean the
+// same on every back end; atan2 returns [-0.5, 0.5). Fixed-point products are rounded and saturated.
+#define MATH_FORMAT_Q15 1
+#define MATH_FORMAT_Q31 2
+#define MATH_FORMAT_IQ24 3
+#define MATH_FORMAT_F32 4
+
+#define MATH_Q15_ONE 32768L
+#define MATH_Q31_ONE 2147483648.0f
+#define MATH_IQ24_ONE 16777216L // Range +-128
+
+#define MATH_TWO_PI 6.28318531f
+
+/*------------------------------TYPES------------------------------*/
+
+typedef int16_t MATH_Q15;
+typedef int32_t MATH_Q31;
+typedef int32_t MATH_IQ24;
+typedef float MATH_F32;
+
+// MAC accumulators: full products, one sat at the end (as the C28x MAC and the FILTER kernels do)
+typedef int32_t MATH_AccQ15; // Q30
+typedef int64_t MATH_AccQ31; // Q62
+typedef int64_t MATH_AccIQ24; // Q48
+typedef float MATH_AccF32;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// Loops and tables, in typedMath.c
+MATH_Q31 MATH_sinQ31(MATH_Q31 angle);
+MATH_IQ24 MATH_sinIQ24(MATH_IQ24 angle);
+MATH_Q15 MATH_sqrtQ15(MATH_Q15 value);
+MATH_Q31 MATH_sqrtQ31(MATH_Q31 value);
+MATH_IQ24 MATH_sqrtIQ24(MATH_IQ24 value);
+MATH_Q15 MATH_atan2Q15(MATH_Q15 y, MATH_Q15 x);
+MATH_Q31 MATH_atan2Q31(MATH_Q31 y, MATH_Q31 x);
+MATH_IQ24 MATH_atan2IQ24(MATH_IQ24 y, MATH_IQ24 x);
+
+/*------------------------------Q15------------------------------*/
+
+// Accumulator back to Q15, rounded
+static inline MATH_Q15 MATH_satQ15(MATH_AccQ15 accumulator) {
+    const int32_t value = ((accumulator >> 14) + 1L) >> 1;
+    if (value > 32767L) {
+        return 32767;
+    } else if (value < -32768L) {
+        return -32768;
+    }
+    return (MATH_Q15)value;
+}
+
+static inline MATH_Q15 MATH_mulQ15(MATH_Q15 a, MATH_Q15 b) {
+    return MATH_satQ15((int32_t)a * b);
+}
+
+static inline MATH_AccQ15 MATH_macQ15(MATH_AccQ15 accumulator, MATH_Q15 a, MATH_Q15 b) {
+    return accumulator + (int32_t)a * b;
+}
+
+// The DDS quarter-wave table: a turn is 1.0, bit 15 (sign and integer part) dropped from the phase
+static inline MATH_Q15 MATH_sinQ15(MATH_Q15 angle) {
+    return DDS_sinQ15((uint32_t)(uint16_t)angle << 17);
+}
+
+static inline MATH_Q15 MATH_cosQ15(MATH_Q15 angle) {
+    return DDS_cosQ15((uint32_t)(uint16_t)angle << 17);
+}
+
+static inline MATH_Q15 MATH_fromFloatQ15(float value) {
+    const float scaled = value * (float)MATH_Q15_ONE;
+    if (scaled >= 32767.0f) {
+        return 32767;
+    } else if (scaled <= -32768.0f) {
+        return -32768;
+    }
+    return (MATH_Q15)(scaled < 0.0f ? scaled - 0.5f : scaled + 0.5f);
+}
+
+static inline float MATH_toFloatQ15(MATH_Q15 value) {
+    return (float)value * (1.0f / (float)MATH_Q15_ONE);
+}
+
+/*------------------------------Q31------------------------------*/
+
+static inline MATH_Q31 MATH_satQ31(MATH_AccQ31 accumulator) {
+    const int64_t value = ((accumulator >> 30) + 1) >> 1;
+    if (value > INT32_MAX) {
+        return INT32_MAX;
+    } else if (value < INT32_MIN) {
+        return INT32_MIN;
+    }
+    return (MATH_Q31)value;
+}
+
+static inline MATH_Q31 MATH_mulQ31(MATH_Q31 a, MATH_Q31 b) {
+    return MATH_satQ31((int64_t)a * b);
+}
+
+static inline MATH_AccQ31 MATH_macQ31(MATH_AccQ31 accumulator, MATH_Q31 a, MATH_Q31 b) {
+    return accumulator + (int64_t)a * b;
+}
+
+static inline MATH_Q31 MATH_cosQ31(MATH_Q31 angle) {
+    return MATH_sinQ31((MATH_Q31)((uint32_t)angle + (DDS_PHASE_QUARTER >> 1)));
+}
+
+// Float has 24 bits of mantissa: the lowest 7 bits of the result are 0
+static inline MATH_Q31 MATH_fromFloatQ31(float value) {
+    const float scaled = value * MATH_Q31_ONE;
+    if (scaled >= MATH_Q31_ONE) {
+        return INT32_MAX;
+    } else if (scaled <= -MATH_Q31_ONE) {
+        return INT32_MIN;
+    }
+    return (MATH_Q31)scaled;
+}
+
+static inline float MATH_toFloatQ31(MATH_Q31 value) {
+    return (float)value * (1.0f / MATH_Q31_ONE);
+}
+
+/*------------------------------IQ24------------------------------*/
+
+static inline MATH_IQ24 MATH_satIQ24(MATH_AccIQ24 accumulator) {
+    const int64_t value = ((accumulator >> 23) + 1) >> 1;
+    if (value > INT32_MAX) {
+        return INT32_MAX;
+    } else if (value < INT32_MIN) {
+        return INT32_MIN;
+    }
+    return (MATH_IQ24)value;
+}
+
+static inline MATH_IQ24 MATH_mulIQ24(MATH_IQ24 a, MATH_IQ24 b) {
+    return MATH_satIQ24((int64_t)a * b);
+}
+
+static inline MATH_AccIQ24 MATH_macIQ24(MATH_AccIQ24 accumulator, MATH_IQ24 a, MATH_IQ24 b) {
+    return accumulator + (int64_t)a * b;
+}
+
+static inline MATH_IQ24 MATH_cosIQ24(MATH_IQ24 angle) {
+    return MATH_sinIQ24(angle + (MATH_IQ24_ONE / 4));
+}
+
+static inline MATH_IQ24 MATH_fromFloatIQ24(float value) {
+    const float scaled = value * (float)MATH_IQ24_ONE;
+    if (scaled >= 2147483648.0f) {
+        return INT32_MAX;
+    } else if (scaled <= -2147483648.0f) {
+        return INT32_MIN;
+    }
+    return (MATH_IQ24)(scaled < 0.0f ? scaled - 0.5f : scaled + 0.5f);
+}
+
+static inline float MATH_toFloatIQ24(MATH_IQ24 value) {
+    return (float)value * (1.0f / (float)MATH_IQ24_ONE);
+}
+
+/*------------------------------F32------------------------------*/
+
+// Nothing to saturate, kept so generic code compiles on every back end
+static inline MATH_F32 MATH_satF32(MATH_AccF32 accumulator) {
+    return accumulator;
+}
+
+static inline MATH_F32 MATH_mulF32(MATH_F32 a, MATH_F32 b) {
+    return a * b;
+}
+
+static inline MATH_AccF32 MATH_macF32(MATH_AccF32 accumulator, MATH_F32 a, MATH_F32 b) {
+    return accumulator + a * b;
+}
+
+// The TMU of the F2837x computes the per-unit functions in a few cycles; elsewhere the float library
+static inline MATH_F32 MATH_sinF32(MATH_F32 angle) {
+#if defined(__TMS320C28XX_TMU__)
+    return __sinpuf32(angle);
+#else
+    return sinf(MATH_TWO_PI * (angle - floorf(angle)));
+#endif
+}
+
+static inline MATH_F32 MATH_cosF32(MATH_F32 angle) {
+#if defined(__TMS320C28XX_TMU__)
+    return __cospuf32(angle);
+#else
+    return cosf(MATH_TWO_PI * (angle - floorf(angle)));
+#endif
+}
+
+static inline MATH_F32 MATH_sqrtF32(MATH_F32 value) {
+#if defined(__TMS320C28XX_TMU__)
+    return __sqrt(value);
+#else
+    return sqrtf(value);
+#endif
+}
+
+static inline MATH_F32 MATH_atan2F32(MATH_F32 y, MATH_F32 x) {
+#if defined(__TMS320C28XX_TMU__)
+    return __atan2puf32(y, x);
+#else
+    const MATH_F32 angle = atan2f(y, x) * (1.0f / MATH_TWO_PI);
+    return angle >= 0.5f ? -0.5f : angle;
+#endif
+}
+
+static inline MATH_F32 MATH_fromFloatF32(float value) {
+    return value;
+}
+
+static inline float MATH_toFloatF32(MATH_F32 value) {
+    return value;
+}
+
+#endif
+
+/*------------------------------GENERIC API------------------------------*/
+
+// A call site defines MATH_FORMAT before including this header and writes MATH_Value, MATH_mul, MATH_sin...
+#if defined(MATH_FORMAT) && !defined(TYPEDMATH_GENERIC)
+#define TYPEDMATH_GENERIC
+
+#if MATH_FORMAT == MATH_FORMAT_Q15
+#define MATH_SUFFIX Q15
+typedef MATH_Q15 MATH_Value;
+typedef MATH_AccQ15 MATH_Accumulator;
+#elif MATH_FORMAT == MATH_FORMAT_Q31
+#define MATH_SUFFIX Q31
+typedef MATH_Q31 MATH_Value;
+typedef MATH_AccQ31 MATH_Accumulator;
+#elif MATH_FORMAT == MATH_FORMAT_IQ24
+#define MATH_SUFFIX IQ24
+typedef MATH_IQ24 MATH_Value;
+typedef MATH_AccIQ24 MATH_Accumulator;
+#elif MATH_FORMAT == MATH_FORMAT_F32
+#define MATH_SUFFIX F32
+typedef MATH_F32 MATH_Value;
+typedef MATH_AccF32 MATH_Accumulator;
+#else
+#error "MATH_FORMAT must be MATH_FORMAT_Q15, MATH_FORMAT_Q31, MATH_FORMAT_IQ24 or MATH_FORMAT_F32"
+#endif
+
+#define MATH_PASTE(op, suffix) MATH_##op##suffix
+#define MATH_EXPAND(op, suffix) MATH_PASTE(op, suffix)
+#define MATH_CALL(op) MATH_EXPAND(op, MATH_SUFFIX)
+
+#define MATH_sat(accumulator) MATH_CALL(sat)(accumulator)
+#define MATH_mul(a, b) MATH_CALL(mul)(a, b)
+#define MATH_mac(accumulator, a, b) MATH_CALL(mac)(accumulator, a, b)
+#define MATH_sin(angle) MATH_CALL(sin)(angle)
+#define MATH_cos(angle) MATH_CALL(cos)(angle)
+#define MATH_sqrt(value) MATH_CALL(sqrt)(value)
+#define MATH_atan2(y, x) MATH_CALL(atan2)(y, x)
+#define MATH_fromFloat(value) MATH_CALL(fromFloat)(value)
+#define MATH_toFloat(value) MATH_CALL(toFloat)(value)
+
+#endif
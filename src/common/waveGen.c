@@ -0,0 +1,71 @@
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "waveGen.h"
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+void WAVE_init(WAVE_Generator *generator, float sampleFrequency) {
+    generator->channelCount = 0U;
+    generator->sampleFrequency = sampleFrequency;
+}
+
+WAVE_Channel *WAVE_addChannel(WAVE_Generator *generator, uint32_t dacBase, const WAVE_Shape *shape) {
+    if (generator->channelCount >= WAVE_MAX_CHANNELS) {
+        return 0;
+    }
+    WAVE_Channel *channel = &generator->channels[generator->channelCount];
+    channel->dacBase = dacBase;
+    WAVE_setShape(channel, shape);
+    channel->phase = 0UL;
+    channel->phaseIncrement = 0UL;
+    // Full-scale wave centred on the DAC mid-level
+    channel->amplitude = WAVE_DAC_MAX;
+    channel->offset = (WAVE_DAC_MAX + 1) / 2;
+    generator->channelCount ++;
+    return channel;
+}
+
+void WAVE_setShape(WAVE_Channel *channel, const WAVE_Shape *shape) {
+    channel->table = shape->table;
+    channel->interpolate = shape->interpolate;
+}
+
+void WAVE_setFrequency(const WAVE_Generator *generator, WAVE_Channel *channel, float frequency) {
+    // Frequency MUST BE between 0 and the Nyquist frequency
+    if (frequency < 0.0f) {
+        frequency = 0.0f;
+    } else if (frequency > 0.5f * generator->sampleFrequency) {
+        frequency = 0.5f * generator->sampleFrequency;
+    }
+    channel->phaseIncrement = (uint32_t)(frequency / generator->sampleFrequency * WAVE_PHASE_TURN + 0.5f);
+}
+
+void WAVE_setPhaseIncrement(WAVE_Channel *channel, uint32_t phaseIncrement) {
+    channel->phaseIncrement = phaseIncrement;
+}
+
+void WAVE_setPhase(WAVE_Channel *channel, uint32_t phase) {
+    channel->phase = phase;
+}
+
+void WAVE_setAmplitude(WAVE_Channel *channel, uint16_t amplitude) {
+    channel->amplitude = amplitude;
+}
+
+void WAVE_setOffset(WAVE_Channel *channel, uint16_t offset) {
+    channel->offset = offset;
+}
+
+void WAVE_fill(WAVE_Generator *generator, uint16_t *frames, uint16_t length) {
+    const uint16_t stride = generator->channelCount;
+    uint16_t index;
+    for (index = 0; index < stride; index ++) {
+        WAVE_Channel *channel = &generator->channels[index];
+        uint16_t *output = frames + index;
+        uint16_t frame;
+        for (frame = 0; frame < length; frame ++) {
+            *output = WAVE_step(channel);
+            output += stride;
+        }
+    }
+}
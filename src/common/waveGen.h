@@ -0,0 +1,86 @@
+#ifndef WAVEGEN_H
+#define WAVEGEN_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*------------------------------DRIVERLIB------------------------------*/
+
+#include "dac.h"
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "waveTables.h"
+
+/*------------------------------MACROS------------------------------*/
+
+#define WAVE_MAX_CHANNELS 3U // DACA, DACB and DACC
+#define WAVE_PHASE_TURN 4294967296.0f // 2^32, one full period
+#define WAVE_DAC_MAX 4095
+
+/*------------------------------TYPES------------------------------*/
+
+typedef struct {
+    uint32_t dacBase;
+    const uint16_t *table;
+    bool interpolate;
+    uint32_t phase; // Upper WAVE_TABLE_BITS bits index the table, the rest is the fraction
+    uint32_t phaseIncrement; // frequency * 2^32 / sampleFrequency
+    uint16_t amplitude; // Peak-to-peak DAC levels
+    uint16_t offset; // DAC level of the waveform zero
+} WAVE_Channel;
+
+typedef struct {
+    WAVE_Channel channels[WAVE_MAX_CHANNELS];
+    uint16_t channelCount;
+    float sampleFrequency;
+} WAVE_Generator;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+void WAVE_init(WAVE_Generator *generator, float sampleFrequency);
+// NULL when every channel is taken
+WAVE_Channel *WAVE_addChannel(WAVE_Generator *generator, uint32_t dacBase, const WAVE_Shape *shape);
+void WAVE_setShape(WAVE_Channel *channel, const WAVE_Shape *shape);
+void WAVE_setFrequency(const WAVE_Generator *generator, WAVE_Channel *channel, float frequency);
+void WAVE_setPhaseIncrement(WAVE_Channel *channel, uint32_t phaseIncrement);
+void WAVE_setPhase(WAVE_Channel *channel, uint32_t phase);
+void WAVE_setAmplitude(WAVE_Channel *channel, uint16_t amplitude);
+void WAVE_setOffset(WAVE_Channel *channel, uint16_t offset);
+
+// length frames of every channel, interleaved in channel order (a DACDMA stream block), for DMA-fed DACs
+void WAVE_fill(WAVE_Generator *generator, uint16_t *frames, uint16_t length);
+
+// Next 12-bit DAC code of a channel, phase advanced by one sample
+static inline uint16_t WAVE_step(WAVE_Channel *channel) {
+    const uint32_t phase = channel->phase;
+    channel->phase = phase + channel->phaseIncrement;
+    const uint16_t index = (uint16_t)(phase >> (32U - WAVE_TABLE_BITS));
+    int32_t sample = (int32_t)channel->table[index] - WAVE_TABLE_ZERO;
+    if (channel->interpolate) {
+        // Guard point at WAVE_TABLE_LENGTH, no wrap needed
+        const int32_t next = (int32_t)channel->table[index + 1U] - WAVE_TABLE_ZERO;
+        const int32_t fraction = (int32_t)((phase >> (17U - WAVE_TABLE_BITS)) & 0x7FFFUL); // Q15
+        sample += ((next - sample) * fraction) >> 15;
+    }
+    int32_t output = (int32_t)channel->offset + ((sample * (int32_t)channel->amplitude) >> 16);
+    if (output < 0) {
+        output = 0;
+    } else if (output > WAVE_DAC_MAX) {
+        output = WAVE_DAC_MAX;
+    }
+    return (uint16_t)output;
+}
+
+// Every channel stepped and written to its DAC shadow register, call once per sample
+static inline void WAVE_update(WAVE_Generator *generator) {
+    uint16_t index;
+    for (index = 0; index < generator->channelCount; index ++) {
+        WAVE_Channel *channel = &generator->channels[index];
+        DAC_setShadowValue(channel->dacBase, WAVE_step(channel));
+    }
+}
+
+#endif
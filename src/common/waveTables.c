@@ -0,0 +1,196 @@
+// Generated by tools/generateWaveTables.py, do not edit
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "waveTables.h"
+
+/*------------------------------TABLES------------------------------*/
+
+// const data is placed in flash (.const) by the linker command file
+const uint16_t WAVE_sineTable[WAVE_TABLE_LENGTH + 1] = {
+    32768, 33170, 33572, 33974, 34376, 34777, 35178, 35579, 35980, 36380, 36779, 37178,
+    37576, 37973, 38370, 38766, 39161, 39554, 39947, 40339, 40730, 41119, 41507, 41894,
+    42280, 42664, 43046, 43427, 43807, 44185, 44561, 44935, 45307, 45678, 46047, 46413,
+    46778, 47140, 47500, 47858, 48214, 48568, 48919, 49267, 49614, 49957, 50298, 50637,
+    50972, 51305, 51636, 51963, 52287, 52609, 52927, 53243, 53555, 53864, 54171, 54473,
+    54773, 55069, 55362, 55652, 55938, 56220, 56499, 56775, 57047, 57315, 57579, 57840,
+    58097, 58350, 58600, 58845, 59087, 59324, 59558, 59787, 60013, 60234, 60451, 60664,
+    60873, 61078, 61278, 61474, 61666, 61853, 62036, 62215, 62389, 62559, 62724, 62885,
+    63041, 63192, 63339, 63482, 63620, 63753, 63881, 64005, 64124, 64238, 64348, 64453,
+    64553, 64648, 64739, 64825, 64905, 64981, 65053, 65119, 65180, 65237, 65289, 65335,
+    65377, 65414, 65446, 65473, 65496, 65513, 65525, 65533, 65535, 65533, 65525, 65513,
+    65496, 65473, 65446, 65414, 65377, 65335, 65289, 65237, 65180, 65119, 65053, 64981,
+    64905, 64825, 64739, 64648, 64553, 64453, 64348, 64238, 64124, 64005, 63881, 63753,
+    63620, 63482, 63339, 63192, 63041, 62885, 62724, 62559, 62389, 62215, 62036, 61853,
+    61666, 61474, 61278, 61078, 60873, 60664, 60451, 60234, 60013, 59787, 59558, 59324,
+    59087, 58845, 58600, 58350, 58097, 57840, 57579, 57315, 57047, 56775, 56499, 56220,
+    55938, 55652, 55362, 55069, 54773, 54473, 54171, 53864, 53555, 53243, 52927, 52609,
+    52287, 51963, 51636, 51305, 50972, 50637, 50298, 49957, 49614, 49267, 48919, 48568,
+    48214, 47858, 47500, 47140, 46778, 46413, 46047, 45678, 45307, 44935, 44561, 44185,
+    43807, 43427, 43046, 42664, 42280, 41894, 41507, 41119, 40730, 40339, 39947, 39554,
+    39161, 38766, 38370, 37973, 37576, 37178, 36779, 36380, 35980, 35579, 35178, 34777,
+    34376, 33974, 33572, 33170, 32768, 32366, 31964, 31562, 31160, 30759, 30358, 29957,
+    29556, 29156, 28757, 28358, 27960, 27563, 27166, 26770, 26375, 25982, 25589, 25197,
+    24806, 24417, 24029, 23642, 23256, 22872, 22490, 22109, 21729, 21351, 20975, 20601,
+    20229, 19858, 19489, 19123, 18758, 18396, 18036, 17678, 17322, 16968, 16617, 16269,
+    15922, 15579, 15238, 14899, 14564, 14231, 13900, 13573, 13249, 12927, 12609, 12293,
+    11981, 11672, 11365, 11063, 10763, 10467, 10174, 9884, 9598, 9316, 9037, 8761,
+    8489, 8221, 7957, 7696, 7439, 7186, 6936, 6691, 6449, 6212, 5978, 5749,
+    5523, 5302, 5085, 4872, 4663, 4458, 4258, 4062, 3870, 3683, 3500, 3321,
+    3147, 2977, 2812, 2651, 2495, 2344, 2197, 2054, 1916, 1783, 1655, 1531,
+    1412, 1298, 1188, 1083, 983, 888, 797, 711, 631, 555, 483, 417,
+    356, 299, 247, 201, 159, 122, 90, 63, 40, 23, 11, 3,
+    1, 3, 11, 23, 40, 63, 90, 122, 159, 201, 247, 299,
+    356, 417, 483, 555, 631, 711, 797, 888, 983, 1083, 1188, 1298,
+    1412, 1531, 1655, 1783, 1916, 2054, 2197, 2344, 2495, 2651, 2812, 2977,
+    3147, 3321, 3500, 3683, 3870, 4062, 4258, 4458, 4663, 4872, 5085, 5302,
+    5523, 5749, 5978, 6212, 6449, 6691, 6936, 7186, 7439, 7696, 7957, 8221,
+    8489, 8761, 9037, 9316, 9598, 9884, 10174, 10467, 10763, 11063, 11365, 11672,
+    11981, 12293, 12609, 12927, 13249, 13573, 13900, 14231, 14564, 14899, 15238, 15579,
+    15922, 16269, 16617, 16968, 17322, 17678, 18036, 18396, 18758, 19123, 19489, 19858,
+    20229, 20601, 20975, 21351, 21729, 22109, 22490, 22872, 23256, 23642, 24029, 24417,
+    24806, 25197, 25589, 25982, 26375, 26770, 27166, 27563, 27960, 28358, 28757, 29156,
+    29556, 29957, 30358, 30759, 31160, 31562, 31964, 32366, 32768
+};
+
+const uint16_t WAVE_triangleTable[WAVE_TABLE_LENGTH + 1] = {
+    32768, 33024, 33280, 33536, 33792, 34048, 34304, 34560, 34816, 35072, 35328, 35584,
+    35840, 36096, 36352, 36608, 36864, 37120, 37376, 37632, 37888, 38144, 38400, 38656,
+    38912, 39168, 39424, 39680, 39936, 40192, 40448, 40704, 40960, 41216, 41472, 41728,
+    41984, 42240, 42496, 42752, 43008, 43264, 43520, 43776, 44032, 44288, 44544, 44800,
+    45056, 45312, 45568, 45824, 46080, 46336, 46592, 46848, 47104, 47360, 47616, 47872,
+    48128, 48384, 48640, 48896, 49152, 49407, 49663, 49919, 50175, 50431, 50687, 50943,
+    51199, 51455, 51711, 51967, 52223, 52479, 52735, 52991, 53247, 53503, 53759, 54015,
+    54271, 54527, 54783, 55039, 55295, 55551, 55807, 56063, 56319, 56575, 56831, 57087,
+    57343, 57599, 57855, 58111, 58367, 58623, 58879, 59135, 59391, 59647, 59903, 60159,
+    60415, 60671, 60927, 61183, 61439, 61695, 61951, 62207, 62463, 62719, 62975, 63231,
+    63487, 63743, 63999, 64255, 64511, 64767, 65023, 65279, 65535, 65279, 65023, 64767,
+    64511, 64255, 63999, 63743, 63487, 63231, 62975, 62719, 62463, 62207, 61951, 61695,
+    61439, 61183, 60927, 60671, 60415, 60159, 59903, 59647, 59391, 59135, 58879, 58623,
+    58367, 58111, 57855, 57599, 57343, 57087, 56831, 56575, 56319, 56063, 55807, 55551,
+    55295, 55039, 54783, 54527, 54271, 54015, 53759, 53503, 53247, 52991, 52735, 52479,
+    52223, 51967, 51711, 51455, 51199, 50943, 50687, 50431, 50175, 49919, 49663, 49407,
+    49152, 48896, 48640, 48384, 48128, 47872, 47616, 47360, 47104, 46848, 46592, 46336,
+    46080, 45824, 45568, 45312, 45056, 44800, 44544, 44288, 44032, 43776, 43520, 43264,
+    43008, 42752, 42496, 42240, 41984, 41728, 41472, 41216, 40960, 40704, 40448, 40192,
+    39936, 39680, 39424, 39168, 38912, 38656, 38400, 38144, 37888, 37632, 37376, 37120,
+    36864, 36608, 36352, 36096, 35840, 35584, 35328, 35072, 34816, 34560, 34304, 34048,
+    33792, 33536, 33280, 33024, 32768, 32512, 32256, 32000, 31744, 31488, 31232, 30976,
+    30720, 30464, 30208, 29952, 29696, 29440, 29184, 28928, 28672, 28416, 28160, 27904,
+    27648, 27392, 27136, 26880, 26624, 26368, 26112, 25856, 25600, 25344, 25088, 24832,
+    24576, 24320, 24064, 23808, 23552, 23296, 23040, 22784, 22528, 22272, 22016, 21760,
+    21504, 21248, 20992, 20736, 20480, 20224, 19968, 19712, 19456, 19200, 18944, 18688,
+    18432, 18176, 17920, 17664, 17408, 17152, 16896, 16640, 16384, 16129, 15873, 15617,
+    15361, 15105, 14849, 14593, 14337, 14081, 13825, 13569, 13313, 13057, 12801, 12545,
+    12289, 12033, 11777, 11521, 11265, 11009, 10753, 10497, 10241, 9985, 9729, 9473,
+    9217, 8961, 8705, 8449, 8193, 7937, 7681, 7425, 7169, 6913, 6657, 6401,
+    6145, 5889, 5633, 5377, 5121, 4865, 4609, 4353, 4097, 3841, 3585, 3329,
+    3073, 2817, 2561, 2305, 2049, 1793, 1537, 1281, 1025, 769, 513, 257,
+    1, 257, 513, 769, 1025, 1281, 1537, 1793, 2049, 2305, 2561, 2817,
+    3073, 3329, 3585, 3841, 4097, 4353, 4609, 4865, 5121, 5377, 5633, 5889,
+    6145, 6401, 6657, 6913, 7169, 7425, 7681, 7937, 8193, 8449, 8705, 8961,
+    9217, 9473, 9729, 9985, 10241, 10497, 10753, 11009, 11265, 11521, 11777, 12033,
+    12289, 12545, 12801, 13057, 13313, 13569, 13825, 14081, 14337, 14593, 14849, 15105,
+    15361, 15617, 15873, 16129, 16384, 16640, 16896, 17152, 17408, 17664, 17920, 18176,
+    18432, 18688, 18944, 19200, 19456, 19712, 19968, 20224, 20480, 20736, 20992, 21248,
+    21504, 21760, 22016, 22272, 22528, 22784, 23040, 23296, 23552, 23808, 24064, 24320,
+    24576, 24832, 25088, 25344, 25600, 25856, 26112, 26368, 26624, 26880, 27136, 27392,
+    27648, 27904, 28160, 28416, 28672, 28928, 29184, 29440, 29696, 29952, 30208, 30464,
+    30720, 30976, 31232, 31488, 31744, 32000, 32256, 32512, 32768
+};
+
+const uint16_t WAVE_squareTable[WAVE_TABLE_LENGTH + 1] = {
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 65535
+};
+
+const uint16_t WAVE_sawtoothTable[WAVE_TABLE_LENGTH + 1] = {
+    32768, 32896, 33024, 33152, 33280, 33408, 33536, 33664, 33792, 33920, 34048, 34176,
+    34304, 34432, 34560, 34688, 34816, 34944, 35072, 35200, 35328, 35456, 35584, 35712,
+    35840, 35968, 36096, 36224, 36352, 36480, 36608, 36736, 36864, 36992, 37120, 37248,
+    37376, 37504, 37632, 37760, 37888, 38016, 38144, 38272, 38400, 38528, 38656, 38784,
+    38912, 39040, 39168, 39296, 39424, 39552, 39680, 39808, 39936, 40064, 40192, 40320,
+    40448, 40576, 40704, 40832, 40960, 41088, 41216, 41344, 41472, 41600, 41728, 41856,
+    41984, 42112, 42240, 42368, 42496, 42624, 42752, 42880, 43008, 43136, 43264, 43392,
+    43520, 43648, 43776, 43904, 44032, 44160, 44288, 44416, 44544, 44672, 44800, 44928,
+    45056, 45184, 45312, 45440, 45568, 45696, 45824, 45952, 46080, 46208, 46336, 46464,
+    46592, 46720, 46848, 46976, 47104, 47232, 47360, 47488, 47616, 47744, 47872, 48000,
+    48128, 48256, 48384, 48512, 48640, 48768, 48896, 49024, 49152, 49279, 49407, 49535,
+    49663, 49791, 49919, 50047, 50175, 50303, 50431, 50559, 50687, 50815, 50943, 51071,
+    51199, 51327, 51455, 51583, 51711, 51839, 51967, 52095, 52223, 52351, 52479, 52607,
+    52735, 52863, 52991, 53119, 53247, 53375, 53503, 53631, 53759, 53887, 54015, 54143,
+    54271, 54399, 54527, 54655, 54783, 54911, 55039, 55167, 55295, 55423, 55551, 55679,
+    55807, 55935, 56063, 56191, 56319, 56447, 56575, 56703, 56831, 56959, 57087, 57215,
+    57343, 57471, 57599, 57727, 57855, 57983, 58111, 58239, 58367, 58495, 58623, 58751,
+    58879, 59007, 59135, 59263, 59391, 59519, 59647, 59775, 59903, 60031, 60159, 60287,
+    60415, 60543, 60671, 60799, 60927, 61055, 61183, 61311, 61439, 61567, 61695, 61823,
+    61951, 62079, 62207, 62335, 62463, 62591, 62719, 62847, 62975, 63103, 63231, 63359,
+    63487, 63615, 63743, 63871, 63999, 64127, 64255, 64383, 64511, 64639, 64767, 64895,
+    65023, 65151, 65279, 65407, 1, 129, 257, 385, 513, 641, 769, 897,
+    1025, 1153, 1281, 1409, 1537, 1665, 1793, 1921, 2049, 2177, 2305, 2433,
+    2561, 2689, 2817, 2945, 3073, 3201, 3329, 3457, 3585, 3713, 3841, 3969,
+    4097, 4225, 4353, 4481, 4609, 4737, 4865, 4993, 5121, 5249, 5377, 5505,
+    5633, 5761, 5889, 6017, 6145, 6273, 6401, 6529, 6657, 6785, 6913, 7041,
+    7169, 7297, 7425, 7553, 7681, 7809, 7937, 8065, 8193, 8321, 8449, 8577,
+    8705, 8833, 8961, 9089, 9217, 9345, 9473, 9601, 9729, 9857, 9985, 10113,
+    10241, 10369, 10497, 10625, 10753, 10881, 11009, 11137, 11265, 11393, 11521, 11649,
+    11777, 11905, 12033, 12161, 12289, 12417, 12545, 12673, 12801, 12929, 13057, 13185,
+    13313, 13441, 13569, 13697, 13825, 13953, 14081, 14209, 14337, 14465, 14593, 14721,
+    14849, 14977, 15105, 15233, 15361, 15489, 15617, 15745, 15873, 16001, 16129, 16257,
+    16384, 16512, 16640, 16768, 16896, 17024, 17152, 17280, 17408, 17536, 17664, 17792,
+    17920, 18048, 18176, 18304, 18432, 18560, 18688, 18816, 18944, 19072, 19200, 19328,
+    19456, 19584, 19712, 19840, 19968, 20096, 20224, 20352, 20480, 20608, 20736, 20864,
+    20992, 21120, 21248, 21376, 21504, 21632, 21760, 21888, 22016, 22144, 22272, 22400,
+    22528, 22656, 22784, 22912, 23040, 23168, 23296, 23424, 23552, 23680, 23808, 23936,
+    24064, 24192, 24320, 24448, 24576, 24704, 24832, 24960, 25088, 25216, 25344, 25472,
+    25600, 25728, 25856, 25984, 26112, 26240, 26368, 26496, 26624, 26752, 26880, 27008,
+    27136, 27264, 27392, 27520, 27648, 27776, 27904, 28032, 28160, 28288, 28416, 28544,
+    28672, 28800, 28928, 29056, 29184, 29312, 29440, 29568, 29696, 29824, 29952, 30080,
+    30208, 30336, 30464, 30592, 30720, 30848, 30976, 31104, 31232, 31360, 31488, 31616,
+    31744, 31872, 32000, 32128, 32256, 32384, 32512, 32640, 32768
+};
+
+const WAVE_Shape WAVE_sine = {WAVE_sineTable, true};
+const WAVE_Shape WAVE_triangle = {WAVE_triangleTable, true};
+const WAVE_Shape WAVE_square = {WAVE_squareTable, false};
+const WAVE_Shape WAVE_sawtooth = {WAVE_sawtoothTable, false};
@@ -0,0 +1,35 @@
+// Generated by tools/generateWaveTables.py, do not edit
+#ifndef WAVETABLES_H
+#define WAVETABLES_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*------------------------------MACROS------------------------------*/
+
+#define WAVE_TABLE_BITS 9U
+#define WAVE_TABLE_LENGTH (1U << WAVE_TABLE_BITS)
+#define WAVE_TABLE_ZERO 32768L // Offset binary zero
+
+/*------------------------------TYPES------------------------------*/
+
+typedef struct {
+    const uint16_t *table; // WAVE_TABLE_LENGTH + 1 points, the last one repeats the first
+    bool interpolate; // Linear interpolation between points, off for shapes with jumps
+} WAVE_Shape;
+
+/*------------------------------TABLES------------------------------*/
+
+extern const uint16_t WAVE_sineTable[WAVE_TABLE_LENGTH + 1];
+extern const uint16_t WAVE_triangleTable[WAVE_TABLE_LENGTH + 1];
+extern const uint16_t WAVE_squareTable[WAVE_TABLE_LENGTH + 1];
+extern const uint16_t WAVE_sawtoothTable[WAVE_TABLE_LENGTH + 1];
+
+extern const WAVE_Shape WAVE_sine;
+extern const WAVE_Shape WAVE_triangle;
+extern const WAVE_Shape WAVE_square;
+extern const WAVE_Shape WAVE_sawtooth;
+
+#endif
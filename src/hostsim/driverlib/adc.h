@@ -0,0 +1,125 @@
+#ifndef ADC_H
+#define ADC_H
+
+#include "hostSim.h"
+#include "inc/hw_adc.h"
+
+typedef enum {
+    ADC_CLK_DIV_1_0 = 0,
+    ADC_CLK_DIV_2_0 = 2,
+    ADC_CLK_DIV_2_5 = 3,
+    ADC_CLK_DIV_3_0 = 4,
+    ADC_CLK_DIV_3_5 = 5,
+    ADC_CLK_DIV_4_0 = 6,
+    ADC_CLK_DIV_4_5 = 7,
+    ADC_CLK_DIV_5_0 = 8,
+    ADC_CLK_DIV_5_5 = 9,
+    ADC_CLK_DIV_6_0 = 10,
+    ADC_CLK_DIV_6_5 = 11,
+    ADC_CLK_DIV_7_0 = 12,
+    ADC_CLK_DIV_7_5 = 13,
+    ADC_CLK_DIV_8_0 = 14,
+    ADC_CLK_DIV_8_5 = 15
+} ADC_ClkPrescale;
+
+typedef enum {
+    ADC_RESOLUTION_12BIT,
+    ADC_RESOLUTION_16BIT
+} ADC_Resolution;
+
+typedef enum {
+    ADC_MODE_SINGLE_ENDED,
+    ADC_MODE_DIFFERENTIAL
+} ADC_SignalMode;
+
+typedef enum {
+    ADC_TRIGGER_SW_ONLY = 0x00,
+    ADC_TRIGGER_CPU1_TINT0 = 0x01,
+    ADC_TRIGGER_CPU1_TINT1 = 0x02,
+    ADC_TRIGGER_CPU1_TINT2 = 0x03,
+    ADC_TRIGGER_GPIO = 0x04,
+    ADC_TRIGGER_EPWM1_SOCA = 0x05,
+    ADC_TRIGGER_EPWM1_SOCB = 0x06,
+    ADC_TRIGGER_EPWM2_SOCA = 0x07,
+    ADC_TRIGGER_EPWM2_SOCB = 0x08,
+    ADC_TRIGGER_EPWM3_SOCA = 0x09,
+    ADC_TRIGGER_EPWM3_SOCB = 0x0A,
+    ADC_TRIGGER_EPWM4_SOCA = 0x0B,
+    ADC_TRIGGER_EPWM4_SOCB = 0x0C,
+    ADC_TRIGGER_EPWM5_SOCA = 0x0D,
+    ADC_TRIGGER_EPWM5_SOCB = 0x0E,
+    ADC_TRIGGER_EPWM6_SOCA = 0x0F,
+    ADC_TRIGGER_EPWM6_SOCB = 0x10,
+    ADC_TRIGGER_EPWM7_SOCA = 0x11,
+    ADC_TRIGGER_EPWM7_SOCB = 0x12,
+    ADC_TRIGGER_EPWM8_SOCA = 0x13,
+    ADC_TRIGGER_EPWM8_SOCB = 0x14,
+    ADC_TRIGGER_EPWM9_SOCA = 0x15,
+    ADC_TRIGGER_EPWM9_SOCB = 0x16,
+    ADC_TRIGGER_EPWM10_SOCA = 0x17,
+    ADC_TRIGGER_EPWM10_SOCB = 0x18,
+    ADC_TRIGGER_EPWM11_SOCA = 0x19,
+    ADC_TRIGGER_EPWM11_SOCB = 0x1A,
+    ADC_TRIGGER_EPWM12_SOCA = 0x1B,
+    ADC_TRIGGER_EPWM12_SOCB = 0x1C
+} ADC_Trigger;
+
+typedef enum {
+    ADC_CH_ADCIN0, ADC_CH_ADCIN1, ADC_CH_ADCIN2, ADC_CH_ADCIN3,
+    ADC_CH_ADCIN4, ADC_CH_ADCIN5, ADC_CH_ADCIN6, ADC_CH_ADCIN7,
+    ADC_CH_ADCIN8, ADC_CH_ADCIN9, ADC_CH_ADCIN10, ADC_CH_ADCIN11,
+    ADC_CH_ADCIN12, ADC_CH_ADCIN13, ADC_CH_ADCIN14, ADC_CH_ADCIN15
+} ADC_Channel;
+
+typedef enum {
+    ADC_PULSE_END_OF_ACQ_WIN,
+    ADC_PULSE_END_OF_CONV
+} ADC_PulseMode;
+
+typedef enum {
+    ADC_INT_NUMBER1,
+    ADC_INT_NUMBER2,
+    ADC_INT_NUMBER3,
+    ADC_INT_NUMBER4
+} ADC_IntNumber;
+
+typedef enum {
+    ADC_SOC_NUMBER0, ADC_SOC_NUMBER1, ADC_SOC_NUMBER2, ADC_SOC_NUMBER3,
+    ADC_SOC_NUMBER4, ADC_SOC_NUMBER5, ADC_SOC_NUMBER6, ADC_SOC_NUMBER7,
+    ADC_SOC_NUMBER8, ADC_SOC_NUMBER9, ADC_SOC_NUMBER10, ADC_SOC_NUMBER11,
+    ADC_SOC_NUMBER12, ADC_SOC_NUMBER13, ADC_SOC_NUMBER14, ADC_SOC_NUMBER15
+} ADC_SOCNumber;
+
+typedef enum {
+    ADC_INT_SOC_TRIGGER_NONE,
+    ADC_INT_SOC_TRIGGER_ADCINT1,
+    ADC_INT_SOC_TRIGGER_ADCINT2
+} ADC_IntSOCTrigger;
+
+typedef enum {
+    ADC_PRI_ALL_ROUND_ROBIN = 0,
+    ADC_PRI_SOC0_HIPRI = 1,
+    ADC_PRI_THRU_SOC15_HIPRI = 16
+} ADC_PriorityMode;
+
+void ADC_setPrescaler(uint32_t base, ADC_ClkPrescale clkPrescale);
+void ADC_setMode(uint32_t base, ADC_Resolution resolution, ADC_SignalMode signalMode);
+void ADC_setupSOC(uint32_t base, ADC_SOCNumber socNumber, ADC_Trigger trigger, ADC_Channel channel, uint32_t sampleWindow);
+void ADC_setInterruptSOCTrigger(uint32_t base, ADC_SOCNumber socNumber, ADC_IntSOCTrigger trigger);
+void ADC_setSOCPriority(uint32_t base, ADC_PriorityMode priMode);
+void ADC_setInterruptPulseMode(uint32_t base, ADC_PulseMode pulseMode);
+void ADC_enableConverter(uint32_t base);
+void ADC_disableConverter(uint32_t base);
+void ADC_forceSOC(uint32_t base, ADC_SOCNumber socNumber);
+void ADC_enableInterrupt(uint32_t base, ADC_IntNumber adcIntNum);
+void ADC_disableInterrupt(uint32_t base, ADC_IntNumber adcIntNum);
+void ADC_setInterruptSource(uint32_t base, ADC_IntNumber adcIntNum, uint16_t socNumber);
+void ADC_enableContinuousMode(uint32_t base, ADC_IntNumber adcIntNum);
+void ADC_disableContinuousMode(uint32_t base, ADC_IntNumber adcIntNum);
+bool ADC_getInterruptStatus(uint32_t base, ADC_IntNumber adcIntNum);
+void ADC_clearInterruptStatus(uint32_t base, ADC_IntNumber adcIntNum);
+bool ADC_getInterruptOverflowStatus(uint32_t base, ADC_IntNumber adcIntNum);
+void ADC_clearInterruptOverflowStatus(uint32_t base, ADC_IntNumber adcIntNum);
+uint16_t ADC_readResult(uint32_t resultBase, ADC_SOCNumber socNumber);
+
+#endif
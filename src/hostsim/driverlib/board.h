@@ -0,0 +1,8 @@
+#ifndef BOARD_H
+#define BOARD_H
+
+// Host simulation: SysConfig output is not used by these programs
+
+#include "driverlib.h"
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef C2000WARE_LIBRARIES_H
+#define C2000WARE_LIBRARIES_H
+
+// Host simulation: SysConfig output is not used by these programs
+
+#include "driverlib.h"
+
+#endif
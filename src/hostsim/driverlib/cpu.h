@@ -0,0 +1,20 @@
+#ifndef CPU_H
+#define CPU_H
+
+#include "hostSim.h"
+
+// Host simulation: ISRs are plain functions called by the simulated PIE
+#define interrupt
+#define __interrupt
+
+// Global interrupt mask (INTM)
+#define EINT HostSim_enableGlobalInterrupts()
+#define DINT HostSim_disableGlobalInterrupts()
+
+// Real-time debug mode has no meaning on the host
+#define ERTM ((void)0)
+#define DRTM ((void)0)
+
+#define NOP ((void)0)
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef CPUTIMER_H
+#define CPUTIMER_H
+
+#include "hostSim.h"
+
+typedef enum {
+    CPUTIMER_CLOCK_PRESCALER_1 = 0,
+    CPUTIMER_CLOCK_PRESCALER_2 = 1,
+    CPUTIMER_CLOCK_PRESCALER_4 = 2,
+    CPUTIMER_CLOCK_PRESCALER_8 = 3,
+    CPUTIMER_CLOCK_PRESCALER_16 = 4
+} CPUTimer_ClockPrescaler;
+
+void CPUTimer_stopTimer(uint32_t base);
+void CPUTimer_startTimer(uint32_t base);
+void CPUTimer_reloadTimerCounter(uint32_t base);
+void CPUTimer_setPeriod(uint32_t base, uint32_t periodCount);
+uint32_t CPUTimer_getTimerCount(uint32_t base);
+void CPUTimer_setPreScaler(uint32_t base, uint16_t prescaler);
+void CPUTimer_enableInterrupt(uint32_t base);
+void CPUTimer_disableInterrupt(uint32_t base);
+bool CPUTimer_getTimerOverflowStatus(uint32_t base);
+void CPUTimer_clearOverflowFlag(uint32_t base);
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef DAC_H
+#define DAC_H
+
+#include "hostSim.h"
+#include "inc/hw_dac.h"
+
+typedef enum {
+    DAC_REF_VDAC,
+    DAC_REF_ADC_VREFHI
+} DAC_ReferenceVoltage;
+
+typedef enum {
+    DAC_LOAD_SYSCLK,
+    DAC_LOAD_PWMSYNC
+} DAC_LoadMode;
+
+void DAC_setReferenceVoltage(uint32_t base, DAC_ReferenceVoltage source);
+void DAC_setLoadMode(uint32_t base, DAC_LoadMode mode);
+void DAC_enableOutput(uint32_t base);
+void DAC_disableOutput(uint32_t base);
+void DAC_setShadowValue(uint32_t base, uint16_t value);
+uint16_t DAC_getActiveValue(uint32_t base);
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef DEBUG_H
+#define DEBUG_H
+
+#include <assert.h>
+
+// Host simulation: driverlib assertions map onto the C library
+#define ASSERT(expr) assert(expr)
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef DEVICE_H
+#define DEVICE_H
+
+#include "hostSim.h"
+
+// LaunchXL-F28379D board
+#define DEVICE_GPIO_PIN_LED1 31U
+#define DEVICE_GPIO_PIN_LED2 34U
+
+#define DEVICE_SYSCLK_FREQ 200000000UL // 200 MHz
+#define DEVICE_LSPCLK_FREQ (DEVICE_SYSCLK_FREQ / 4)
+
+// Host simulation: delays advance the virtual clock instead of burning cycles
+#define DEVICE_DELAY_US(x) HostSim_delayMicroseconds((uint32_t)(x))
+
+// CPU2 boot mode handed over by CPU1
+#define C1C2_BROM_BOOTMODE_BOOT_FROM_RAM 0x00000005UL
+#define C1C2_BROM_BOOTMODE_BOOT_FROM_FLASH 0x0000000BUL
+
+void Device_init(void);
+void Device_initGPIO(void);
+// Host simulation: starts HostSim_cpu2Main on its own thread
+void Device_bootCPU2(uint32_t bootmode);
+
+#endif
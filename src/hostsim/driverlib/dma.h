@@ -0,0 +1,98 @@
+#ifndef DMA_H
+#define DMA_H
+
+#include "hostSim.h"
+
+// Source and destination addresses below 0x100000 are peripheral registers, anything else is host memory
+
+typedef enum {
+    DMA_TRIGGER_SOFTWARE = 0,
+    DMA_TRIGGER_ADCA1 = 1,
+    DMA_TRIGGER_ADCA2 = 2,
+    DMA_TRIGGER_ADCA3 = 3,
+    DMA_TRIGGER_ADCA4 = 4,
+    DMA_TRIGGER_ADCAEVT = 5,
+    DMA_TRIGGER_ADCB1 = 6,
+    DMA_TRIGGER_ADCB2 = 7,
+    DMA_TRIGGER_ADCB3 = 8,
+    DMA_TRIGGER_ADCB4 = 9,
+    DMA_TRIGGER_ADCBEVT = 10,
+    DMA_TRIGGER_ADCC1 = 11,
+    DMA_TRIGGER_ADCC2 = 12,
+    DMA_TRIGGER_ADCC3 = 13,
+    DMA_TRIGGER_ADCC4 = 14,
+    DMA_TRIGGER_ADCCEVT = 15,
+    DMA_TRIGGER_ADCD1 = 16,
+    DMA_TRIGGER_ADCD2 = 17,
+    DMA_TRIGGER_ADCD3 = 18,
+    DMA_TRIGGER_ADCD4 = 19,
+    DMA_TRIGGER_ADCDEVT = 20,
+    DMA_TRIGGER_EPWM1SOCA = 36,
+    DMA_TRIGGER_EPWM1SOCB = 37,
+    DMA_TRIGGER_EPWM2SOCA = 38,
+    DMA_TRIGGER_EPWM2SOCB = 39,
+    DMA_TRIGGER_EPWM3SOCA = 40,
+    DMA_TRIGGER_EPWM3SOCB = 41,
+    DMA_TRIGGER_EPWM4SOCA = 42,
+    DMA_TRIGGER_EPWM4SOCB = 43,
+    DMA_TRIGGER_EPWM5SOCA = 44,
+    DMA_TRIGGER_EPWM5SOCB = 45,
+    DMA_TRIGGER_EPWM6SOCA = 46,
+    DMA_TRIGGER_EPWM6SOCB = 47,
+    DMA_TRIGGER_EPWM7SOCA = 48,
+    DMA_TRIGGER_EPWM7SOCB = 49,
+    DMA_TRIGGER_EPWM8SOCA = 50,
+    DMA_TRIGGER_EPWM8SOCB = 51,
+    DMA_TRIGGER_EPWM9SOCA = 52,
+    DMA_TRIGGER_EPWM9SOCB = 53,
+    DMA_TRIGGER_EPWM10SOCA = 54,
+    DMA_TRIGGER_EPWM10SOCB = 55,
+    DMA_TRIGGER_EPWM11SOCA = 56,
+    DMA_TRIGGER_EPWM11SOCB = 57,
+    DMA_TRIGGER_EPWM12SOCA = 58,
+    DMA_TRIGGER_EPWM12SOCB = 59,
+    DMA_TRIGGER_TINT0 = 68,
+    DMA_TRIGGER_TINT1 = 69,
+    DMA_TRIGGER_TINT2 = 70
+} DMA_Trigger;
+
+typedef enum {
+    DMA_INT_AT_BEGINNING,
+    DMA_INT_AT_END
+} DMA_InterruptMode;
+
+typedef enum {
+    DMA_EMULATION_STOP,
+    DMA_EMULATION_FREE_RUN
+} DMA_EmulationMode;
+
+// DMA_configMode() flags
+#define DMA_CFG_ONESHOT_DISABLE 0x0000U
+#define DMA_CFG_ONESHOT_ENABLE 0x0400U
+#define DMA_CFG_CONTINUOUS_DISABLE 0x0000U
+#define DMA_CFG_CONTINUOUS_ENABLE 0x0800U
+#define DMA_CFG_SIZE_16BIT 0x0000U
+#define DMA_CFG_SIZE_32BIT 0x4000U
+
+void DMA_initController(void);
+void DMA_setEmulationMode(DMA_EmulationMode mode);
+void DMA_configAddresses(uint32_t base, const void *destAddr, const void *srcAddr);
+void DMA_configBurst(uint32_t base, uint16_t size, int16_t srcStep, int16_t destStep);
+void DMA_configTransfer(uint32_t base, uint32_t transferSize, int16_t srcStep, int16_t destStep);
+void DMA_configWrap(uint32_t base, uint32_t srcWrapSize, int16_t srcStep, uint32_t destWrapSize, int16_t destStep);
+void DMA_configMode(uint32_t base, DMA_Trigger trigger, uint32_t config);
+void DMA_setInterruptMode(uint32_t base, DMA_InterruptMode mode);
+void DMA_enableInterrupt(uint32_t base);
+void DMA_disableInterrupt(uint32_t base);
+void DMA_enableTrigger(uint32_t base);
+void DMA_disableTrigger(uint32_t base);
+void DMA_enableOverrunInterrupt(uint32_t base);
+void DMA_clearTriggerFlag(uint32_t base);
+void DMA_clearErrorFlag(uint32_t base);
+void DMA_forceTrigger(uint32_t base);
+void DMA_startChannel(uint32_t base);
+void DMA_stopChannel(uint32_t base);
+bool DMA_getTransferStatusFlag(uint32_t base);
+bool DMA_getRunStatusFlag(uint32_t base);
+
+#endif
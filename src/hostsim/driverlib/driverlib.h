@@ -0,0 +1,23 @@
+#ifndef DRIVERLIB_H
+#define DRIVERLIB_H
+
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_types.h"
+#include "inc/hw_adc.h"
+#include "inc/hw_dac.h"
+#include "adc.h"
+#include "cpu.h"
+#include "cputimer.h"
+#include "dac.h"
+#include "debug.h"
+#include "dma.h"
+#include "epwm.h"
+#include "gpio.h"
+#include "interrupt.h"
+#include "ipc.h"
+#include "pin_map.h"
+#include "sci.h"
+#include "sysctl.h"
+
+#endif
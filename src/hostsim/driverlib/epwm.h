@@ -0,0 +1,176 @@
+#ifndef EPWM_H
+#define EPWM_H
+
+#include "hostSim.h"
+
+typedef enum {
+    EPWM_COUNTER_MODE_UP,
+    EPWM_COUNTER_MODE_DOWN,
+    EPWM_COUNTER_MODE_UP_DOWN,
+    EPWM_COUNTER_MODE_STOP_FREEZE
+} EPWM_TimeBaseCountMode;
+
+typedef enum {
+    EPWM_CLOCK_DIVIDER_1, EPWM_CLOCK_DIVIDER_2, EPWM_CLOCK_DIVIDER_4, EPWM_CLOCK_DIVIDER_8,
+    EPWM_CLOCK_DIVIDER_16, EPWM_CLOCK_DIVIDER_32, EPWM_CLOCK_DIVIDER_64, EPWM_CLOCK_DIVIDER_128
+} EPWM_ClockDivider;
+
+typedef enum {
+    EPWM_HSCLOCK_DIVIDER_1, EPWM_HSCLOCK_DIVIDER_2, EPWM_HSCLOCK_DIVIDER_4, EPWM_HSCLOCK_DIVIDER_6,
+    EPWM_HSCLOCK_DIVIDER_8, EPWM_HSCLOCK_DIVIDER_10, EPWM_HSCLOCK_DIVIDER_12, EPWM_HSCLOCK_DIVIDER_14
+} EPWM_HSClockDivider;
+
+typedef enum {
+    EPWM_PERIOD_SHADOW_LOAD,
+    EPWM_PERIOD_DIRECT_LOAD
+} EPWM_PeriodLoadMode;
+
+typedef enum {
+    EPWM_COUNTER_COMPARE_A = 0,
+    EPWM_COUNTER_COMPARE_B = 2,
+    EPWM_COUNTER_COMPARE_C = 5,
+    EPWM_COUNTER_COMPARE_D = 7
+} EPWM_CounterCompareModule;
+
+typedef enum {
+    EPWM_COMP_LOAD_ON_CNTR_ZERO,
+    EPWM_COMP_LOAD_ON_CNTR_PERIOD,
+    EPWM_COMP_LOAD_ON_CNTR_ZERO_PERIOD,
+    EPWM_COMP_LOAD_FREEZE
+} EPWM_CounterCompareLoadMode;
+
+typedef enum {
+    EPWM_ACTION_QUALIFIER_A,
+    EPWM_ACTION_QUALIFIER_B
+} EPWM_ActionQualifierModule;
+
+typedef enum {
+    EPWM_AQ_LOAD_ON_CNTR_ZERO,
+    EPWM_AQ_LOAD_ON_CNTR_PERIOD,
+    EPWM_AQ_LOAD_ON_CNTR_ZERO_PERIOD,
+    EPWM_AQ_LOAD_FREEZE
+} EPWM_ActionQualifierLoadMode;
+
+typedef enum {
+    EPWM_AQ_OUTPUT_A = 0,
+    EPWM_AQ_OUTPUT_B = 4
+} EPWM_ActionQualifierOutputModule;
+
+typedef enum {
+    EPWM_AQ_OUTPUT_NO_CHANGE,
+    EPWM_AQ_OUTPUT_LOW,
+    EPWM_AQ_OUTPUT_HIGH,
+    EPWM_AQ_OUTPUT_TOGGLE
+} EPWM_ActionQualifierOutput;
+
+typedef enum {
+    EPWM_AQ_OUTPUT_ON_TIMEBASE_ZERO = 0,
+    EPWM_AQ_OUTPUT_ON_TIMEBASE_PERIOD = 2,
+    EPWM_AQ_OUTPUT_ON_TIMEBASE_UP_CMPA = 4,
+    EPWM_AQ_OUTPUT_ON_TIMEBASE_DOWN_CMPA = 6,
+    EPWM_AQ_OUTPUT_ON_TIMEBASE_UP_CMPB = 8,
+    EPWM_AQ_OUTPUT_ON_TIMEBASE_DOWN_CMPB = 10
+} EPWM_ActionQualifierOutputEvent;
+
+typedef enum {
+    EPWM_SYNC_OUT_PULSE_ON_SOFTWARE = 0,
+    EPWM_SYNC_OUT_PULSE_ON_EPWMxSYNCIN = 0,
+    EPWM_SYNC_OUT_PULSE_ON_COUNTER_ZERO = 1,
+    EPWM_SYNC_OUT_PULSE_ON_COUNTER_COMPARE_B = 2,
+    EPWM_SYNC_OUT_PULSE_DISABLED = 4
+} EPWM_SyncOutPulseMode;
+
+typedef enum {
+    EPWM_COUNT_MODE_DOWN_AFTER_SYNC,
+    EPWM_COUNT_MODE_UP_AFTER_SYNC
+} EPWM_SyncCountMode;
+
+typedef enum {
+    EPWM_DB_FED,
+    EPWM_DB_RED
+} EPWM_DeadBandDelayMode;
+
+typedef enum {
+    EPWM_DB_POLARITY_ACTIVE_HIGH,
+    EPWM_DB_POLARITY_ACTIVE_LOW
+} EPWM_DeadBandPolarity;
+
+#define EPWM_DB_INPUT_EPWMA 0U
+#define EPWM_DB_INPUT_EPWMB 1U
+
+typedef enum {
+    EPWM_DB_COUNTER_CLOCK_FULL_CYCLE,
+    EPWM_DB_COUNTER_CLOCK_HALF_CYCLE
+} EPWM_DeadBandClockMode;
+
+// Time-base counter direction, TBSTS CTRDIR
+#define EPWM_TIME_BASE_STATUS_COUNT_DOWN 0U
+#define EPWM_TIME_BASE_STATUS_COUNT_UP 1U
+
+// Event-trigger interrupt sources
+#define EPWM_INT_TBCTR_ZERO 1U
+#define EPWM_INT_TBCTR_PERIOD 2U
+#define EPWM_INT_TBCTR_ZERO_OR_PERIOD 3U
+#define EPWM_INT_TBCTR_U_CMPA 4U
+#define EPWM_INT_TBCTR_D_CMPA 5U
+#define EPWM_INT_TBCTR_U_CMPB 6U
+#define EPWM_INT_TBCTR_D_CMPB 7U
+
+typedef enum {
+    EPWM_SOC_A = 0,
+    EPWM_SOC_B = 1
+} EPWM_ADCStartOfConversionType;
+
+// ADC start of conversion sources, numbered as the interrupt's
+typedef enum {
+    EPWM_SOC_DCxEVT1 = 0,
+    EPWM_SOC_TBCTR_ZERO = 1,
+    EPWM_SOC_TBCTR_PERIOD = 2,
+    EPWM_SOC_TBCTR_ZERO_OR_PERIOD = 3,
+    EPWM_SOC_TBCTR_U_CMPA = 4,
+    EPWM_SOC_TBCTR_D_CMPA = 5,
+    EPWM_SOC_TBCTR_U_CMPB = 6,
+    EPWM_SOC_TBCTR_D_CMPB = 7
+} EPWM_ADCStartOfConversionSource;
+
+void EPWM_setClockPrescaler(uint32_t base, EPWM_ClockDivider prescaler, EPWM_HSClockDivider highSpeedPrescaler);
+void EPWM_setPeriodLoadMode(uint32_t base, EPWM_PeriodLoadMode loadMode);
+void EPWM_setTimeBaseCounterMode(uint32_t base, EPWM_TimeBaseCountMode counterMode);
+void EPWM_setTimeBasePeriod(uint32_t base, uint16_t periodCount);
+uint16_t EPWM_getTimeBasePeriod(uint32_t base);
+void EPWM_setTimeBaseCounter(uint32_t base, uint16_t count);
+uint16_t EPWM_getTimeBaseCounterValue(uint32_t base);
+uint16_t EPWM_getTimeBaseCounterDirection(uint32_t base);
+void EPWM_setPhaseShift(uint32_t base, uint16_t phaseCount);
+void EPWM_setCounterCompareShadowLoadMode(uint32_t base, EPWM_CounterCompareModule compModule, EPWM_CounterCompareLoadMode loadMode);
+void EPWM_setCounterCompareValue(uint32_t base, EPWM_CounterCompareModule compModule, uint16_t compCount);
+uint16_t EPWM_getCounterCompareValue(uint32_t base, EPWM_CounterCompareModule compModule);
+void EPWM_setActionQualifierShadowLoadMode(uint32_t base, EPWM_ActionQualifierModule aqModule, EPWM_ActionQualifierLoadMode loadMode);
+void EPWM_setActionQualifierAction(uint32_t base, EPWM_ActionQualifierOutputModule epwmOutput, EPWM_ActionQualifierOutput output, EPWM_ActionQualifierOutputEvent event);
+
+void EPWM_setSyncOutPulseMode(uint32_t base, EPWM_SyncOutPulseMode mode);
+void EPWM_enablePhaseShiftLoad(uint32_t base);
+void EPWM_disablePhaseShiftLoad(uint32_t base);
+void EPWM_setCountModeAfterSync(uint32_t base, EPWM_SyncCountMode mode);
+void EPWM_forceSyncPulse(uint32_t base);
+void EPWM_setDeadBandDelayMode(uint32_t base, EPWM_DeadBandDelayMode delayMode, bool enableDelayMode);
+void EPWM_setDeadBandDelayPolarity(uint32_t base, EPWM_DeadBandDelayMode delayMode, EPWM_DeadBandPolarity polarity);
+void EPWM_setRisingEdgeDeadBandDelayInput(uint32_t base, uint16_t input);
+void EPWM_setFallingEdgeDeadBandDelayInput(uint32_t base, uint16_t input);
+void EPWM_setDeadBandCounterClock(uint32_t base, EPWM_DeadBandClockMode clockMode);
+void EPWM_setRisingEdgeDelayCount(uint32_t base, uint16_t redCount);
+void EPWM_setFallingEdgeDelayCount(uint32_t base, uint16_t fedCount);
+void EPWM_setInterruptSource(uint32_t base, uint16_t interruptSource);
+void EPWM_setInterruptEventCount(uint32_t base, uint16_t eventCount);
+void EPWM_enableInterrupt(uint32_t base);
+void EPWM_disableInterrupt(uint32_t base);
+bool EPWM_getEventTriggerInterruptStatus(uint32_t base);
+void EPWM_clearEventTriggerInterruptFlag(uint32_t base);
+void EPWM_enableADCTrigger(uint32_t base, EPWM_ADCStartOfConversionType adcSOCType);
+void EPWM_disableADCTrigger(uint32_t base, EPWM_ADCStartOfConversionType adcSOCType);
+void EPWM_setADCTriggerSource(uint32_t base, EPWM_ADCStartOfConversionType adcSOCType, EPWM_ADCStartOfConversionSource socSource);
+void EPWM_setADCTriggerEventPrescale(uint32_t base, EPWM_ADCStartOfConversionType adcSOCType, uint16_t preScaleCount);
+bool EPWM_getADCTriggerFlagStatus(uint32_t base, EPWM_ADCStartOfConversionType adcSOCType);
+void EPWM_clearADCTriggerFlag(uint32_t base, EPWM_ADCStartOfConversionType adcSOCType);
+
+#endif
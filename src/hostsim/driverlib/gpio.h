@@ -0,0 +1,23 @@
+#ifndef GPIO_H
+#define GPIO_H
+
+#include "hostSim.h"
+
+typedef enum {
+    GPIO_DIR_MODE_IN,
+    GPIO_DIR_MODE_OUT
+} GPIO_Direction;
+
+#define GPIO_PIN_TYPE_STD 0x0000U
+#define GPIO_PIN_TYPE_PULLUP 0x0001U
+#define GPIO_PIN_TYPE_INVERT 0x0002U
+#define GPIO_PIN_TYPE_OD 0x0004U
+
+void GPIO_setPadConfig(uint32_t pin, uint32_t pinType);
+void GPIO_setDirectionMode(uint32_t pin, GPIO_Direction pinIO);
+void GPIO_setPinConfig(uint32_t pinConfig);
+void GPIO_writePin(uint32_t pin, uint32_t outVal);
+uint32_t GPIO_readPin(uint32_t pin);
+void GPIO_togglePin(uint32_t pin);
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef HW_ADC_H
+#define HW_ADC_H
+
+// Host simulation: result register offsets from ADCxRESULT_BASE, used as DMA sources
+
+#define ADC_O_RESULT0 0x0U
+#define ADC_O_RESULT1 0x1U
+#define ADC_O_RESULT2 0x2U
+#define ADC_O_RESULT3 0x3U
+#define ADC_O_RESULT4 0x4U
+#define ADC_O_RESULT5 0x5U
+#define ADC_O_RESULT6 0x6U
+#define ADC_O_RESULT7 0x7U
+#define ADC_O_RESULT8 0x8U
+#define ADC_O_RESULT9 0x9U
+#define ADC_O_RESULT10 0xAU
+#define ADC_O_RESULT11 0xBU
+#define ADC_O_RESULT12 0xCU
+#define ADC_O_RESULT13 0xDU
+#define ADC_O_RESULT14 0xEU
+#define ADC_O_RESULT15 0xFU
+
+#endif
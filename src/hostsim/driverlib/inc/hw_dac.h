@@ -0,0 +1,14 @@
+#ifndef HW_DAC_H
+#define HW_DAC_H
+
+// Host simulation: register offsets from DACx_BASE, DACVALS used as a DMA destination
+
+#define DAC_O_REV 0x0U
+#define DAC_O_CTL 0x1U
+#define DAC_O_VALA 0x2U
+#define DAC_O_VALS 0x3U
+#define DAC_O_OUTEN 0x4U
+#define DAC_O_LOCK 0x5U
+#define DAC_O_TRIM 0x6U
+
+#endif
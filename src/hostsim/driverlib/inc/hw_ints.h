@@ -0,0 +1,52 @@
+#ifndef HW_INTS_H
+#define HW_INTS_H
+
+// Host simulation: interrupt number = (PIE group << 8) | channel
+// Groups 13 and 14 are the CPU timer 1 and 2 lines, outside the PIE
+
+#define INT_ADCA1 0x0101U
+#define INT_ADCB1 0x0102U
+#define INT_ADCC1 0x0103U
+#define INT_ADCD1 0x0106U
+#define INT_TIMER0 0x0107U
+#define INT_IPC_0 0x010DU
+#define INT_IPC_1 0x010EU
+#define INT_IPC_2 0x010FU
+#define INT_IPC_3 0x0110U
+
+#define INT_EPWM1 0x0301U
+#define INT_EPWM2 0x0302U
+#define INT_EPWM3 0x0303U
+#define INT_EPWM4 0x0304U
+#define INT_EPWM5 0x0305U
+#define INT_EPWM6 0x0306U
+
+#define INT_DMA_CH1 0x0701U
+#define INT_DMA_CH2 0x0702U
+#define INT_DMA_CH3 0x0703U
+#define INT_DMA_CH4 0x0704U
+#define INT_DMA_CH5 0x0705U
+#define INT_DMA_CH6 0x0706U
+
+#define INT_SCIA_RX 0x0901U
+#define INT_SCIA_TX 0x0902U
+#define INT_SCIB_RX 0x0903U
+#define INT_SCIB_TX 0x0904U
+
+#define INT_ADCA2 0x0A02U
+#define INT_ADCA3 0x0A03U
+#define INT_ADCA4 0x0A04U
+#define INT_ADCB2 0x0A06U
+#define INT_ADCB3 0x0A07U
+#define INT_ADCB4 0x0A08U
+#define INT_ADCC2 0x0A0AU
+#define INT_ADCC3 0x0A0BU
+#define INT_ADCC4 0x0A0CU
+#define INT_ADCD2 0x0A0EU
+#define INT_ADCD3 0x0A0FU
+#define INT_ADCD4 0x0A10U
+
+#define INT_TIMER1 0x0D00U
+#define INT_TIMER2 0x0E00U
+
+#endif
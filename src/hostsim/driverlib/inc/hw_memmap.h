@@ -0,0 +1,50 @@
+#ifndef HW_MEMMAP_H
+#define HW_MEMMAP_H
+
+// Host simulation: same base addresses as the F2837xD, used only as peripheral identifiers
+
+#define CPUTIMER0_BASE 0x00000C00U
+#define CPUTIMER1_BASE 0x00000C08U
+#define CPUTIMER2_BASE 0x00000C10U
+
+#define ADCARESULT_BASE 0x00000B00U
+#define ADCBRESULT_BASE 0x00000B20U
+#define ADCCRESULT_BASE 0x00000B40U
+#define ADCDRESULT_BASE 0x00000B60U
+
+#define DMA_BASE 0x00001000U
+#define DMA_CH1_BASE 0x00001020U
+#define DMA_CH2_BASE 0x00001040U
+#define DMA_CH3_BASE 0x00001060U
+#define DMA_CH4_BASE 0x00001080U
+#define DMA_CH5_BASE 0x000010A0U
+#define DMA_CH6_BASE 0x000010C0U
+
+#define EPWM1_BASE 0x00004000U
+#define EPWM2_BASE 0x00004100U
+#define EPWM3_BASE 0x00004200U
+#define EPWM4_BASE 0x00004300U
+#define EPWM5_BASE 0x00004400U
+#define EPWM6_BASE 0x00004500U
+#define EPWM7_BASE 0x00004600U
+#define EPWM8_BASE 0x00004700U
+#define EPWM9_BASE 0x00004800U
+#define EPWM10_BASE 0x00004900U
+#define EPWM11_BASE 0x00004A00U
+#define EPWM12_BASE 0x00004B00U
+
+#define DACA_BASE 0x00005C00U
+#define DACB_BASE 0x00005C10U
+#define DACC_BASE 0x00005C20U
+
+#define SCIA_BASE 0x00007200U
+#define SCIB_BASE 0x00007210U
+#define SCIC_BASE 0x00007220U
+#define SCID_BASE 0x00007230U
+
+#define ADCA_BASE 0x00007400U
+#define ADCB_BASE 0x00007480U
+#define ADCC_BASE 0x00007500U
+#define ADCD_BASE 0x00007580U
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef HW_TYPES_H
+#define HW_TYPES_H
+
+// Host simulation: no memory-mapped registers, peripherals are reached through driverlib calls only
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef INTERRUPT_H
+#define INTERRUPT_H
+
+#include "hostSim.h"
+
+// PIE acknowledge masks, one bit per group
+#define INTERRUPT_ACK_GROUP1 0x0001U
+#define INTERRUPT_ACK_GROUP2 0x0002U
+#define INTERRUPT_ACK_GROUP3 0x0004U
+#define INTERRUPT_ACK_GROUP4 0x0008U
+#define INTERRUPT_ACK_GROUP5 0x0010U
+#define INTERRUPT_ACK_GROUP6 0x0020U
+#define INTERRUPT_ACK_GROUP7 0x0040U
+#define INTERRUPT_ACK_GROUP8 0x0080U
+#define INTERRUPT_ACK_GROUP9 0x0100U
+#define INTERRUPT_ACK_GROUP10 0x0200U
+#define INTERRUPT_ACK_GROUP11 0x0400U
+#define INTERRUPT_ACK_GROUP12 0x0800U
+
+void Interrupt_initModule(void);
+void Interrupt_initVectorTable(void);
+void Interrupt_register(uint32_t interruptNumber, void (*handler)(void));
+void Interrupt_unregister(uint32_t interruptNumber);
+void Interrupt_enable(uint32_t interruptNumber);
+void Interrupt_disable(uint32_t interruptNumber);
+void Interrupt_clearACKGroup(uint16_t group);
+
+static inline bool Interrupt_enableMaster(void) {
+    return HostSim_enableGlobalInterrupts();
+}
+
+static inline bool Interrupt_disableMaster(void) {
+    return HostSim_disableGlobalInterrupts();
+}
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef IPC_H
+#define IPC_H
+
+#include "hostSim.h"
+
+// Host simulation: 32 flags each way between CPU1 and CPU2, flags 0 to 3 interrupt the other core
+
+typedef enum {
+    IPC_CPU1_L_CPU2_R, // Code running on CPU1
+    IPC_CPU2_L_CPU1_R // Code running on CPU2
+} IPC_Type_t;
+
+#define IPC_FLAG0 0x00000001UL
+#define IPC_FLAG1 0x00000002UL
+#define IPC_FLAG2 0x00000004UL
+#define IPC_FLAG3 0x00000008UL
+#define IPC_FLAG4 0x00000010UL
+#define IPC_FLAG31 0x80000000UL
+
+// Interrupts of flags 0 to 3 (INT_IPC_0 to INT_IPC_3)
+#define IPC_INT0 0U
+#define IPC_INT1 1U
+#define IPC_INT2 2U
+#define IPC_INT3 3U
+
+void IPC_setFlagLtoR(IPC_Type_t ipcType, uint32_t flags);
+void IPC_clearFlagLtoR(IPC_Type_t ipcType, uint32_t flags);
+void IPC_ackFlagRtoL(IPC_Type_t ipcType, uint32_t flags);
+bool IPC_isFlagBusyLtoR(IPC_Type_t ipcType, uint32_t flags);
+bool IPC_isFlagBusyRtoL(IPC_Type_t ipcType, uint32_t flags);
+void IPC_waitForFlag(IPC_Type_t ipcType, uint32_t flags);
+void IPC_waitForAck(IPC_Type_t ipcType, uint32_t flags);
+// Both cores meet here: returns once the other core has reached its IPC_sync on the same flag
+void IPC_sync(IPC_Type_t ipcType, uint32_t flag);
+// Free-running SYSCLK counter shared by both cores
+uint64_t IPC_getCounter(IPC_Type_t ipcType);
+// Registers and enables the PIE vector of an IPC interrupt on the calling core
+void IPC_registerInterrupt(IPC_Type_t ipcType, uint32_t ipcInt, void (*pfnHandler)(void));
+
+#endif
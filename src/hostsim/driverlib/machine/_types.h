@@ -0,0 +1,8 @@
+#ifndef MACHINE__TYPES_H
+#define MACHINE__TYPES_H
+
+// Host simulation: the C28x compiler types come from the host <stdint.h>
+
+#include <stdint.h>
+
+#endif
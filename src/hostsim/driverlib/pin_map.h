@@ -0,0 +1,23 @@
+#ifndef PIN_MAP_H
+#define PIN_MAP_H
+
+// Host simulation: pin configuration = (pin << 8) | mux position
+
+#define GPIO_0_GPIO0 0x00000000UL
+#define GPIO_0_EPWM1A 0x00000001UL
+#define GPIO_1_GPIO1 0x00000100UL
+#define GPIO_1_EPWM1B 0x00000101UL
+#define GPIO_2_GPIO2 0x00000200UL
+#define GPIO_2_EPWM2A 0x00000201UL
+#define GPIO_3_GPIO3 0x00000300UL
+#define GPIO_3_EPWM2B 0x00000301UL
+#define GPIO_4_GPIO4 0x00000400UL
+#define GPIO_4_EPWM3A 0x00000401UL
+#define GPIO_5_GPIO5 0x00000500UL
+#define GPIO_5_EPWM3B 0x00000501UL
+#define GPIO_42_GPIO42 0x00002A00UL
+#define GPIO_42_SCITXDA 0x00002A0FUL
+#define GPIO_43_GPIO43 0x00002B00UL
+#define GPIO_43_SCIRXDA 0x00002B0FUL
+
+#endif
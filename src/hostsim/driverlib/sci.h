@@ -0,0 +1,63 @@
+#ifndef SCI_H
+#define SCI_H
+
+#include "hostSim.h"
+
+#define SCI_CONFIG_WLEN_MASK 0x0007U
+#define SCI_CONFIG_WLEN_8 0x0007U
+#define SCI_CONFIG_WLEN_7 0x0006U
+#define SCI_CONFIG_WLEN_6 0x0005U
+#define SCI_CONFIG_WLEN_5 0x0004U
+#define SCI_CONFIG_STOP_MASK 0x0080U
+#define SCI_CONFIG_STOP_ONE 0x0000U
+#define SCI_CONFIG_STOP_TWO 0x0080U
+#define SCI_CONFIG_PAR_MASK 0x0060U
+#define SCI_CONFIG_PAR_NONE 0x0000U
+#define SCI_CONFIG_PAR_EVEN 0x0060U
+#define SCI_CONFIG_PAR_ODD 0x0020U
+
+#define SCI_INT_RXERR 0x01U
+#define SCI_INT_RXRDY_BRKDT 0x02U
+#define SCI_INT_TXRDY 0x04U
+#define SCI_INT_TXFF 0x08U
+#define SCI_INT_RXFF 0x10U
+#define SCI_INT_FE 0x20U
+#define SCI_INT_OE 0x40U
+#define SCI_INT_PE 0x80U
+
+typedef enum {
+    SCI_FIFO_TX0, SCI_FIFO_TX1, SCI_FIFO_TX2, SCI_FIFO_TX3, SCI_FIFO_TX4, SCI_FIFO_TX5, SCI_FIFO_TX6, SCI_FIFO_TX7,
+    SCI_FIFO_TX8, SCI_FIFO_TX9, SCI_FIFO_TX10, SCI_FIFO_TX11, SCI_FIFO_TX12, SCI_FIFO_TX13, SCI_FIFO_TX14, SCI_FIFO_TX15,
+    SCI_FIFO_TX16
+} SCI_TxFIFOLevel;
+
+typedef enum {
+    SCI_FIFO_RX0, SCI_FIFO_RX1, SCI_FIFO_RX2, SCI_FIFO_RX3, SCI_FIFO_RX4, SCI_FIFO_RX5, SCI_FIFO_RX6, SCI_FIFO_RX7,
+    SCI_FIFO_RX8, SCI_FIFO_RX9, SCI_FIFO_RX10, SCI_FIFO_RX11, SCI_FIFO_RX12, SCI_FIFO_RX13, SCI_FIFO_RX14, SCI_FIFO_RX15,
+    SCI_FIFO_RX16
+} SCI_RxFIFOLevel;
+
+void SCI_setConfig(uint32_t base, uint32_t lspclkHz, uint32_t baud, uint32_t config);
+void SCI_enableModule(uint32_t base);
+void SCI_disableModule(uint32_t base);
+void SCI_resetChannels(uint32_t base);
+void SCI_performSoftwareReset(uint32_t base);
+void SCI_enableFIFO(uint32_t base);
+void SCI_disableFIFO(uint32_t base);
+void SCI_resetTxFIFO(uint32_t base);
+void SCI_resetRxFIFO(uint32_t base);
+void SCI_setFIFOInterruptLevel(uint32_t base, SCI_TxFIFOLevel txLevel, SCI_RxFIFOLevel rxLevel);
+SCI_TxFIFOLevel SCI_getTxFIFOStatus(uint32_t base);
+SCI_RxFIFOLevel SCI_getRxFIFOStatus(uint32_t base);
+void SCI_enableInterrupt(uint32_t base, uint32_t intFlags);
+void SCI_disableInterrupt(uint32_t base, uint32_t intFlags);
+uint32_t SCI_getInterruptStatus(uint32_t base);
+void SCI_clearInterruptStatus(uint32_t base, uint32_t intFlags);
+void SCI_clearOverflowStatus(uint32_t base);
+void SCI_writeCharNonBlocking(uint32_t base, uint16_t data);
+void SCI_writeCharBlockingFIFO(uint32_t base, uint16_t data);
+void SCI_writeCharArray(uint32_t base, const uint16_t * const array, uint16_t length);
+uint16_t SCI_readCharNonBlocking(uint32_t base);
+uint16_t SCI_readCharBlockingFIFO(uint32_t base);
+
+#endif
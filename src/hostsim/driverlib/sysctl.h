@@ -0,0 +1,56 @@
+#ifndef SYSCTL_H
+#define SYSCTL_H
+
+#include "hostSim.h"
+
+// Host simulation: clocks are always running, resets clear the simulated state
+
+typedef enum {
+    SYSCTL_PERIPH_CLK_EPWM1 = 0x0002,
+    SYSCTL_PERIPH_CLK_EPWM2 = 0x0102,
+    SYSCTL_PERIPH_CLK_EPWM3 = 0x0202,
+    SYSCTL_PERIPH_CLK_EPWM4 = 0x0302,
+    SYSCTL_PERIPH_CLK_EPWM5 = 0x0402,
+    SYSCTL_PERIPH_CLK_EPWM6 = 0x0502,
+    SYSCTL_PERIPH_CLK_TBCLKSYNC = 0x1200,
+    SYSCTL_PERIPH_CLK_ADCA = 0x000D,
+    SYSCTL_PERIPH_CLK_ADCB = 0x010D,
+    SYSCTL_PERIPH_CLK_ADCC = 0x020D,
+    SYSCTL_PERIPH_CLK_ADCD = 0x030D,
+    SYSCTL_PERIPH_CLK_DACA = 0x1010,
+    SYSCTL_PERIPH_CLK_DACB = 0x1110,
+    SYSCTL_PERIPH_CLK_DACC = 0x1210,
+    SYSCTL_PERIPH_CLK_SCIA = 0x0007,
+    SYSCTL_PERIPH_CLK_SCIB = 0x0107,
+    SYSCTL_PERIPH_CLK_SCIC = 0x0207,
+    SYSCTL_PERIPH_CLK_SCID = 0x0307
+} SysCtl_PeripheralPCLOCKCR;
+
+typedef enum {
+    SYSCTL_PERIPH_RES_EPWM1 = 0x0002,
+    SYSCTL_PERIPH_RES_ADCA = 0x000D,
+    SYSCTL_PERIPH_RES_ADCB = 0x010D,
+    SYSCTL_PERIPH_RES_ADCC = 0x020D,
+    SYSCTL_PERIPH_RES_ADCD = 0x030D
+} SysCtl_PeripheralSOFTPRES;
+
+// Peripheral ownership between the cores, only the ADCs are routed in the simulation
+typedef enum {
+    SYSCTL_CPUSEL0_EPWM = 0,
+    SYSCTL_CPUSEL5_SCI = 5,
+    SYSCTL_CPUSEL11_ADC = 11
+} SysCtl_CPUSelPeriphInstance;
+
+typedef enum {
+    SYSCTL_CPUSEL_CPU1 = 0,
+    SYSCTL_CPUSEL_CPU2 = 1
+} SysCtl_CPUSel;
+
+void SysCtl_enablePeripheral(SysCtl_PeripheralPCLOCKCR peripheral);
+void SysCtl_disablePeripheral(SysCtl_PeripheralPCLOCKCR peripheral);
+void SysCtl_resetPeripheral(SysCtl_PeripheralSOFTPRES peripheral);
+void SysCtl_delay(uint32_t count);
+// peripheralInst counts from 1 (1 is ADCA); run on CPU1 before the other core configures it
+void SysCtl_selectCPUForPeripheral(SysCtl_CPUSelPeriphInstance peripheral, uint16_t peripheralInst, SysCtl_CPUSel cpuInst);
+
+#endif
@@ -0,0 +1,3540 @@
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <complex.h>
+#include <math.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+/*------------------------------DRIVERLIB (HOST SIMULATION)------------------------------*/
+
+#include "hostSim.h"
+#include "adc.h"
+#include "cputimer.h"
+#include "dac.h"
+#include "device.h"
+#include "dma.h"
+#include "epwm.h"
+#include "gpio.h"
+#include "interrupt.h"
+#include "ipc.h"
+#include "sci.h"
+#include "sysctl.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+
+/*------------------------------PROJECT LIBRARIES------------------------------*/
+
+#include "bode.h"
+#include "report.h"
+
+// The target is built with -Dmain=HostSim_targetMain, the simulator keeps the real entry point
+#undef main
+
+/*------------------------------MACROS------------------------------*/
+
+#define GROUPS 15 // PIE groups 1 to 12, CPU timer 1 and 2 lines as groups 13 and 14
+#define CHANNELS 17 // PIE channels 1 to 16, channel 0 for the non-PIE lines
+#define TIMERS 3
+#define DACS 3
+#define DAC_CAPTURE 65536U // Last writes of each DAC kept for the spectrum, power of two
+#define SPECTRUM_MAX_POINTS 1048576U
+#define ADCS 4
+#define SOCS 16
+#define ADC_INTS 4
+#define EPWMS 12
+#define GPIOS 169
+#define DMA_CHANNELS 6
+#define SCIS 4
+#define SCI_FIFO_DEPTH 16U
+#define EVENTS 512
+#define CPUS 2
+#define IPC_INTERRUPT_FLAGS 4U // IPC flags 0 to 3 interrupt the other core
+
+#define NO_EVENT UINT64_MAX
+
+// Addresses below this are C28x peripheral registers (16-bit word addressing)
+#define PERIPHERAL_SPACE 0x100000U
+
+// 12-bit conversion time in ADC clocks, acquisition window excluded
+#define ADC_CONVERSION_ADCCLKS 11
+// ADCINB3 wired to the EPWM1A pin whatever the ADC source: the switching node, a high output reads full scale
+#define SWITCH_NODE_ADC 1U
+#define SWITCH_NODE_CHANNEL 3U
+#define PLANT_IMAGES 2000 // Stimulus images summed into the sampled plant response
+
+/*------------------------------TYPES------------------------------*/
+
+typedef struct {
+    void (*handler)(void);
+    bool enabled;
+    bool pending;
+    uint64_t calls;
+    uint64_t overruns; // Raised again while still pending
+    uint64_t totalNanoseconds;
+    uint64_t maxNanoseconds;
+} HostSim_Vector;
+
+// One C28x core: its PIE, its interrupt mask and the thread running its program
+typedef struct {
+    HostSim_Vector vectors[GROUPS][CHANNELS];
+    uint16_t pieBlockedGroups; // Groups waiting for Interrupt_clearACKGroup
+    // Held by whoever owns the core: its target while INTM is set, the hardware thread while one of its ISRs runs
+    pthread_mutex_t mutex;
+    volatile bool masksInterrupts;
+    volatile bool delaying;
+    volatile bool waitingIPC; // Spinning on the other core: its pending ISRs must not stall the hardware
+    volatile bool started;
+    volatile bool finished;
+    uint64_t delayWake;
+    uint64_t interruptStartNanoseconds; // Host time the running ISR started
+    // Startup: from the target entry to the first EINT, target thread CPU time
+    uint64_t startNanoseconds;
+    uint64_t startupNanoseconds;
+    uint64_t startupCycles;
+    bool startupDone;
+} HostSim_CPU;
+
+typedef struct {
+    uint32_t period; // PRD
+    uint16_t prescaler; // TPR, clock divided by TPR + 1
+    bool running;
+    bool interruptEnabled;
+    bool overflow; // TIF
+    uint32_t frozenCount;
+    uint64_t reloadCycle;
+    uint64_t nextExpiry;
+    uint64_t expiries;
+} HostSim_Timer;
+
+typedef struct {
+    bool outputEnabled;
+    uint16_t loadMode;
+    uint16_t shadow;
+    uint16_t active;
+    uint64_t writes;
+    uint16_t minimum;
+    uint16_t maximum;
+    double sum;
+    // Mid-level crossing tracking for the frequency estimate
+    bool high;
+    uint64_t crossings;
+    uint64_t firstCrossing;
+    uint64_t lastCrossing;
+} HostSim_DAC;
+
+typedef struct {
+    bool converterEnabled;
+    uint16_t prescale;
+    uint16_t resolution;
+    uint16_t pulseMode;
+    uint16_t socChannel[SOCS];
+    uint16_t socTrigger[SOCS];
+    uint32_t socWindow[SOCS];
+    uint16_t socInterruptTrigger[SOCS];
+    uint16_t result[SOCS];
+    uint16_t interruptSource[ADC_INTS];
+    bool interruptEnabled[ADC_INTS];
+    bool interruptContinuous[ADC_INTS];
+    bool interruptFlag[ADC_INTS];
+    bool interruptOverflow[ADC_INTS];
+    uint16_t cpu; // Owner, receives the interrupts
+    uint64_t busyUntil;
+    uint64_t conversions;
+    uint64_t overflows;
+} HostSim_ADC;
+
+// Event-trigger output, counting its source events down to a pulse
+typedef struct {
+    uint16_t source;
+    uint16_t prescale; // Events per pulse, 0 disables it
+    uint16_t events;
+    bool enabled;
+    bool flag;
+    uint64_t next;
+    uint64_t pulses;
+    uint64_t missed; // Interrupt events while the flag was still set
+} HostSim_EPWMTrigger;
+
+#define EPWM_TRIGGER_INT 0U
+#define EPWM_TRIGGER_SOCA 1U
+#define EPWM_TRIGGER_SOCB 2U
+#define EPWM_TRIGGERS 3U
+
+typedef struct {
+    bool clockEnabled;
+    uint16_t clockDivider;
+    uint16_t highSpeedDivider;
+    uint16_t counterMode;
+    uint16_t period;
+    uint16_t counter;
+    uint16_t phase;
+    uint16_t compare[4]; // A, B, C, D
+    uint16_t actions[2][6]; // Output A/B, event zero/period/CMPA up/down/CMPB up/down
+    uint64_t periodWrites;
+    uint64_t compareWrites;
+    // Time base: a carrier period starts at originCycle and every whole period from it
+    bool counting;
+    uint64_t originCycle;
+    uint16_t syncOutMode;
+    bool phaseLoad;
+    uint16_t countAfterSync;
+    // Dead-band submodule: RED drives output A, FED output B
+    bool risingDelayEnabled;
+    bool fallingDelayEnabled;
+    bool risingInverted;
+    bool fallingInverted;
+    uint16_t risingInput; // EPWM_DB_INPUT_EPWMA or EPWMB
+    uint16_t fallingInput;
+    bool halfCycleDelay;
+    uint16_t risingDelay;
+    uint16_t fallingDelay;
+    // Event trigger: the interrupt, SOCA and SOCB
+    HostSim_EPWMTrigger triggers[EPWM_TRIGGERS];
+    // Switching pattern of the final outputs, checked after every ISR that changed it
+    uint64_t checks;
+    uint64_t switchingChecks; // Checks with both outputs switching
+    double minimumDeadTime; // Seconds both outputs were low around a transition
+    double maximumOverlap; // Seconds both outputs were high in a carrier period (shoot-through)
+    double lag; // Degrees behind EPWM1
+} HostSim_EPWM;
+
+// High intervals of an output over one carrier period, in time-base counts
+#define WAVE_INTERVALS 16
+
+typedef struct {
+    unsigned count;
+    double start[WAVE_INTERVALS]; // In [0, span)
+    double length[WAVE_INTERVALS];
+    double span; // Carrier period
+} HostSim_Wave;
+
+typedef struct {
+    bool output;
+    uint32_t state;
+    uint32_t muxPosition;
+    uint64_t toggles;
+    uint64_t writes;
+} HostSim_GPIO;
+
+typedef struct {
+    // Shadow registers, copied to the active ones when a transfer starts
+    uintptr_t sourceShadow;
+    uintptr_t destinationShadow;
+    uintptr_t source;
+    uintptr_t destination;
+    uintptr_t sourceBegin;
+    uintptr_t destinationBegin;
+    uint16_t burstSize;
+    int16_t sourceBurstStep;
+    int16_t destinationBurstStep;
+    uint32_t transferSize;
+    int16_t sourceTransferStep;
+    int16_t destinationTransferStep;
+    uint32_t sourceWrapSize;
+    uint32_t destinationWrapSize;
+    int16_t sourceWrapStep;
+    int16_t destinationWrapStep;
+    uint32_t sourceWrapLeft;
+    uint32_t destinationWrapLeft;
+    uint16_t trigger;
+    uint32_t mode;
+    bool interruptAtEnd;
+    bool interruptEnabled;
+    bool triggerEnabled;
+    bool running;
+    bool transferActive;
+    uint32_t burstsLeft;
+    uint64_t bursts;
+    uint64_t transfers;
+} HostSim_DMA;
+
+typedef struct {
+    bool enabled;
+    bool fifoEnabled;
+    uint32_t baud; // Actual rate from the BRR divider
+    uint16_t bitsPerCharacter; // Start, data, parity and stop bits
+    uint16_t txFifo[SCI_FIFO_DEPTH];
+    uint16_t txHead;
+    uint16_t txCount;
+    bool shifting; // A character is in the transmit shift register
+    uint16_t shiftRegister;
+    uint16_t txLevel;
+    uint16_t rxLevel;
+    uint32_t interruptEnabled;
+    bool txFifoFlag; // TXFFINT
+    uint64_t bytesSent;
+    uint64_t firstByteCycle;
+    uint64_t lastByteCycle;
+    uint64_t txOverflows; // Writes to a full FIFO, lost
+    uint64_t sinkDrops; // Bytes the output could not take (pty nobody reads)
+    uint16_t rxFifo[SCI_FIFO_DEPTH];
+    uint16_t rxHead;
+    uint16_t rxCount;
+    bool rxFifoFlag; // RXFFINT
+    bool rxOverflow; // RXFFOVF, until SCI_clearOverflowStatus
+    bool receiving; // Reception event scheduled
+    uint64_t bytesReceived;
+    uint64_t rxOverflows; // Characters lost on a full FIFO
+} HostSim_SCI;
+
+typedef enum {
+    EVENT_ADC_SAMPLE,
+    EVENT_ADC_END_OF_CONVERSION,
+    EVENT_SCI_TRANSMITTED,
+    EVENT_SCI_RECEIVED
+} HostSim_EventType;
+
+typedef struct {
+    HostSim_EventType type;
+    uint64_t cycle;
+    uint64_t order; // Scheduling order, keeps events of the same cycle first in first out
+    uint16_t module;
+    uint16_t soc;
+} HostSim_Event;
+
+/*------------------------------STATE------------------------------*/
+
+// Scheduler lock, protects the clock, timers, ADCs and the event list
+static pthread_mutex_t simMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t hardwareCondition = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t targetCondition = PTHREAD_COND_INITIALIZER;
+
+// CPU1 runs HostSim_targetMain from the start, CPU2 runs HostSim_cpu2Main once Device_bootCPU2 is called
+static HostSim_CPU cpus[CPUS] = {
+    {.mutex = PTHREAD_MUTEX_INITIALIZER, .delayWake = NO_EVENT},
+    {.mutex = PTHREAD_MUTEX_INITIALIZER, .delayWake = NO_EVENT}
+};
+static volatile bool simulationEnded;
+static __thread bool inInterrupt;
+static __thread unsigned cpuIndex; // Core the calling thread runs code of: its target, or the hardware thread in one of its ISRs
+
+static volatile uint64_t cycles;
+static uint64_t endCycle;
+static HostSim_Timer timers[TIMERS];
+static HostSim_DAC dacs[DACS];
+// Time and value of the last DAC_CAPTURE writes of each DAC, indexed by write count
+static uint64_t dacCaptureCycles[DACS][DAC_CAPTURE];
+static uint16_t dacCaptureValues[DACS][DAC_CAPTURE];
+static double minimumSINAD[DACS]; // dB, -n; 0 leaves a DAC unchecked
+static HostSim_ADC adcs[ADCS];
+static HostSim_EPWM epwms[EPWMS];
+static bool tbclkSync = true; // Device_init leaves the time-base clocks running
+static volatile bool epwmOutputsChanged; // Switching pattern to check after the running ISR
+static volatile uint32_t epwmOutputsSequence; // Bumped with every change of the outputs, for cached waves
+static volatile bool deliveryDue; // An ISR may be taken: raised, enabled, acknowledged or unmasked since the last pass
+static HostSim_GPIO gpios[GPIOS];
+static HostSim_DMA dmas[DMA_CHANNELS];
+static HostSim_SCI scis[SCIS];
+// IPC flags each core raises towards the other, IPCSET and IPCFLG as seen by the other side
+static volatile uint32_t ipcFlags[CPUS];
+static uint64_t ipcFlagsSet[CPUS];
+static int sciOutput = -1; // SCI-A transmit stream, file or pty master
+static bool sciInput; // SCI-A also receives what the host writes to the pty
+static HostSim_Event events[EVENTS]; // Binary min-heap on cycle then order
+static unsigned eventCount;
+static uint64_t eventOrder;
+static uint64_t droppedEvents;
+
+static HostSim_ADCSource adcSource = HostSim_loopbackSource;
+static void *adcSourceContext;
+static HostSim_SineParameters sineParameters = {60.0, 2000.0, 2048.0};
+static HostSim_PlantParameters plantParameters;
+static FILE *traceFile;
+static double pace; // Virtual seconds per host second, 0 runs unpaced
+static uint64_t paceStart; // Host time of virtual cycle 0 in a paced run
+#define PACE_MAX_LAG 1000000U // ns behind the pace before paced time slips
+static uint64_t stalls; // Times paced time slipped
+static uint64_t lastObserved; // Latest count observedCycles handed out, counters never run backwards
+
+static const uint32_t adcInterrupts[ADCS][ADC_INTS] = {
+    {INT_ADCA1, INT_ADCA2, INT_ADCA3, INT_ADCA4},
+    {INT_ADCB1, INT_ADCB2, INT_ADCB3, INT_ADCB4},
+    {INT_ADCC1, INT_ADCC2, INT_ADCC3, INT_ADCC4},
+    {INT_ADCD1, INT_ADCD2, INT_ADCD3, INT_ADCD4}
+};
+
+static const uint32_t timerInterrupts[TIMERS] = {INT_TIMER0, INT_TIMER1, INT_TIMER2};
+
+static const uint32_t ipcInterrupts[IPC_INTERRUPT_FLAGS] = {INT_IPC_0, INT_IPC_1, INT_IPC_2, INT_IPC_3};
+
+// EPWMxSYNCI sources: EPWM1 chains to 2 and 3 and feeds the heads of the 4, 7 and 10 chains
+static const int syncSources[EPWMS] = {-1, 0, 1, 0, 3, 4, 0, 6, 7, 0, 9, 10};
+
+static const uint32_t dmaInterrupts[DMA_CHANNELS] = {INT_DMA_CH1, INT_DMA_CH2, INT_DMA_CH3, INT_DMA_CH4, INT_DMA_CH5, INT_DMA_CH6};
+
+// SCI-C and SCI-D transmit interrupts are in PIE group 8
+static const uint32_t sciTxInterrupts[SCIS] = {INT_SCIA_TX, INT_SCIB_TX, 0x0806U, 0x0808U};
+static const uint32_t sciRxInterrupts[SCIS] = {INT_SCIA_RX, INT_SCIB_RX, 0x0805U, 0x0807U};
+
+/*------------------------------HELPERS------------------------------*/
+
+// CPU time of the calling thread, host waits excluded
+static uint64_t threadNanoseconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+static uint64_t hostNanoseconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+static void trace(const char *peripheral, unsigned index, const char *field, unsigned long value) {
+    if (traceFile != NULL) {
+        fprintf(traceFile, "%llu,%s,%u,%s,%lu\n", (unsigned long long)cycles, peripheral, index, field, value);
+    }
+}
+
+static HostSim_Vector *vectorOf(unsigned cpu, uint32_t interruptNumber) {
+    const uint32_t group = (interruptNumber >> 8) & 0xFFU;
+    const uint32_t channel = interruptNumber & 0xFFU;
+    if (group >= GROUPS || channel >= CHANNELS) {
+        fprintf(stderr, "hostsim: unknown interrupt number 0x%04X\n", (unsigned)interruptNumber);
+        abort();
+    }
+    return &cpus[cpu].vectors[group][channel];
+}
+
+static unsigned indexOf(uint32_t base, uint32_t first, uint32_t stride, unsigned count, const char *name) {
+    const unsigned index = (base - first) / stride;
+    if (base < first || (base - first) % stride != 0U || index >= count) {
+        fprintf(stderr, "hostsim: bad %s base 0x%08X\n", name, (unsigned)base);
+        abort();
+    }
+    return index;
+}
+
+#define TIMER_OF(base) (&timers[indexOf((base), CPUTIMER0_BASE, 8U, TIMERS, "CPU timer")])
+#define DAC_OF(base) (&dacs[indexOf((base), DACA_BASE, 0x10U, DACS, "DAC")])
+#define ADC_INDEX(base) indexOf((base), ADCA_BASE, 0x80U, ADCS, "ADC")
+#define DMA_OF(base) (&dmas[indexOf((base), DMA_CH1_BASE, 0x20U, DMA_CHANNELS, "DMA channel")])
+#define EPWM_INDEX(base) indexOf((base), EPWM1_BASE, 0x100U, EPWMS, "EPWM")
+#define SCI_INDEX(base) indexOf((base), SCIA_BASE, 0x10U, SCIS, "SCI")
+
+// Peripheral interrupt line into the PIE of a core, simMutex held
+static void raiseInterrupt(unsigned cpu, uint32_t interruptNumber) {
+    HostSim_Vector *vector = vectorOf(cpu, interruptNumber);
+    if (vector->pending) {
+        // A flag nobody listens to is not an overrun
+        if (vector->enabled) {
+            vector->overruns ++;
+        }
+    } else {
+        vector->pending = true;
+    }
+    if (vector->enabled) {
+        deliveryDue = true;
+    }
+    pthread_cond_signal(&hardwareCondition);
+}
+
+static bool eventBefore(const HostSim_Event *first, const HostSim_Event *second) {
+    return first->cycle < second->cycle || (first->cycle == second->cycle && first->order < second->order);
+}
+
+// Every ADC SOC of a PWM-triggered sequence is two events, a heap keeps them cheap to queue and pop
+static void scheduleEvent(HostSim_EventType type, uint64_t cycle, uint16_t module, uint16_t soc) {
+    if (eventCount == EVENTS) {
+        droppedEvents ++;
+        return;
+    }
+    const HostSim_Event event = {type, cycle, eventOrder ++, module, soc};
+    unsigned index = eventCount ++;
+    while (index > 0U && eventBefore(&event, &events[(index - 1U) / 2U])) {
+        events[index] = events[(index - 1U) / 2U];
+        index = (index - 1U) / 2U;
+    }
+    events[index] = event;
+    pthread_cond_signal(&hardwareCondition);
+}
+
+static HostSim_Event popEvent(void) {
+    const HostSim_Event first = events[0];
+    const HostSim_Event last = events[-- eventCount];
+    unsigned index = 0U;
+    for (;;) {
+        unsigned child = 2U * index + 1U;
+        if (child >= eventCount) {
+            break;
+        }
+        if (child + 1U < eventCount && eventBefore(&events[child + 1U], &events[child])) {
+            child ++;
+        }
+        if (!eventBefore(&events[child], &last)) {
+            break;
+        }
+        events[index] = events[child];
+        index = child;
+    }
+    if (eventCount > 0U) {
+        events[index] = last;
+    }
+    return first;
+}
+
+static void triggerDMA(uint16_t trigger);
+static uint64_t nextEventCycle(void);
+static uint64_t observedCycles(void);
+static void checkSwitching(void);
+static uint16_t epwmOutputLevel(const HostSim_EPWM *epwm, unsigned output, uint64_t cycle);
+static void markOutputsChanged(void);
+static void advancePlant(HostSim_PlantParameters *plant, double input, double time);
+
+/*------------------------------SIGNAL SOURCES------------------------------*/
+
+void HostSim_setADCSource(HostSim_ADCSource source, void *context) {
+    pthread_mutex_lock(&simMutex);
+    adcSource = source;
+    adcSourceContext = context;
+    pthread_mutex_unlock(&simMutex);
+}
+
+// Every ADC input wired to the DACA output, ADCINB3 excepted (SWITCH_NODE_CHANNEL)
+uint16_t HostSim_loopbackSource(uint32_t adcBase, uint16_t channel, double time, void *context) {
+    (void)adcBase;
+    (void)channel;
+    (void)time;
+    (void)context;
+    return dacs[0].active;
+}
+
+// ADCB and ADCC inputs 120 and 240 degrees behind ADCA's, a three-phase set across the converters (ADCD as ADCA)
+uint16_t HostSim_sineSource(uint32_t adcBase, uint16_t channel, double time, void *context) {
+    const HostSim_SineParameters *parameters = (const HostSim_SineParameters *)context;
+    (void)channel;
+    const double lag = 2.0 * M_PI / 3.0 * (ADC_INDEX(adcBase) % 3U);
+    double value = parameters->offset + parameters->amplitude * sin(2.0 * M_PI * parameters->frequency * time - lag);
+    if (value < 0.0) {
+        value = 0.0;
+    } else if (value > 4095.0) {
+        value = 4095.0;
+    }
+    return (uint16_t)(value + 0.5);
+}
+
+/*------------------------------CLOCK------------------------------*/
+
+uint64_t HostSim_getCycles(void) {
+    return cycles;
+}
+
+double HostSim_getTime(void) {
+    return (double)cycles / HOSTSIM_SYSCLK_FREQ;
+}
+
+static void delayCycles(uint64_t count) {
+    // Time cannot advance inside an ISR, it runs in zero virtual time
+    if (inInterrupt) {
+        return;
+    }
+    HostSim_CPU *cpu = &cpus[cpuIndex];
+    pthread_mutex_lock(&simMutex);
+    cpu->delayWake = cycles + count;
+    cpu->delaying = true;
+    pthread_cond_signal(&hardwareCondition);
+    // Once the run is over the target stays parked here so the report is not disturbed
+    while (cycles < cpu->delayWake || simulationEnded) {
+        pthread_cond_wait(&targetCondition, &simMutex);
+    }
+    cpu->delaying = false;
+    cpu->delayWake = NO_EVENT;
+    // The hardware thread waits for this before moving the clock on
+    pthread_cond_signal(&hardwareCondition);
+    pthread_mutex_unlock(&simMutex);
+}
+
+void HostSim_delayMicroseconds(uint32_t microseconds) {
+    delayCycles((uint64_t)microseconds * (uint64_t)(HOSTSIM_SYSCLK_FREQ / 1000000.0));
+}
+
+/*------------------------------CPU AND PIE------------------------------*/
+
+bool HostSim_enableGlobalInterrupts(void) {
+    HostSim_CPU *cpu = &cpus[cpuIndex];
+    const bool wasMasked = cpu->masksInterrupts;
+    if (!inInterrupt && !cpu->startupDone) {
+        cpu->startupNanoseconds = threadNanoseconds() - cpu->startNanoseconds;
+        cpu->startupCycles = cycles;
+        cpu->startupDone = true;
+    }
+    if (!inInterrupt && cpu->masksInterrupts) {
+        cpu->masksInterrupts = false;
+        deliveryDue = true;
+        pthread_mutex_unlock(&cpu->mutex);
+    }
+    return wasMasked;
+}
+
+bool HostSim_disableGlobalInterrupts(void) {
+    HostSim_CPU *cpu = &cpus[cpuIndex];
+    const bool wasMasked = cpu->masksInterrupts;
+    if (!inInterrupt && !cpu->masksInterrupts) {
+        pthread_mutex_lock(&cpu->mutex);
+        cpu->masksInterrupts = true;
+    }
+    return wasMasked;
+}
+
+void Interrupt_initModule(void) {
+    HostSim_CPU *cpu = &cpus[cpuIndex];
+    unsigned group;
+    unsigned channel;
+    for (group = 0; group < GROUPS; group ++) {
+        for (channel = 0; channel < CHANNELS; channel ++) {
+            cpu->vectors[group][channel].enabled = false;
+            cpu->vectors[group][channel].pending = false;
+        }
+    }
+    cpu->pieBlockedGroups = 0U;
+}
+
+void Interrupt_initVectorTable(void) {
+    HostSim_CPU *cpu = &cpus[cpuIndex];
+    unsigned group;
+    unsigned channel;
+    for (group = 0; group < GROUPS; group ++) {
+        for (channel = 0; channel < CHANNELS; channel ++) {
+            cpu->vectors[group][channel].handler = NULL;
+        }
+    }
+}
+
+void Interrupt_register(uint32_t interruptNumber, void (*handler)(void)) {
+    vectorOf(cpuIndex, interruptNumber)->handler = handler;
+    deliveryDue = true;
+}
+
+void Interrupt_unregister(uint32_t interruptNumber) {
+    vectorOf(cpuIndex, interruptNumber)->handler = NULL;
+}
+
+void Interrupt_enable(uint32_t interruptNumber) {
+    vectorOf(cpuIndex, interruptNumber)->enabled = true;
+    deliveryDue = true;
+}
+
+void Interrupt_disable(uint32_t interruptNumber) {
+    vectorOf(cpuIndex, interruptNumber)->enabled = false;
+}
+
+void Interrupt_clearACKGroup(uint16_t group) {
+    cpus[cpuIndex].pieBlockedGroups &= (uint16_t)~group;
+    deliveryDue = true;
+}
+
+// Takes a core away from its target, fails when the target masks interrupts while waiting on the clock
+static bool acquireCPU(HostSim_CPU *cpu) {
+    while (pthread_mutex_trylock(&cpu->mutex) == EBUSY) {
+        if (cpu->delaying || cpu->waitingIPC || cpu->finished) {
+            return false;
+        }
+        sched_yield();
+    }
+    return true;
+}
+
+// Runs the pending ISRs of one core in PIE priority order until none can be taken
+static void deliverInterruptsOf(unsigned index) {
+    HostSim_CPU *cpu = &cpus[index];
+    bool delivered = true;
+    while (delivered) {
+        delivered = false;
+        unsigned group;
+        for (group = 1; group < GROUPS && !delivered; group ++) {
+            const uint16_t groupMask = (uint16_t)(1U << (group - 1U));
+            const bool isPIE = group <= 12U;
+            if (isPIE && (cpu->pieBlockedGroups & groupMask)) {
+                continue;
+            }
+            unsigned channel;
+            for (channel = 0; channel < CHANNELS && !delivered; channel ++) {
+                HostSim_Vector *vector = &cpu->vectors[group][channel];
+                if (!vector->pending || !vector->enabled || vector->handler == NULL) {
+                    continue;
+                }
+                if (!acquireCPU(cpu)) {
+                    // Tried again on the next pass
+                    deliveryDue = true;
+                    return;
+                }
+                vector->pending = false;
+                if (isPIE) {
+                    cpu->pieBlockedGroups |= groupMask;
+                }
+                inInterrupt = true;
+                cpuIndex = index;
+                const uint64_t start = hostNanoseconds();
+                cpu->interruptStartNanoseconds = start;
+                vector->handler();
+                const uint64_t elapsed = hostNanoseconds() - start;
+                cpuIndex = 0U;
+                inInterrupt = false;
+                // New compares or configuration: check the switching pattern they give
+                if (epwmOutputsChanged) {
+                    checkSwitching();
+                }
+                pthread_mutex_unlock(&cpu->mutex);
+                vector->calls ++;
+                vector->totalNanoseconds += elapsed;
+                if (elapsed > vector->maxNanoseconds) {
+                    vector->maxNanoseconds = elapsed;
+                }
+                delivered = true;
+            }
+        }
+    }
+}
+
+// CPU1 first, as the PIE of each core works on its own; skipped when nothing changed since the last pass
+static void deliverInterrupts(void) {
+    if (!deliveryDue) {
+        return;
+    }
+    deliveryDue = false;
+    unsigned index;
+    for (index = 0; index < CPUS; index ++) {
+        if (cpus[index].started) {
+            deliverInterruptsOf(index);
+        }
+    }
+}
+
+/*------------------------------GPIO------------------------------*/
+
+static HostSim_GPIO *gpioOf(uint32_t pin) {
+    if (pin >= GPIOS) {
+        fprintf(stderr, "hostsim: bad GPIO %u\n", (unsigned)pin);
+        abort();
+    }
+    return &gpios[pin];
+}
+
+void GPIO_setPadConfig(uint32_t pin, uint32_t pinType) {
+    (void)gpioOf(pin);
+    (void)pinType;
+}
+
+void GPIO_setDirectionMode(uint32_t pin, GPIO_Direction pinIO) {
+    gpioOf(pin)->output = (pinIO == GPIO_DIR_MODE_OUT);
+}
+
+void GPIO_setPinConfig(uint32_t pinConfig) {
+    gpioOf(pinConfig >> 8)->muxPosition = pinConfig & 0xFFU;
+}
+
+void GPIO_writePin(uint32_t pin, uint32_t outVal) {
+    HostSim_GPIO *gpio = gpioOf(pin);
+    gpio->state = outVal ? 1U : 0U;
+    gpio->writes ++;
+    trace("GPIO", pin, "DAT", gpio->state);
+}
+
+uint32_t GPIO_readPin(uint32_t pin) {
+    return gpioOf(pin)->state;
+}
+
+void GPIO_togglePin(uint32_t pin) {
+    HostSim_GPIO *gpio = gpioOf(pin);
+    gpio->state ^= 1U;
+    gpio->toggles ++;
+    trace("GPIO", pin, "DAT", gpio->state);
+}
+
+/*------------------------------DAC------------------------------*/
+
+void DAC_setReferenceVoltage(uint32_t base, DAC_ReferenceVoltage source) {
+    (void)DAC_OF(base);
+    (void)source;
+}
+
+void DAC_setLoadMode(uint32_t base, DAC_LoadMode mode) {
+    DAC_OF(base)->loadMode = (uint16_t)mode;
+}
+
+void DAC_enableOutput(uint32_t base) {
+    DAC_OF(base)->outputEnabled = true;
+}
+
+void DAC_disableOutput(uint32_t base) {
+    DAC_OF(base)->outputEnabled = false;
+}
+
+// DACVALS write from the CPU or the DMA, simMutex held
+// at: cycle of the write, the CPU's observed time or the DMA's event time
+static void writeDAC(HostSim_DAC *dac, uint16_t value, uint64_t at) {
+    value &= 0x0FFFU;
+    if (dac == &dacs[0] && adcSource == HostSim_plantSource && plantParameters.fromDAC) {
+        // Filter brought up to now with the value held so far, ADC samples see the write at its exact time
+        advancePlant(&plantParameters, dac->active / 4095.0, (double)at / HOSTSIM_SYSCLK_FREQ);
+    }
+    const unsigned index = (unsigned)(dac - dacs);
+    dacCaptureCycles[index][dac->writes % DAC_CAPTURE] = at;
+    dacCaptureValues[index][dac->writes % DAC_CAPTURE] = value;
+    dac->shadow = value;
+    dac->active = value;
+    if (dac->writes == 0U || value < dac->minimum) {
+        dac->minimum = value;
+    }
+    if (dac->writes == 0U || value > dac->maximum) {
+        dac->maximum = value;
+    }
+    dac->writes ++;
+    dac->sum += value;
+    const uint16_t middle = (uint16_t)((dac->minimum + dac->maximum) / 2U);
+    const uint16_t hysteresis = (uint16_t)((dac->maximum - dac->minimum) / 8U);
+    if (!dac->high && hysteresis > 0U && value > middle + hysteresis) {
+        dac->high = true;
+        if (dac->crossings == 0U) {
+            dac->firstCrossing = at;
+        }
+        dac->lastCrossing = at;
+        dac->crossings ++;
+    } else if (dac->high && value + hysteresis < middle) {
+        dac->high = false;
+    }
+    trace("DAC", index, "DACVALS", value);
+}
+
+// Shadow values load on the next SYSCLK, so they are active at once
+void DAC_setShadowValue(uint32_t base, uint16_t value) {
+    HostSim_DAC *dac = DAC_OF(base);
+    pthread_mutex_lock(&simMutex);
+    // Late in an ISR by its run time so far, as the target's own timer reads see it
+    writeDAC(dac, value, observedCycles());
+    pthread_mutex_unlock(&simMutex);
+}
+
+uint16_t DAC_getActiveValue(uint32_t base) {
+    return DAC_OF(base)->active;
+}
+
+/*------------------------------ADC------------------------------*/
+
+static double adcClockDivider(const HostSim_ADC *adc) {
+    return adc->prescale == 0U ? 1.0 : (adc->prescale + 2U) / 2.0;
+}
+
+// Queues every SOC of every ADC that listens to the trigger, simClock held
+static void triggerSOCs(unsigned module, uint16_t trigger, bool interruptTrigger) {
+    unsigned first = 0;
+    unsigned last = ADCS;
+    if (interruptTrigger) {
+        first = module;
+        last = module + 1U;
+    }
+    unsigned index;
+    for (index = first; index < last; index ++) {
+        HostSim_ADC *adc = &adcs[index];
+        if (!adc->converterEnabled) {
+            continue;
+        }
+        unsigned soc;
+        for (soc = 0; soc < SOCS; soc ++) {
+            const bool selected = interruptTrigger ? adc->socInterruptTrigger[soc] == trigger : adc->socTrigger[soc] == trigger;
+            if (!selected) {
+                continue;
+            }
+            // SOCs convert one after the other in round-robin order
+            const uint64_t start = adc->busyUntil > cycles ? adc->busyUntil : cycles;
+            const uint64_t acquisition = adc->socWindow[soc];
+            const uint64_t conversion = (uint64_t)(ADC_CONVERSION_ADCCLKS * adcClockDivider(adc) + 0.5);
+            adc->busyUntil = start + acquisition + conversion;
+            scheduleEvent(EVENT_ADC_SAMPLE, start + acquisition, (uint16_t)index, (uint16_t)soc);
+            scheduleEvent(EVENT_ADC_END_OF_CONVERSION, adc->busyUntil, (uint16_t)index, (uint16_t)soc);
+        }
+    }
+}
+
+static void pulseADCInterrupts(unsigned module, unsigned soc, uint16_t pulseMode) {
+    HostSim_ADC *adc = &adcs[module];
+    if (adc->pulseMode != pulseMode) {
+        return;
+    }
+    unsigned number;
+    for (number = 0; number < ADC_INTS; number ++) {
+        if (!adc->interruptEnabled[number] || adc->interruptSource[number] != soc) {
+            continue;
+        }
+        if (adc->interruptFlag[number] && !adc->interruptContinuous[number]) {
+            // Previous flag never cleared: no new pulse
+            adc->interruptOverflow[number] = true;
+            adc->overflows ++;
+            continue;
+        }
+        adc->interruptFlag[number] = true;
+        raiseInterrupt(adc->cpu, adcInterrupts[module][number]);
+        triggerDMA((uint16_t)(DMA_TRIGGER_ADCA1 + 5U * module + number));
+        if (number < 2U) {
+            triggerSOCs(module, (uint16_t)(number + 1U), true);
+        }
+    }
+}
+
+static void processADCEvent(const HostSim_Event *event) {
+    HostSim_ADC *adc = &adcs[event->module];
+    if (event->type == EVENT_ADC_SAMPLE) {
+        const uint32_t base = ADCA_BASE + 0x80U * event->module;
+        const uint16_t channel = adc->socChannel[event->soc];
+        uint16_t value;
+        if (event->module == SWITCH_NODE_ADC && channel == SWITCH_NODE_CHANNEL) {
+            value = epwmOutputLevel(&epwms[0], 0U, event->cycle) ? 4095U : 0U;
+        } else {
+            value = adcSource(base, channel, (double)event->cycle / HOSTSIM_SYSCLK_FREQ, adcSourceContext) & 0x0FFFU;
+        }
+        if (adc->resolution == ADC_RESOLUTION_16BIT) {
+            value = (uint16_t)(value << 4);
+        }
+        adc->result[event->soc] = value;
+        pulseADCInterrupts(event->module, event->soc, ADC_PULSE_END_OF_ACQ_WIN);
+    } else {
+        adc->conversions ++;
+        trace("ADC", event->module, "RESULT", adc->result[event->soc]);
+        pulseADCInterrupts(event->module, event->soc, ADC_PULSE_END_OF_CONV);
+    }
+}
+
+void ADC_setPrescaler(uint32_t base, ADC_ClkPrescale clkPrescale) {
+    pthread_mutex_lock(&simMutex);
+    adcs[ADC_INDEX(base)].prescale = (uint16_t)clkPrescale;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void ADC_setMode(uint32_t base, ADC_Resolution resolution, ADC_SignalMode signalMode) {
+    (void)signalMode;
+    pthread_mutex_lock(&simMutex);
+    adcs[ADC_INDEX(base)].resolution = (uint16_t)resolution;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void ADC_setupSOC(uint32_t base, ADC_SOCNumber socNumber, ADC_Trigger trigger, ADC_Channel channel, uint32_t sampleWindow) {
+    pthread_mutex_lock(&simMutex);
+    HostSim_ADC *adc = &adcs[ADC_INDEX(base)];
+    adc->socTrigger[socNumber] = (uint16_t)trigger;
+    adc->socChannel[socNumber] = (uint16_t)channel;
+    adc->socWindow[socNumber] = sampleWindow;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void ADC_setInterruptSOCTrigger(uint32_t base, ADC_SOCNumber socNumber, ADC_IntSOCTrigger trigger) {
+    pthread_mutex_lock(&simMutex);
+    adcs[ADC_INDEX(base)].socInterruptTrigger[socNumber] = (uint16_t)trigger;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void ADC_setSOCPriority(uint32_t base, ADC_PriorityMode priMode) {
+    (void)ADC_INDEX(base);
+    (void)priMode;
+}
+
+void ADC_setInterruptPulseMode(uint32_t base, ADC_PulseMode pulseMode) {
+    pthread_mutex_lock(&simMutex);
+    adcs[ADC_INDEX(base)].pulseMode = (uint16_t)pulseMode;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void ADC_enableConverter(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    adcs[ADC_INDEX(base)].converterEnabled = true;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void ADC_disableConverter(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    adcs[ADC_INDEX(base)].converterEnabled = false;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void ADC_forceSOC(uint32_t base, ADC_SOCNumber socNumber) {
+    pthread_mutex_lock(&simMutex);
+    const unsigned module = ADC_INDEX(base);
+    const uint16_t trigger = adcs[module].socTrigger[socNumber];
+    // Software force converts only the requested SOC
+    adcs[module].socTrigger[socNumber] = 0xFFFFU;
+    triggerSOCs(module, 0xFFFFU, false);
+    adcs[module].socTrigger[socNumber] = trigger;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void ADC_enableInterrupt(uint32_t base, ADC_IntNumber adcIntNum) {
+    pthread_mutex_lock(&simMutex);
+    adcs[ADC_INDEX(base)].interruptEnabled[adcIntNum] = true;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void ADC_disableInterrupt(uint32_t base, ADC_IntNumber adcIntNum) {
+    pthread_mutex_lock(&simMutex);
+    adcs[ADC_INDEX(base)].interruptEnabled[adcIntNum] = false;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void ADC_setInterruptSource(uint32_t base, ADC_IntNumber adcIntNum, uint16_t socNumber) {
+    pthread_mutex_lock(&simMutex);
+    adcs[ADC_INDEX(base)].interruptSource[adcIntNum] = socNumber;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void ADC_enableContinuousMode(uint32_t base, ADC_IntNumber adcIntNum) {
+    pthread_mutex_lock(&simMutex);
+    adcs[ADC_INDEX(base)].interruptContinuous[adcIntNum] = true;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void ADC_disableContinuousMode(uint32_t base, ADC_IntNumber adcIntNum) {
+    pthread_mutex_lock(&simMutex);
+    adcs[ADC_INDEX(base)].interruptContinuous[adcIntNum] = false;
+    pthread_mutex_unlock(&simMutex);
+}
+
+bool ADC_getInterruptStatus(uint32_t base, ADC_IntNumber adcIntNum) {
+    pthread_mutex_lock(&simMutex);
+    const bool status = adcs[ADC_INDEX(base)].interruptFlag[adcIntNum];
+    pthread_mutex_unlock(&simMutex);
+    return status;
+}
+
+void ADC_clearInterruptStatus(uint32_t base, ADC_IntNumber adcIntNum) {
+    pthread_mutex_lock(&simMutex);
+    adcs[ADC_INDEX(base)].interruptFlag[adcIntNum] = false;
+    pthread_mutex_unlock(&simMutex);
+}
+
+bool ADC_getInterruptOverflowStatus(uint32_t base, ADC_IntNumber adcIntNum) {
+    pthread_mutex_lock(&simMutex);
+    const bool status = adcs[ADC_INDEX(base)].interruptOverflow[adcIntNum];
+    pthread_mutex_unlock(&simMutex);
+    return status;
+}
+
+void ADC_clearInterruptOverflowStatus(uint32_t base, ADC_IntNumber adcIntNum) {
+    pthread_mutex_lock(&simMutex);
+    adcs[ADC_INDEX(base)].interruptOverflow[adcIntNum] = false;
+    pthread_mutex_unlock(&simMutex);
+}
+
+uint16_t ADC_readResult(uint32_t resultBase, ADC_SOCNumber socNumber) {
+    return adcs[indexOf(resultBase, ADCARESULT_BASE, 0x20U, ADCS, "ADC result")].result[socNumber];
+}
+
+/*------------------------------DMA------------------------------*/
+
+static bool isPeripheral(uintptr_t address) {
+    return address < PERIPHERAL_SPACE;
+}
+
+// Steps are in 16-bit words, host memory is byte addressed
+static uintptr_t stepAddress(uintptr_t address, int32_t step) {
+    return isPeripheral(address) ? address + step : address + step * (intptr_t)sizeof(uint16_t);
+}
+
+static uint16_t *dmaWord(uintptr_t address) {
+    if (!isPeripheral(address)) {
+        return (uint16_t *)address;
+    }
+    if (address >= ADCARESULT_BASE && address < ADCARESULT_BASE + 0x20U * ADCS) {
+        const uintptr_t offset = address - ADCARESULT_BASE;
+        return &adcs[offset / 0x20U].result[offset % 0x20U % SOCS];
+    }
+    fprintf(stderr, "hostsim: DMA access to unsupported register 0x%05lX\n", (unsigned long)address);
+    abort();
+}
+
+// DACVALS takes the write path of the CPU (statistics, plant, spectrum), the rest is plain memory
+static void dmaWrite(uintptr_t address, uint16_t value) {
+    if (address >= DACA_BASE && address < DACA_BASE + 0x10U * DACS && (address - DACA_BASE) % 0x10U == DAC_O_VALS) {
+        writeDAC(&dacs[(address - DACA_BASE) / 0x10U], value, cycles);
+        return;
+    }
+    *dmaWord(address) = value;
+}
+
+static void wrapOrStep(uintptr_t *address, uintptr_t *begin, uint32_t *wrapLeft, uint32_t wrapSize, int16_t wrapStep, int16_t transferStep) {
+    if (wrapSize != 0U && *wrapLeft != 0U && -- *wrapLeft == 0U) {
+        *begin = stepAddress(*begin, wrapStep);
+        *address = *begin;
+        *wrapLeft = wrapSize;
+    } else {
+        *address = stepAddress(*address, transferStep);
+    }
+}
+
+// One burst on a channel, a new transfer reloads the shadow addresses first; simMutex held
+static void runDMABurst(unsigned index) {
+    HostSim_DMA *dma = &dmas[index];
+    if (!dma->transferActive) {
+        dma->source = dma->sourceShadow;
+        dma->destination = dma->destinationShadow;
+        dma->sourceBegin = dma->sourceShadow;
+        dma->destinationBegin = dma->destinationShadow;
+        dma->sourceWrapLeft = dma->sourceWrapSize;
+        dma->destinationWrapLeft = dma->destinationWrapSize;
+        dma->burstsLeft = dma->transferSize;
+        dma->transferActive = true;
+        if (dma->interruptEnabled && !dma->interruptAtEnd) {
+            raiseInterrupt(0U, dmaInterrupts[index]);
+        }
+    }
+    const uint16_t wordsPerAccess = (dma->mode & DMA_CFG_SIZE_32BIT) ? 2U : 1U;
+    do {
+        uint16_t word;
+        for (word = 0; word < dma->burstSize; word ++) {
+            uint16_t half;
+            for (half = 0; half < wordsPerAccess; half ++) {
+                dmaWrite(stepAddress(dma->destination, half), *dmaWord(stepAddress(dma->source, half)));
+            }
+            if (word + 1U < dma->burstSize) {
+                dma->source = stepAddress(dma->source, dma->sourceBurstStep);
+                dma->destination = stepAddress(dma->destination, dma->destinationBurstStep);
+            }
+        }
+        wrapOrStep(&dma->source, &dma->sourceBegin, &dma->sourceWrapLeft, dma->sourceWrapSize, dma->sourceWrapStep, dma->sourceTransferStep);
+        wrapOrStep(&dma->destination, &dma->destinationBegin, &dma->destinationWrapLeft, dma->destinationWrapSize, dma->destinationWrapStep, dma->destinationTransferStep);
+        dma->bursts ++;
+        dma->burstsLeft --;
+    } while ((dma->mode & DMA_CFG_ONESHOT_ENABLE) && dma->burstsLeft > 0U);
+    if (dma->burstsLeft == 0U) {
+        dma->transferActive = false;
+        dma->transfers ++;
+        if (dma->interruptEnabled && dma->interruptAtEnd) {
+            raiseInterrupt(0U, dmaInterrupts[index]);
+        }
+        if (!(dma->mode & DMA_CFG_CONTINUOUS_ENABLE)) {
+            dma->running = false;
+        }
+    }
+}
+
+static void triggerDMA(uint16_t trigger) {
+    unsigned index;
+    for (index = 0; index < DMA_CHANNELS; index ++) {
+        const HostSim_DMA *dma = &dmas[index];
+        if (dma->running && dma->triggerEnabled && dma->trigger == trigger) {
+            runDMABurst(index);
+        }
+    }
+}
+
+void DMA_initController(void) {
+    pthread_mutex_lock(&simMutex);
+    memset(dmas, 0, sizeof(dmas));
+    pthread_mutex_unlock(&simMutex);
+}
+
+void DMA_setEmulationMode(DMA_EmulationMode mode) {
+    (void)mode;
+}
+
+void DMA_configAddresses(uint32_t base, const void *destAddr, const void *srcAddr) {
+    pthread_mutex_lock(&simMutex);
+    HostSim_DMA *dma = DMA_OF(base);
+    dma->destinationShadow = (uintptr_t)destAddr;
+    dma->sourceShadow = (uintptr_t)srcAddr;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void DMA_configBurst(uint32_t base, uint16_t size, int16_t srcStep, int16_t destStep) {
+    pthread_mutex_lock(&simMutex);
+    HostSim_DMA *dma = DMA_OF(base);
+    dma->burstSize = size;
+    dma->sourceBurstStep = srcStep;
+    dma->destinationBurstStep = destStep;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void DMA_configTransfer(uint32_t base, uint32_t transferSize, int16_t srcStep, int16_t destStep) {
+    pthread_mutex_lock(&simMutex);
+    HostSim_DMA *dma = DMA_OF(base);
+    dma->transferSize = transferSize;
+    dma->sourceTransferStep = srcStep;
+    dma->destinationTransferStep = destStep;
+    pthread_mutex_unlock(&simMutex);
+}
+
+// Wrap sizes larger than the transfer size disable wrapping, as on the device
+void DMA_configWrap(uint32_t base, uint32_t srcWrapSize, int16_t srcStep, uint32_t destWrapSize, int16_t destStep) {
+    pthread_mutex_lock(&simMutex);
+    HostSim_DMA *dma = DMA_OF(base);
+    dma->sourceWrapSize = srcWrapSize;
+    dma->sourceWrapStep = srcStep;
+    dma->destinationWrapSize = destWrapSize;
+    dma->destinationWrapStep = destStep;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void DMA_configMode(uint32_t base, DMA_Trigger trigger, uint32_t config) {
+    pthread_mutex_lock(&simMutex);
+    HostSim_DMA *dma = DMA_OF(base);
+    dma->trigger = (uint16_t)trigger;
+    dma->mode = config;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void DMA_setInterruptMode(uint32_t base, DMA_InterruptMode mode) {
+    pthread_mutex_lock(&simMutex);
+    DMA_OF(base)->interruptAtEnd = (mode == DMA_INT_AT_END);
+    pthread_mutex_unlock(&simMutex);
+}
+
+void DMA_enableInterrupt(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    DMA_OF(base)->interruptEnabled = true;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void DMA_disableInterrupt(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    DMA_OF(base)->interruptEnabled = false;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void DMA_enableTrigger(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    DMA_OF(base)->triggerEnabled = true;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void DMA_disableTrigger(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    DMA_OF(base)->triggerEnabled = false;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void DMA_enableOverrunInterrupt(uint32_t base) {
+    (void)DMA_OF(base);
+}
+
+void DMA_clearTriggerFlag(uint32_t base) {
+    (void)DMA_OF(base);
+}
+
+void DMA_clearErrorFlag(uint32_t base) {
+    (void)DMA_OF(base);
+}
+
+void DMA_forceTrigger(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    const HostSim_DMA *dma = DMA_OF(base);
+    if (dma->running) {
+        runDMABurst((unsigned)(dma - dmas));
+    }
+    pthread_mutex_unlock(&simMutex);
+}
+
+void DMA_startChannel(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    HostSim_DMA *dma = DMA_OF(base);
+    dma->running = true;
+    dma->transferActive = false;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void DMA_stopChannel(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    HostSim_DMA *dma = DMA_OF(base);
+    dma->running = false;
+    dma->transferActive = false;
+    pthread_mutex_unlock(&simMutex);
+}
+
+bool DMA_getTransferStatusFlag(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    const bool status = DMA_OF(base)->transferActive;
+    pthread_mutex_unlock(&simMutex);
+    return status;
+}
+
+bool DMA_getRunStatusFlag(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    const bool status = DMA_OF(base)->running;
+    pthread_mutex_unlock(&simMutex);
+    return status;
+}
+
+/*------------------------------SCI------------------------------*/
+
+static uint64_t sciCharacterCycles(const HostSim_SCI *sci) {
+    const uint32_t baud = sci->baud ? sci->baud : 9600U;
+    return (uint64_t)(HOSTSIM_SYSCLK_FREQ * sci->bitsPerCharacter / baud + 0.5);
+}
+
+// TXFFINT is set while the FIFO holds no more than the interrupt level, simMutex held
+static void updateSCITxFlag(unsigned index) {
+    HostSim_SCI *sci = &scis[index];
+    if (!sci->fifoEnabled || sci->txCount > sci->txLevel) {
+        return;
+    }
+    if (!sci->txFifoFlag) {
+        sci->txFifoFlag = true;
+        if (sci->interruptEnabled & SCI_INT_TXFF) {
+            raiseInterrupt(0U, sciTxInterrupts[index]);
+        }
+    }
+}
+
+// RXFFINT is set once the FIFO holds the interrupt level, simMutex held
+static void updateSCIRxFlag(unsigned index) {
+    HostSim_SCI *sci = &scis[index];
+    if (!sci->fifoEnabled || sci->rxCount == 0U || sci->rxCount < sci->rxLevel) {
+        return;
+    }
+    if (!sci->rxFifoFlag) {
+        sci->rxFifoFlag = true;
+        if (sci->interruptEnabled & SCI_INT_RXFF) {
+            raiseInterrupt(0U, sciRxInterrupts[index]);
+        }
+    }
+}
+
+// SCI-A reception from the pty, one character time per poll so input never outruns the line, simMutex held
+static void startSCIReception(unsigned index) {
+    HostSim_SCI *sci = &scis[index];
+    if (index != 0U || !sciInput || sci->receiving || !sci->enabled) {
+        return;
+    }
+    sci->receiving = true;
+    scheduleEvent(EVENT_SCI_RECEIVED, cycles + sciCharacterCycles(sci), (uint16_t)index, 0U);
+}
+
+// Moves the next character into the shift register, simMutex held
+static void startSCITransmission(unsigned index) {
+    HostSim_SCI *sci = &scis[index];
+    if (sci->shifting || sci->txCount == 0U || !sci->enabled) {
+        return;
+    }
+    sci->shiftRegister = sci->txFifo[sci->txHead];
+    sci->txHead = (uint16_t)((sci->txHead + 1U) % SCI_FIFO_DEPTH);
+    sci->txCount --;
+    sci->shifting = true;
+    scheduleEvent(EVENT_SCI_TRANSMITTED, cycles + sciCharacterCycles(sci), (uint16_t)index, 0U);
+    updateSCITxFlag(index);
+}
+
+static void processSCIEvent(const HostSim_Event *event) {
+    HostSim_SCI *sci = &scis[event->module];
+    const unsigned char byte = (unsigned char)(sci->shiftRegister & 0xFFU);
+    if (sci->bytesSent == 0U) {
+        sci->firstByteCycle = event->cycle;
+    }
+    sci->bytesSent ++;
+    sci->lastByteCycle = event->cycle;
+    if (event->module == 0U && sciOutput >= 0 && write(sciOutput, &byte, 1) != 1) {
+        sci->sinkDrops ++;
+    }
+    sci->shifting = false;
+    startSCITransmission(event->module);
+}
+
+static void processSCIReceiveEvent(const HostSim_Event *event) {
+    HostSim_SCI *sci = &scis[event->module];
+    sci->receiving = false;
+    unsigned char byte;
+    // Non-blocking: nothing written yet (or no one on the other side) is an idle line
+    if (read(sciOutput, &byte, 1) == 1) {
+        sci->bytesReceived ++;
+        trace("SCI", event->module, "RXBUF", byte);
+        if (sci->rxCount >= SCI_FIFO_DEPTH) {
+            sci->rxOverflows ++;
+            sci->rxOverflow = true;
+        } else {
+            sci->rxFifo[(sci->rxHead + sci->rxCount) % SCI_FIFO_DEPTH] = byte;
+            sci->rxCount ++;
+            updateSCIRxFlag(event->module);
+        }
+    }
+    startSCIReception(event->module);
+}
+
+void SCI_setConfig(uint32_t base, uint32_t lspclkHz, uint32_t baud, uint32_t config) {
+    pthread_mutex_lock(&simMutex);
+    HostSim_SCI *sci = &scis[SCI_INDEX(base)];
+    // BRR = LSPCLK / (baud * 8) - 1, as the driverlib computes it
+    const uint32_t divider = lspclkHz / (baud * 8U);
+    sci->baud = divider ? lspclkHz / (divider * 8U) : baud;
+    const uint16_t dataBits = (uint16_t)((config & SCI_CONFIG_WLEN_MASK) + 1U);
+    sci->bitsPerCharacter = (uint16_t)(1U + dataBits + ((config & SCI_CONFIG_PAR_MASK) ? 1U : 0U)
+                                       + ((config & SCI_CONFIG_STOP_MASK) ? 2U : 1U));
+    sci->enabled = true;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void SCI_enableModule(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    const unsigned index = SCI_INDEX(base);
+    scis[index].enabled = true;
+    startSCITransmission(index);
+    startSCIReception(index);
+    pthread_mutex_unlock(&simMutex);
+}
+
+void SCI_disableModule(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    scis[SCI_INDEX(base)].enabled = false;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void SCI_resetChannels(uint32_t base) {
+    SCI_resetTxFIFO(base);
+    SCI_resetRxFIFO(base);
+}
+
+void SCI_performSoftwareReset(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    // Flags cleared, TXFFINT set again at once when the FIFO is still at or below its level
+    const unsigned index = SCI_INDEX(base);
+    scis[index].txFifoFlag = false;
+    updateSCITxFlag(index);
+    pthread_mutex_unlock(&simMutex);
+}
+
+void SCI_enableFIFO(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    const unsigned index = SCI_INDEX(base);
+    scis[index].fifoEnabled = true;
+    updateSCITxFlag(index);
+    pthread_mutex_unlock(&simMutex);
+}
+
+void SCI_disableFIFO(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    scis[SCI_INDEX(base)].fifoEnabled = false;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void SCI_resetTxFIFO(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    const unsigned index = SCI_INDEX(base);
+    scis[index].txCount = 0U;
+    scis[index].txHead = 0U;
+    updateSCITxFlag(index);
+    pthread_mutex_unlock(&simMutex);
+}
+
+void SCI_resetRxFIFO(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    const unsigned index = SCI_INDEX(base);
+    scis[index].rxCount = 0U;
+    scis[index].rxHead = 0U;
+    scis[index].rxFifoFlag = false;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void SCI_setFIFOInterruptLevel(uint32_t base, SCI_TxFIFOLevel txLevel, SCI_RxFIFOLevel rxLevel) {
+    pthread_mutex_lock(&simMutex);
+    const unsigned index = SCI_INDEX(base);
+    scis[index].txLevel = (uint16_t)txLevel;
+    scis[index].rxLevel = (uint16_t)rxLevel;
+    updateSCITxFlag(index);
+    updateSCIRxFlag(index);
+    pthread_mutex_unlock(&simMutex);
+}
+
+SCI_TxFIFOLevel SCI_getTxFIFOStatus(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    const uint16_t count = scis[SCI_INDEX(base)].txCount;
+    pthread_mutex_unlock(&simMutex);
+    return (SCI_TxFIFOLevel)count;
+}
+
+SCI_RxFIFOLevel SCI_getRxFIFOStatus(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    const uint16_t count = scis[SCI_INDEX(base)].rxCount;
+    pthread_mutex_unlock(&simMutex);
+    return (SCI_RxFIFOLevel)count;
+}
+
+void SCI_enableInterrupt(uint32_t base, uint32_t intFlags) {
+    pthread_mutex_lock(&simMutex);
+    const unsigned index = SCI_INDEX(base);
+    HostSim_SCI *sci = &scis[index];
+    const uint32_t wasEnabled = sci->interruptEnabled;
+    sci->interruptEnabled |= intFlags;
+    // A flag already set interrupts as soon as it is enabled
+    if (!(wasEnabled & SCI_INT_TXFF) && (intFlags & SCI_INT_TXFF) && sci->txFifoFlag) {
+        raiseInterrupt(0U, sciTxInterrupts[index]);
+    }
+    if (!(wasEnabled & SCI_INT_RXFF) && (intFlags & SCI_INT_RXFF) && sci->rxFifoFlag) {
+        raiseInterrupt(0U, sciRxInterrupts[index]);
+    }
+    pthread_cond_signal(&hardwareCondition);
+    pthread_mutex_unlock(&simMutex);
+}
+
+void SCI_disableInterrupt(uint32_t base, uint32_t intFlags) {
+    pthread_mutex_lock(&simMutex);
+    scis[SCI_INDEX(base)].interruptEnabled &= ~intFlags;
+    pthread_mutex_unlock(&simMutex);
+}
+
+uint32_t SCI_getInterruptStatus(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    const HostSim_SCI *sci = &scis[SCI_INDEX(base)];
+    const uint32_t status = (sci->txFifoFlag ? SCI_INT_TXFF : 0U) | (sci->rxFifoFlag ? SCI_INT_RXFF : 0U);
+    pthread_mutex_unlock(&simMutex);
+    return status;
+}
+
+void SCI_clearInterruptStatus(uint32_t base, uint32_t intFlags) {
+    pthread_mutex_lock(&simMutex);
+    const unsigned index = SCI_INDEX(base);
+    if (intFlags & SCI_INT_TXFF) {
+        scis[index].txFifoFlag = false;
+        // Set again at once if the FIFO is still at or below the level
+        updateSCITxFlag(index);
+    }
+    if (intFlags & SCI_INT_RXFF) {
+        scis[index].rxFifoFlag = false;
+        updateSCIRxFlag(index);
+    }
+    pthread_mutex_unlock(&simMutex);
+}
+
+void SCI_clearOverflowStatus(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    scis[SCI_INDEX(base)].rxOverflow = false;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void SCI_writeCharNonBlocking(uint32_t base, uint16_t data) {
+    pthread_mutex_lock(&simMutex);
+    const unsigned index = SCI_INDEX(base);
+    HostSim_SCI *sci = &scis[index];
+    trace("SCI", index, "TXBUF", data & 0xFFU);
+    if (sci->txCount >= SCI_FIFO_DEPTH) {
+        sci->txOverflows ++;
+    } else {
+        sci->txFifo[(sci->txHead + sci->txCount) % SCI_FIFO_DEPTH] = data;
+        sci->txCount ++;
+        startSCITransmission(index);
+    }
+    pthread_mutex_unlock(&simMutex);
+}
+
+void SCI_writeCharBlockingFIFO(uint32_t base, uint16_t data) {
+    // Waits on the virtual clock for room in the FIFO
+    while (SCI_getTxFIFOStatus(base) == SCI_FIFO_TX16) {
+        delayCycles(sciCharacterCycles(&scis[SCI_INDEX(base)]));
+    }
+    SCI_writeCharNonBlocking(base, data);
+}
+
+void SCI_writeCharArray(uint32_t base, const uint16_t * const array, uint16_t length) {
+    uint16_t index;
+    for (index = 0; index < length; index ++) {
+        SCI_writeCharBlockingFIFO(base, array[index]);
+    }
+}
+
+uint16_t SCI_readCharNonBlocking(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    HostSim_SCI *sci = &scis[SCI_INDEX(base)];
+    uint16_t data = 0U;
+    if (sci->rxCount > 0U) {
+        data = sci->rxFifo[sci->rxHead];
+        sci->rxHead = (uint16_t)((sci->rxHead + 1U) % SCI_FIFO_DEPTH);
+        sci->rxCount --;
+    }
+    pthread_mutex_unlock(&simMutex);
+    return data;
+}
+
+uint16_t SCI_readCharBlockingFIFO(uint32_t base) {
+    // Waits on the virtual clock for a character
+    while (SCI_getRxFIFOStatus(base) == SCI_FIFO_RX0) {
+        delayCycles(sciCharacterCycles(&scis[SCI_INDEX(base)]));
+    }
+    return SCI_readCharNonBlocking(base);
+}
+
+// SCI-A output: a file, or a new pseudo terminal for a live decoder when path is "pty"
+static bool openSCIOutput(const char *path) {
+    if (strcmp(path, "pty") == 0) {
+        sciOutput = posix_openpt(O_RDWR | O_NOCTTY);
+        if (sciOutput < 0 || grantpt(sciOutput) != 0 || unlockpt(sciOutput) != 0) {
+            perror("posix_openpt");
+            return false;
+        }
+        // Never block the simulation on a reader that is not keeping up
+        fcntl(sciOutput, F_SETFL, fcntl(sciOutput, F_GETFL) | O_NONBLOCK);
+        // Binary both ways, no line editing or newline translation on either side
+        struct termios attributes;
+        if (tcgetattr(sciOutput, &attributes) == 0) {
+            cfmakeraw(&attributes);
+            tcsetattr(sciOutput, TCSANOW, &attributes);
+        }
+        fprintf(stderr, "hostsim: SCI-A on %s\n", ptsname(sciOutput));
+        // Both ways: what a client writes to the pty reaches the SCI-A receiver
+        sciInput = true;
+        return true;
+    }
+    sciOutput = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (sciOutput < 0) {
+        perror(path);
+        return false;
+    }
+    return true;
+}
+
+/*------------------------------EPWM------------------------------*/
+
+static uint16_t compareSlot(EPWM_CounterCompareModule compModule) {
+    switch (compModule) {
+        case EPWM_COUNTER_COMPARE_A: return 0U;
+        case EPWM_COUNTER_COMPARE_B: return 1U;
+        case EPWM_COUNTER_COMPARE_C: return 2U;
+        default: return 3U;
+    }
+}
+
+// SYSCLK cycles per time-base count; EPWMCLK is SYSCLK / 2 after reset
+static uint32_t epwmCountCycles(const HostSim_EPWM *epwm) {
+    const uint32_t highSpeed = epwm->highSpeedDivider == 0U ? 1U : 2U * epwm->highSpeedDivider;
+    return 2U * (1U << epwm->clockDivider) * highSpeed;
+}
+
+// Counts in one carrier period
+static uint32_t epwmSteps(const HostSim_EPWM *epwm) {
+    return epwm->counterMode == EPWM_COUNTER_MODE_UP_DOWN ? 2U * epwm->period : epwm->period + 1U;
+}
+
+static uint64_t epwmPeriodCycles(const HostSim_EPWM *epwm) {
+    return (uint64_t)epwmSteps(epwm) * epwmCountCycles(epwm);
+}
+
+static double epwmTimeBaseClock(const HostSim_EPWM *epwm) {
+    return HOSTSIM_SYSCLK_FREQ / (double)epwmCountCycles(epwm);
+}
+
+// Step of the carrier period holding a counter value, counting up or down
+static uint32_t epwmStepOf(const HostSim_EPWM *epwm, uint32_t value, bool countingUp) {
+    const uint32_t period = epwm->period;
+    if (value > period) {
+        value = period;
+    }
+    if (epwm->counterMode == EPWM_COUNTER_MODE_DOWN) {
+        return period - value;
+    }
+    if (epwm->counterMode == EPWM_COUNTER_MODE_UP_DOWN && !countingUp && value > 0U) {
+        return 2U * period - value;
+    }
+    return value;
+}
+
+// First cycle at or after from on which the given step of a carrier period falls
+static uint64_t epwmCycleOfStep(const HostSim_EPWM *epwm, uint32_t step, uint64_t from) {
+    const uint64_t period = epwmPeriodCycles(epwm);
+    uint64_t cycle = epwm->originCycle + (uint64_t)step * epwmCountCycles(epwm);
+    if (cycle < from) {
+        cycle += (from - cycle + period - 1U) / period * period;
+    } else {
+        cycle -= (cycle - from) / period * period;
+    }
+    return cycle;
+}
+
+// Origin that puts the given step of the period on cycle
+static void epwmPlaceStep(HostSim_EPWM *epwm, uint32_t step, uint64_t cycle) {
+    const uint64_t period = epwmPeriodCycles(epwm);
+    epwm->originCycle = cycle + period - ((uint64_t)step * epwmCountCycles(epwm)) % period;
+}
+
+// Steps at which an event-trigger source fires, none for a source the mode never reaches
+static unsigned epwmEventSteps(const HostSim_EPWM *epwm, uint16_t source, uint32_t steps[2]) {
+    const uint32_t period = epwm->period;
+    const uint16_t mode = epwm->counterMode;
+    unsigned count = 0U;
+    if (source == EPWM_INT_TBCTR_ZERO || source == EPWM_INT_TBCTR_ZERO_OR_PERIOD) {
+        steps[count ++] = epwmStepOf(epwm, 0U, true);
+    }
+    if (source == EPWM_INT_TBCTR_PERIOD || source == EPWM_INT_TBCTR_ZERO_OR_PERIOD) {
+        steps[count ++] = epwmStepOf(epwm, period, true);
+    }
+    if (source >= EPWM_INT_TBCTR_U_CMPA && source <= EPWM_INT_TBCTR_D_CMPB) {
+        const uint32_t value = epwm->compare[source >= EPWM_INT_TBCTR_U_CMPB ? 1 : 0];
+        const bool up = (source == EPWM_INT_TBCTR_U_CMPA || source == EPWM_INT_TBCTR_U_CMPB);
+        const bool reached = value <= period && (mode == EPWM_COUNTER_MODE_UP_DOWN
+            || (mode == EPWM_COUNTER_MODE_UP && up) || (mode == EPWM_COUNTER_MODE_DOWN && !up));
+        if (reached) {
+            steps[count ++] = epwmStepOf(epwm, value, up);
+        }
+    }
+    return count;
+}
+
+static void scheduleEPWMTrigger(HostSim_EPWM *epwm, unsigned trigger, uint64_t from) {
+    HostSim_EPWMTrigger *output = &epwm->triggers[trigger];
+    output->next = NO_EVENT;
+    if (!epwm->counting || !output->enabled || output->prescale == 0U) {
+        return;
+    }
+    uint32_t steps[2];
+    const unsigned count = epwmEventSteps(epwm, output->source, steps);
+    unsigned index;
+    for (index = 0; index < count; index ++) {
+        const uint64_t cycle = epwmCycleOfStep(epwm, steps[index], from);
+        if (cycle < output->next) {
+            output->next = cycle;
+        }
+    }
+}
+
+static void scheduleEPWMTriggers(HostSim_EPWM *epwm, uint64_t from) {
+    unsigned trigger;
+    for (trigger = 0; trigger < EPWM_TRIGGERS; trigger ++) {
+        scheduleEPWMTrigger(epwm, trigger, from);
+    }
+}
+
+// Step at which the module pulses EPWMxSYNCO on its own, false for pass-through or none
+static bool epwmSyncOutStep(const HostSim_EPWM *epwm, uint32_t *step) {
+    if (epwm->syncOutMode == EPWM_SYNC_OUT_PULSE_ON_COUNTER_ZERO) {
+        *step = epwmStepOf(epwm, 0U, true);
+        return true;
+    }
+    if (epwm->syncOutMode == EPWM_SYNC_OUT_PULSE_ON_COUNTER_COMPARE_B && epwm->compare[1] <= epwm->period) {
+        *step = epwmStepOf(epwm, epwm->compare[1], epwm->counterMode != EPWM_COUNTER_MODE_DOWN);
+        return true;
+    }
+    return false;
+}
+
+// Starts and stops the time bases and lines them up along the sync chain, simMutex held;
+// forced is a module given a software sync pulse now, -1 for none
+static void updateEPWMTimeBases(int forced) {
+    bool pulse[EPWMS];
+    uint64_t pulseCycle[EPWMS];
+    unsigned index;
+    for (index = 0; index < EPWMS; index ++) {
+        HostSim_EPWM *epwm = &epwms[index];
+        const bool counting = epwm->clockEnabled && tbclkSync && epwm->counterMode != EPWM_COUNTER_MODE_STOP_FREEZE
+            && epwm->period > 0U;
+        if (counting && !epwm->counting) {
+            // Counts up from TBCTR (down in down-count mode) from now on
+            epwmPlaceStep(epwm, epwmStepOf(epwm, epwm->counter, true), cycles);
+        }
+        epwm->counting = counting;
+        pulse[index] = false;
+        if (!counting) {
+            scheduleEPWMTriggers(epwm, cycles + 1U);
+            continue;
+        }
+        // Sync input: the source's pulse, or a software pulse on this module
+        const int source = syncSources[index];
+        bool synced = false;
+        uint64_t syncCycle = 0U;
+        if ((int)index == forced) {
+            synced = true;
+            syncCycle = cycles;
+        } else if (source >= 0 && pulse[source]) {
+            synced = true;
+            syncCycle = pulseCycle[source];
+        }
+        if (synced && epwm->phaseLoad) {
+            // TBPHS loaded at the pulse, the period repeats from there
+            epwmPlaceStep(epwm, epwmStepOf(epwm, epwm->phase, epwm->countAfterSync == EPWM_COUNT_MODE_UP_AFTER_SYNC),
+                          syncCycle);
+        }
+        uint32_t step;
+        if (epwmSyncOutStep(epwm, &step)) {
+            pulse[index] = true;
+            pulseCycle[index] = epwmCycleOfStep(epwm, step, cycles);
+        } else if (epwm->syncOutMode == EPWM_SYNC_OUT_PULSE_ON_EPWMxSYNCIN && synced) {
+            pulse[index] = true;
+            pulseCycle[index] = syncCycle;
+        }
+        scheduleEPWMTriggers(epwm, cycles + 1U);
+    }
+    markOutputsChanged();
+}
+
+// Keeps the position of a running time base across a period, prescaler or mode change
+static void holdEPWMPosition(HostSim_EPWM *epwm) {
+    if (epwm->counting) {
+        const uint64_t period = epwmPeriodCycles(epwm);
+        const uint64_t next = epwmCycleOfStep(epwm, 0U, cycles + 1U);
+        // Start of the current period, the new one runs from it
+        epwm->originCycle = next >= period ? next - period : next;
+    }
+}
+
+void EPWM_setClockPrescaler(uint32_t base, EPWM_ClockDivider prescaler, EPWM_HSClockDivider highSpeedPrescaler) {
+    pthread_mutex_lock(&simMutex);
+    HostSim_EPWM *epwm = &epwms[EPWM_INDEX(base)];
+    holdEPWMPosition(epwm);
+    epwm->clockDivider = (uint16_t)prescaler;
+    epwm->highSpeedDivider = (uint16_t)highSpeedPrescaler;
+    updateEPWMTimeBases(-1);
+    pthread_mutex_unlock(&simMutex);
+}
+
+void EPWM_setPeriodLoadMode(uint32_t base, EPWM_PeriodLoadMode loadMode) {
+    (void)EPWM_INDEX(base);
+    (void)loadMode;
+}
+
+void EPWM_setTimeBaseCounterMode(uint32_t base, EPWM_TimeBaseCountMode counterMode) {
+    const unsigned index = EPWM_INDEX(base);
+    pthread_mutex_lock(&simMutex);
+    holdEPWMPosition(&epwms[index]);
+    epwms[index].counterMode = (uint16_t)counterMode;
+    updateEPWMTimeBases(-1);
+    pthread_mutex_unlock(&simMutex);
+    trace("EPWM", index + 1U, "CTRMODE", counterMode);
+}
+
+void EPWM_setTimeBasePeriod(uint32_t base, uint16_t periodCount) {
+    const unsigned index = EPWM_INDEX(base);
+    pthread_mutex_lock(&simMutex);
+    if (periodCount != epwms[index].period) {
+        holdEPWMPosition(&epwms[index]);
+        epwms[index].period = periodCount;
+        updateEPWMTimeBases(-1);
+    }
+    epwms[index].periodWrites ++;
+    pthread_mutex_unlock(&simMutex);
+    trace("EPWM", index + 1U, "TBPRD", periodCount);
+}
+
+uint16_t EPWM_getTimeBasePeriod(uint32_t base) {
+    return epwms[EPWM_INDEX(base)].period;
+}
+
+void EPWM_setTimeBaseCounter(uint32_t base, uint16_t count) {
+    pthread_mutex_lock(&simMutex);
+    HostSim_EPWM *epwm = &epwms[EPWM_INDEX(base)];
+    epwm->counter = count;
+    if (epwm->counting) {
+        epwmPlaceStep(epwm, epwmStepOf(epwm, count, true), cycles);
+        updateEPWMTimeBases(-1);
+    }
+    pthread_mutex_unlock(&simMutex);
+}
+
+// Position of a counting time base in its current period, simMutex held
+static uint32_t epwmCurrentStep(const HostSim_EPWM *epwm) {
+    const uint64_t start = epwmCycleOfStep(epwm, 0U, cycles + 1U);
+    const uint32_t steps = epwmSteps(epwm);
+    return steps - 1U - (uint32_t)((start - cycles - 1U) / epwmCountCycles(epwm)) % steps;
+}
+
+uint16_t EPWM_getTimeBaseCounterValue(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    const HostSim_EPWM *epwm = &epwms[EPWM_INDEX(base)];
+    uint16_t count = epwm->counter;
+    if (epwm->counting) {
+        // Position in the current period, folded back onto the counter value
+        const uint32_t step = epwmCurrentStep(epwm);
+        if (epwm->counterMode == EPWM_COUNTER_MODE_DOWN) {
+            count = (uint16_t)(epwm->period - step);
+        } else if (step > epwm->period) {
+            count = (uint16_t)(2U * epwm->period - step);
+        } else {
+            count = (uint16_t)step;
+        }
+    }
+    pthread_mutex_unlock(&simMutex);
+    return count;
+}
+
+// CTRDIR: up-down counters turn at TBPRD, the other modes count one way
+uint16_t EPWM_getTimeBaseCounterDirection(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    const HostSim_EPWM *epwm = &epwms[EPWM_INDEX(base)];
+    uint16_t direction = epwm->counterMode == EPWM_COUNTER_MODE_DOWN ? EPWM_TIME_BASE_STATUS_COUNT_DOWN
+                                                                      : EPWM_TIME_BASE_STATUS_COUNT_UP;
+    if (epwm->counting && epwm->counterMode == EPWM_COUNTER_MODE_UP_DOWN && epwmCurrentStep(epwm) >= epwm->period) {
+        direction = EPWM_TIME_BASE_STATUS_COUNT_DOWN;
+    }
+    pthread_mutex_unlock(&simMutex);
+    return direction;
+}
+
+void EPWM_setPhaseShift(uint32_t base, uint16_t phaseCount) {
+    pthread_mutex_lock(&simMutex);
+    epwms[EPWM_INDEX(base)].phase = phaseCount;
+    updateEPWMTimeBases(-1);
+    pthread_mutex_unlock(&simMutex);
+}
+
+void EPWM_setSyncOutPulseMode(uint32_t base, EPWM_SyncOutPulseMode mode) {
+    pthread_mutex_lock(&simMutex);
+    epwms[EPWM_INDEX(base)].syncOutMode = (uint16_t)mode;
+    updateEPWMTimeBases(-1);
+    pthread_mutex_unlock(&simMutex);
+}
+
+void EPWM_enablePhaseShiftLoad(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    epwms[EPWM_INDEX(base)].phaseLoad = true;
+    updateEPWMTimeBases(-1);
+    pthread_mutex_unlock(&simMutex);
+}
+
+void EPWM_disablePhaseShiftLoad(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    epwms[EPWM_INDEX(base)].phaseLoad = false;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void EPWM_setCountModeAfterSync(uint32_t base, EPWM_SyncCountMode mode) {
+    pthread_mutex_lock(&simMutex);
+    epwms[EPWM_INDEX(base)].countAfterSync = (uint16_t)mode;
+    updateEPWMTimeBases(-1);
+    pthread_mutex_unlock(&simMutex);
+}
+
+void EPWM_forceSyncPulse(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    updateEPWMTimeBases((int)EPWM_INDEX(base));
+    pthread_mutex_unlock(&simMutex);
+}
+
+void EPWM_setDeadBandDelayMode(uint32_t base, EPWM_DeadBandDelayMode delayMode, bool enableDelayMode) {
+    HostSim_EPWM *epwm = &epwms[EPWM_INDEX(base)];
+    if (delayMode == EPWM_DB_RED) {
+        epwm->risingDelayEnabled = enableDelayMode;
+    } else {
+        epwm->fallingDelayEnabled = enableDelayMode;
+    }
+    markOutputsChanged();
+}
+
+void EPWM_setDeadBandDelayPolarity(uint32_t base, EPWM_DeadBandDelayMode delayMode, EPWM_DeadBandPolarity polarity) {
+    HostSim_EPWM *epwm = &epwms[EPWM_INDEX(base)];
+    if (delayMode == EPWM_DB_RED) {
+        epwm->risingInverted = (polarity == EPWM_DB_POLARITY_ACTIVE_LOW);
+    } else {
+        epwm->fallingInverted = (polarity == EPWM_DB_POLARITY_ACTIVE_LOW);
+    }
+    markOutputsChanged();
+}
+
+void EPWM_setRisingEdgeDeadBandDelayInput(uint32_t base, uint16_t input) {
+    epwms[EPWM_INDEX(base)].risingInput = input;
+    markOutputsChanged();
+}
+
+void EPWM_setFallingEdgeDeadBandDelayInput(uint32_t base, uint16_t input) {
+    epwms[EPWM_INDEX(base)].fallingInput = input;
+    markOutputsChanged();
+}
+
+void EPWM_setDeadBandCounterClock(uint32_t base, EPWM_DeadBandClockMode clockMode) {
+    epwms[EPWM_INDEX(base)].halfCycleDelay = (clockMode == EPWM_DB_COUNTER_CLOCK_HALF_CYCLE);
+    markOutputsChanged();
+}
+
+void EPWM_setRisingEdgeDelayCount(uint32_t base, uint16_t redCount) {
+    // DBRED is 14 bits
+    epwms[EPWM_INDEX(base)].risingDelay = redCount & 0x3FFFU;
+    markOutputsChanged();
+}
+
+void EPWM_setFallingEdgeDelayCount(uint32_t base, uint16_t fedCount) {
+    epwms[EPWM_INDEX(base)].fallingDelay = fedCount & 0x3FFFU;
+    markOutputsChanged();
+}
+
+static void setEPWMTriggerSource(uint32_t base, unsigned trigger, uint16_t source) {
+    pthread_mutex_lock(&simMutex);
+    HostSim_EPWM *epwm = &epwms[EPWM_INDEX(base)];
+    epwm->triggers[trigger].source = source;
+    scheduleEPWMTrigger(epwm, trigger, cycles + 1U);
+    pthread_mutex_unlock(&simMutex);
+}
+
+static void setEPWMTriggerPrescale(uint32_t base, unsigned trigger, uint16_t eventCount) {
+    pthread_mutex_lock(&simMutex);
+    HostSim_EPWM *epwm = &epwms[EPWM_INDEX(base)];
+    epwm->triggers[trigger].prescale = eventCount & 0x0FU;
+    epwm->triggers[trigger].events = 0U;
+    scheduleEPWMTrigger(epwm, trigger, cycles + 1U);
+    pthread_mutex_unlock(&simMutex);
+}
+
+static void enableEPWMTrigger(uint32_t base, unsigned trigger, bool enabled) {
+    pthread_mutex_lock(&simMutex);
+    HostSim_EPWM *epwm = &epwms[EPWM_INDEX(base)];
+    epwm->triggers[trigger].enabled = enabled;
+    scheduleEPWMTrigger(epwm, trigger, cycles + 1U);
+    pthread_cond_signal(&hardwareCondition);
+    pthread_mutex_unlock(&simMutex);
+}
+
+static bool epwmTriggerFlag(uint32_t base, unsigned trigger) {
+    pthread_mutex_lock(&simMutex);
+    const bool status = epwms[EPWM_INDEX(base)].triggers[trigger].flag;
+    pthread_mutex_unlock(&simMutex);
+    return status;
+}
+
+static void clearEPWMTriggerFlag(uint32_t base, unsigned trigger) {
+    pthread_mutex_lock(&simMutex);
+    epwms[EPWM_INDEX(base)].triggers[trigger].flag = false;
+    pthread_mutex_unlock(&simMutex);
+}
+
+static unsigned socTrigger(EPWM_ADCStartOfConversionType adcSOCType) {
+    return adcSOCType == EPWM_SOC_A ? EPWM_TRIGGER_SOCA : EPWM_TRIGGER_SOCB;
+}
+
+void EPWM_setInterruptSource(uint32_t base, uint16_t interruptSource) {
+    setEPWMTriggerSource(base, EPWM_TRIGGER_INT, interruptSource);
+}
+
+void EPWM_setInterruptEventCount(uint32_t base, uint16_t eventCount) {
+    setEPWMTriggerPrescale(base, EPWM_TRIGGER_INT, eventCount);
+}
+
+void EPWM_enableInterrupt(uint32_t base) {
+    enableEPWMTrigger(base, EPWM_TRIGGER_INT, true);
+}
+
+void EPWM_disableInterrupt(uint32_t base) {
+    enableEPWMTrigger(base, EPWM_TRIGGER_INT, false);
+}
+
+bool EPWM_getEventTriggerInterruptStatus(uint32_t base) {
+    return epwmTriggerFlag(base, EPWM_TRIGGER_INT);
+}
+
+void EPWM_clearEventTriggerInterruptFlag(uint32_t base) {
+    clearEPWMTriggerFlag(base, EPWM_TRIGGER_INT);
+}
+
+void EPWM_enableADCTrigger(uint32_t base, EPWM_ADCStartOfConversionType adcSOCType) {
+    enableEPWMTrigger(base, socTrigger(adcSOCType), true);
+}
+
+void EPWM_disableADCTrigger(uint32_t base, EPWM_ADCStartOfConversionType adcSOCType) {
+    enableEPWMTrigger(base, socTrigger(adcSOCType), false);
+}
+
+void EPWM_setADCTriggerSource(uint32_t base, EPWM_ADCStartOfConversionType adcSOCType, EPWM_ADCStartOfConversionSource socSource) {
+    setEPWMTriggerSource(base, socTrigger(adcSOCType), (uint16_t)socSource);
+}
+
+void EPWM_setADCTriggerEventPrescale(uint32_t base, EPWM_ADCStartOfConversionType adcSOCType, uint16_t preScaleCount) {
+    setEPWMTriggerPrescale(base, socTrigger(adcSOCType), preScaleCount);
+}
+
+bool EPWM_getADCTriggerFlagStatus(uint32_t base, EPWM_ADCStartOfConversionType adcSOCType) {
+    return epwmTriggerFlag(base, socTrigger(adcSOCType));
+}
+
+void EPWM_clearADCTriggerFlag(uint32_t base, EPWM_ADCStartOfConversionType adcSOCType) {
+    clearEPWMTriggerFlag(base, socTrigger(adcSOCType));
+}
+
+void EPWM_setCounterCompareShadowLoadMode(uint32_t base, EPWM_CounterCompareModule compModule, EPWM_CounterCompareLoadMode loadMode) {
+    (void)EPWM_INDEX(base);
+    (void)compModule;
+    (void)loadMode;
+}
+
+void EPWM_setCounterCompareValue(uint32_t base, EPWM_CounterCompareModule compModule, uint16_t compCount) {
+    const unsigned index = EPWM_INDEX(base);
+    HostSim_EPWM *epwm = &epwms[index];
+    const uint16_t slot = compareSlot(compModule);
+    epwm->compare[slot] = compCount;
+    epwm->compareWrites ++;
+    markOutputsChanged();
+    // Compare-triggered interrupts and SOCs move with the compare
+    unsigned trigger;
+    for (trigger = 0; trigger < EPWM_TRIGGERS; trigger ++) {
+        if (epwm->triggers[trigger].enabled && epwm->triggers[trigger].source >= EPWM_INT_TBCTR_U_CMPA) {
+            pthread_mutex_lock(&simMutex);
+            scheduleEPWMTrigger(epwm, trigger, cycles + 1U);
+            pthread_mutex_unlock(&simMutex);
+        }
+    }
+    trace("EPWM", index + 1U, slot == 0U ? "CMPA" : slot == 1U ? "CMPB" : slot == 2U ? "CMPC" : "CMPD", compCount);
+}
+
+uint16_t EPWM_getCounterCompareValue(uint32_t base, EPWM_CounterCompareModule compModule) {
+    return epwms[EPWM_INDEX(base)].compare[compareSlot(compModule)];
+}
+
+void EPWM_setActionQualifierShadowLoadMode(uint32_t base, EPWM_ActionQualifierModule aqModule, EPWM_ActionQualifierLoadMode loadMode) {
+    (void)EPWM_INDEX(base);
+    (void)aqModule;
+    (void)loadMode;
+}
+
+void EPWM_setActionQualifierAction(uint32_t base, EPWM_ActionQualifierOutputModule epwmOutput, EPWM_ActionQualifierOutput output, EPWM_ActionQualifierOutputEvent event) {
+    epwms[EPWM_INDEX(base)].actions[epwmOutput == EPWM_AQ_OUTPUT_A ? 0 : 1][event / 2U] = (uint16_t)output;
+    markOutputsChanged();
+}
+
+// Event-trigger interrupts and ADC start of conversions due now, simMutex held
+static void processEPWMEvents(void) {
+    unsigned index;
+    for (index = 0; index < EPWMS; index ++) {
+        HostSim_EPWM *epwm = &epwms[index];
+        unsigned trigger;
+        for (trigger = 0; trigger < EPWM_TRIGGERS; trigger ++) {
+            HostSim_EPWMTrigger *output = &epwm->triggers[trigger];
+            while (epwm->counting && output->enabled && output->next <= cycles) {
+                const uint64_t eventCycle = output->next;
+                scheduleEPWMTrigger(epwm, trigger, eventCycle + 1U);
+                if (++ output->events < output->prescale) {
+                    continue;
+                }
+                output->events = 0U;
+                if (trigger != EPWM_TRIGGER_INT) {
+                    // SOC pulses go out whatever the flag, which only records them
+                    output->flag = true;
+                    output->pulses ++;
+                    const uint16_t socSource = (uint16_t)(2U * index + trigger - EPWM_TRIGGER_SOCA);
+                    triggerSOCs(0U, (uint16_t)(ADC_TRIGGER_EPWM1_SOCA + socSource), false);
+                    triggerDMA((uint16_t)(DMA_TRIGGER_EPWM1SOCA + socSource));
+                    continue;
+                }
+                // No new interrupt until the ISR clears ETFLG
+                if (output->flag) {
+                    output->missed ++;
+                    continue;
+                }
+                output->flag = true;
+                output->pulses ++;
+                raiseInterrupt(0U, INT_EPWM1 + index);
+            }
+        }
+    }
+}
+
+static uint16_t applyAction(uint16_t state, uint16_t action) {
+    switch (action) {
+        case EPWM_AQ_OUTPUT_LOW: return 0U;
+        case EPWM_AQ_OUTPUT_HIGH: return 1U;
+        case EPWM_AQ_OUTPUT_TOGGLE: return state ^ 1U;
+        default: return state;
+    }
+}
+
+typedef struct {
+    uint32_t phase; // Counter step within the carrier period
+    uint16_t order; // Zero, period, CMPA, CMPB when several fall on the same step
+    uint16_t action;
+} HostSim_PWMEvent;
+
+static void addPWMEvent(HostSim_PWMEvent *events, unsigned *count, uint32_t phase, uint16_t order, uint16_t action) {
+    if (action == EPWM_AQ_OUTPUT_NO_CHANGE) {
+        return;
+    }
+    // Insertion sort by step, then by priority
+    unsigned index = (*count) ++;
+    while (index > 0U && (events[index - 1U].phase > phase || (events[index - 1U].phase == phase && events[index - 1U].order > order))) {
+        events[index] = events[index - 1U];
+        index --;
+    }
+    events[index].phase = phase;
+    events[index].order = order;
+    events[index].action = action;
+}
+
+// Counter value match as events on the carrier period timeline, up and down sides apart in up-down count
+static void addCounterMatch(HostSim_PWMEvent *events, unsigned *count, const HostSim_EPWM *epwm, uint32_t value,
+                            uint16_t order, uint16_t upAction, uint16_t downAction) {
+    const uint32_t period = epwm->period;
+    if (value > period) {
+        return;
+    }
+    if (epwm->counterMode == EPWM_COUNTER_MODE_UP) {
+        addPWMEvent(events, count, value, order, upAction);
+    } else if (epwm->counterMode == EPWM_COUNTER_MODE_DOWN) {
+        addPWMEvent(events, count, period - value, order, downAction);
+    } else {
+        // Counting up before TBPRD, down from it; zero is reached counting up
+        if (value < period) {
+            addPWMEvent(events, count, value, order, upAction);
+        }
+        if (value > 0U) {
+            addPWMEvent(events, count, 2U * period - value, order, downAction);
+        }
+    }
+}
+
+// Action-qualifier events of one output over a carrier period, in step order; returns the count
+static unsigned epwmActionEvents(const HostSim_EPWM *epwm, unsigned output, HostSim_PWMEvent events[8]) {
+    const uint16_t *actions = epwm->actions[output];
+    unsigned count = 0U;
+    addCounterMatch(events, &count, epwm, 0U, 0U, actions[0], actions[0]);
+    addCounterMatch(events, &count, epwm, epwm->period, 1U, actions[1], actions[1]);
+    addCounterMatch(events, &count, epwm, epwm->compare[0], 2U, actions[2], actions[3]);
+    addCounterMatch(events, &count, epwm, epwm->compare[1], 3U, actions[4], actions[5]);
+    return count;
+}
+
+// High-time fraction of a carrier period, with the output state carried over from the previous period
+static double epwmDutyCycle(const HostSim_EPWM *epwm, unsigned output) {
+    if (epwm->period == 0U || epwm->counterMode == EPWM_COUNTER_MODE_STOP_FREEZE) {
+        return 0.0;
+    }
+    const uint32_t steps = epwmSteps(epwm);
+    // Only the steps with an action matter: O(1) instead of stepping every count
+    HostSim_PWMEvent events[8];
+    const unsigned count = epwmActionEvents(epwm, output, events);
+    // First period settles the state, the second one is measured
+    uint16_t state = 0U;
+    unsigned index;
+    for (index = 0; index < count; index ++) {
+        state = applyAction(state, events[index].action);
+    }
+    uint32_t highSteps = 0U;
+    uint32_t previous = 0U;
+    for (index = 0; index < count; index ++) {
+        highSteps += state * (events[index].phase - previous);
+        state = applyAction(state, events[index].action);
+        previous = events[index].phase;
+    }
+    highSteps += state * (steps - previous);
+    return (double)highSteps / (double)steps;
+}
+
+static bool waveAlwaysHigh(const HostSim_Wave *wave) {
+    return wave->count == 1U && wave->length[0] >= wave->span;
+}
+
+static void addInterval(HostSim_Wave *wave, double start, double length) {
+    if (length > 0.0 && wave->count < WAVE_INTERVALS) {
+        wave->start[wave->count] = fmod(start, wave->span);
+        wave->length[wave->count] = length;
+        wave->count ++;
+    }
+}
+
+// Sorts the intervals and merges the overlapping ones, across the period end too
+static void normaliseWave(HostSim_Wave *wave) {
+    unsigned index;
+    unsigned other;
+    for (index = 1; index < wave->count; index ++) {
+        for (other = index; other > 0U && wave->start[other - 1U] > wave->start[other]; other --) {
+            const double start = wave->start[other];
+            const double length = wave->length[other];
+            wave->start[other] = wave->start[other - 1U];
+            wave->length[other] = wave->length[other - 1U];
+            wave->start[other - 1U] = start;
+            wave->length[other - 1U] = length;
+        }
+    }
+    unsigned merged = 0U;
+    for (index = 0; index < wave->count; index ++) {
+        if (merged > 0U && wave->start[index] <= wave->start[merged - 1U] + wave->length[merged - 1U]) {
+            const double end = fmax(wave->start[merged - 1U] + wave->length[merged - 1U], wave->start[index] + wave->length[index]);
+            wave->length[merged - 1U] = end - wave->start[merged - 1U];
+        } else {
+            wave->start[merged] = wave->start[index];
+            wave->length[merged] = wave->length[index];
+            merged ++;
+        }
+    }
+    wave->count = merged;
+    // The last interval may run past the period end into the first ones
+    while (wave->count > 1U && wave->start[wave->count - 1U] + wave->length[wave->count - 1U] >= wave->start[0] + wave->span) {
+        const unsigned last = wave->count - 1U;
+        const double end = fmax(wave->start[last] + wave->length[last], wave->start[0] + wave->span + wave->length[0]);
+        wave->length[last] = end - wave->start[last];
+        for (index = 1; index < wave->count; index ++) {
+            wave->start[index - 1U] = wave->start[index];
+            wave->length[index - 1U] = wave->length[index];
+        }
+        wave->count --;
+    }
+    for (index = 0; index < wave->count; index ++) {
+        if (wave->length[index] >= wave->span) {
+            wave->count = 1U;
+            wave->start[0] = 0.0;
+            wave->length[0] = wave->span;
+            return;
+        }
+    }
+}
+
+// Action-qualifier output as high intervals
+static void actionWave(const HostSim_EPWM *epwm, unsigned output, HostSim_Wave *wave) {
+    HostSim_PWMEvent events[8];
+    const unsigned count = epwmActionEvents(epwm, output, events);
+    wave->span = (double)epwmSteps(epwm);
+    wave->count = 0U;
+    uint16_t state = 0U;
+    unsigned index;
+    for (index = 0; index < count; index ++) {
+        state = applyAction(state, events[index].action);
+    }
+    double rise = 0.0;
+    for (index = 0; index < count; index ++) {
+        const uint16_t next = applyAction(state, events[index].action);
+        if (next && !state) {
+            rise = events[index].phase;
+        } else if (!next && state) {
+            addInterval(wave, rise, events[index].phase - rise);
+        }
+        state = next;
+    }
+    if (state) {
+        // Still high at the period end, joined to the first interval by normaliseWave
+        addInterval(wave, rise, wave->span - rise);
+    }
+    normaliseWave(wave);
+}
+
+static void invertWave(HostSim_Wave *wave) {
+    HostSim_Wave inverted = {0U, {0.0}, {0.0}, wave->span};
+    if (wave->count == 0U) {
+        addInterval(&inverted, 0.0, wave->span);
+    } else if (!waveAlwaysHigh(wave)) {
+        unsigned index;
+        for (index = 0; index < wave->count; index ++) {
+            const double end = wave->start[index] + wave->length[index];
+            const double next = index + 1U < wave->count ? wave->start[index + 1U] : wave->start[0] + wave->span;
+            addInterval(&inverted, end, next - end);
+        }
+    }
+    *wave = inverted;
+}
+
+// Rising edges delayed (pulses shorter than the delay vanish), or falling edges delayed
+static void delayWave(HostSim_Wave *wave, double delay, bool rising) {
+    if (delay <= 0.0 || wave->count == 0U || waveAlwaysHigh(wave)) {
+        return;
+    }
+    HostSim_Wave delayed = {0U, {0.0}, {0.0}, wave->span};
+    unsigned index;
+    for (index = 0; index < wave->count; index ++) {
+        if (!rising) {
+            addInterval(&delayed, wave->start[index], wave->length[index] + delay);
+        } else if (wave->length[index] > delay) {
+            addInterval(&delayed, wave->start[index] + delay, wave->length[index] - delay);
+        }
+    }
+    normaliseWave(&delayed);
+    *wave = delayed;
+}
+
+static void joinWaves(HostSim_Wave *wave, const HostSim_Wave *other) {
+    unsigned index;
+    for (index = 0; index < other->count; index ++) {
+        addInterval(wave, other->start[index], other->length[index]);
+    }
+    normaliseWave(wave);
+}
+
+static double waveTotal(const HostSim_Wave *wave) {
+    double total = 0.0;
+    unsigned index;
+    for (index = 0; index < wave->count; index ++) {
+        total += wave->length[index];
+    }
+    return total;
+}
+
+// EPWMxA and EPWMxB after the dead-band submodule
+static void epwmOutputWaves(const HostSim_EPWM *epwm, HostSim_Wave *outputA, HostSim_Wave *outputB) {
+    HostSim_Wave actions[2];
+    actionWave(epwm, 0U, &actions[0]);
+    actionWave(epwm, 1U, &actions[1]);
+    const double scale = epwm->halfCycleDelay ? 0.5 : 1.0;
+    *outputA = actions[0];
+    if (epwm->risingDelayEnabled) {
+        *outputA = actions[epwm->risingInput == EPWM_DB_INPUT_EPWMB ? 1 : 0];
+        delayWave(outputA, scale * epwm->risingDelay, true);
+        if (epwm->risingInverted) {
+            invertWave(outputA);
+        }
+    }
+    *outputB = actions[1];
+    if (epwm->fallingDelayEnabled) {
+        *outputB = actions[epwm->fallingInput == EPWM_DB_INPUT_EPWMB ? 1 : 0];
+        delayWave(outputB, scale * epwm->fallingDelay, false);
+        if (epwm->fallingInverted) {
+            invertWave(outputB);
+        }
+    }
+}
+
+// New compares, actions, dead band or time base: the switching pattern is checked again and cached waves rebuilt
+static void markOutputsChanged(void) {
+    epwmOutputsChanged = true;
+    epwmOutputsSequence ++;
+}
+
+// Level of EPWMxA (output 0) or EPWMxB on a cycle, from the carrier period it falls in; low while stopped
+static uint16_t epwmOutputLevel(const HostSim_EPWM *epwm, unsigned output, uint64_t cycle) {
+    // Sampled far more often than the outputs change: the waves are built once per change
+    static HostSim_Wave waves[EPWMS][2];
+    static uint32_t builtSequence[EPWMS];
+    static bool built[EPWMS];
+    if (!epwm->counting || epwm->period == 0U || epwm->counterMode == EPWM_COUNTER_MODE_STOP_FREEZE) {
+        return 0U;
+    }
+    const unsigned module = (unsigned)(epwm - epwms);
+    if (!built[module] || builtSequence[module] != epwmOutputsSequence) {
+        builtSequence[module] = epwmOutputsSequence;
+        built[module] = true;
+        epwmOutputWaves(epwm, &waves[module][0], &waves[module][1]);
+    }
+    const HostSim_Wave *wave = &waves[module][output];
+    // The origin may lie ahead of the cycle by up to a period
+    const uint64_t period = epwmPeriodCycles(epwm);
+    const uint64_t offset = (cycle + period - epwm->originCycle % period) % period;
+    const double step = (double)offset / epwmCountCycles(epwm);
+    unsigned index;
+    for (index = 0; index < wave->count; index ++) {
+        if (fmod(step - wave->start[index] + wave->span, wave->span) < wave->length[index]) {
+            return 1U;
+        }
+    }
+    return 0U;
+}
+
+// Shortest edge delay in time-base counts, 0 unless both edges are delayed
+static double epwmDeadBand(const HostSim_EPWM *epwm) {
+    if (!epwm->risingDelayEnabled || !epwm->fallingDelayEnabled) {
+        return 0.0;
+    }
+    const double scale = epwm->halfCycleDelay ? 0.5 : 1.0;
+    return scale * (epwm->risingDelay < epwm->fallingDelay ? epwm->risingDelay : epwm->fallingDelay);
+}
+
+// Legs: dead band or phase load configured, their outputs must never be high together
+static bool epwmIsLeg(const HostSim_EPWM *epwm) {
+    return epwm->risingDelayEnabled || epwm->fallingDelayEnabled || epwm->phaseLoad;
+}
+
+// Dead time, shoot-through and phase of every leg, on the current compares
+static void checkSwitching(void) {
+    epwmOutputsChanged = false;
+    unsigned index;
+    for (index = 0; index < EPWMS; index ++) {
+        HostSim_EPWM *epwm = &epwms[index];
+        if (!epwm->counting || !epwmIsLeg(epwm)) {
+            continue;
+        }
+        HostSim_Wave outputA;
+        HostSim_Wave outputB;
+        epwmOutputWaves(epwm, &outputA, &outputB);
+        const double countTime = 1.0 / epwmTimeBaseClock(epwm);
+        // Both high: A and B each inverted, joined, inverted back
+        HostSim_Wave lowA = outputA;
+        HostSim_Wave lowB = outputB;
+        invertWave(&lowA);
+        invertWave(&lowB);
+        HostSim_Wave bothHigh = lowA;
+        joinWaves(&bothHigh, &lowB);
+        invertWave(&bothHigh);
+        const double overlap = waveTotal(&bothHigh) * countTime;
+        if (epwm->checks == 0U || overlap > epwm->maximumOverlap) {
+            epwm->maximumOverlap = overlap;
+        }
+        epwm->checks ++;
+        const bool switchingA = outputA.count > 0U && !waveAlwaysHigh(&outputA);
+        const bool switchingB = outputB.count > 0U && !waveAlwaysHigh(&outputB);
+        if (switchingA && switchingB) {
+            // Both low: the gaps between the joined high times
+            HostSim_Wave bothLow = outputA;
+            joinWaves(&bothLow, &outputB);
+            invertWave(&bothLow);
+            // One gap before every rising edge of either output, a missing one is no dead time at all
+            double deadTime = 0.0;
+            if (bothLow.count >= outputA.count + outputB.count) {
+                unsigned gap;
+                for (gap = 0; gap < bothLow.count; gap ++) {
+                    if (gap == 0U || bothLow.length[gap] < deadTime) {
+                        deadTime = bothLow.length[gap];
+                    }
+                }
+            }
+            deadTime *= countTime;
+            if (epwm->switchingChecks == 0U || deadTime < epwm->minimumDeadTime) {
+                epwm->minimumDeadTime = deadTime;
+            }
+            epwm->switchingChecks ++;
+        }
+        const HostSim_EPWM *master = &epwms[0];
+        if (master->counting && epwmPeriodCycles(master) == epwmPeriodCycles(epwm)) {
+            const uint64_t period = epwmPeriodCycles(epwm);
+            const uint64_t lag = (epwm->originCycle + period - master->originCycle % period) % period;
+            epwm->lag = 360.0 * (double)lag / (double)period;
+        }
+    }
+}
+
+// Input held since the last call, in per unit of full scale
+static void advancePlant(HostSim_PlantParameters *plant, double input, double time) {
+    const double elapsed = time - plant->lastTime;
+    plant->lastTime = time;
+    if (elapsed <= 0.0) {
+        return;
+    }
+    if (!plant->secondOrder) {
+        // Exact for an input held over the interval
+        plant->output += (input - plant->output) * (1.0 - exp(-elapsed / plant->timeConstant));
+    } else {
+        // Also exact: the distance to the input decays along the two natural modes
+        const double omega = 2.0 * M_PI * plant->naturalFrequency;
+        const double error = plant->output - input;
+        if (fabs(plant->damping - 1.0) < 1e-9) {
+            const double decay = exp(-omega * elapsed);
+            const double slope = plant->rate + omega * error;
+            plant->output = input + (error + slope * elapsed) * decay;
+            plant->rate = (slope - omega * (error + slope * elapsed)) * decay;
+        } else {
+            const double complex root = csqrt(plant->damping * plant->damping - 1.0 + 0.0 * I);
+            const double complex first = omega * (-plant->damping + root);
+            const double complex second = omega * (-plant->damping - root);
+            const double complex weight = (plant->rate - second * error) / (first - second);
+            const double complex firstMode = weight * cexp(first * elapsed);
+            const double complex secondMode = (error - weight) * cexp(second * elapsed);
+            plant->output = input + creal(firstMode + secondMode);
+            plant->rate = creal(first * firstMode + second * secondMode);
+        }
+    }
+}
+
+// Averaged model for EPWM1A: the switching ripple is left out, the filter sees the duty cycle of each carrier period
+uint16_t HostSim_plantSource(uint32_t adcBase, uint16_t channel, double time, void *context) {
+    HostSim_PlantParameters *plant = (HostSim_PlantParameters *)context;
+    (void)adcBase;
+    (void)channel;
+    advancePlant(plant, plant->fromDAC ? dacs[0].active / 4095.0 : epwmDutyCycle(&epwms[0], 0U), time);
+    double value = 4095.0 * plant->output;
+    if (value < 0.0) {
+        value = 0.0;
+    } else if (value > 4095.0) {
+        value = 4095.0;
+    }
+    if (value < plant->minimum) {
+        plant->minimum = value;
+    }
+    if (value > plant->maximum) {
+        plant->maximum = value;
+    }
+    return (uint16_t)(value + 0.5);
+}
+
+static double complex continuousResponse(const HostSim_PlantParameters *plant, double frequency) {
+    if (!plant->secondOrder) {
+        return 1.0 / (1.0 + I * 2.0 * M_PI * frequency * plant->timeConstant);
+    }
+    const double ratio = frequency / plant->naturalFrequency;
+    return 1.0 / (1.0 - ratio * ratio + I * 2.0 * plant->damping * ratio);
+}
+
+// Hold of one sample period as a transfer function, times the sample frequency so it is 1 at DC
+static double complex holdResponse(double frequency, double sampleFrequency) {
+    const double angle = 2.0 * M_PI * frequency / sampleFrequency;
+    return fabs(angle) < 1e-12 ? 1.0 : (1.0 - cexp(-I * angle)) / (I * angle);
+}
+
+bool HostSim_plantResponse(double frequency, double sampleFrequency, double *gain, double *phase) {
+    if (adcSource != HostSim_plantSource) {
+        return false;
+    }
+    const HostSim_PlantParameters *plant = &plantParameters;
+    double complex response = continuousResponse(plant, frequency);
+    if (sampleFrequency > 0.0) {
+        // Images of the held stimulus around every multiple of the sample frequency alias back onto it
+        const double complex hold = holdResponse(frequency, sampleFrequency);
+        int image;
+        for (image = 1; image <= PLANT_IMAGES; image ++) {
+            const double above = frequency + image * sampleFrequency;
+            const double below = frequency - image * sampleFrequency;
+            response += (continuousResponse(plant, above) * holdResponse(above, sampleFrequency)
+                         + continuousResponse(plant, below) * holdResponse(below, sampleFrequency)) / hold;
+        }
+    }
+    *gain = cabs(response);
+    *phase = carg(response) * 180.0 / M_PI;
+    return true;
+}
+
+// "rc:TAU" (seconds) or "lc:F0:ZETA" (Hz, damping ratio)
+static bool parsePlant(const char *text, bool fromDAC) {
+    plantParameters.fromDAC = fromDAC;
+    plantParameters.minimum = 4095.0;
+    if (sscanf(text, "rc:%lf", &plantParameters.timeConstant) == 1 && plantParameters.timeConstant > 0.0) {
+        plantParameters.secondOrder = false;
+        return true;
+    }
+    if (sscanf(text, "lc:%lf:%lf", &plantParameters.naturalFrequency, &plantParameters.damping) == 2
+        && plantParameters.naturalFrequency > 0.0 && plantParameters.damping >= 0.0) {
+        plantParameters.secondOrder = true;
+        return true;
+    }
+    fprintf(stderr, "hostsim: plant must be rc:TAU or lc:F0:ZETA\n");
+    return false;
+}
+
+/*------------------------------CPU TIMERS------------------------------*/
+
+static uint64_t timerPeriodCycles(const HostSim_Timer *timer) {
+    return ((uint64_t)timer->period + 1U) * ((uint64_t)timer->prescaler + 1U);
+}
+
+void CPUTimer_stopTimer(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    HostSim_Timer *timer = TIMER_OF(base);
+    if (timer->running) {
+        const uint64_t elapsed = (cycles - timer->reloadCycle) / ((uint64_t)timer->prescaler + 1U);
+        timer->frozenCount = timer->period - (uint32_t)(elapsed % ((uint64_t)timer->period + 1U));
+    }
+    timer->running = false;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void CPUTimer_startTimer(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    HostSim_Timer *timer = TIMER_OF(base);
+    // Start also reloads the counter from the period register
+    timer->running = true;
+    timer->reloadCycle = cycles;
+    timer->nextExpiry = cycles + timerPeriodCycles(timer);
+    pthread_cond_signal(&hardwareCondition);
+    pthread_mutex_unlock(&simMutex);
+}
+
+void CPUTimer_reloadTimerCounter(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    HostSim_Timer *timer = TIMER_OF(base);
+    timer->reloadCycle = cycles;
+    timer->nextExpiry = cycles + timerPeriodCycles(timer);
+    timer->frozenCount = timer->period;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void CPUTimer_setPeriod(uint32_t base, uint32_t periodCount) {
+    pthread_mutex_lock(&simMutex);
+    TIMER_OF(base)->period = periodCount;
+    pthread_mutex_unlock(&simMutex);
+}
+
+// Cycle count as code reading a counter sees it, simMutex held. Host time only fills the gap up to the
+// next event: the hardware catches up with nothing later, and a count read after it must not be smaller
+static uint64_t observedCycles(void) {
+    uint64_t now = cycles;
+    if (inInterrupt) {
+        // Virtual time stands still inside an ISR, count its host run time so ISRs can time themselves
+        now += (uint64_t)((hostNanoseconds() - cpus[cpuIndex].interruptStartNanoseconds) * (HOSTSIM_SYSCLK_FREQ / 1e9));
+    } else if (pace > 0.0) {
+        // Paced run: the background loop sees time pass between events
+        const uint64_t paced = (uint64_t)((hostNanoseconds() - paceStart) * pace * (HOSTSIM_SYSCLK_FREQ / 1e9));
+        if (paced > now) {
+            now = paced;
+        }
+    }
+    const uint64_t next = nextEventCycle();
+    if (now > next && next >= cycles) {
+        now = next;
+    }
+    if (now < lastObserved) {
+        now = lastObserved;
+    }
+    lastObserved = now;
+    return now;
+}
+
+uint32_t CPUTimer_getTimerCount(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    const HostSim_Timer *timer = TIMER_OF(base);
+    uint32_t count = timer->frozenCount;
+    if (timer->running) {
+        const uint64_t elapsed = (observedCycles() - timer->reloadCycle) / ((uint64_t)timer->prescaler + 1U);
+        count = timer->period - (uint32_t)(elapsed % ((uint64_t)timer->period + 1U));
+    }
+    pthread_mutex_unlock(&simMutex);
+    return count;
+}
+
+void CPUTimer_setPreScaler(uint32_t base, uint16_t prescaler) {
+    pthread_mutex_lock(&simMutex);
+    TIMER_OF(base)->prescaler = prescaler;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void CPUTimer_enableInterrupt(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    TIMER_OF(base)->interruptEnabled = true;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void CPUTimer_disableInterrupt(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    TIMER_OF(base)->interruptEnabled = false;
+    pthread_mutex_unlock(&simMutex);
+}
+
+bool CPUTimer_getTimerOverflowStatus(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    const bool status = TIMER_OF(base)->overflow;
+    pthread_mutex_unlock(&simMutex);
+    return status;
+}
+
+void CPUTimer_clearOverflowFlag(uint32_t base) {
+    pthread_mutex_lock(&simMutex);
+    TIMER_OF(base)->overflow = false;
+    pthread_mutex_unlock(&simMutex);
+}
+
+/*------------------------------SYSCTL AND DEVICE------------------------------*/
+
+void SysCtl_enablePeripheral(SysCtl_PeripheralPCLOCKCR peripheral) {
+    pthread_mutex_lock(&simMutex);
+    // EPWM clock enables are in PCLKCR2, one bit per module; TBCLKSYNC starts every enabled time base together
+    if (peripheral == SYSCTL_PERIPH_CLK_TBCLKSYNC) {
+        tbclkSync = true;
+        updateEPWMTimeBases(-1);
+    } else if ((peripheral & 0x1FU) == 0x02U) {
+        epwms[(peripheral >> 8) % EPWMS].clockEnabled = true;
+        updateEPWMTimeBases(-1);
+    }
+    pthread_cond_signal(&hardwareCondition);
+    pthread_mutex_unlock(&simMutex);
+}
+
+void SysCtl_disablePeripheral(SysCtl_PeripheralPCLOCKCR peripheral) {
+    pthread_mutex_lock(&simMutex);
+    if (peripheral == SYSCTL_PERIPH_CLK_TBCLKSYNC) {
+        tbclkSync = false;
+        updateEPWMTimeBases(-1);
+    } else if ((peripheral & 0x1FU) == 0x02U) {
+        epwms[(peripheral >> 8) % EPWMS].clockEnabled = false;
+        updateEPWMTimeBases(-1);
+    }
+    pthread_mutex_unlock(&simMutex);
+}
+
+void SysCtl_resetPeripheral(SysCtl_PeripheralSOFTPRES peripheral) {
+    pthread_mutex_lock(&simMutex);
+    if ((peripheral & 0x1FU) == 0x0DU) {
+        // CPUSEL11 is a device configuration register, the reset keeps the owner
+        HostSim_ADC *adc = &adcs[(peripheral >> 8) % ADCS];
+        const uint16_t owner = adc->cpu;
+        memset(adc, 0, sizeof(HostSim_ADC));
+        adc->cpu = owner;
+    } else if ((peripheral & 0x1FU) == 0x02U) {
+        memset(&epwms[(peripheral >> 8) % EPWMS], 0, sizeof(HostSim_EPWM));
+        updateEPWMTimeBases(-1);
+    }
+    pthread_mutex_unlock(&simMutex);
+}
+
+// Driverlib delay loop takes 5 cycles per count
+void SysCtl_delay(uint32_t count) {
+    delayCycles((uint64_t)count * 5U);
+}
+
+void SysCtl_selectCPUForPeripheral(SysCtl_CPUSelPeriphInstance peripheral, uint16_t peripheralInst, SysCtl_CPUSel cpuInst) {
+    pthread_mutex_lock(&simMutex);
+    // Other peripherals keep interrupting CPU1
+    if (peripheral == SYSCTL_CPUSEL11_ADC && peripheralInst >= 1U && peripheralInst <= ADCS) {
+        adcs[peripheralInst - 1U].cpu = cpuInst == SYSCTL_CPUSEL_CPU2 ? 1U : 0U;
+    }
+    pthread_mutex_unlock(&simMutex);
+}
+
+void Device_init(void) {
+}
+
+void Device_initGPIO(void) {
+}
+
+static void *runTarget(void *argument);
+
+void Device_bootCPU2(uint32_t bootmode) {
+    (void)bootmode;
+    if (cpus[1].started) {
+        return;
+    }
+    cpus[1].started = true;
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, runTarget, (void *)(uintptr_t)1U) != 0) {
+        perror("pthread_create");
+        abort();
+    }
+    pthread_detach(thread);
+}
+
+/*------------------------------IPC------------------------------*/
+
+// Core the code calling with this type runs on
+static unsigned ipcLocal(IPC_Type_t ipcType) {
+    return ipcType == IPC_CPU2_L_CPU1_R ? 1U : 0U;
+}
+
+void IPC_setFlagLtoR(IPC_Type_t ipcType, uint32_t flags) {
+    const unsigned local = ipcLocal(ipcType);
+    pthread_mutex_lock(&simMutex);
+    const uint32_t raised = flags & ~ipcFlags[local];
+    ipcFlags[local] |= flags;
+    ipcFlagsSet[local] ++;
+    // Only a flag going up interrupts, one already pending is not raised again
+    unsigned flag;
+    for (flag = 0; flag < IPC_INTERRUPT_FLAGS; flag ++) {
+        if (raised & (1UL << flag)) {
+            raiseInterrupt(local ^ 1U, ipcInterrupts[flag]);
+        }
+    }
+    pthread_mutex_unlock(&simMutex);
+}
+
+void IPC_clearFlagLtoR(IPC_Type_t ipcType, uint32_t flags) {
+    pthread_mutex_lock(&simMutex);
+    ipcFlags[ipcLocal(ipcType)] &= ~flags;
+    pthread_mutex_unlock(&simMutex);
+}
+
+void IPC_ackFlagRtoL(IPC_Type_t ipcType, uint32_t flags) {
+    pthread_mutex_lock(&simMutex);
+    ipcFlags[ipcLocal(ipcType) ^ 1U] &= ~flags;
+    pthread_mutex_unlock(&simMutex);
+}
+
+bool IPC_isFlagBusyLtoR(IPC_Type_t ipcType, uint32_t flags) {
+    return (ipcFlags[ipcLocal(ipcType)] & flags) != 0UL;
+}
+
+bool IPC_isFlagBusyRtoL(IPC_Type_t ipcType, uint32_t flags) {
+    return (ipcFlags[ipcLocal(ipcType) ^ 1U] & flags) != 0UL;
+}
+
+// Busy waits, as on the target: the other core runs on its own thread meanwhile. A core spinning with INTM set
+// would otherwise hold the hardware thread on its first pending ISR, and with it the other core's delays
+void IPC_waitForFlag(IPC_Type_t ipcType, uint32_t flags) {
+    cpus[cpuIndex].waitingIPC = true;
+    while ((ipcFlags[ipcLocal(ipcType) ^ 1U] & flags) != flags) {
+        sched_yield();
+    }
+    cpus[cpuIndex].waitingIPC = false;
+}
+
+void IPC_waitForAck(IPC_Type_t ipcType, uint32_t flags) {
+    cpus[cpuIndex].waitingIPC = true;
+    while ((ipcFlags[ipcLocal(ipcType)] & flags) != 0UL) {
+        sched_yield();
+    }
+    cpus[cpuIndex].waitingIPC = false;
+}
+
+void IPC_sync(IPC_Type_t ipcType, uint32_t flag) {
+    IPC_setFlagLtoR(ipcType, flag);
+    IPC_waitForFlag(ipcType, flag);
+    IPC_ackFlagRtoL(ipcType, flag);
+    IPC_waitForAck(ipcType, flag);
+}
+
+uint64_t IPC_getCounter(IPC_Type_t ipcType) {
+    (void)ipcType;
+    pthread_mutex_lock(&simMutex);
+    const uint64_t count = observedCycles();
+    pthread_mutex_unlock(&simMutex);
+    return count;
+}
+
+void IPC_registerInterrupt(IPC_Type_t ipcType, uint32_t ipcInt, void (*pfnHandler)(void)) {
+    (void)ipcType;
+    if (ipcInt >= IPC_INTERRUPT_FLAGS) {
+        fprintf(stderr, "hostsim: bad IPC interrupt %u\n", (unsigned)ipcInt);
+        abort();
+    }
+    Interrupt_register(ipcInterrupts[ipcInt], pfnHandler);
+    Interrupt_enable(ipcInterrupts[ipcInt]);
+}
+
+/*------------------------------HARDWARE LOOP------------------------------*/
+
+__attribute__((weak)) void HostSim_setup(void) {
+}
+
+// Single-core builds: nothing to boot on CPU2
+__attribute__((weak)) void HostSim_cpu2Main(void) {
+    fprintf(stderr, "hostsim: CPU2 booted without a program, build one with -Dmain=HostSim_cpu2Main\n");
+}
+
+// Fires timers and peripheral events due at the current cycle, simMutex held
+static void processDueEvents(void) {
+    unsigned index;
+    for (index = 0; index < TIMERS; index ++) {
+        HostSim_Timer *timer = &timers[index];
+        while (timer->running && timer->nextExpiry <= cycles) {
+            timer->reloadCycle = timer->nextExpiry;
+            timer->nextExpiry += timerPeriodCycles(timer);
+            timer->overflow = true;
+            timer->expiries ++;
+            if (timer->interruptEnabled) {
+                raiseInterrupt(0U, timerInterrupts[index]);
+            }
+            triggerSOCs(0U, (uint16_t)(ADC_TRIGGER_CPU1_TINT0 + index), false);
+            triggerDMA((uint16_t)(DMA_TRIGGER_TINT0 + index));
+        }
+    }
+    processEPWMEvents();
+    // Oldest due event first so ADC samples and conversions stay ordered
+    while (eventCount > 0U && events[0].cycle <= cycles) {
+        const HostSim_Event event = popEvent();
+        if (event.type == EVENT_SCI_TRANSMITTED) {
+            processSCIEvent(&event);
+        } else if (event.type == EVENT_SCI_RECEIVED) {
+            processSCIReceiveEvent(&event);
+        } else {
+            processADCEvent(&event);
+        }
+    }
+}
+
+static uint64_t nextEventCycle(void) {
+    uint64_t next = NO_EVENT;
+    unsigned index;
+    for (index = 0; index < TIMERS; index ++) {
+        if (timers[index].running && timers[index].nextExpiry < next) {
+            next = timers[index].nextExpiry;
+        }
+    }
+    for (index = 0; index < EPWMS; index ++) {
+        const HostSim_EPWM *epwm = &epwms[index];
+        unsigned trigger;
+        for (trigger = 0; epwm->counting && trigger < EPWM_TRIGGERS; trigger ++) {
+            if (epwm->triggers[trigger].enabled && epwm->triggers[trigger].next < next) {
+                next = epwm->triggers[trigger].next;
+            }
+        }
+    }
+    if (eventCount > 0U && events[0].cycle < next) {
+        next = events[0].cycle;
+    }
+    for (index = 0; index < CPUS; index ++) {
+        if (cpus[index].delaying && cpus[index].delayWake < next) {
+            next = cpus[index].delayWake;
+        }
+    }
+    return next;
+}
+
+// A core whose delay is over but has not resumed yet
+static bool delayDue(void) {
+    unsigned index;
+    for (index = 0; index < CPUS; index ++) {
+        if (cpus[index].delaying && cycles >= cpus[index].delayWake) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Sleeps until a target signals the hardware or the timeout passes, simMutex held
+static void waitForTargets(uint64_t nanoseconds) {
+    struct timespec timeout;
+    clock_gettime(CLOCK_REALTIME, &timeout);
+    timeout.tv_sec += (time_t)(nanoseconds / 1000000000ULL);
+    timeout.tv_nsec += (long)(nanoseconds % 1000000000ULL);
+    if (timeout.tv_nsec >= 1000000000L) {
+        timeout.tv_sec ++;
+        timeout.tv_nsec -= 1000000000L;
+    }
+    pthread_cond_timedwait(&hardwareCondition, &simMutex, &timeout);
+}
+
+// Every started core has returned from its main
+static bool targetsFinished(void) {
+    unsigned index;
+    for (index = 0; index < CPUS; index ++) {
+        if (cpus[index].started && !cpus[index].finished) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void runHardware(void) {
+    pthread_mutex_lock(&simMutex);
+    uint64_t idleSince = 0U;
+    while (cycles < endCycle) {
+        if (delayDue()) {
+            // Clock held until the core resumes: spinning here would starve it of the host CPU, and of simMutex
+            pthread_cond_broadcast(&targetCondition);
+            waitForTargets(1000000U);
+            continue;
+        }
+        uint64_t next = nextEventCycle();
+        if (pace > 0.0 && next != NO_EVENT) {
+            // Paced run: sleep until the next event is due so the background loop gets host time meanwhile.
+            // A delay started meanwhile may be due sooner, so a target's signal ends the sleep
+            const uint64_t dueCycle = next < endCycle ? next : endCycle;
+            const uint64_t due = paceStart + (uint64_t)(dueCycle / HOSTSIM_SYSCLK_FREQ / pace * 1e9);
+            const uint64_t now = hostNanoseconds();
+            if (due > now + 20000U) {
+                waitForTargets(due - now);
+                continue;
+            }
+            // Behind the pace (a host stall, or more events than the host keeps up with), the overdue events are not
+            // caught up on back to back, which would starve the background loop of its time: paced time slips instead
+            if (now > due + PACE_MAX_LAG) {
+                paceStart += now - due - PACE_MAX_LAG;
+                stalls ++;
+            }
+        }
+        if (next == NO_EVENT) {
+            // Nothing scheduled: wait for the target to start a timer or a delay
+            if (targetsFinished()) {
+                break;
+            }
+            if (idleSince == 0U) {
+                idleSince = hostNanoseconds();
+            } else if (hostNanoseconds() - idleSince > 2000000000ULL) {
+                fprintf(stderr, "hostsim: target idle with nothing scheduled, stopping\n");
+                break;
+            }
+            waitForTargets(10000000U);
+            continue;
+        }
+        idleSince = 0U;
+        cycles = next < endCycle ? next : endCycle;
+        processDueEvents();
+        if (delayDue()) {
+            pthread_cond_broadcast(&targetCondition);
+        }
+        pthread_mutex_unlock(&simMutex);
+        deliverInterrupts();
+        pthread_mutex_lock(&simMutex);
+    }
+    simulationEnded = true;
+    pthread_mutex_unlock(&simMutex);
+}
+
+// Thread of one core, argument is its index
+static void *runTarget(void *argument) {
+    cpuIndex = (unsigned)(uintptr_t)argument;
+    HostSim_CPU *cpu = &cpus[cpuIndex];
+    // INTM is set after reset
+    pthread_mutex_lock(&cpu->mutex);
+    cpu->masksInterrupts = true;
+    cpu->startNanoseconds = threadNanoseconds();
+    if (cpuIndex == 0U) {
+        HostSim_targetMain();
+    } else {
+        HostSim_cpu2Main();
+    }
+    if (cpu->masksInterrupts) {
+        cpu->masksInterrupts = false;
+        pthread_mutex_unlock(&cpu->mutex);
+    }
+    cpu->finished = true;
+    pthread_mutex_lock(&simMutex);
+    pthread_cond_signal(&hardwareCondition);
+    pthread_mutex_unlock(&simMutex);
+    return NULL;
+}
+
+/*------------------------------REPORT------------------------------*/
+
+static const char *counterModeName(uint16_t mode) {
+    switch (mode) {
+        case EPWM_COUNTER_MODE_UP: return "UP";
+        case EPWM_COUNTER_MODE_DOWN: return "DOWN";
+        case EPWM_COUNTER_MODE_UP_DOWN: return "UP_DOWN";
+        default: return "STOP_FREEZE";
+    }
+}
+
+// In-place radix-2 FFT, length a power of two
+static void fft(double complex *data, unsigned length) {
+    unsigned index;
+    unsigned reversed = 0U;
+    for (index = 1U; index < length; index ++) {
+        unsigned bit = length >> 1;
+        while (reversed & bit) {
+            reversed ^= bit;
+            bit >>= 1;
+        }
+        reversed |= bit;
+        if (index < reversed) {
+            const double complex swap = data[index];
+            data[index] = data[reversed];
+            data[reversed] = swap;
+        }
+    }
+    unsigned span;
+    for (span = 2U; span <= length; span <<= 1) {
+        const double complex step = cexp(-2.0 * M_PI * I / span);
+        unsigned start;
+        for (start = 0U; start < length; start += span) {
+            double complex twiddle = 1.0;
+            unsigned offset;
+            for (offset = 0U; offset < span / 2U; offset ++) {
+                const double complex odd = twiddle * data[start + offset + span / 2U];
+                data[start + offset + span / 2U] = data[start + offset] - odd;
+                data[start + offset] += odd;
+                twiddle *= step;
+            }
+        }
+    }
+}
+
+// Bins of the window's main lobe on each side of a tone (4-term Blackman-Harris)
+#define SPECTRUM_LOBE 4U
+
+// Power of the main lobe around bin, clipped to the spectrum
+static double lobePower(const double *power, unsigned bins, unsigned bin) {
+    double sum = 0.0;
+    const unsigned first = bin > SPECTRUM_LOBE ? bin - SPECTRUM_LOBE : 0U;
+    unsigned index;
+    for (index = first; index <= bin + SPECTRUM_LOBE && index < bins; index ++) {
+        sum += power[index];
+    }
+    return sum;
+}
+
+// Spectral purity of a DAC pin: the held output (zero-order hold between writes) sampled at 8 times the update
+// rate over the last 20 periods or more, so the images of the update rate are in the band
+static double printDACSpectrum(unsigned index, double frequency) {
+    const HostSim_DAC *dac = &dacs[index];
+    const uint64_t captured = dac->writes < DAC_CAPTURE ? dac->writes : DAC_CAPTURE;
+    if (captured < 64U || frequency <= 0.0) {
+        return NAN;
+    }
+    const uint64_t oldest = dac->writes - captured;
+    const uint64_t firstCycle = dacCaptureCycles[index][oldest % DAC_CAPTURE];
+    const uint64_t lastWrite = dacCaptureCycles[index][(dac->writes - 1U) % DAC_CAPTURE];
+    if (lastWrite <= firstCycle) {
+        return NAN;
+    }
+    const double updateRate = (captured - 1U) * HOSTSIM_SYSCLK_FREQ / (double)(lastWrite - firstCycle);
+    const double analysisRate = 8.0 * updateRate < HOSTSIM_SYSCLK_FREQ ? 8.0 * updateRate : HOSTSIM_SYSCLK_FREQ;
+    const double step = HOSTSIM_SYSCLK_FREQ / analysisRate; // Cycles per point
+    unsigned length = 1024U;
+    while (length < SPECTRUM_MAX_POINTS && length < 20.0 * analysisRate / frequency) {
+        length <<= 1;
+    }
+    while (length > 1024U && length * step > (double)(cycles - firstCycle)) {
+        length >>= 1;
+    }
+    if (length * step > (double)(cycles - firstCycle)) {
+        return NAN;
+    }
+    double complex *points = malloc(length * sizeof(double complex));
+    double *power = malloc((length / 2U + 1U) * sizeof(double));
+    if (points == NULL || power == NULL) {
+        free(points);
+        free(power);
+        return NAN;
+    }
+    // Held value at each point, the most recent writes
+    const double start = (double)cycles - length * step;
+    uint64_t write = oldest;
+    double mean = 0.0;
+    unsigned point;
+    for (point = 0U; point < length; point ++) {
+        const double time = start + point * step;
+        while (write + 1U < dac->writes && (double)dacCaptureCycles[index][(write + 1U) % DAC_CAPTURE] <= time) {
+            write ++;
+        }
+        points[point] = dacCaptureValues[index][write % DAC_CAPTURE];
+        mean += creal(points[point]);
+    }
+    mean /= length;
+    for (point = 0U; point < length; point ++) {
+        const double phase = 2.0 * M_PI * point / length;
+        const double window = 0.35875 - 0.48829 * cos(phase) + 0.14128 * cos(2.0 * phase) - 0.01168 * cos(3.0 * phase);
+        points[point] = (creal(points[point]) - mean) * window;
+    }
+    fft(points, length);
+    const unsigned bins = length / 2U + 1U;
+    unsigned bin;
+    for (bin = 0U; bin < bins; bin ++) {
+        power[bin] = creal(points[bin]) * creal(points[bin]) + cimag(points[bin]) * cimag(points[bin]);
+    }
+    // Fundamental: largest bin clear of DC
+    unsigned peak = SPECTRUM_LOBE + 1U;
+    for (bin = SPECTRUM_LOBE + 1U; bin < bins; bin ++) {
+        if (power[bin] > power[peak]) {
+            peak = bin;
+        }
+    }
+    const double fundamental = lobePower(power, bins, peak);
+    // Everything else above the DC lobe is noise, distortion and images; the largest other bin is the worst spur
+    double rest = 0.0;
+    unsigned spur = 0U;
+    for (bin = SPECTRUM_LOBE + 1U; bin < bins; bin ++) {
+        if (bin + SPECTRUM_LOBE >= peak && bin <= peak + SPECTRUM_LOBE) {
+            continue;
+        }
+        rest += power[bin];
+        if (spur == 0U || power[bin] > power[spur]) {
+            spur = bin;
+        }
+    }
+    double harmonics = 0.0;
+    unsigned harmonic;
+    for (harmonic = 2U; harmonic <= 5U && harmonic * peak + SPECTRUM_LOBE < bins; harmonic ++) {
+        harmonics += lobePower(power, bins, harmonic * peak);
+    }
+    // A constant output (the end of a sweep) has no tone, and a pure one no spur, to give a ratio against
+    if (fundamental <= 0.0 || spur == 0U || power[spur] <= 0.0) {
+        free(points);
+        free(power);
+        return NAN;
+    }
+    const double resolution = analysisRate / length;
+    const double sinad = 10.0 * log10(fundamental / rest);
+    printf("  spectrum %u points at %.0f Hz (%.1f Hz bins, updates at %.0f Hz): tone %.1f Hz, SINAD %.1f dB (ENOB %.1f), "
+           "SFDR %.1f dBc (spur at %.0f Hz), THD %.1f dBc\n", length, analysisRate, resolution, updateRate, peak * resolution,
+           sinad, (sinad - 1.76) / 6.02, 10.0 * log10(power[peak] / power[spur]), spur * resolution,
+           harmonics > 0.0 ? 10.0 * log10(harmonics / fundamental) : -INFINITY);
+    free(points);
+    free(power);
+    return sinad;
+}
+
+static void writeLine(const char *line, void *context) {
+    (void)context;
+    printf("%s\n", line);
+}
+
+static double wrapDegrees(double phase) {
+    while (phase > 180.0) {
+        phase -= 360.0;
+    }
+    while (phase <= -180.0) {
+        phase += 360.0;
+    }
+    return phase;
+}
+
+// Largest error of a Bode point against the sampled filter
+#define BODE_GAIN_LIMIT 0.1 // dB
+#define BODE_PHASE_LIMIT 1.0 // Degrees
+
+// Bode table of the target against the filter given with -f, as sampled through the DAC hold and on its own
+static void compareBode(void) {
+    const BODE_Analyzer *analyzer = (const BODE_Analyzer *)REPORT_find("bode");
+    double gains[2];
+    double phases[2];
+    if (analyzer == 0 || analyzer->rows == 0U || !HostSim_plantResponse(1.0, 0.0, &gains[0], &phases[0])) {
+        return;
+    }
+    double errors[4] = {0.0, 0.0, 0.0, 0.0}; // Sampled dB and degrees, continuous dB and degrees
+    // Every point of a finished sweep settled and within the limits of the sampled filter
+    bool passed = !analyzer->running && analyzer->rows == analyzer->settings.points * analyzer->settings.tones;
+    printf("Bode against the plant filter\n");
+    unsigned row;
+    for (row = 0; row < analyzer->rows; row ++) {
+        const BODE_Row *entry = &analyzer->table[row];
+        HostSim_plantResponse(entry->frequency, analyzer->sampleFrequency, &gains[0], &phases[0]);
+        HostSim_plantResponse(entry->frequency, 0.0, &gains[1], &phases[1]);
+        unsigned model;
+        for (model = 0; model < 2U; model ++) {
+            const double gainError = fabs(entry->magnitude - 20.0 * log10(gains[model]));
+            const double phaseError = fabs(wrapDegrees(entry->phase - phases[model]));
+            errors[2U * model] = gainError > errors[2U * model] ? gainError : errors[2U * model];
+            errors[2U * model + 1U] = phaseError > errors[2U * model + 1U] ? phaseError : errors[2U * model + 1U];
+        }
+        // A weak response is held to half an ADC code of its peak instead: with a few samples per period the
+        // quantisation error repeats every period and no window averages it out
+        const double codes = gains[0] * analyzer->settings.amplitude / analyzer->settings.tones;
+        const double gainLimit = fmax(BODE_GAIN_LIMIT, 20.0 * log10(1.0 + 0.5 / codes));
+        const double phaseLimit = fmax(BODE_PHASE_LIMIT, atan(0.5 / codes) * 180.0 / M_PI);
+        const bool rowPassed = entry->settled && fabs(entry->magnitude - 20.0 * log10(gains[0])) <= gainLimit
+                               && fabs(wrapDegrees(entry->phase - phases[0])) <= phaseLimit;
+        passed = passed && rowPassed;
+        printf("  %9.2f Hz measured %8.2f dB %7.1f deg, filter sampled %8.2f dB %7.1f deg, continuous %8.2f dB %7.1f deg%s\n",
+               entry->frequency, entry->magnitude, entry->phase, 20.0 * log10(gains[0]), phases[0],
+               20.0 * log10(gains[1]), phases[1], rowPassed ? "" : entry->settled ? " FAIL" : " FAIL (not settled)");
+    }
+    REPORT_check(passed);
+    printf("  largest error against the sampled filter %.3f dB %.2f deg, the continuous one %.3f dB %.2f deg\n",
+           errors[0], errors[1], errors[2], errors[3]);
+    printf("  %u of %u points, limit %.1f dB %.0f deg or half an ADC code of a weaker response %s\n", analyzer->rows,
+           analyzer->settings.points * analyzer->settings.tones, BODE_GAIN_LIMIT, BODE_PHASE_LIMIT, passed ? "ok" : "FAIL");
+}
+
+static void printReport(double hostSeconds) {
+    const double seconds = HostSim_getTime();
+    printf("Host simulation: %.6f s virtual (%llu SYSCLK cycles) in %.3f s host\n", seconds, (unsigned long long)cycles, hostSeconds);
+    if (stalls > 0U) {
+        printf("Paced time slipped %llu times, the host over 1 ms behind\n", (unsigned long long)stalls);
+    }
+    unsigned index;
+    for (index = 0; index < CPUS; index ++) {
+        const HostSim_CPU *cpu = &cpus[index];
+        // Single-core programs keep the report they always had
+        const char *name = index == 0U ? (cpus[1].started ? "CPU1 " : "") : "CPU2 ";
+        if (!cpu->started) {
+            continue;
+        }
+        if (cpu->startupDone) {
+            printf("%sStartup to EINT: %.1f us host CPU, %.1f us virtual (%llu cycles)\n", name, cpu->startupNanoseconds / 1e3,
+                   cpu->startupCycles / HOSTSIM_SYSCLK_FREQ * 1e6, (unsigned long long)cpu->startupCycles);
+        }
+        printf("%sInterrupts\n", name);
+        unsigned group;
+        unsigned channel;
+        for (group = 1; group < GROUPS; group ++) {
+            for (channel = 0; channel < CHANNELS; channel ++) {
+                const HostSim_Vector *vector = &cpu->vectors[group][channel];
+                if (vector->calls == 0U && vector->overruns == 0U && !(vector->pending && vector->enabled)) {
+                    continue;
+                }
+                printf("  INT%u.%u calls %llu rate %.1f Hz mean %.1f ns max %llu ns load %.3f%% overruns %llu%s\n", group, channel,
+                       (unsigned long long)vector->calls, seconds > 0.0 ? vector->calls / seconds : 0.0,
+                       vector->calls ? (double)vector->totalNanoseconds / vector->calls : 0.0,
+                       (unsigned long long)vector->maxNanoseconds, seconds > 0.0 ? vector->totalNanoseconds / seconds * 1e-7 : 0.0,
+                       (unsigned long long)vector->overruns,
+                       group <= 12U && (cpu->pieBlockedGroups & (1U << (group - 1U))) ? " (group never acknowledged)" : "");
+            }
+        }
+    }
+    if (cpus[1].started) {
+        printf("IPC flags set CPU1 to CPU2 %llu CPU2 to CPU1 %llu\n", (unsigned long long)ipcFlagsSet[0],
+               (unsigned long long)ipcFlagsSet[1]);
+    }
+    for (index = 0; index < TIMERS; index ++) {
+        if (timers[index].expiries) {
+            printf("CPUTIMER%u period %lu expiries %llu rate %.1f Hz\n", index, (unsigned long)timers[index].period + 1UL,
+                   (unsigned long long)timers[index].expiries, timers[index].expiries / seconds);
+        }
+    }
+    for (index = 0; index < DACS; index ++) {
+        const HostSim_DAC *dac = &dacs[index];
+        double sinad = NAN;
+        if (dac->writes > 0U) {
+            double frequency = 0.0;
+            if (dac->crossings > 1U && dac->lastCrossing > dac->firstCrossing) {
+                frequency = (dac->crossings - 1U) * HOSTSIM_SYSCLK_FREQ / (double)(dac->lastCrossing - dac->firstCrossing);
+            }
+            printf("DAC%c writes %llu min %u max %u mean %.1f frequency %.3f Hz\n", 'A' + index,
+                   (unsigned long long)dac->writes, dac->minimum, dac->maximum, dac->sum / dac->writes, frequency);
+            sinad = printDACSpectrum(index, frequency);
+        }
+        if (minimumSINAD[index] > 0.0) {
+            // No spectrum at all fails too: the program was expected to play a tone
+            const bool passed = REPORT_check(sinad >= minimumSINAD[index]);
+            printf("DAC%c SINAD minimum %.1f dB %s\n", 'A' + index, minimumSINAD[index],
+                   passed ? "ok" : isnan(sinad) ? "FAIL (no tone)" : "FAIL");
+        }
+    }
+    for (index = 0; index < ADCS; index ++) {
+        if (adcs[index].conversions) {
+            printf("ADC%c conversions %llu overflows %llu\n", 'A' + index, (unsigned long long)adcs[index].conversions,
+                   (unsigned long long)adcs[index].overflows);
+        }
+    }
+    for (index = 0; index < DMA_CHANNELS; index ++) {
+        if (dmas[index].bursts) {
+            printf("DMA CH%u bursts %llu transfers %llu\n", index + 1U, (unsigned long long)dmas[index].bursts,
+                   (unsigned long long)dmas[index].transfers);
+        }
+    }
+    if (adcSource == HostSim_plantSource) {
+        if (plantParameters.secondOrder) {
+            printf("Plant LC f0 %.1f Hz zeta %.3f", plantParameters.naturalFrequency, plantParameters.damping);
+        } else {
+            printf("Plant RC tau %.3f ms", 1e3 * plantParameters.timeConstant);
+        }
+        printf(" from %s", plantParameters.fromDAC ? "DACA" : "EPWM1A");
+        printf(" output min %.0f max %.0f last %.0f (codes)\n", plantParameters.minimum, plantParameters.maximum,
+               4095.0 * plantParameters.output);
+    }
+    for (index = 0; index < SCIS; index ++) {
+        const HostSim_SCI *sci = &scis[index];
+        if (sci->bytesSent == 0U && sci->txOverflows == 0U && sci->bytesReceived == 0U) {
+            continue;
+        }
+        // Line usage: time spent shifting characters over the time between the first and the last
+        double rate = 0.0;
+        double usage = 0.0;
+        if (sci->lastByteCycle > sci->firstByteCycle) {
+            const double span = (sci->lastByteCycle - sci->firstByteCycle) / HOSTSIM_SYSCLK_FREQ;
+            rate = (sci->bytesSent - 1U) / span;
+            usage = 100.0 * rate * sci->bitsPerCharacter / sci->baud;
+        }
+        printf("SCI%c baud %lu bytes %llu rate %.0f B/s line %.1f%% FIFO overflows %llu output drops %llu\n", 'A' + index,
+               (unsigned long)sci->baud, (unsigned long long)sci->bytesSent, rate, usage,
+               (unsigned long long)sci->txOverflows, (unsigned long long)sci->sinkDrops);
+        if (sci->bytesReceived) {
+            printf("  received %llu bytes, RX FIFO overflows %llu\n", (unsigned long long)sci->bytesReceived,
+                   (unsigned long long)sci->rxOverflows);
+        }
+    }
+    // Final compares included, even without an ISR since they were written
+    checkSwitching();
+    for (index = 0; index < EPWMS; index ++) {
+        const HostSim_EPWM *epwm = &epwms[index];
+        if (epwm->periodWrites == 0U && epwm->compareWrites == 0U) {
+            continue;
+        }
+        double frequency = 0.0;
+        if (epwm->period > 0U) {
+            frequency = epwm->counterMode == EPWM_COUNTER_MODE_UP_DOWN
+                ? epwmTimeBaseClock(epwm) / (2.0 * epwm->period)
+                : epwmTimeBaseClock(epwm) / (epwm->period + 1.0);
+        }
+        printf("EPWM%u %s mode %s TBPRD %u CMPA %u CMPB %u frequency %.1f Hz duty A %.2f%% B %.2f%% writes %llu\n", index + 1U,
+               epwm->clockEnabled ? "on" : "off", counterModeName(epwm->counterMode), epwm->period, epwm->compare[0],
+               epwm->compare[1], frequency, 100.0 * epwmDutyCycle(epwm, 0U), 100.0 * epwmDutyCycle(epwm, 1U),
+               (unsigned long long)(epwm->periodWrites + epwm->compareWrites));
+        const HostSim_EPWMTrigger *interrupt = &epwm->triggers[EPWM_TRIGGER_INT];
+        if (interrupt->pulses || interrupt->missed) {
+            printf("  interrupts %llu missed %llu (flag not cleared)\n", (unsigned long long)interrupt->pulses,
+                   (unsigned long long)interrupt->missed);
+        }
+        if (epwm->triggers[EPWM_TRIGGER_SOCA].pulses || epwm->triggers[EPWM_TRIGGER_SOCB].pulses) {
+            printf("  ADC start of conversions SOCA %llu SOCB %llu\n",
+                   (unsigned long long)epwm->triggers[EPWM_TRIGGER_SOCA].pulses,
+                   (unsigned long long)epwm->triggers[EPWM_TRIGGER_SOCB].pulses);
+        }
+        if (epwm->checks) {
+            // Never both high, and every edge at least the dead band the delays set (half a count of slack)
+            const double countTime = 1.0 / epwmTimeBaseClock(epwm);
+            const double deadBand = epwmDeadBand(epwm) * countTime;
+            const bool passed = REPORT_check(epwm->maximumOverlap == 0.0
+                                             && (epwm->switchingChecks == 0U
+                                                 || epwm->minimumDeadTime >= deadBand - 0.5 * countTime));
+            printf("  leg phase %.1f deg behind EPWM1, dead time min %.0f ns (dead band %.0f ns), shoot-through max %.0f ns over %llu checks",
+                   epwm->lag, 1e9 * epwm->minimumDeadTime, 1e9 * deadBand, 1e9 * epwm->maximumOverlap,
+                   (unsigned long long)epwm->checks);
+            printf("%s %s\n", epwm->switchingChecks == 0U ? " (outputs never both switching)" : "", passed ? "ok" : "FAIL");
+        }
+    }
+    for (index = 0; index < GPIOS; index ++) {
+        if (gpios[index].toggles || gpios[index].writes) {
+            printf("GPIO%u toggles %llu writes %llu\n", index, (unsigned long long)gpios[index].toggles,
+                   (unsigned long long)gpios[index].writes);
+        }
+    }
+    if (droppedEvents) {
+        printf("Dropped peripheral events %llu\n", (unsigned long long)droppedEvents);
+    }
+    // Reports the target's modules registered, then the checks against the simulated plant
+    REPORT_dumpAll(&writeLine, 0);
+    compareBode();
+}
+
+/*------------------------------MAIN------------------------------*/
+
+// Comma-separated dB, DACA first
+static bool parseSINADLimits(const char *text) {
+    unsigned index;
+    for (index = 0; index < DACS && *text != '\0'; index ++) {
+        char *end;
+        minimumSINAD[index] = *text == ',' ? 0.0 : strtod(text, &end);
+        if (*text != ',') {
+            if (end == text || minimumSINAD[index] < 0.0 || (*end != ',' && *end != '\0')) {
+                fprintf(stderr, "hostsim: SINAD limits must be dB,dB,dB\n");
+                return false;
+            }
+            text = end;
+        }
+        if (*text == ',') {
+            text ++;
+        }
+    }
+    return true;
+}
+
+static void printUsage(const char *program) {
+    fprintf(stderr, "usage: %s [-t seconds] [-s frequency] [-o trace.csv] [-r pace] [-u sci.bin|pty] [-p|-f rc:TAU|lc:F0:ZETA] [-n dB,...] [-c]\n", program);
+    fprintf(stderr, "  -t  virtual run time (default 1 s)\n");
+    fprintf(stderr, "  -r  virtual seconds per host second, so the background loop keeps up as on the target (default unpaced)\n");
+    fprintf(stderr, "  -s  feed every ADC input with a sine of this frequency instead of the DACA loopback,\n");
+    fprintf(stderr, "      ADCB and ADCC inputs 120 and 240 degrees behind\n");
+    fprintf(stderr, "  -p  feed every ADC input with EPWM1A through an RC (time constant in s) or LC (Hz, damping) filter\n");
+    fprintf(stderr, "  -f  feed every ADC input with DACA through the same filters, a known response to measure\n");
+    fprintf(stderr, "  -o  write every register write as cycle,peripheral,index,field,value\n");
+    fprintf(stderr, "  -u  write the bytes SCI-A transmits to a file, or to a new pseudo terminal with \"pty\"\n");
+    fprintf(stderr, "      (both ways: SCI-A receives what is written to the pty)\n");
+    fprintf(stderr, "  -n  minimum SINAD of the DACA, DACB and DACC spectra, a check each; empty or 0 leaves a DAC out\n");
+    fprintf(stderr, "  -c  fail the run when no check was recorded, for self-testing programs (REPORT_check)\n");
+}
+
+int main(int argc, char **argv) {
+    double seconds = 1.0;
+    bool requireChecks = false;
+    int option;
+    while ((option = getopt(argc, argv, "t:s:o:r:u:p:f:n:ch")) != -1) {
+        switch (option) {
+            case 't':
+                seconds = atof(optarg);
+                break;
+            case 'r':
+                pace = atof(optarg);
+                break;
+            case 's':
+                sineParameters.frequency = atof(optarg);
+                adcSource = HostSim_sineSource;
+                adcSourceContext = &sineParameters;
+                break;
+            case 'p':
+            case 'f':
+                if (!parsePlant(optarg, option == 'f')) {
+                    return 1;
+                }
+                adcSource = HostSim_plantSource;
+                adcSourceContext = &plantParameters;
+                break;
+            case 'o':
+                traceFile = fopen(optarg, "w");
+                if (traceFile == NULL) {
+                    perror(optarg);
+                    return 1;
+                }
+                break;
+            case 'u':
+                if (!openSCIOutput(optarg)) {
+                    return 1;
+                }
+                break;
+            case 'n':
+                if (!parseSINADLimits(optarg)) {
+                    return 1;
+                }
+                break;
+            case 'c':
+                requireChecks = true;
+                break;
+            default:
+                printUsage(argv[0]);
+                return option == 'h' ? 0 : 1;
+        }
+    }
+    endCycle = (uint64_t)(seconds * HOSTSIM_SYSCLK_FREQ);
+    HostSim_setup();
+    const uint64_t start = hostNanoseconds();
+    // Set before the target runs: code reading a counter first thing must already see paced time
+    paceStart = start;
+    pthread_t target;
+    cpus[0].started = true;
+    if (pthread_create(&target, NULL, runTarget, (void *)(uintptr_t)0U) != 0) {
+        perror("pthread_create");
+        return 1;
+    }
+    runHardware();
+    // The target loops forever, stop it with the process; hold the CPU so no ISR is half-run
+    pthread_mutex_lock(&simMutex);
+    printReport((hostNanoseconds() - start) / 1e9);
+    if (traceFile != NULL) {
+        fclose(traceFile);
+    }
+    if (sciOutput >= 0) {
+        close(sciOutput);
+    }
+    // A failed check fails the run, and so does none at all when checks were asked for
+    const uint16_t checks = REPORT_checkCount();
+    const uint16_t failures = REPORT_failureCount();
+    if (checks > 0U || requireChecks) {
+        printf("Checks %u, failed %u\n", checks, failures);
+    }
+    fflush(stdout);
+    _exit(failures > 0U || (requireChecks && checks == 0U) ? 1 : 0);
+}
@@ -0,0 +1,67 @@
+#ifndef HOSTSIM_H
+#define HOSTSIM_H
+
+/*------------------------------STANDARD LIBRARIES------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*------------------------------MACROS------------------------------*/
+
+// Virtual clock rate, one cycle is one SYSCLK period of the F28379D
+#define HOSTSIM_SYSCLK_FREQ 200000000.0
+
+/*------------------------------TYPES------------------------------*/
+
+// ADC input: returns the 12-bit code seen on a channel at a given virtual time in seconds
+typedef uint16_t (*HostSim_ADCSource)(uint32_t adcBase, uint16_t channel, double time, void *context);
+
+// Context of HostSim_sineSource, values in ADC codes
+typedef struct {
+    double frequency; // Hz
+    double amplitude; // Peak
+    double offset;
+} HostSim_SineParameters;
+
+// Context of HostSim_plantSource: averaged EPWM1A output, or the DACA output, through an RC or an LC filter
+typedef struct {
+    bool fromDAC; // DACA output as the filter input, advanced at every DACA write
+    bool secondOrder; // LC when true, RC otherwise
+    double timeConstant; // RC, seconds
+    double naturalFrequency; // LC, Hz
+    double damping; // LC, zeta
+    double output; // Per unit of full scale
+    double rate; // d(output)/dt, LC only
+    double lastTime;
+    double minimum; // Output watermarks, ADC codes
+    double maximum;
+} HostSim_PlantParameters;
+
+/*------------------------------FUNCTIONS------------------------------*/
+
+// Target program entry point, the main.c under test is built with -Dmain=HostSim_targetMain
+void HostSim_targetMain(void);
+// CPU2 program entry point, built separately with -Dmain=HostSim_cpu2Main and started by Device_bootCPU2
+void HostSim_cpu2Main(void);
+
+// Optional hook called before the target starts, a harness may override it to set sources
+void HostSim_setup(void);
+
+void HostSim_setADCSource(HostSim_ADCSource source, void *context);
+uint16_t HostSim_loopbackSource(uint32_t adcBase, uint16_t channel, double time, void *context);
+uint16_t HostSim_sineSource(uint32_t adcBase, uint16_t channel, double time, void *context);
+// EPWM1A duty cycle (0 to 1 is 0 to 4095 codes) or DACA filtered by the plant, for closed-loop and response tests
+uint16_t HostSim_plantSource(uint32_t adcBase, uint16_t channel, double time, void *context);
+// Analytic response of the plant given with -p or -f, gain and phase in degrees; false without a plant.
+// With a sample frequency, the response seen through a DAC hold and a sampler at that rate, over the held stimulus
+bool HostSim_plantResponse(double frequency, double sampleFrequency, double *gain, double *phase);
+
+uint64_t HostSim_getCycles(void);
+double HostSim_getTime(void);
+void HostSim_delayMicroseconds(uint32_t microseconds);
+
+// Global interrupt mask, both return true when interrupts were previously disabled
+bool HostSim_enableGlobalInterrupts(void);
+bool HostSim_disableGlobalInterrupts(void);
+
+#endif
@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""Generates src/common/fftTables.h/.c, the flash tables of the spectrum FFT.
+
+A real FFT of N points runs as a complex FFT of N / 2 points, so one set of
+tables sized for the largest transform serves every smaller one:
+
+- FFT_sineTable holds sin(2 pi i / FFT_MAX_POINTS) over a whole period. A
+  twiddle of a transform of n points is read with a stride of
+  FFT_MAX_POINTS / n, its cosine a quarter period further on.
+- FFT_bitReverseTable holds the bit-reversed index of every point of the
+  largest complex transform; a complex transform of m points takes
+  FFT_bitReverseTable[i] >> (FFT_MAX_BITS - 1 - log2(m)).
+
+    python3 tools/generateFFTTables.py                # 4096 points
+    python3 tools/generateFFTTables.py --bits 13      # 8192 points
+"""
+
+import argparse
+import math
+import os
+import struct
+
+
+def float_literal(value):
+    # Nearest float32, written with enough digits to read back exactly
+    value = struct.unpack("<f", struct.pack("<f", value))[0]
+    text = "%.9g" % value
+    if "." not in text and "e" not in text:
+        text += ".0"
+    return text + "f"
+
+
+def bit_reverse(index, bits):
+    result = 0
+    for _ in range(bits):
+        result = (result << 1) | (index & 1)
+        index >>= 1
+    return result
+
+
+def write_header(path, bits):
+    lines = [
+        "// Generated by tools/generateFFTTables.py, do not edit",
+        "#ifndef FFTTABLES_H",
+        "#define FFTTABLES_H",
+        "",
+        "/*------------------------------STANDARD LIBRARIES------------------------------*/",
+        "",
+        "#include <stdint.h>",
+        "",
+        "/*------------------------------MACROS------------------------------*/",
+        "",
+        "#define FFT_MAX_BITS %dU" % bits,
+        "#define FFT_MAX_POINTS (1U << FFT_MAX_BITS) // Largest real transform",
+        "",
+        "/*------------------------------TABLES------------------------------*/",
+        "",
+        "// sin(2 pi i / FFT_MAX_POINTS), cos(x) is FFT_sineTable[i + FFT_MAX_POINTS / 4]",
+        "extern const float FFT_sineTable[FFT_MAX_POINTS];",
+        "// Bit-reversed indices of a complex transform of FFT_MAX_POINTS / 2 points",
+        "extern const uint16_t FFT_bitReverseTable[FFT_MAX_POINTS / 2U];",
+        "",
+        "#endif",
+        "",
+    ]
+    with open(path, "w") as output:
+        output.write("\n".join(lines))
+
+
+def write_source(path, bits):
+    points = 1 << bits
+    sines = [float_literal(math.sin(2.0 * math.pi * index / points)) for index in range(points)]
+    # Exact zeros and ones where the angle is a multiple of a quarter period
+    for quarter, value in enumerate(["0.0f", "1.0f", "0.0f", "-1.0f"]):
+        sines[quarter * points // 4] = value
+    reversed_indices = ["%d" % bit_reverse(index, bits - 1) for index in range(points // 2)]
+    lines = [
+        "// Generated by tools/generateFFTTables.py, do not edit",
+        "/*------------------------------PROJECT LIBRARIES------------------------------*/",
+        "",
+        '#include "fftTables.h"',
+        "",
+        "/*------------------------------TABLES------------------------------*/",
+        "",
+        "// const data is placed in flash (.const) by the linker command file",
+        "const float FFT_sineTable[FFT_MAX_POINTS] = {",
+    ]
+    for first in range(0, len(sines), 6):
+        lines.append("    " + ", ".join(sines[first:first + 6]) + ("," if first + 6 < len(sines) else ""))
+    lines += ["};", "", "const uint16_t FFT_bitReverseTable[FFT_MAX_POINTS / 2U] = {"]
+    for first in range(0, len(reversed_indices), 12):
+        row = ", ".join(reversed_indices[first:first + 12])
+        lines.append("    " + row + ("," if first + 12 < len(reversed_indices) else ""))
+    lines += ["};", ""]
+    with open(path, "w") as output:
+        output.write("\n".join(lines))
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--bits", type=int, default=12, help="log2 of the largest real transform (default 12)")
+    parser.add_argument("--output", default=os.path.join(root, "src", "common"), help="output directory")
+    arguments = parser.parse_args()
+    # 16-bit indices, and the smallest transform the analyzer accepts is 256 points
+    if not 8 <= arguments.bits <= 15:
+        raise SystemExit("--bits must be between 8 and 15")
+    write_header(os.path.join(arguments.output, "fftTables.h"), arguments.bits)
+    write_source(os.path.join(arguments.output, "fftTables.c"), arguments.bits)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""Generates src/common/waveTables.h/.c, the flash waveform tables used by waveGen.
+
+Every table holds one period in WAVE_TABLE_LENGTH points plus a guard point
+(a copy of the first one) for interpolation. Values are offset binary:
+32768 is zero, 32768 +/- 32767 are the peaks.
+
+User shapes come from text files with one sample per line (any scale, any
+length); they are normalised to +/-1 and resampled to the table length:
+
+    python3 tools/generateWaveTables.py --shape pulse=shapes/pulse.txt
+"""
+
+import argparse
+import math
+import os
+import re
+
+TABLE_BITS = 9
+TABLE_LENGTH = 1 << TABLE_BITS
+
+
+def sine(x):
+    return math.sin(2.0 * math.pi * x)
+
+
+def triangle(x):
+    if x < 0.25:
+        return 4.0 * x
+    if x < 0.75:
+        return 2.0 - 4.0 * x
+    return 4.0 * x - 4.0
+
+
+def square(x):
+    return 1.0 if x < 0.5 else -1.0
+
+
+def sawtooth(x):
+    # Starts at zero like the sine, jumps from +1 to -1 at half period
+    return 2.0 * x if x < 0.5 else 2.0 * x - 2.0
+
+
+# name, function, interpolate between points
+BUILTIN_SHAPES = [
+    ("sine", sine, True),
+    ("triangle", triangle, True),
+    ("square", square, False),
+    ("sawtooth", sawtooth, False),
+]
+
+
+def load_shape(path):
+    with open(path) as source:
+        samples = [float(line.split(",")[0]) for line in source if line.strip() and not line.startswith("#")]
+    if len(samples) < 2:
+        raise SystemExit("%s: at least two samples are needed" % path)
+    peak = max(abs(sample) for sample in samples) or 1.0
+    samples = [sample / peak for sample in samples]
+
+    def shape(x):
+        position = x * len(samples)
+        index = int(position)
+        fraction = position - index
+        return samples[index % len(samples)] * (1.0 - fraction) + samples[(index + 1) % len(samples)] * fraction
+
+    return shape
+
+
+def table(shape):
+    points = []
+    for point in range(TABLE_LENGTH):
+        value = max(-1.0, min(1.0, shape(point / TABLE_LENGTH)))
+        points.append(32768 + int(round(32767.0 * value)))
+    return points + points[:1]
+
+
+def c_name(name):
+    return "WAVE_" + name + "Table"
+
+
+def write_header(path, shapes):
+    lines = [
+        "// Generated by tools/generateWaveTables.py, do not edit",
+        "#ifndef WAVETABLES_H",
+        "#define WAVETABLES_H",
+        "",
+        "/*------------------------------STANDARD LIBRARIES------------------------------*/",
+        "",
+        "#include <stdbool.h>",
+        "#include <stdint.h>",
+        "",
+        "/*------------------------------MACROS------------------------------*/",
+        "",
+        "#define WAVE_TABLE_BITS %dU" % TABLE_BITS,
+        "#define WAVE_TABLE_LENGTH (1U << WAVE_TABLE_BITS)",
+        "#define WAVE_TABLE_ZERO 32768L // Offset binary zero",
+        "",
+        "/*------------------------------TYPES------------------------------*/",
+        "",
+        "typedef struct {",
+        "    const uint16_t *table; // WAVE_TABLE_LENGTH + 1 points, the last one repeats the first",
+        "    bool interpolate; // Linear interpolation between points, off for shapes with jumps",
+        "} WAVE_Shape;",
+        "",
+        "/*------------------------------TABLES------------------------------*/",
+        "",
+    ]
+    for name, _, _ in shapes:
+        lines.append("extern const uint16_t %s[WAVE_TABLE_LENGTH + 1];" % c_name(name))
+    lines.append("")
+    for name, _, _ in shapes:
+        lines.append("extern const WAVE_Shape WAVE_%s;" % name)
+    lines += ["", "#endif", ""]
+    with open(path, "w") as output:
+        output.write("\n".join(lines))
+
+
+def write_source(path, shapes):
+    lines = [
+        "// Generated by tools/generateWaveTables.py, do not edit",
+        "/*------------------------------PROJECT LIBRARIES------------------------------*/",
+        "",
+        '#include "waveTables.h"',
+        "",
+        "/*------------------------------TABLES------------------------------*/",
+        "",
+        "// const data is placed in flash (.const) by the linker command file",
+    ]
+    for name, shape, _ in shapes:
+        points = table(shape)
+        lines.append("const uint16_t %s[WAVE_TABLE_LENGTH + 1] = {" % c_name(name))
+        for first in range(0, len(points), 12):
+            row = ", ".join("%d" % point for point in points[first:first + 12])
+            lines.append("    " + row + ("," if first + 12 < len(points) else ""))
+        lines += ["};", ""]
+    for name, _, interpolate in shapes:
+        lines.append("const WAVE_Shape WAVE_%s = {%s, %s};" % (name, c_name(name), "true" if interpolate else "false"))
+    lines.append("")
+    with open(path, "w") as output:
+        output.write("\n".join(lines))
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--shape", action="append", default=[], metavar="NAME=FILE",
+                        help="user shape, one sample per line")
+    parser.add_argument("--step", action="append", default=[], metavar="NAME",
+                        help="turn interpolation off for a user shape (shapes with jumps)")
+    parser.add_argument("--output", default=os.path.join(root, "src", "common"), help="output directory")
+    arguments = parser.parse_args()
+    shapes = list(BUILTIN_SHAPES)
+    for definition in arguments.shape:
+        name, _, path = definition.partition("=")
+        if not re.match(r"^[a-z][A-Za-z0-9]*$", name) or not path:
+            raise SystemExit("--shape expects camelCaseName=file, got %r" % definition)
+        shapes.append((name, load_shape(path), name not in arguments.step))
+    write_header(os.path.join(arguments.output, "waveTables.h"), shapes)
+    write_source(os.path.join(arguments.output, "waveTables.c"), shapes)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""Checks the output of src/January_2025/kernelBenchmark_main.c against a baseline.
+
+Every kernel line holds its cost (ns and SYSCLK ticks per sample), the C28x
+cycles estimated from its instruction counts and its largest error against a
+double reference, ending in "ok" or "FAIL". The run
+fails on a FAIL line, on a missing kernel or final line, and, with a
+baseline, on any kernel slower than the baseline by more than the threshold
+(and by more than the slack, so sub-nanosecond host timings do not flap).
+
+The input is the host simulation, started here and stopped after the last
+line, or the CIO console of a board run saved to a file. Several runs (--runs,
+or runs one after the other in the file) count with their fastest cost per
+kernel and their largest error:
+
+    python3 tools/kernelBenchmark.py --simulate ./kernelBenchmark --save baseline.json
+    python3 tools/kernelBenchmark.py --simulate ./kernelBenchmark --baseline baseline.json --threshold 20
+    python3 tools/kernelBenchmark.py console.txt --baseline board.json
+
+A baseline only compares with runs on the same machine: host nanoseconds in
+the simulation, C28x cycles on the board. A shared host also changes speed
+between runs; --normalise divides every cost by the median change over all
+kernels first, so only kernels slower against the others fail:
+
+    python3 tools/kernelBenchmark.py --simulate ./kernelBenchmark --baseline baseline.json --normalise --threshold 50
+"""
+
+import argparse
+import json
+import re
+import subprocess
+import sys
+
+LINE = re.compile(r"^(\S+)\s+([\d.]+) ns\s+([\d.]+) ticks \(C28x est\s+([\d.]+)\), "
+                  r"error max (\S+) (.*) \(limit (\S+)\) (ok|FAIL)$")
+DONE = re.compile(r"^kernelBenchmark: (\d+) kernels, (\d+) failed$")
+
+
+def read_simulation(program, seconds):
+    """Benchmark lines of a paced simulation, which is stopped once they are all out."""
+    simulation = subprocess.Popen([program, "-t", str(seconds), "-r", "1"], stdout=subprocess.PIPE,
+                                  universal_newlines=True)
+    lines = []
+    for line in simulation.stdout:
+        lines.append(line.rstrip("\n"))
+        if DONE.match(lines[-1]):
+            break
+    simulation.kill()
+    simulation.wait()
+    return lines
+
+
+def parse(lines):
+    """Kernel results over every run in lines, and the kernel count of each complete run."""
+    results = {}
+    runs = []
+    for line in lines:
+        match = LINE.match(line)
+        if match:
+            name, ns, ticks, estimate, error, units, limit, verdict = match.groups()
+            result = {"ns": float(ns), "ticks": float(ticks), "estimate": float(estimate), "error": float(error),
+                      "units": units, "limit": float(limit), "passed": verdict == "ok"}
+            if name in results:
+                previous = results[name]
+                result["ns"] = min(result["ns"], previous["ns"])
+                result["ticks"] = min(result["ticks"], previous["ticks"])
+                result["error"] = max(result["error"], previous["error"])
+                result["passed"] = result["passed"] and previous["passed"]
+            results[name] = result
+        elif DONE.match(line):
+            runs.append(int(DONE.match(line).group(1)))
+    return results, runs
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", nargs="?", help="saved benchmark output (default: standard input)")
+    parser.add_argument("--simulate", metavar="PROGRAM", help="run this host simulation of the benchmark")
+    parser.add_argument("--runs", type=int, default=3, help="simulation runs, the fastest counts (default 3)")
+    parser.add_argument("--seconds", type=float, default=60.0, help="virtual time limit of the simulation (default 60 s)")
+    parser.add_argument("--baseline", metavar="JSON", help="compare the costs with this baseline")
+    parser.add_argument("--save", metavar="JSON", help="store this run as a baseline")
+    parser.add_argument("--threshold", type=float, default=20.0, help="slowdown failing the run, %% (default 20)")
+    parser.add_argument("--slack", type=float, default=1.0, help="slowdown ignored below this, ns (default 1)")
+    parser.add_argument("--normalise", action="store_true", help="compare costs over the median change of the run")
+    arguments = parser.parse_args()
+
+    if arguments.simulate:
+        lines = []
+        for _ in range(arguments.runs):
+            lines += read_simulation(arguments.simulate, arguments.seconds)
+    else:
+        source = open(arguments.input) if arguments.input else sys.stdin
+        lines = [line.rstrip("\n") for line in source]
+    results, runs = parse(lines)
+    problems = []
+    if not runs or any(count != len(results) for count in runs):
+        problems.append("incomplete run: %d kernels, runs ended with %s" % (len(results), runs or "none"))
+    baseline = {}
+    if arguments.baseline:
+        with open(arguments.baseline) as baseline_file:
+            baseline = json.load(baseline_file)["kernels"]
+        for name in baseline:
+            if name not in results:
+                problems.append("%s: missing" % name)
+    # Machine speed of this run against the baseline's
+    speed = 1.0
+    changes = sorted(results[name]["ns"] / baseline[name]["ns"] for name in results
+                     if name in baseline and baseline[name]["ns"] > 0.0)
+    if arguments.normalise and changes:
+        speed = changes[len(changes) // 2]
+        print("median change %+.1f%%, costs compared over it" % (100.0 * (speed - 1.0)))
+
+    print("%-18s %10s %10s %10s %10s %8s  %s" % ("kernel", "ns/sample", "ticks", "C28x est", "baseline", "change",
+                                                  "error"))
+    for name, result in results.items():
+        change = ""
+        reference = ""
+        if name in baseline:
+            before = baseline[name]["ns"] * speed
+            reference = "%.1f" % before
+            change = "%+.1f%%" % (100.0 * (result["ns"] / before - 1.0)) if before > 0.0 else ""
+            if result["ns"] > before * (1.0 + arguments.threshold / 100.0) and result["ns"] - before > arguments.slack:
+                problems.append("%s: %.1f ns per sample, baseline %.1f ns" % (name, result["ns"], before))
+        elif baseline:
+            change = "new"
+        if not result["passed"]:
+            problems.append("%s: error %g %s over the limit %g" % (name, result["error"], result["units"], result["limit"]))
+        print("%-18s %10.1f %10.2f %10.1f %10s %8s  %g %s (limit %g)" % (
+            name, result["ns"], result["ticks"], result["estimate"], reference, change, result["error"], result["units"],
+            result["limit"]))
+
+    if arguments.save and not problems:
+        with open(arguments.save, "w") as save_file:
+            json.dump({"kernels": results}, save_file, indent=1, sort_keys=True)
+            save_file.write("\n")
+        print("baseline saved to %s" % arguments.save)
+    for problem in problems:
+        print("FAIL %s" % problem)
+    print("%d kernels, %d problems" % (len(results), len(problems)))
+    return 1 if problems else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
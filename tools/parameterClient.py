@@ -0,0 +1,310 @@
+#!/usr/bin/env python3
+"""Reads and changes the run-time settings of src/common/parameters.c over SCI.
+
+Commands use the telemetry framing the other way (0x55 0xAA, type, sequence,
+length, payload, CRC-16/CCITT-FALSE) and each one is answered by a reply
+frame in the telemetry stream: command type, status, command sequence, then
+the command's fields. SET only stages a value (range-checked by the target);
+COMMIT hands every staged value to the ISR at once, at a sample boundary.
+
+    python3 tools/parameterClient.py /dev/ttyACM0 list
+    python3 tools/parameterClient.py /dev/ttyACM0 set frequencyDACA=50 amplitudeDACA=2000
+    python3 tools/parameterClient.py /dev/ttyACM0 get frequencyDACA
+
+With --simulate the client starts a host simulation on a pseudo terminal,
+talks to it and leaves its report on the console. "check" runs the protocol
+against the target: description, range checks, staging, commit, revert and
+malformed commands, then a committed DACA frequency seen back in the
+analytics snapshots:
+
+    python3 tools/parameterClient.py --simulate ./baseADCPWM check
+"""
+
+import argparse
+import os
+import struct
+import subprocess
+import sys
+import time
+
+from telemetryDecoder import Decoder, SYNC, crc16
+
+COMMAND_DESCRIBE = 0x10
+COMMAND_GET = 0x11
+COMMAND_SET = 0x12
+COMMAND_COMMIT = 0x13
+COMMAND_REVERT = 0x14
+
+STATUS_OK = 0
+STATUS_UNKNOWN_COMMAND = 1
+STATUS_BAD_LENGTH = 2
+STATUS_BAD_INDEX = 3
+STATUS_OUT_OF_RANGE = 4
+STATUS_BUSY = 5
+STATUS_NAMES = ["ok", "unknown command", "bad length", "bad index", "out of range", "busy"]
+
+TYPE_UINT16 = 0
+TYPE_FLOAT = 1
+
+
+class Parameter:
+    def __init__(self, index, kind, minimum, maximum, name, units):
+        self.index = index
+        self.kind = kind
+        self.minimum = minimum
+        self.maximum = maximum
+        self.name = name
+        self.units = units
+
+    def encode(self, value):
+        if self.kind == TYPE_FLOAT:
+            return struct.unpack("<I", struct.pack("<f", float(value)))[0]
+        return int(value) & 0xFFFFFFFF
+
+    def decode(self, bits):
+        if self.kind == TYPE_FLOAT:
+            return struct.unpack("<f", struct.pack("<I", bits))[0]
+        return bits
+
+
+class CommandError(Exception):
+    pass
+
+
+class Client:
+    def __init__(self, descriptor, timeout=0.5, attempts=4):
+        self.descriptor = descriptor
+        self.timeout = timeout
+        self.attempts = attempts
+        self.sequence = 0
+        self.replies = {}
+        self.snapshots = []
+        self.decoder = Decoder(lambda *_: None, self.on_snapshot, lambda *_: None, self.on_reply)
+        self.parameters = []
+
+    def on_reply(self, sequence, payload):
+        command, status, command_sequence = struct.unpack_from("<BBH", payload)
+        self.replies[command_sequence] = (command, status, bytes(payload[4:]))
+
+    def on_snapshot(self, sequence, snapshot):
+        self.snapshots.append(snapshot)
+
+    def poll(self, seconds):
+        # Everything the target sends is decoded, the telemetry keeps streaming meanwhile
+        end = time.monotonic() + seconds
+        while True:
+            try:
+                data = os.read(self.descriptor, 4096)
+            except BlockingIOError:
+                data = b""
+            except OSError:
+                raise CommandError("port closed")
+            if data:
+                self.decoder.feed(data)
+            elif time.monotonic() >= end:
+                return
+            else:
+                time.sleep(0.002)
+
+    def send(self, command, payload=b""):
+        body = struct.pack("<BHH", command, self.sequence, len(payload)) + payload
+        os.write(self.descriptor, SYNC + body + struct.pack("<H", crc16(body)))
+
+    def request(self, command, payload=b""):
+        """Reply status and fields; sent again when no reply comes (lost frame, full telemetry queue)."""
+        for _ in range(self.attempts):
+            self.sequence = (self.sequence + 1) & 0xFFFF
+            self.send(command, payload)
+            end = time.monotonic() + self.timeout
+            while time.monotonic() < end:
+                self.poll(0.01)
+                reply = self.replies.pop(self.sequence, None)
+                if reply is not None:
+                    if reply[0] != command:
+                        raise CommandError("reply to command 0x%02X for 0x%02X" % (reply[0], command))
+                    return reply[1], reply[2]
+        raise CommandError("no reply to command 0x%02X" % command)
+
+    def describe(self):
+        self.parameters = []
+        while True:
+            status, fields = self.request(COMMAND_DESCRIBE, bytes([len(self.parameters)]))
+            if status == STATUS_BAD_INDEX:
+                return self.parameters
+            if status != STATUS_OK:
+                raise CommandError("describe: %s" % STATUS_NAMES[status])
+            index, kind, minimum, maximum = struct.unpack_from("<BBff", fields)
+            name, units = fields[10:].split(b"\0")[:2]
+            self.parameters.append(Parameter(index, kind, minimum, maximum, name.decode(), units.decode()))
+
+    def find(self, name):
+        for parameter in self.parameters:
+            if parameter.name == name:
+                return parameter
+        raise CommandError("no parameter %s" % name)
+
+    def get(self, parameter):
+        """Staged and committed values."""
+        status, fields = self.request(COMMAND_GET, bytes([parameter.index]))
+        if status != STATUS_OK:
+            raise CommandError("get %s: %s" % (parameter.name, STATUS_NAMES[status]))
+        staged, committed = struct.unpack_from("<II", fields, 1)
+        return parameter.decode(staged), parameter.decode(committed)
+
+    def set(self, parameter, value):
+        status, _ = self.request(COMMAND_SET, struct.pack("<BI", parameter.index, parameter.encode(value)))
+        return status
+
+    def commit(self):
+        # Busy only until the ISR takes the previous commit, one sample
+        for _ in range(self.attempts):
+            status, _ = self.request(COMMAND_COMMIT)
+            if status != STATUS_BUSY:
+                return status
+            time.sleep(0.01)
+        return STATUS_BUSY
+
+    def revert(self):
+        return self.request(COMMAND_REVERT)[0]
+
+
+def open_port(path, baud):
+    descriptor = os.open(path, os.O_RDWR | os.O_NOCTTY | os.O_NONBLOCK)
+    if os.isatty(descriptor):
+        import termios
+        import tty
+        tty.setraw(descriptor)
+        attributes = termios.tcgetattr(descriptor)
+        speed = getattr(termios, "B%d" % baud)
+        attributes[4] = attributes[5] = speed
+        termios.tcsetattr(descriptor, termios.TCSANOW, attributes)
+    return descriptor
+
+
+def start_simulation(program, seconds):
+    simulation = subprocess.Popen([program, "-u", "pty", "-r", "1", "-t", str(seconds)], stderr=subprocess.PIPE,
+                                  universal_newlines=True)
+    for line in simulation.stderr:
+        if "SCI-A on " in line:
+            return simulation, line.split("SCI-A on ")[1].strip()
+        sys.stderr.write(line)
+    raise CommandError("the simulation did not open a pseudo terminal")
+
+
+def show(parameter, staged, committed):
+    pending = "" if staged == committed else " (staged %g)" % staged
+    print("%-16s %12g %-6s [%g, %g]%s" % (parameter.name, committed, parameter.units, parameter.minimum,
+                                         parameter.maximum, pending))
+
+
+def run_check(client):
+    """Protocol session against the target, one line per check; returns the failures."""
+    failures = []
+
+    def expect(condition, text):
+        print("%s %s" % ("ok  " if condition else "FAIL", text))
+        if not condition:
+            failures.append(text)
+
+    parameters = client.describe()
+    expect(len(parameters) > 0, "%d parameters described" % len(parameters))
+    for parameter in parameters:
+        staged, committed = client.get(parameter)
+        expect(staged == committed and parameter.minimum <= committed <= parameter.maximum,
+               "%s starts committed and in range (%g)" % (parameter.name, committed))
+    frequency = client.find("frequencyDACA")
+    amplitude = client.find("amplitudeDACA")
+    _, start_frequency = client.get(frequency)
+    _, start_amplitude = client.get(amplitude)
+    # Out of range, NaN and above 16 bits: rejected, nothing staged
+    expect(client.set(frequency, frequency.maximum * 2.0) == STATUS_OUT_OF_RANGE, "frequency above range rejected")
+    expect(client.set(frequency, float("nan")) == STATUS_OUT_OF_RANGE, "NaN rejected")
+    expect(client.set(amplitude, 0x10000) == STATUS_OUT_OF_RANGE, "17-bit integer rejected")
+    expect(client.get(frequency)[0] == start_frequency, "rejected set leaves the staged value")
+    # Staged values stay off the ISR until the commit
+    new_frequency = 50.0 if start_frequency != 50.0 else 40.0
+    new_amplitude = 3000 if start_amplitude != 3000 else 2000
+    expect(client.set(frequency, new_frequency) == STATUS_OK, "frequencyDACA %g staged" % new_frequency)
+    expect(client.set(amplitude, new_amplitude) == STATUS_OK, "amplitudeDACA %d staged" % new_amplitude)
+    expect(client.get(frequency) == (new_frequency, start_frequency), "staged value not committed yet")
+    expect(client.revert() == STATUS_OK and client.get(frequency)[0] == start_frequency,
+           "revert drops the staged values")
+    client.set(frequency, new_frequency)
+    client.set(amplitude, new_amplitude)
+    expect(client.commit() == STATUS_OK, "commit accepted")
+    expect(client.get(frequency) == (new_frequency, new_frequency)
+           and client.get(amplitude) == (new_amplitude, new_amplitude), "both values committed together")
+    # Malformed commands
+    expect(client.request(COMMAND_GET, bytes([len(parameters)]))[0] == STATUS_BAD_INDEX, "unknown index refused")
+    expect(client.request(COMMAND_SET, b"\x00\x01")[0] == STATUS_BAD_LENGTH, "short set refused")
+    expect(client.request(0x1F)[0] == STATUS_UNKNOWN_COMMAND, "unknown command refused")
+    # The ISR runs with the new frequency: the analytics measure it on ADCIN14 (DACA loopback in the simulation)
+    client.snapshots = []
+    deadline = time.monotonic() + 3.0
+    measured = None
+    while time.monotonic() < deadline:
+        client.poll(0.05)
+        if len(client.snapshots) >= 3:
+            measured = client.snapshots[-1]["frequency"]
+            break
+    expect(measured is not None and abs(measured - new_frequency) < 0.01 * new_frequency,
+           "analytics measure %s Hz" % ("no" if measured is None else "%.2f" % measured))
+    return failures
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("port", nargs="?", help="serial port or pseudo terminal of the target")
+    parser.add_argument("--simulate", metavar="PROGRAM", help="start this host simulation and use its pseudo terminal")
+    parser.add_argument("--seconds", type=float, default=8.0, help="virtual run time of the simulation (default 8 s)")
+    parser.add_argument("--baud", type=int, default=230400, help="serial port rate (default 230400)")
+    parser.add_argument("command", choices=["list", "get", "set", "revert", "check"])
+    parser.add_argument("arguments", nargs="*", help="names for get, name=value pairs for set")
+    arguments = parser.parse_args()
+
+    simulation = None
+    port = arguments.port
+    if arguments.simulate:
+        simulation, port = start_simulation(arguments.simulate, arguments.seconds)
+    elif port is None:
+        parser.error("a port or --simulate is needed")
+    descriptor = open_port(port, arguments.baud)
+    client = Client(descriptor)
+    result = 0
+    try:
+        client.describe()
+        if arguments.command == "list":
+            for parameter in client.parameters:
+                show(parameter, *client.get(parameter))
+        elif arguments.command == "get":
+            for name in arguments.arguments:
+                parameter = client.find(name)
+                show(parameter, *client.get(parameter))
+        elif arguments.command == "set":
+            # Staged one by one, committed together
+            for pair in arguments.arguments:
+                name, value = pair.split("=", 1)
+                status = client.set(client.find(name), value)
+                if status != STATUS_OK:
+                    raise CommandError("set %s: %s" % (name, STATUS_NAMES[status]))
+            status = client.commit()
+            if status != STATUS_OK:
+                raise CommandError("commit: %s" % STATUS_NAMES[status])
+        elif arguments.command == "revert":
+            client.revert()
+        else:
+            failures = run_check(client)
+            print("%d checks failed" % len(failures))
+            result = 1 if failures else 0
+    except CommandError as error:
+        print("error: %s" % error, file=sys.stderr)
+        result = 1
+    os.close(descriptor)
+    if simulation:
+        # Its report follows once the virtual run time is over
+        simulation.wait()
+    return result
+
+
+if __name__ == "__main__":
+    sys.exit(main())
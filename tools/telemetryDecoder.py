@@ -0,0 +1,259 @@
+#!/usr/bin/env python3
+"""Decodes the SCI telemetry stream of src/common/telemetry.c.
+
+Frame: 0x55 0xAA, type, sequence (u16), payload length (u16), payload,
+CRC-16/CCITT-FALSE of type to payload; all little endian. Capture payloads
+hold a channel, a sample count, the first sample and groups of 16
+zigzag-coded deltas, each group a 4-bit width then the deltas in that width,
+packed LSB first. Snapshot payloads hold the powerQuality analytics as floats.
+Scope payloads hold a channel, flags (min/max pairs, forced), the decimation
+and the trigger point, then the frame's points coded as a capture from its
+sample count on. Reply payloads answer the host's commands (see
+tools/parameterClient.py) and are skipped here.
+
+The input is a file written by the host simulation (-u sci.bin), its pseudo
+terminal (-u pty) or the LaunchPad's serial port:
+
+    python3 tools/telemetryDecoder.py sci.bin --samples adca.csv --scope scope.csv
+    python3 tools/telemetryDecoder.py /dev/ttyACM0 --baud 230400 --seconds 10
+"""
+
+import argparse
+import os
+import struct
+import sys
+import time
+
+SYNC = b"\x55\xaa"
+HEADER_LENGTH = 7
+MAX_PAYLOAD = 512
+FRAME_CAPTURE = 0x01
+FRAME_SNAPSHOT = 0x02
+FRAME_SCOPE = 0x03
+FRAME_REPLY = 0x04
+GROUP_LENGTH = 16
+
+
+def crc16(data, crc=0xFFFF):
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+
+class BitReader:
+    def __init__(self, data):
+        self.data = data
+        self.position = 0
+        self.bits = 0
+        self.count = 0
+
+    def read(self, width):
+        while self.count < width:
+            if self.position >= len(self.data):
+                raise ValueError("capture bit stream too short")
+            self.bits |= self.data[self.position] << self.count
+            self.position += 1
+            self.count += 8
+        value = self.bits & ((1 << width) - 1)
+        self.bits >>= width
+        self.count -= width
+        return value
+
+
+def decode_samples(payload, offset):
+    count, first = struct.unpack_from("<HH", payload, offset)
+    samples = [first]
+    reader = BitReader(payload[offset + 4:])
+    while len(samples) < count:
+        width = reader.read(4)
+        for _ in range(min(GROUP_LENGTH, count - len(samples))):
+            code = reader.read(width) if width else 0
+            delta = (code >> 1) ^ -(code & 1)
+            samples.append((samples[-1] + delta) & 0x0FFF)
+    return samples
+
+
+def decode_capture(payload):
+    return payload[0], decode_samples(payload, 1)
+
+
+def decode_scope(payload):
+    channel, flags, decimation, trigger = struct.unpack_from("<BBHH", payload)
+    values = decode_samples(payload, 6)
+    min_max = bool(flags & 0x01)
+    points = list(zip(values[0::2], values[1::2])) if min_max else [(value, value) for value in values]
+    return {"channel": channel, "minMax": min_max, "forced": bool(flags & 0x02), "decimation": decimation,
+            "trigger": trigger, "points": points}
+
+
+def decode_snapshot(payload):
+    window, mean, rms, ac_rms, frequency, thd, harmonics = struct.unpack_from("<I5fB", payload)
+    values = struct.unpack_from("<%df" % harmonics, payload, 25)
+    return {"window": window, "mean": mean, "rms": rms, "acRms": ac_rms, "frequency": frequency, "thd": thd,
+            "harmonics": list(values)}
+
+
+class Decoder:
+    def __init__(self, on_capture, on_snapshot, on_scope, on_reply=None):
+        self.on_capture = on_capture
+        self.on_snapshot = on_snapshot
+        self.on_scope = on_scope
+        self.on_reply = on_reply
+        self.buffer = bytearray()
+        self.expected = None
+        self.frames = 0
+        self.crc_errors = 0
+        self.skipped = 0  # Bytes discarded while resynchronising
+        self.lost = 0  # Frames missing from the sequence
+        self.samples = 0
+        self.scope_frames = 0
+        self.capture_bytes = 0
+        self.total_bytes = 0
+
+    def feed(self, data):
+        self.total_bytes += len(data)
+        self.buffer += data
+        while True:
+            start = self.buffer.find(SYNC)
+            if start < 0:
+                # Keep a last 0x55, it may be the first half of the next sync
+                keep = 1 if self.buffer[-1:] == SYNC[:1] else 0
+                self.skipped += len(self.buffer) - keep
+                del self.buffer[:len(self.buffer) - keep]
+                return
+            if start:
+                self.skipped += start
+                del self.buffer[:start]
+            if len(self.buffer) < HEADER_LENGTH:
+                return
+            frame_type, sequence, length = struct.unpack_from("<BHH", self.buffer, 2)
+            if length > MAX_PAYLOAD:
+                self.resync()
+                continue
+            end = HEADER_LENGTH + length + 2
+            if len(self.buffer) < end:
+                return
+            body = bytes(self.buffer[2:HEADER_LENGTH + length])
+            crc, = struct.unpack_from("<H", self.buffer, HEADER_LENGTH + length)
+            if crc16(body) != crc:
+                self.crc_errors += 1
+                self.resync()
+                continue
+            del self.buffer[:end]
+            self.accept(frame_type, sequence, body[5:], end)
+
+    def resync(self):
+        # False sync or corrupted frame: search again one byte further
+        self.skipped += 1
+        del self.buffer[:1]
+
+    def accept(self, frame_type, sequence, payload, length):
+        if self.expected is not None:
+            self.lost += (sequence - self.expected) & 0xFFFF
+        self.expected = (sequence + 1) & 0xFFFF
+        self.frames += 1
+        if frame_type == FRAME_CAPTURE:
+            channel, samples = decode_capture(payload)
+            self.samples += len(samples)
+            self.capture_bytes += length
+            self.on_capture(sequence, channel, samples)
+        elif frame_type == FRAME_SNAPSHOT:
+            self.on_snapshot(sequence, decode_snapshot(payload))
+        elif frame_type == FRAME_SCOPE:
+            self.scope_frames += 1
+            self.on_scope(sequence, decode_scope(payload))
+        elif frame_type == FRAME_REPLY and self.on_reply:
+            self.on_reply(sequence, payload)
+
+
+def open_input(path, baud):
+    descriptor = os.open(path, os.O_RDONLY | os.O_NOCTTY)
+    if os.isatty(descriptor):
+        import termios
+        import tty
+        tty.setraw(descriptor)
+        attributes = termios.tcgetattr(descriptor)
+        speed = getattr(termios, "B%d" % baud)
+        attributes[4] = attributes[5] = speed
+        termios.tcsetattr(descriptor, termios.TCSANOW, attributes)
+        return descriptor, True
+    return descriptor, False
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="file, pseudo terminal or serial port")
+    parser.add_argument("--baud", type=int, default=230400, help="serial port rate (default 230400)")
+    parser.add_argument("--seconds", type=float, default=0.0, help="stop a live stream after this time")
+    parser.add_argument("--samples", metavar="CSV", help="write sequence,channel,sample per decoded sample")
+    parser.add_argument("--snapshots", metavar="CSV", help="write the analytics snapshots")
+    parser.add_argument("--scope", metavar="CSV", help="write sequence,point,minimum,maximum,trigger per scope point")
+    arguments = parser.parse_args()
+
+    samples_file = open(arguments.samples, "w") if arguments.samples else None
+    snapshots_file = open(arguments.snapshots, "w") if arguments.snapshots else None
+    scope_file = open(arguments.scope, "w") if arguments.scope else None
+    if samples_file:
+        samples_file.write("sequence,channel,sample\n")
+    if scope_file:
+        scope_file.write("sequence,point,minimum,maximum,trigger\n")
+
+    def on_capture(sequence, channel, samples):
+        if samples_file:
+            samples_file.writelines("%d,%d,%d\n" % (sequence, channel, value) for value in samples)
+
+    def on_snapshot(sequence, snapshot):
+        if snapshots_file:
+            if snapshots_file.tell() == 0:
+                harmonics = ",".join("h%d" % (index + 1) for index in range(len(snapshot["harmonics"])))
+                snapshots_file.write("sequence,window,mean,rms,acRms,frequency,thd,%s\n" % harmonics)
+            snapshots_file.write("%d,%d,%.3f,%.3f,%.3f,%.4f,%.5f,%s\n" % (
+                sequence, snapshot["window"], snapshot["mean"], snapshot["rms"], snapshot["acRms"],
+                snapshot["frequency"], snapshot["thd"], ",".join("%.3f" % value for value in snapshot["harmonics"])))
+
+    def on_scope(sequence, frame):
+        if scope_file:
+            # Points relative to the trigger point, in input samples
+            scope_file.writelines("%d,%d,%d,%d,%d\n" % (
+                sequence, (index - frame["trigger"]) * frame["decimation"], low, high, index == frame["trigger"])
+                for index, (low, high) in enumerate(frame["points"]))
+
+    decoder = Decoder(on_capture, on_snapshot, on_scope)
+    descriptor, live = open_input(arguments.input, arguments.baud)
+    start = time.monotonic()
+    try:
+        while not live or arguments.seconds <= 0.0 or time.monotonic() - start < arguments.seconds:
+            try:
+                data = os.read(descriptor, 4096)
+            except OSError:
+                # Pseudo terminal closed by the simulation
+                break
+            if not data:
+                break
+            decoder.feed(data)
+    except KeyboardInterrupt:
+        pass
+    elapsed = time.monotonic() - start
+    os.close(descriptor)
+
+    print("frames %d lost %d CRC errors %d bytes skipped %d" % (decoder.frames, decoder.lost, decoder.crc_errors,
+                                                                decoder.skipped))
+    if decoder.scope_frames:
+        print("scope frames %d" % decoder.scope_frames)
+    if decoder.samples:
+        print("samples %d capture bytes %d ratio %.2f (%.2f bits/sample, raw 16-bit words)" % (
+            decoder.samples, decoder.capture_bytes, 2.0 * decoder.samples / decoder.capture_bytes,
+            8.0 * decoder.capture_bytes / decoder.samples))
+    if live and elapsed > 0.0:
+        print("%.0f samples/s %.0f B/s over %.1f s" % (decoder.samples / elapsed, decoder.total_bytes / elapsed,
+                                                       elapsed))
+    for stream in (samples_file, snapshots_file, scope_file):
+        if stream:
+            stream.close()
+    return 0 if decoder.crc_errors == 0 else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())